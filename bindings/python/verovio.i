@@ -27,6 +27,13 @@
     from typing import Optional, Union
 %}
 
+// Toolkit::BuildFeatureIndex
+%feature("shadow") vrv::Toolkit::BuildFeatureIndex(const std::string &) %{
+def buildFeatureIndex(toolkit, options: dict) -> bool:
+    """Build an index of the melodic n-grams of a set of files."""
+    return $action(toolkit, json.dumps(options))
+%}
+
 // Toolkit::Edit
 %feature("shadow") vrv::Toolkit::Edit( const std::string & ) %{
 def edit(toolkit, editor_action: dict) -> bool:
@@ -41,6 +48,13 @@ def editInfo(toolkit) -> dict:
     return json.loads($action(toolkit))
 %}
 
+// Toolkit::GetABCCollectionIndex
+%feature("shadow") vrv::Toolkit::GetABCCollectionIndex() const %{
+def getABCCollectionIndex(toolkit) -> dict:
+    """Return the index of the ABC collection previously loaded."""
+    return json.loads($action(toolkit))
+%}
+
 // Toolkit::GetAvailableOptions
 %feature("shadow") vrv::Toolkit::GetAvailableOptions() const %{
 def getAvailableOptions(toolkit) -> dict:
@@ -94,6 +108,15 @@ def getMEI(toolkit, options: Optional[dict] = None) -> str:
     return $action(toolkit, json.dumps(options))
 %}
 
+// Toolkit::GetMEIBuffer
+%feature("shadow") vrv::Toolkit::GetMEIBuffer(const std::string & = "") %{
+def getMEIBuffer(toolkit, options: Optional[dict] = None) -> bytes:
+    """Get the MEI as UTF-8 encoded bytes."""
+    if options is None:
+        options = {}
+    return $action(toolkit, json.dumps(options))
+%}
+
 // Toolkit::GetMIDIValuesForElement
 %feature("shadow") vrv::Toolkit::GetMIDIValuesForElement(const std::string &) %{
 def getMIDIValuesForElement(toolkit, xml_id: str) -> dict:
@@ -115,6 +138,24 @@ def getTimesForElement(toolkit, xml_id: str) -> dict:
     return json.loads($action(toolkit, xml_id))
 %}
 
+// Toolkit::LoadABCCollection
+%feature("shadow") vrv::Toolkit::LoadABCCollection(const std::string &, const std::string & = "") %{
+def loadABCCollection(toolkit, data: str, index: Optional[Union[str, dict]] = None) -> bool:
+    """Load an ABC file with several tunes and index them without importing them."""
+    if index is None:
+        index = ""
+    elif isinstance(index, dict):
+        index = json.dumps(index)
+    return $action(toolkit, data, index)
+%}
+
+// Toolkit::QueryFeatureIndex
+%feature("shadow") vrv::Toolkit::QueryFeatureIndex(const std::string &) %{
+def queryFeatureIndex(toolkit, query: dict) -> dict:
+    """Search a melodic pattern in the feature index."""
+    return json.loads($action(toolkit, json.dumps(query)))
+%}
+
 // Toolkit::RedoLayout
 %feature("shadow") vrv::Toolkit::RedoLayout(const std::string & = "") %{
 def redoLayout(toolkit, options: Optional[dict] = None) -> None:
@@ -195,8 +236,40 @@ def validatePAE(toolkit, data: Union[str, dict]) -> dict:
     return json.loads($action(toolkit, data))
 %}
 
-%module(package="verovio") verovio
+// Release the GIL during the calls so that toolkits can be used in parallel from Python threads
+// A toolkit instance must not be used by more than one thread at a time
+// The state shared by the toolkits (the log level and the logging to buffer flag) is atomic
+%module(package="verovio", threads="1") verovio
+%include "pybuffer.i"
 %include "std_string.i"
+
+// Data buffers passed from any object supporting the buffer protocol (e.g., bytes, bytearray or memoryview)
+%pybuffer_binary(const char *data, int length);
+%pybuffer_binary(const unsigned char *data, int length);
+
+// Outputs returned as bytes without being decoded, the GIL being released while they are produced
+%feature("nothreadallow") vrv::Toolkit::GetMEIBuffer;
+%feature("nothreadallow") vrv::Toolkit::RenderToSVGBuffer;
+%extend vrv::Toolkit {
+    PyObject *GetMEIBuffer(const std::string &jsonOptions = "")
+    {
+        std::string output;
+        Py_BEGIN_ALLOW_THREADS
+        output = $self->GetMEI(jsonOptions);
+        Py_END_ALLOW_THREADS
+        return PyBytes_FromStringAndSize(output.data(), (Py_ssize_t)output.size());
+    }
+
+    PyObject *RenderToSVGBuffer(int pageNo = 1, bool xmlDeclaration = false)
+    {
+        std::string output;
+        Py_BEGIN_ALLOW_THREADS
+        output = $self->RenderToSVG(pageNo, xmlDeclaration);
+        Py_END_ALLOW_THREADS
+        return PyBytes_FromStringAndSize(output.data(), (Py_ssize_t)output.size());
+    }
+}
+
 %include "../../include/vrv/toolkit.h"
 %include "../../include/vrv/toolkitdef.h"
 
@@ -0,0 +1,73 @@
+# This script it expected to be run from ./bindings/python
+# It compares the time and the memory for producing MIDI, timemaps and features with and without the layout
+import argparse
+import os
+import resource
+import subprocess
+import sys
+import time
+
+# Add path for toolkit built in-place
+sys.path.append('.')
+import verovio
+
+modes = {
+    'layout': {'breaks': 'auto'},
+    'no-breaks': {'breaks': 'none'},
+    'data-only': {'dataOnly': True}
+}
+
+
+def read_files(path):
+    files = []
+    # A directory with one file per score
+    if os.path.isdir(path):
+        for item in sorted(os.listdir(path)):
+            if os.path.isfile(os.path.join(path, item)):
+                files.append(os.path.join(path, item))
+    else:
+        files.append(path)
+    return files
+
+
+def run(mode, files, repeat):
+    tk = verovio.toolkit(False)
+    tk.setResourcePath('../../data')
+    verovio.enableLog(verovio.LOG_OFF)
+    tk.setOptions(modes[mode])
+    start = time.perf_counter()
+    for i in range(repeat):
+        for file in files:
+            tk.loadFile(file)
+            tk.renderToMIDI()
+            tk.renderToTimemap()
+            tk.getDescriptiveFeatures()
+    elapsed = time.perf_counter() - start
+    # maximum resident set size (in kilobytes on Linux)
+    memory = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    print(f'{elapsed} {memory}')
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('input', help='a directory with scores or a single score')
+    parser.add_argument('--repeat', type=int, default=1)
+    parser.add_argument('--mode', choices=modes.keys(), help=argparse.SUPPRESS)
+    args = parser.parse_args()
+
+    files = read_files(args.input)
+    if len(files) == 0:
+        print('No file found in {}'.format(args.input))
+        sys.exit(1)
+
+    # Run a single mode (in a separate process for measuring the memory)
+    if args.mode:
+        run(args.mode, files, args.repeat)
+        sys.exit(0)
+
+    print(f'Verovio {verovio.toolkit(False).getVersion()}')
+    for mode in modes:
+        output = subprocess.check_output(
+            [sys.executable, __file__, args.input, '--repeat', str(args.repeat), '--mode', mode])
+        elapsed, memory = output.decode().split()
+        print('{} files - {}: {:.3f} s, {:.1f} MB'.format(len(files), mode, float(elapsed), int(memory) / 1024))
@@ -0,0 +1,91 @@
+# This script it expected to be run from ./bindings/python
+# It measures the throughput for building a feature index of a corpus and the latency of the queries,
+# and checks that the queries taken from the documents find them
+import argparse
+import json
+import os
+import random
+import sys
+import tempfile
+import time
+
+# Add path for toolkit built in-place
+sys.path.append('.')
+import verovio
+
+
+def read_files(path):
+    files = []
+    # A directory with one file per score
+    if os.path.isdir(path):
+        for item in sorted(os.listdir(path)):
+            if os.path.isfile(os.path.join(path, item)):
+                files.append(os.path.join(path, item))
+    else:
+        files.append(path)
+    return files
+
+
+def sample_queries(files, count, length):
+    tk = verovio.toolkit(False)
+    tk.setResourcePath('../../data')
+    tk.setOptions({'dataOnly': True})
+    queries = []
+    random.seed(1)
+    for file in random.sample(files, min(count, len(files))):
+        if not tk.loadFile(file):
+            continue
+        intervals = json.loads(tk.getDescriptiveFeatures({}))['intervalsChromatic']
+        if len(intervals) < length:
+            continue
+        start = random.randint(0, len(intervals) - length)
+        queries.append((file, [int(interval) for interval in intervals[start:start + length]]))
+    return queries
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('input', help='a directory with scores or a single score')
+    parser.add_argument('--ngram-length', type=int, default=4)
+    parser.add_argument('--queries', type=int, default=100)
+    parser.add_argument('--query-length', type=int, default=5)
+    args = parser.parse_args()
+
+    files = read_files(args.input)
+    if len(files) == 0:
+        print('No file found in {}'.format(args.input))
+        sys.exit(1)
+
+    verovio.enableLog(verovio.LOG_OFF)
+    print(f'Verovio {verovio.toolkit(False).getVersion()}')
+
+    index = os.path.join(tempfile.mkdtemp(), 'index.vrvfeat')
+    tk = verovio.toolkit(False)
+    tk.setResourcePath('../../data')
+    start = time.perf_counter()
+    built = tk.buildFeatureIndex({'files': files, 'output': index, 'ngramLength': args.ngram_length, 'threads': 0})
+    build_time = time.perf_counter() - start
+    if not built:
+        print('The index could not be built')
+        sys.exit(1)
+    print('{} files - build {:.3f} s ({:.1f} files/s), {:.1f} MB'.format(
+        len(files), build_time, len(files) / build_time, os.path.getsize(index) / 1024 / 1024))
+
+    start = time.perf_counter()
+    tk.loadFeatureIndex(index)
+    print('load {:.3f} s'.format(time.perf_counter() - start))
+
+    errors = 0
+    query_time = 0
+    queries = sample_queries(files, args.queries, args.query_length)
+    for file, intervals in queries:
+        start = time.perf_counter()
+        result = tk.queryFeatureIndex({'intervalsChromatic': intervals, 'limit': 0})
+        query_time += time.perf_counter() - start
+        if file not in [match['document'] for match in result['matches']]:
+            print('{} - {}: the document is not found'.format(file, intervals))
+            errors += 1
+    if queries:
+        print('{} queries - {:.3f} ms per query'.format(len(queries), query_time * 1000 / len(queries)))
+
+    sys.exit(1 if errors else 0)
@@ -0,0 +1,146 @@
+# This script it expected to be run from ./bindings/python
+# It compares the direct Humdrum to MIDI conversion with loading the data and rendering it to MIDI
+import argparse
+import base64
+import collections
+import os
+import struct
+import sys
+import time
+
+# Add path for toolkit built in-place
+sys.path.append('.')
+import verovio
+
+
+def read_files(path):
+    files = []
+    # A directory with .krn files
+    if os.path.isdir(path):
+        for item in sorted(os.listdir(path)):
+            if not(item.endswith('.krn')):
+                continue
+            with open(os.path.join(path, item)) as f:
+                files.append((item, f.read()))
+    else:
+        with open(path) as f:
+            files.append((os.path.basename(path), f.read()))
+    return files
+
+
+def midi_events(data):
+    # Return the sorted list of (track, tick, event) of a base64 MIDI file, with the end of track events left out
+    midi = base64.b64decode(data)
+    events = []
+    pos = 14
+    track = 0
+    while pos + 8 <= len(midi):
+        length = struct.unpack('>I', midi[pos + 4:pos + 8])[0]
+        end = pos + 8 + length
+        pos += 8
+        tick = 0
+        status = 0
+        while pos < end:
+            delta = 0
+            while True:
+                byte = midi[pos]
+                pos += 1
+                delta = (delta << 7) | (byte & 0x7F)
+                if byte < 0x80:
+                    break
+            tick += delta
+            if midi[pos] >= 0x80:
+                status = midi[pos]
+                pos += 1
+            if status == 0xFF:
+                meta = midi[pos]
+                pos += 1
+                size = 0
+                while True:
+                    byte = midi[pos]
+                    pos += 1
+                    size = (size << 7) | (byte & 0x7F)
+                    if byte < 0x80:
+                        break
+                if meta != 0x2F:
+                    events.append((track, tick, 'meta {:02x}'.format(meta), midi[pos:pos + size].hex()))
+                pos += size
+            elif status in (0xF0, 0xF7):
+                size = midi[pos]
+                pos += 1 + size
+            elif (status & 0xF0) in (0xC0, 0xD0):
+                events.append((track, tick, '{:02x}'.format(status), midi[pos]))
+                pos += 1
+            else:
+                # A note on with a velocity of 0 is a note off
+                if (status & 0xF0) == 0x90 and midi[pos + 1] == 0:
+                    events.append((track, tick, '{:02x}'.format(0x80 | (status & 0x0F)), midi[pos]))
+                elif (status & 0xF0) == 0x80:
+                    events.append((track, tick, '{:02x}'.format(status), midi[pos]))
+                else:
+                    events.append((track, tick, '{:02x}'.format(status), midi[pos], midi[pos + 1]))
+                pos += 2
+        pos = end
+        track += 1
+    return sorted(events)
+
+
+def event_name(event):
+    names = {'meta 03': 'track name', 'meta 51': 'tempo', 'meta 58': 'time signature', 'meta 59': 'key signature'}
+    if event[2] in names:
+        return names[event[2]]
+    if event[2].startswith('meta'):
+        return event[2]
+    return {0x80: 'note off', 0x90: 'note on', 0xC0: 'program change'}.get(int(event[2], 16) & 0xF0, event[2])
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('input', help='a directory with .krn files or a single .krn file')
+    parser.add_argument('--repeat', type=int, default=1)
+    args = parser.parse_args()
+
+    files = read_files(args.input)
+    if len(files) == 0:
+        print('No Humdrum file found in {}'.format(args.input))
+        sys.exit(1)
+
+    tk = verovio.toolkit(False)
+    print(f'Verovio {tk.getVersion()}')
+    tk.setResourcePath('../../data')
+    tk.setInputFrom('humdrum')
+    verovio.enableLog(verovio.LOG_OFF)
+
+    docMIDI = {}
+    start = time.perf_counter()
+    for i in range(args.repeat):
+        for name, data in files:
+            tk.loadData(data)
+            docMIDI[name] = tk.renderToMIDI()
+    docTime = time.perf_counter() - start
+
+    directMIDI = {}
+    start = time.perf_counter()
+    for i in range(args.repeat):
+        for name, data in files:
+            directMIDI[name] = tk.convertHumdrumToMIDI(data)
+    directTime = time.perf_counter() - start
+
+    count = len(files) * args.repeat
+    print('{} files - loading and rendering: {:.1f} files/s'.format(len(files), count / docTime))
+    print('{} files - direct conversion: {:.1f} files/s'.format(len(files), count / directTime))
+
+    identical = 0
+    for name, data in files:
+        docEvents = midi_events(docMIDI[name])
+        directEvents = midi_events(directMIDI[name])
+        if docEvents == directEvents:
+            identical += 1
+            continue
+        # List the kind of events that are missing or added in the direct conversion
+        missing = list((collections.Counter(docEvents) - collections.Counter(directEvents)).elements())
+        added = list((collections.Counter(directEvents) - collections.Counter(docEvents)).elements())
+        kinds = sorted(set(event_name(event) for event in missing + added))
+        print('Different MIDI output in {} ({} missing and {} added events: {})'.format(
+            name, len(missing), len(added), ', '.join(kinds)))
+    print('{} of {} files with identical MIDI output'.format(identical, len(files)))
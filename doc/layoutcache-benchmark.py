@@ -0,0 +1,75 @@
+# This script it expected to be run from ./bindings/python
+# It compares the time for loading files with the horizontal layout restored from the layout cache directory
+# with the time for loading them with a full layout, and checks that the SVG of all the pages is the same
+import argparse
+import os
+import re
+import sys
+import tempfile
+import time
+
+# Add path for toolkit built in-place
+sys.path.append('.')
+import verovio
+
+
+def read_files(path):
+    files = []
+    # A directory with one file per score
+    if os.path.isdir(path):
+        for item in sorted(os.listdir(path)):
+            if os.path.isfile(os.path.join(path, item)):
+                files.append(os.path.join(path, item))
+    else:
+        files.append(path)
+    return files
+
+
+def render(tk):
+    svg = ''
+    for page in range(1, tk.getPageCount() + 1):
+        svg += tk.renderToSVG(page)
+    # The IDs generated during the layout and the order of the glyph definitions can be different
+    svg = re.sub(r'<defs>.*?</defs>', '', svg, flags=re.DOTALL)
+    return re.sub(r'(id|href|data-[a-z]*)="[^"]*"', '', svg)
+
+
+def load(file, cache_dir):
+    tk = verovio.toolkit(False)
+    tk.setResourcePath('../../data')
+    tk.setOptions({'xmlIdSeed': 1, 'layoutCacheDir': cache_dir})
+    start = time.perf_counter()
+    tk.loadFile(file)
+    elapsed = time.perf_counter() - start
+    return elapsed, render(tk)
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('input', help='a directory with scores or a single score')
+    args = parser.parse_args()
+
+    files = read_files(args.input)
+    if len(files) == 0:
+        print('No file found in {}'.format(args.input))
+        sys.exit(1)
+
+    verovio.enableLog(verovio.LOG_OFF)
+    print(f'Verovio {verovio.toolkit(False).getVersion()}')
+
+    errors = 0
+    cold_time = 0
+    cached_time = 0
+    with tempfile.TemporaryDirectory() as cache_dir:
+        for file in files:
+            # The first load does the layout and writes the cache file, the second one restores it
+            elapsed, cold_svg = load(file, cache_dir)
+            cold_time += elapsed
+            elapsed, cached_svg = load(file, cache_dir)
+            cached_time += elapsed
+            if cold_svg != cached_svg:
+                print('{}: the layout restored from the cache is not the same as a full layout'.format(file))
+                errors += 1
+    print('{} files: {:.3f} s with the cache (full layout {:.3f} s)'.format(len(files), cached_time, cold_time))
+
+    sys.exit(1 if errors else 0)
@@ -0,0 +1,79 @@
+# This script it expected to be run from ./bindings/python
+# It measures the number of incipits rendered per second on a single core
+import argparse
+import os
+import sys
+import time
+
+# Add path for toolkit built in-place
+sys.path.append('.')
+import verovio
+
+benchmarkOptions = {
+    'adjustPageHeight': True,
+    'footer': 'none',
+    'header': 'none',
+    'pageWidth': 2100,
+    'scale': 40
+}
+
+
+def read_incipits(path):
+    incipits = []
+    # A directory with one incipit per .pae file
+    if os.path.isdir(path):
+        for item in sorted(os.listdir(path)):
+            if not(item.endswith('.pae')):
+                continue
+            with open(os.path.join(path, item)) as f:
+                incipits.append(f.read())
+    # A file with one incipit per line (single line PAE or JSON)
+    else:
+        with open(path) as f:
+            for line in f:
+                line = line.strip('\n')
+                if len(line) > 0:
+                    incipits.append(line)
+    return incipits
+
+
+def run(tk, incipits, repeat, validate):
+    start = time.perf_counter()
+    for i in range(repeat):
+        for incipit in incipits:
+            if validate:
+                tk.validatePAE(incipit)
+            else:
+                tk.loadData(incipit)
+                tk.renderToSVG(1)
+    elapsed = time.perf_counter() - start
+    return (len(incipits) * repeat) / elapsed
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('input', help='a directory with .pae files or a file with one incipit per line')
+    parser.add_argument('--repeat', type=int, default=1)
+    args = parser.parse_args()
+
+    incipits = read_incipits(args.input)
+    if len(incipits) == 0:
+        print('No incipit found in {}'.format(args.input))
+        sys.exit(1)
+
+    tk = verovio.toolkit(False)
+    print(f'Verovio {tk.getVersion()}')
+    tk.setResourcePath('../../data')
+    tk.setInputFrom('pae')
+    verovio.enableLog(verovio.LOG_OFF)
+
+    tk.setOptions(benchmarkOptions)
+    default = run(tk, incipits, args.repeat, False)
+    print('{} incipits - default mode: {:.1f} incipits/s'.format(len(incipits), default))
+
+    tk.setOptions({'incipitMode': True})
+    incipitMode = run(tk, incipits, args.repeat, False)
+    print('{} incipits - incipit mode: {:.1f} incipits/s'.format(len(incipits), incipitMode))
+
+    validation = run(tk, incipits, args.repeat, True)
+    print('{} incipits - validation: {:.1f} incipits/s'.format(len(incipits), validation))
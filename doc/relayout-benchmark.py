@@ -0,0 +1,90 @@
+# This script it expected to be run from ./bindings/python
+# It compares the time for redoing the layout after changing an option with the time of a full layout
+# and checks that the SVG of all the pages is the same
+import argparse
+import json
+import os
+import re
+import sys
+import time
+
+# Add path for toolkit built in-place
+sys.path.append('.')
+import verovio
+
+# One option change for each stage redone
+changes = [
+    {'svgViewBox': True},
+    {'spacingStaff': 16},
+    {'justificationSystem': 2},
+    {'pageWidth': 1800},
+    {'pageHeight': 1500},
+    {'breaks': 'smart'},
+    {'spacingLinear': 0.3},
+]
+
+
+def read_files(path):
+    files = []
+    # A directory with one file per score
+    if os.path.isdir(path):
+        for item in sorted(os.listdir(path)):
+            if os.path.isfile(os.path.join(path, item)):
+                files.append(os.path.join(path, item))
+    else:
+        files.append(path)
+    return files
+
+
+def render(tk):
+    svg = ''
+    for page in range(1, tk.getPageCount() + 1):
+        svg += tk.renderToSVG(page)
+    # The IDs generated during the layout and the order of the glyph definitions can be different
+    svg = re.sub(r'<defs>.*?</defs>', '', svg, flags=re.DOTALL)
+    return re.sub(r'(id|href|data-[a-z]*)="[^"]*"', '', svg)
+
+
+def relayout(file, change, full):
+    tk = verovio.toolkit(False)
+    tk.setResourcePath('../../data')
+    tk.setOptions({'xmlIdSeed': 1})
+    tk.loadFile(file)
+    tk.redoLayout()
+    tk.setOptions(change)
+    start = time.perf_counter()
+    # Setting resetCache explicitly always redoes the full layout
+    tk.redoLayout({'resetCache': True} if full else {})
+    elapsed = time.perf_counter() - start
+    return elapsed, render(tk)
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('input', help='a directory with scores or a single score')
+    args = parser.parse_args()
+
+    files = read_files(args.input)
+    if len(files) == 0:
+        print('No file found in {}'.format(args.input))
+        sys.exit(1)
+
+    verovio.enableLog(verovio.LOG_OFF)
+    print(f'Verovio {verovio.toolkit(False).getVersion()}')
+
+    errors = 0
+    for change in changes:
+        staged_time = 0
+        full_time = 0
+        for file in files:
+            elapsed, staged_svg = relayout(file, change, False)
+            staged_time += elapsed
+            elapsed, full_svg = relayout(file, change, True)
+            full_time += elapsed
+            if staged_svg != full_svg:
+                print('{} - {}: the layout is not the same as a full layout'.format(file, json.dumps(change)))
+                errors += 1
+        print('{} files - {}: {:.3f} s (full layout {:.3f} s)'.format(
+            len(files), json.dumps(change), staged_time, full_time))
+
+    sys.exit(1 if errors else 0)
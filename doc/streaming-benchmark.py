@@ -0,0 +1,72 @@
+# This script it expected to be run from ./bindings/python
+# It compares the time and the peak memory for loading MEI files with and without the streaming import
+import argparse
+import os
+import resource
+import subprocess
+import sys
+import time
+
+# Add path for toolkit built in-place
+sys.path.append('.')
+import verovio
+
+modes = {
+    'default': {'streamingImport': False},
+    'streaming': {'streamingImport': True}
+}
+
+
+def read_files(path):
+    files = []
+    # A directory with one file per score
+    if os.path.isdir(path):
+        for item in sorted(os.listdir(path)):
+            if os.path.isfile(os.path.join(path, item)):
+                files.append(os.path.join(path, item))
+    else:
+        files.append(path)
+    return files
+
+
+def run(mode, files, repeat):
+    tk = verovio.toolkit(False)
+    tk.setResourcePath('../../data')
+    verovio.enableLog(verovio.LOG_OFF)
+    # Load the data only for measuring the import
+    options = {'dataOnly': True}
+    options.update(modes[mode])
+    tk.setOptions(options)
+    start = time.perf_counter()
+    for i in range(repeat):
+        for file in files:
+            tk.loadFile(file)
+    elapsed = time.perf_counter() - start
+    # maximum resident set size (in kilobytes on Linux)
+    memory = resource.getrusage(resource.RUSAGE_SELF).ru_maxrss
+    print(f'{elapsed} {memory}')
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('input', help='a directory with MEI files or a single MEI file')
+    parser.add_argument('--repeat', type=int, default=1)
+    parser.add_argument('--mode', choices=modes.keys(), help=argparse.SUPPRESS)
+    args = parser.parse_args()
+
+    files = read_files(args.input)
+    if len(files) == 0:
+        print('No file found in {}'.format(args.input))
+        sys.exit(1)
+
+    # Run a single mode (in a separate process for measuring the memory)
+    if args.mode:
+        run(args.mode, files, args.repeat)
+        sys.exit(0)
+
+    print(f'Verovio {verovio.toolkit(False).getVersion()}')
+    for mode in modes:
+        output = subprocess.check_output(
+            [sys.executable, __file__, args.input, '--repeat', str(args.repeat), '--mode', mode])
+        elapsed, memory = output.decode().split()
+        print('{} files - {}: {:.3f} s, {:.1f} MB'.format(len(files), mode, float(elapsed), int(memory) / 1024))
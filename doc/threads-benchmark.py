@@ -0,0 +1,97 @@
+# This script it expected to be run from ./bindings/python
+# It measures the throughput for rendering files to SVG from a pool of Python threads, each thread with its own toolkit,
+# and checks that the output is the same as when rendering them from a single thread
+import argparse
+import concurrent.futures
+import hashlib
+import os
+import re
+import sys
+import threading
+import time
+
+# Add path for toolkit built in-place
+sys.path.append('.')
+import verovio
+
+local = threading.local()
+
+
+def read_files(path):
+    files = []
+    # A directory with one file per score
+    if os.path.isdir(path):
+        for item in sorted(os.listdir(path)):
+            if os.path.isfile(os.path.join(path, item)):
+                files.append(os.path.join(path, item))
+    else:
+        files.append(path)
+    return files
+
+
+def get_toolkit():
+    # A toolkit cannot be used by more than one thread at a time
+    if not hasattr(local, 'tk'):
+        local.tk = verovio.toolkit(False)
+        local.tk.setResourcePath('../../data')
+    return local.tk
+
+
+def render(data):
+    tk = get_toolkit()
+    if not tk.loadDataBuffer(data):
+        return None
+    digest = hashlib.sha1()
+    for page in range(1, tk.getPageCount() + 1):
+        svg = tk.renderToSVGBuffer(page)
+        # The generated IDs and the order of the glyph definitions can be different
+        svg = re.sub(rb'<defs>.*?</defs>', b'', svg, flags=re.DOTALL)
+        digest.update(re.sub(rb'(id|href|data-[a-z]*)="[^"]*"', b'', svg))
+    return digest.hexdigest()
+
+
+def run(data, threads):
+    start = time.perf_counter()
+    with concurrent.futures.ThreadPoolExecutor(max_workers=threads) as executor:
+        results = list(executor.map(render, data))
+    return time.perf_counter() - start, results
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('input', help='a directory with scores or a single score')
+    parser.add_argument('--threads', type=int, nargs='+', default=[1, 2, 4, 8])
+    parser.add_argument('--repeat', type=int, default=1)
+    args = parser.parse_args()
+
+    files = read_files(args.input)
+    if len(files) == 0:
+        print('No file found in {}'.format(args.input))
+        sys.exit(1)
+
+    verovio.enableLog(verovio.LOG_OFF)
+    print(f'Verovio {verovio.toolkit(False).getVersion()} - {os.cpu_count()} CPUs')
+
+    # The files are read beforehand and passed as bytes
+    data = []
+    for file in files:
+        with open(file, 'rb') as f:
+            data.append(f.read())
+    data = data * args.repeat
+
+    errors = 0
+    reference = None
+    single_time = None
+    for threads in args.threads:
+        elapsed, results = run(data, threads)
+        if reference is None:
+            reference = results
+            single_time = elapsed
+        for file, result, ref in zip(files * args.repeat, results, reference):
+            if result != ref:
+                print('{} - {} threads: the output is not the same'.format(file, threads))
+                errors += 1
+        print('{} files - {} threads: {:.3f} s ({:.1f} files/s, speedup {:.2f})'.format(
+            len(data), threads, elapsed, len(data) / elapsed, single_time / elapsed))
+
+    sys.exit(1 if errors else 0)
@@ -0,0 +1,88 @@
+# This script it expected to be run from ./bindings/python
+# It compares the time for switching between page widths cast off in one call with the time for redoing the layout
+# for each width, and checks that the SVG of all the pages is the same
+import argparse
+import json
+import os
+import re
+import sys
+import time
+
+# Add path for toolkit built in-place
+sys.path.append('.')
+import verovio
+
+widths = [2100, 1600, 1200, 900]
+
+
+def read_files(path):
+    files = []
+    # A directory with one file per score
+    if os.path.isdir(path):
+        for item in sorted(os.listdir(path)):
+            if os.path.isfile(os.path.join(path, item)):
+                files.append(os.path.join(path, item))
+    else:
+        files.append(path)
+    return files
+
+
+def render(tk):
+    svg = ''
+    for page in range(1, tk.getPageCount() + 1):
+        svg += tk.renderToSVG(page)
+    # The IDs generated during the layout and the order of the glyph definitions can be different
+    svg = re.sub(r'<defs>.*?</defs>', '', svg, flags=re.DOTALL)
+    return re.sub(r'(id|href|data-[a-z]*)="[^"]*"', '', svg)
+
+
+def load(file):
+    tk = verovio.toolkit(False)
+    tk.setResourcePath('../../data')
+    tk.setOptions({'xmlIdSeed': 1})
+    tk.loadFile(file)
+    return tk
+
+
+if __name__ == '__main__':
+    parser = argparse.ArgumentParser()
+    parser.add_argument('input', help='a directory with scores or a single score')
+    args = parser.parse_args()
+
+    files = read_files(args.input)
+    if len(files) == 0:
+        print('No file found in {}'.format(args.input))
+        sys.exit(1)
+
+    verovio.enableLog(verovio.LOG_OFF)
+    print(f'Verovio {verovio.toolkit(False).getVersion()}')
+
+    errors = 0
+    cast_off_time = 0
+    switch_time = 0
+    redo_time = 0
+    for file in files:
+        tk = load(file)
+        start = time.perf_counter()
+        tk.redoLayoutForWidths(json.dumps(widths))
+        cast_off_time += time.perf_counter() - start
+
+        ref = load(file)
+        for width in widths:
+            start = time.perf_counter()
+            tk.switchLayoutWidth(width)
+            switch_time += time.perf_counter() - start
+
+            ref.setOptions({'pageWidth': width})
+            start = time.perf_counter()
+            ref.redoLayout()
+            redo_time += time.perf_counter() - start
+
+            if render(tk) != render(ref):
+                print('{} - {}: the layout is not the same as after redoing it'.format(file, width))
+                errors += 1
+
+    print('{} files - {} widths: cast off {:.3f} s, switch {:.3f} s (redo layout {:.3f} s)'.format(
+        len(files), len(widths), cast_off_time, switch_time, redo_time))
+
+    sys.exit(1 if errors else 0)
@@ -18,12 +18,30 @@ function getToolkitFunction(VerovioModule, method) {
     // void destructor(Toolkit *ic)
     mapping.destructor = VerovioModule.cwrap("vrvToolkit_destructor", null, ["number"]);
 
+    // void bufferDestructor(std::string *buffer)
+    mapping.bufferDestructor = VerovioModule.cwrap("vrvBuffer_destructor", null, ["number"]);
+
+    // char *bufferGetData(std::string *buffer)
+    mapping.bufferGetData = VerovioModule.cwrap("vrvBuffer_getData", "number", ["number"]);
+
+    // int bufferGetLength(std::string *buffer)
+    mapping.bufferGetLength = VerovioModule.cwrap("vrvBuffer_getLength", "number", ["number"]);
+
     // bool edit(Toolkit *ic, const char *editorAction) 
     mapping.edit = VerovioModule.cwrap("vrvToolkit_edit", "number", ["number", "string"]);
 
     // char *editInfo(Toolkit *ic)
     mapping.editInfo = VerovioModule.cwrap("vrvToolkit_editInfo", "string", ["number"]);
 
+    // void enableLog(Toolkit *ic, int level)
+    mapping.enableLog = VerovioModule.cwrap("vrvToolkit_enableLog", null, ["number", "number"]);
+
+    // void enableLogToBuffer(Toolkit *ic, bool value)
+    mapping.enableLogToBuffer = VerovioModule.cwrap("vrvToolkit_enableLogToBuffer", null, ["number", "number"]);
+
+    // char *getABCCollectionIndex(Toolkit *ic)
+    mapping.getABCCollectionIndex = VerovioModule.cwrap("vrvToolkit_getABCCollectionIndex", "string", ["number"]);
+
     // char *getAvailableOptions(Toolkit *ic)
     mapping.getAvailableOptions = VerovioModule.cwrap("vrvToolkit_getAvailableOptions", "string", ["number"]);
 
@@ -60,6 +78,9 @@ function getToolkitFunction(VerovioModule, method) {
     // char *getMEI(Toolkit *ic, const char *options)
     mapping.getMEI = VerovioModule.cwrap("vrvToolkit_getMEI", "string", ["number", "string"]);
 
+    // std::string *getMEIBuffer(Toolkit *ic, const char *options)
+    mapping.getMEIBuffer = VerovioModule.cwrap("vrvToolkit_getMEIBuffer", "number", ["number", "string"]);
+
     // char *vrvToolkit_getNotatedIdForElement(Toolkit *tk, const char *xmlId);
     mapping.getNotatedIdForElement = VerovioModule.cwrap("vrvToolkit_getNotatedIdForElement", "string", ["number", "string"]);
 
@@ -72,6 +93,12 @@ function getToolkitFunction(VerovioModule, method) {
     // int getPageWithElement(Toolkit *ic, const char *xmlId)
     mapping.getPageWithElement = VerovioModule.cwrap("vrvToolkit_getPageWithElement", "number", ["number", "string"]);
 
+    // char *getProfilingReport(Toolkit *ic)
+    mapping.getProfilingReport = VerovioModule.cwrap("vrvToolkit_getProfilingReport", "string", ["number"]);
+
+    // char *getProfilingTrace(Toolkit *ic)
+    mapping.getProfilingTrace = VerovioModule.cwrap("vrvToolkit_getProfilingTrace", "string", ["number"]);
+
     // double getTimeForElement(Toolkit *ic, const char *xmlId)
     mapping.getTimeForElement = VerovioModule.cwrap("vrvToolkit_getTimeForElement", "number", ["number", "string"]);
 
@@ -84,9 +111,18 @@ function getToolkitFunction(VerovioModule, method) {
     // char *getVersion(Toolkit *ic)
     mapping.getVersion = VerovioModule.cwrap("vrvToolkit_getVersion", "string", ["number"]);
 
+    // bool loadABCCollection(Toolkit *ic, const char *data, const char *jsonIndex)
+    mapping.loadABCCollection = VerovioModule.cwrap("vrvToolkit_loadABCCollection", "number", ["number", "string", "string"]);
+
+    // bool loadABCTune(Toolkit *ic, int tune, bool byReferenceNumber)
+    mapping.loadABCTune = VerovioModule.cwrap("vrvToolkit_loadABCTune", "number", ["number", "number", "number"]);
+
     // bool loadData(Toolkit *ic, const char *data)
     mapping.loadData = VerovioModule.cwrap("vrvToolkit_loadData", "number", ["number", "string"]);
 
+    // bool loadDataBuffer(Toolkit *ic, const char *data, int length)
+    mapping.loadDataBuffer = VerovioModule.cwrap("vrvToolkit_loadDataBuffer", "number", ["number", "number", "number"]);
+
     // bool loadZipDataBase64(Toolkit *ic, const char *data)
     mapping.loadZipDataBase64 = VerovioModule.cwrap("vrvToolkit_loadZipDataBase64", "number", ["number", "string"]);
 
@@ -96,6 +132,9 @@ function getToolkitFunction(VerovioModule, method) {
     // void redoLayout(Toolkit *ic)
     mapping.redoLayout = VerovioModule.cwrap("vrvToolkit_redoLayout", null, ["number", "string"]);
 
+    // char *redoLayoutForWidths(Toolkit *ic, const char *jsonWidths)
+    mapping.redoLayoutForWidths = VerovioModule.cwrap("vrvToolkit_redoLayoutForWidths", "string", ["number", "string"]);
+
     // void redoPagePitchPosLayout(Toolkit *ic)
     mapping.redoPagePitchPosLayout = VerovioModule.cwrap("vrvToolkit_redoPagePitchPosLayout", null, ["number"]);
 
@@ -105,6 +144,9 @@ function getToolkitFunction(VerovioModule, method) {
     // char *renderToExpansionMap(Toolkit *ic)
     mapping.renderToExpansionMap = VerovioModule.cwrap("vrvToolkit_renderToExpansionMap", "string", ["number"]);
 
+    // char *renderToGlyphSprite(Toolkit *ic)
+    mapping.renderToGlyphSprite = VerovioModule.cwrap("vrvToolkit_renderToGlyphSprite", "string", ["number"]);
+
     // char *renderToMIDI(Toolkit *ic, const char *rendering_options)
     mapping.renderToMIDI = VerovioModule.cwrap("vrvToolkit_renderToMIDI", "string", ["number", "string"]);
 
@@ -114,12 +156,21 @@ function getToolkitFunction(VerovioModule, method) {
     // char *renderToSvg(Toolkit *ic, int pageNo, int xmlDeclaration)
     mapping.renderToSVG = VerovioModule.cwrap("vrvToolkit_renderToSVG", "string", ["number", "number", "number"]);
 
+    // std::string *renderToSVGBuffer(Toolkit *ic, int pageNo, int xmlDeclaration)
+    mapping.renderToSVGBuffer = VerovioModule.cwrap("vrvToolkit_renderToSVGBuffer", "number", ["number", "number", "number"]);
+
+    // char *renderToSVGPatch(Toolkit *ic, int pageNo)
+    mapping.renderToSVGPatch = VerovioModule.cwrap("vrvToolkit_renderToSVGPatch", "string", ["number", "number"]);
+
     // char *renderToTimemap(Toolkit *ic)
     mapping.renderToTimemap = VerovioModule.cwrap("vrvToolkit_renderToTimemap", "string", ["number", "string"]);
 
     // void resetOptions(Toolkit *ic)
     mapping.resetOptions = VerovioModule.cwrap("vrvToolkit_resetOptions", null, ["number"]);
 
+    // void resetProfiling(Toolkit *ic)
+    mapping.resetProfiling = VerovioModule.cwrap("vrvToolkit_resetProfiling", null, ["number"]);
+
     // void resetXmlIdSeed(Toolkit *ic, int seed) 
     mapping.resetXmlIdSeed = VerovioModule.cwrap("vrvToolkit_resetXmlIdSeed", null, ["number", "number"]);
 
@@ -129,6 +180,9 @@ function getToolkitFunction(VerovioModule, method) {
     // void setOptions(Toolkit *ic, const char *options) 
     mapping.setOptions = VerovioModule.cwrap("vrvToolkit_setOptions", null, ["number", "string"]);
 
+    // bool switchLayoutWidth(Toolkit *ic, int pageWidth)
+    mapping.switchLayoutWidth = VerovioModule.cwrap("vrvToolkit_switchLayoutWidth", "number", ["number", "number"]);
+
     // char *validatePAE(Toolkit *ic, const char *options)
     mapping.validatePAE = VerovioModule.cwrap("vrvToolkit_validatePAE", "string", ["number", "string"]);
 
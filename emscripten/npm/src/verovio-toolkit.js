@@ -26,6 +26,18 @@ export class VerovioToolkit {
         return JSON.parse(this.proxy.editInfo(this.ptr));
     }
 
+    enableLog(level) {
+        this.proxy.enableLog(this.ptr, level);
+    }
+
+    enableLogToBuffer(value) {
+        this.proxy.enableLogToBuffer(this.ptr, value);
+    }
+
+    getABCCollectionIndex() {
+        return JSON.parse(this.proxy.getABCCollectionIndex(this.ptr));
+    }
+
     getAvailableOptions() {
         return JSON.parse(this.proxy.getAvailableOptions(this.ptr));
     }
@@ -74,6 +86,10 @@ export class VerovioToolkit {
         return this.proxy.getMEI(this.ptr, JSON.stringify(options));
     }
 
+    getMEIBuffer(options = {}) {
+        return this.readBuffer(this.proxy.getMEIBuffer(this.ptr, JSON.stringify(options)));
+    }
+
     getMIDIValuesForElement(xmlId) {
         return JSON.parse(this.proxy.getMIDIValuesForElement(this.ptr, xmlId));
     }
@@ -104,6 +120,14 @@ export class VerovioToolkit {
         return this.proxy.getPageWithElement(this.ptr, xmlId);
     }
 
+    getProfilingReport() {
+        return JSON.parse(this.proxy.getProfilingReport(this.ptr));
+    }
+
+    getProfilingTrace() {
+        return JSON.parse(this.proxy.getProfilingTrace(this.ptr));
+    }
+
     getTimeForElement(xmlId) {
         return this.proxy.getTimeForElement(this.ptr, xmlId);
     }
@@ -116,10 +140,34 @@ export class VerovioToolkit {
         return this.proxy.getVersion(this.ptr);
     }
 
+    loadABCCollection(data, index = "") {
+        if (index instanceof Object) {
+            index = JSON.stringify(index);
+        }
+        return this.proxy.loadABCCollection(this.ptr, data, index);
+    }
+
+    loadABCTune(tune, byReferenceNumber = false) {
+        return this.proxy.loadABCTune(this.ptr, tune, byReferenceNumber);
+    }
+
     loadData(data) {
         return this.proxy.loadData(this.ptr, data);
     }
 
+    loadDataBuffer(data) {
+        if (!(data instanceof ArrayBuffer) && !ArrayBuffer.isView(data)) {
+            console.error("Parameter for loadDataBuffer has to be of type ArrayBuffer or a typed array");
+            return false;
+        }
+        var dataArray = (data instanceof ArrayBuffer) ? new Uint8Array(data) : new Uint8Array(data.buffer, data.byteOffset, data.byteLength);
+        var dataPtr = this.VerovioModule._malloc(dataArray.length);
+        this.VerovioModule.HEAPU8.set(dataArray, dataPtr);
+        var res = this.proxy.loadDataBuffer(this.ptr, dataPtr, dataArray.length);
+        this.VerovioModule._free(dataPtr);
+        return res;
+    }
+
     loadZipDataBase64(data) {
         return this.proxy.loadZipDataBase64(this.ptr, data);
     }
@@ -138,10 +186,22 @@ export class VerovioToolkit {
         return res;
     }
 
+    readBuffer(bufferPtr) {
+        // Copy the buffer out of the module memory (which can grow) and delete it
+        var dataPtr = this.proxy.bufferGetData(bufferPtr);
+        var res = this.VerovioModule.HEAPU8.slice(dataPtr, dataPtr + this.proxy.bufferGetLength(bufferPtr));
+        this.proxy.bufferDestructor(bufferPtr);
+        return res;
+    }
+
     redoLayout(options = {}) {
         this.proxy.redoLayout(this.ptr, JSON.stringify(options));
     }
 
+    redoLayoutForWidths(widths) {
+        return JSON.parse(this.proxy.redoLayoutForWidths(this.ptr, JSON.stringify(widths)));
+    }
+
     redoPagePitchPosLayout() {
         this.proxy.redoPagePitchPosLayout(this.ptr);
     }
@@ -154,6 +214,10 @@ export class VerovioToolkit {
         return JSON.parse(this.proxy.renderToExpansionMap(this.ptr));
     }
 
+    renderToGlyphSprite() {
+        return this.proxy.renderToGlyphSprite(this.ptr);
+    }
+
     renderToMIDI(options) {
         return this.proxy.renderToMIDI(this.ptr, JSON.stringify(options));
     }
@@ -166,6 +230,14 @@ export class VerovioToolkit {
         return this.proxy.renderToSVG(this.ptr, pageNo, xmlDeclaration);
     }
 
+    renderToSVGBuffer(pageNo = 1, xmlDeclaration = false) {
+        return this.readBuffer(this.proxy.renderToSVGBuffer(this.ptr, pageNo, xmlDeclaration));
+    }
+
+    renderToSVGPatch(pageNo = 1) {
+        return JSON.parse(this.proxy.renderToSVGPatch(this.ptr, pageNo));
+    }
+
     renderToTimemap(options = {}) {
         return JSON.parse(this.proxy.renderToTimemap(this.ptr, JSON.stringify(options)));
     }
@@ -174,6 +246,10 @@ export class VerovioToolkit {
         this.proxy.resetOptions(this.ptr);
     }
 
+    resetProfiling() {
+        this.proxy.resetProfiling(this.ptr);
+    }
+
     resetXmlIdSeed(seed) {
         return this.proxy.resetXmlIdSeed(this.ptr, seed);
     }
@@ -186,6 +262,10 @@ export class VerovioToolkit {
         return this.proxy.setOptions(this.ptr, JSON.stringify(options));
     }
 
+    switchLayoutWidth(pageWidth) {
+        return this.proxy.switchLayoutWidth(this.ptr, pageWidth);
+    }
+
     validatePAE(data) {
         if (data instanceof Object) {
             data = JSON.stringify(data);
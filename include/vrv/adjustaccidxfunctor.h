@@ -34,6 +34,12 @@ public:
      */
     bool ImplementsEndInterface() const override { return false; }
 
+    /*
+     * Setter for the scoreDef to use instead of the current one of the document
+     * This is necessary when measures are processed directly (and not through their score)
+     */
+    void SetScoreDef(ScoreDef *scoreDef) { m_scoreDef = scoreDef; }
+
     /*
      * Functor interface
      */
@@ -52,6 +58,8 @@ public:
 private:
     // The current measure
     Measure *m_currentMeasure;
+    // The scoreDef to use, or NULL for the current one of the document
+    ScoreDef *m_scoreDef;
 };
 
 } // namespace vrv
@@ -92,6 +92,8 @@ public:
     int GetDrawingXRel() const { return m_drawingXRel; }
     virtual void SetDrawingXRel(int drawingXRel);
     void CacheXRel(bool restore = false);
+    int GetCachedXRel() const { return m_cachedXRel; }
+    void SetCachedXRel(int cachedXRel) { m_cachedXRel = cachedXRel; }
     ///@}
 
     /**
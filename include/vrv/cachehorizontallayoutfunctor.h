@@ -59,6 +59,76 @@ private:
     bool m_restore;
 };
 
+//----------------------------------------------------------------------------
+// PersistHorizontalLayoutFunctor
+//----------------------------------------------------------------------------
+
+/**
+ * This class writes the cached horizontal layout to a sequence of values, or reads it back from it.
+ * The values are in the order of the traversal and include the xRel of the alignments and the widths of the scoreDefs
+ * and labels used by the cast-off. They also include the state of the accidentals that the horizontal layout keeps
+ * for the layout of the pages. Reading them requires the same content and the aligners to be reset with the same
+ * options (see LayoutCache).
+ */
+class PersistHorizontalLayoutFunctor : public Functor {
+public:
+    /**
+     * @name Constructors, destructors
+     */
+    ///@{
+    PersistHorizontalLayoutFunctor(std::vector<int> *values, bool load);
+    virtual ~PersistHorizontalLayoutFunctor() = default;
+    ///@}
+
+    /*
+     * Abstract base implementation
+     */
+    bool ImplementsEndInterface() const override { return false; }
+
+    /*
+     * Return true if the values do not match the content when reading them
+     */
+    bool HasFailed() const { return (m_failed || (m_load && (m_position != (int)m_values->size()))); }
+
+    /*
+     * Functor interface
+     */
+    ///@{
+    FunctorCode VisitAccid(Accid *accid) override;
+    FunctorCode VisitArpeg(Arpeg *arpeg) override;
+    FunctorCode VisitLayerElement(LayerElement *layerElement) override;
+    FunctorCode VisitMeasure(Measure *measure) override;
+    FunctorCode VisitPage(Page *page) override;
+    FunctorCode VisitScoreDef(ScoreDef *scoreDef) override;
+    FunctorCode VisitSystem(System *system) override;
+    ///@}
+
+protected:
+    //
+private:
+    /**
+     * Write the value or replace it with the next one read
+     */
+    void Persist(int &value);
+
+    /**
+     * Persist the xRel of the alignments of the aligner and of their grace aligners
+     */
+    void PersistAlignments(HorizontalAligner *aligner);
+
+public:
+    //
+private:
+    // The values
+    std::vector<int> *m_values;
+    // Indicates if the values are read (or written)
+    bool m_load;
+    // The position of the next value to read
+    int m_position;
+    // Indicates that the values do not match the content
+    bool m_failed;
+};
+
 } // namespace vrv
 
 #endif // __VRV_CACHEHORIZONTALLAYOUTFUNCTOR_H__
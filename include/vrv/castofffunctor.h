@@ -45,6 +45,11 @@ public:
      */
     void SetSystemWidth(int width) { m_systemWidth = width; }
 
+    /*
+     * Set the IDs of the first child of each system for breaking them as in a previous cast off
+     */
+    void SetBreaks(const std::set<std::string> *breaks) { m_breaks = breaks; }
+
     /*
      * Functor interface
      */
@@ -87,6 +92,8 @@ private:
     bool m_smart;
     // The leftover system (last system with only one measure)
     System *m_leftoverSystem;
+    // The IDs of the first child of each system when casting off with known breaks
+    const std::set<std::string> *m_breaks;
 };
 
 //----------------------------------------------------------------------------
@@ -121,6 +128,11 @@ public:
      */
     void SetPageHeight(int height) { m_pageHeight = height; }
 
+    /*
+     * Set the IDs of the first child of the first system of each page for breaking them as in a previous cast off
+     */
+    void SetBreaks(const std::set<std::string> *breaks) { m_breaks = breaks; }
+
     /*
      * Functor interface
      */
@@ -155,6 +167,8 @@ private:
     System *m_leftoverSystem;
     // The pending elements (Mdiv, Score) to be placed at the beginning of a page
     ArrayOfObjects m_pendingPageElements;
+    // The IDs of the first child of the first system of each page when casting off with known breaks
+    const std::set<std::string> *m_breaks;
 };
 
 //----------------------------------------------------------------------------
@@ -246,7 +246,7 @@ public:
         if (!MatchesType(object)) return false;
         // This should not happen, but just in case
         if (!object->HasAttClass(ATT_NINTEGER)) return false;
-        const AttNInteger *element = dynamic_cast<const AttNInteger *>(object);
+        const AttNInteger *element = object->GetAtt<AttNInteger>(ATT_NINTEGER);
         assert(element);
         return (element->GetN() == m_n);
     }
@@ -275,7 +275,7 @@ public:
         if (!MatchesType(object)) return false;
         // This should not happen, but just in case
         if (!object->HasAttClass(ATT_NINTEGER)) return false;
-        const AttNInteger *element = dynamic_cast<const AttNInteger *>(object);
+        const AttNInteger *element = object->GetAtt<AttNInteger>(ATT_NINTEGER);
         assert(element);
         return (std::find(m_ns.begin(), m_ns.end(), element->GetN()) != m_ns.end());
     }
@@ -303,7 +303,7 @@ public:
         if (!MatchesType(object)) return false;
         // This should not happen, but just in case
         if (!object->HasAttClass(ATT_NNUMBERLIKE)) return false;
-        const AttNNumberLike *element = dynamic_cast<const AttNNumberLike *>(object);
+        const AttNNumberLike *element = object->GetAtt<AttNNumberLike>(ATT_NNUMBERLIKE);
         assert(element);
         return (element->GetN() == m_n);
     }
@@ -371,7 +371,7 @@ public:
     {
         if (!MatchesType(object)) return false;
         if (!object->HasAttClass(ATT_VISIBILITY)) return false;
-        const AttVisibility *visibility = dynamic_cast<const AttVisibility *>(object);
+        const AttVisibility *visibility = object->GetAtt<AttVisibility>(ATT_VISIBILITY);
         assert(visibility);
         return (visibility->GetVisible() == m_isVisible);
     }
@@ -14,6 +14,7 @@
 #include "options.h"
 #include "resources.h"
 #include "scoredef.h"
+#include "scoredefchanges.h"
 
 namespace smf {
 class MidiFile;
@@ -22,14 +23,38 @@ class MidiFile;
 namespace vrv {
 
 class DocSelection;
+class FeatureExtractor;
 class FontInfo;
 class Glyph;
+class Measure;
 class Pages;
 class Page;
 class Score;
+class System;
+class ThreadPool;
 
 enum DocType { Raw = 0, Rendering, Transcription, Facs };
 
+//----------------------------------------------------------------------------
+// CastOffBreaks
+//----------------------------------------------------------------------------
+
+/**
+ * The breaks of a document cast off, for casting it off again in the same way.
+ * Systems are identified by the ID of their first child, and pages by the one of their first system.
+ * The leftover system is the last system merged with the previous one because it did not fit on the page.
+ * The total and justifiable widths of the systems are kept for not laying out the content again.
+ * The IDs of the first measure of each system and page are kept for reporting the break positions.
+ */
+struct CastOffBreaks {
+    std::vector<std::string> m_systems;
+    std::vector<std::string> m_pages;
+    std::string m_leftover;
+    std::vector<std::pair<int, int>> m_systemWidths;
+    std::vector<std::string> m_systemMeasures;
+    std::vector<std::string> m_pageMeasures;
+};
+
 //----------------------------------------------------------------------------
 // Doc
 //----------------------------------------------------------------------------
@@ -73,6 +98,19 @@ public:
     void SetOptions(Options *options) { (*m_options) = *options; }
     ///@}
 
+    /**
+     * Getter for the arena in which the objects of the document are allocated.
+     * The arena needs to be made current with an ObjectArenaScope when creating objects.
+     */
+    ObjectArena *GetArena() { return m_arena; }
+
+    /**
+     * Getter for the thread pool of the horizontal layout, with the number of threads of the layoutThreads option.
+     * The pool is kept for the following layouts and is created again when the option changes.
+     * Return NULL if the layout is not done in parallel.
+     */
+    ThreadPool *GetLayoutThreadPool();
+
     /**
      * Getter for the resources
      */
@@ -262,6 +300,11 @@ public:
      */
     bool ExportFeatures(std::string &output, const std::string &options);
 
+    /**
+     * Extract music features with the extractor, calculating the timemap if necessary.
+     */
+    bool ExtractFeatures(FeatureExtractor &extractor);
+
     /**
      * Set the initial scoreDef of each page.
      * This is necessary for integrating changes that occur within a page.
@@ -275,6 +318,16 @@ public:
      */
     void ScoreDefOptimizeDoc();
 
+    /**
+     * @name Getters for the content of the measures recorded when setting the current scoreDef.
+     * The changes are recorded by the first ScoreDefSetCurrentDoc and have to be reset when the content changes.
+     */
+    ///@{
+    ScoreDefChanges *GetScoreDefChanges() { return &m_scoreDefChanges; }
+    const ScoreDefChanges *GetScoreDefChanges() const { return &m_scoreDefChanges; }
+    void ResetScoreDefChanges() { m_scoreDefChanges.Reset(); }
+    ///@}
+
     /**
      * Set the GrpSym start / end for each System once ScoreDef is set and (if necessary) optimized
      */
@@ -310,8 +363,20 @@ public:
      * @param useSb - true to use the sb from the document.
      * @param usePb - true to use the pb from the document.
      * @param smart - true to sometimes use encoded sb and pb.
+     * @param breaks - the breaks of a previous cast off to use instead of filling the systems and pages.
+     */
+    void CastOffDocBase(bool useSb, bool usePb, bool smart = false, const CastOffBreaks *breaks = NULL);
+
+    /**
+     * Casts off the entire document with the breaks of a previous cast off.
+     * The content is not laid out vertically since the page breaks are already known.
      */
-    void CastOffDocBase(bool useSb, bool usePb, bool smart = false);
+    void CastOffBreaksDoc(const CastOffBreaks &breaks);
+
+    /**
+     * Return the breaks of the document cast off.
+     */
+    const CastOffBreaks &GetCastOffBreaks() const { return m_castOffBreaks; }
 
     /**
      * Undo the cast off of the entire document.
@@ -408,6 +473,21 @@ public:
     bool IsMensuralMusicOnly() const { return m_isMensuralMusicOnly; }
     ///@}
 
+    /**
+     * Return true if the document is processed in incipit mode.
+     * This is set in Doc::PrepareData when the option is enabled and the content has a single staff.
+     */
+    bool IsIncipit() const { return m_isIncipit; }
+
+    /**
+     * @name Setter and getter for the hash of the input data.
+     * The hash identifies the content in the persistent layout cache and is reset when the content is edited.
+     */
+    ///@{
+    void SetDataHash(const std::string &dataHash) { m_dataHash = dataHash; }
+    const std::string &GetDataHash() const { return m_dataHash; }
+    ///@}
+
     /**
      * @name Setter and getter for facsimile
      */
@@ -452,6 +532,13 @@ public:
     void ReactivateSelection(bool resetAligners);
     ///@}
 
+    /**
+     * Reset the vertical alignment of the measures outside an excerpt selection
+     * that hold the start or the end of a time spanning element of the excerpt.
+     * Their staves still point to the alignment of systems deleted when casting off to the selection.
+     */
+    void ResetSelectionContext(Page *selectionPage);
+
     //----------//
     // Functors //
     //----------//
@@ -477,11 +564,41 @@ private:
      */
     void PrepareMeasureIndices();
 
+    /**
+     * Store or restore the horizontal layout of the content page for casting it off again without laying it out.
+     * Restoring it returns false if it does not match the content.
+     */
+    ///@{
+    void StoreHorizontalLayout(Page *page);
+    bool RestoreHorizontalLayout(Page *page);
+    ///@}
+
+    /**
+     * Move the content of all the pages to a single page with one system per score, as UnCastOffDoc does,
+     * but without processing the content of the systems. Their layout and drawing scoreDefs are not reset.
+     */
+    void MergePagesDoc();
+
+    /**
+     * Move the measures of an excerpt selection to a selection page without processing the rest of the document.
+     * The scoreDef of the selection is the drawing scoreDef of the last measure with one before it.
+     * Return false if the excerpt does not start with a measure of a system.
+     */
+    bool InitExcerptDoc(bool resetCache);
+
+    /**
+     * Return the measure holding the drawing scoreDef current for the child idx of a system.
+     * This is the last measure with a drawing scoreDef up to that child, including in endings or editorial markup.
+     */
+    Measure *GetDrawingScoreDefMeasure(System *system, int idx);
+
 public:
     Page *m_selectionPreceding;
     Page *m_selectionFollowing;
     std::string m_selectionStart;
     std::string m_selectionEnd;
+    /** Only the selected content is laid out and the rest of the document is not touched */
+    bool m_selectionIsExcerpt;
 
     /**
      * A copy of the header tree stored as pugi::xml_document
@@ -540,6 +657,17 @@ private:
      */
     Options *m_options;
 
+    /**
+     * The arena for the objects of the document.
+     * It is replaced when the document is reset and released when the document is deleted.
+     */
+    ObjectArena *m_arena;
+
+    /**
+     * The thread pool for the horizontal layout, NULL until the layout is done in parallel.
+     */
+    ThreadPool *m_layoutThreadPool;
+
     /**
      * The resources (glyph table).
      */
@@ -596,6 +724,12 @@ private:
      */
     bool m_currentScoreDefDone;
 
+    /**
+     * The content of the measures recorded by ScoreDefSetCurrentDoc.
+     * It makes it possible to propagate the scoreDef again without processing the layers.
+     */
+    ScoreDefChanges m_scoreDefChanges;
+
     /**
      * A flag to indicate if the data preparation has been done. If yes,
      * data preparation will be reset before being done again.
@@ -622,6 +756,29 @@ private:
      */
     bool m_isMensuralMusicOnly;
 
+    /**
+     * A flag to indicate that the document is processed in incipit mode.
+     * Passes that are irrelevant for a single staff on a single system are skipped.
+     */
+    bool m_isIncipit;
+
+    /**
+     * The hash of the input data for the persistent layout cache.
+     * Empty if the cache is not used or if the content has been edited.
+     */
+    std::string m_dataHash;
+
+    /**
+     * The horizontal layout of the content page stored at the last cast-off.
+     * Empty if the cache was reset or if the content page was changed by a selection.
+     */
+    std::vector<int> m_horizontalLayout;
+
+    /**
+     * The breaks of the last cast-off, empty if the document is not cast off.
+     */
+    CastOffBreaks m_castOffBreaks;
+
     /** Page width (MEI scoredef@page.width) - currently not saved */
     int m_pageWidth;
     /** Page height (MEI scoredef@page.height) - currently not saved */
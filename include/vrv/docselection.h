@@ -35,6 +35,7 @@ public:
     /**
      * Parse the stringified JSON string a stores the values.
      * Priority is given to measureRange selection over start / end ids
+     * With "excerpt": true, only the selected content is laid out (see Doc::InitSelectionDoc)
      */
     bool Parse(const std::string &selection);
 
@@ -52,6 +53,7 @@ public:
     int m_selectionRangeStart;
     int m_selectionRangeEnd;
     std::string m_measureRange;
+    bool m_isExcerpt;
     bool m_isPending;
 };
 
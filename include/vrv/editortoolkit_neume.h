@@ -18,6 +18,7 @@
 #include "editortoolkit.h"
 #include "view.h"
 #include "zone.h"
+#include "zoneindex.h"
 
 #include "jsonxx.h"
 
@@ -87,45 +88,25 @@ protected:
     bool AdjustClefLineFromPosition(Clef *clef, Staff *staff = NULL);
     ///@}
 
+    /**
+     * Return the zone index, building it if necessary.
+     */
+    ZoneIndex *GetZoneIndex();
+
+    /**
+     * Add or update the zones of the element (and of its syllable) in the zone index if it is built.
+     */
+    void UpdateZoneIndex(const std::string &elementId);
+
 private:
     jsonxx::Object m_infoObject;
+    /** The spatial index of the zones, built on the first query */
+    ZoneIndex m_zoneIndex;
 };
 
 //--------------------------------------------------------------------------------
 // Comparator structs
 //--------------------------------------------------------------------------------
-// To be used with std::sort to find the object with a closest bounding
-// box to a point defined by the x and y parameters of ClosestBB
-
-struct ClosestBB {
-    int x;
-    int y;
-
-    int distanceToBB(int ulx, int uly, int lrx, int lry, double rotate = 0)
-    {
-        int offset = (x - ulx) * tan(rotate * M_PI / 180.0);
-        uly = uly - offset;
-        lry = lry - offset;
-        int xDiff = std::max((ulx > x ? ulx - x : 0), (x > lrx ? x - lrx : 0));
-        int yDiff = std::max((uly > y ? uly - y : 0), (y > lry ? y - lry : 0));
-
-        return sqrt(xDiff * xDiff + yDiff * yDiff);
-    }
-
-    bool operator()(Object *a, Object *b)
-    {
-        if (!a->GetFacsimileInterface() || !b->GetFacsimileInterface()) return true;
-        Zone *zoneA = a->GetFacsimileInterface()->GetZone();
-        Zone *zoneB = b->GetFacsimileInterface()->GetZone();
-
-        int distA
-            = distanceToBB(zoneA->GetUlx(), zoneA->GetUly(), zoneA->GetLrx(), zoneA->GetLry(), zoneA->GetRotate());
-        int distB
-            = distanceToBB(zoneB->GetUlx(), zoneB->GetUly(), zoneB->GetLrx(), zoneB->GetLry(), zoneB->GetRotate());
-        return (distA < distB);
-    }
-};
-
 // To be used with std::stable_sort to find the position to insert a new staff
 
 struct StaffSort {
@@ -0,0 +1,153 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        featureindex.h
+// Author:      Laurent Pugin
+// Created:     2023
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef __VRV_FEATURE_INDEX_H__
+#define __VRV_FEATURE_INDEX_H__
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace vrv {
+
+class FeatureExtractor;
+
+//----------------------------------------------------------------------------
+// FeatureIndex
+//----------------------------------------------------------------------------
+
+/**
+ * This class holds an inverted index of the melodic n-grams of a set of documents for incipit and melody search.
+ * The chromatic and diatonic intervals and the refined contour extracted by the FeatureExtractor are indexed, each
+ * n-gram being mapped to the documents and the positions where it appears.
+ * An n-gram is indexed at every position, the values after the end of the melody being padded, so patterns shorter
+ * than the n-grams are found with a prefix search and longer ones are checked against the melody.
+ * The index can be written to a file and read from it.
+ */
+class FeatureIndex {
+public:
+    /**
+     * The melodic features indexed
+     */
+    enum Feature { INTERVALS_CHROMATIC = 0, INTERVALS_DIATONIC, REFINED_CONTOUR, FEATURE_COUNT };
+
+    /**
+     * The melody of a document
+     */
+    struct Document {
+        /** The id of the document, e.g., its filename */
+        std::string m_id;
+        /** The ids of the notes of each pitch, separated by a space for tied notes */
+        std::vector<std::string> m_pitchIds;
+        /** The key values of each feature, one per interval between the pitch at the same position and the next */
+        std::vector<uint8_t> m_values[FEATURE_COUNT];
+    };
+
+    /**
+     * The position of an n-gram in a document
+     */
+    struct Posting {
+        uint32_t m_document;
+        uint32_t m_position;
+    };
+
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    FeatureIndex();
+    virtual ~FeatureIndex() = default;
+    ///@}
+
+    void Reset();
+
+    /**
+     * @name Getters and setters for the length of the n-grams (from 2 to 8)
+     * Setting the length resets the index.
+     */
+    ///@{
+    int GetNgramLength() const { return m_ngramLength; }
+    void SetNgramLength(int ngramLength);
+    ///@}
+
+    /**
+     * Return the number of documents indexed
+     */
+    int GetDocumentCount() const { return (int)m_documents.size(); }
+
+    /**
+     * Fill the melody of a document from the content of a feature extractor
+     */
+    static void FillDocument(Document &document, const FeatureExtractor &extractor);
+
+    /**
+     * Add the documents to the index and index them.
+     * The documents are moved into the index.
+     */
+    void AddDocuments(std::vector<Document> &documents);
+
+    /**
+     * Write the index to a file or read it from a file.
+     * Return false if the file cannot be written or read, or if it is not valid.
+     */
+    ///@{
+    bool Write(const std::string &filename) const;
+    bool Read(const std::string &filename);
+    ///@}
+
+    /**
+     * Search the pattern given in a stringified JSON object and return the matches as a stringified JSON object.
+     * See Toolkit::QueryFeatureIndex for the pattern and the output.
+     */
+    std::string Query(const std::string &jsonQuery) const;
+
+private:
+    /**
+     * Return the key of the n-gram of the feature values starting at the position
+     */
+    uint64_t GetKey(const std::vector<uint8_t> &values, int position) const;
+
+    /**
+     * Build the postings of all the documents
+     */
+    void BuildPostings();
+
+    /**
+     * Append the postings of the keys between first and last (included) for a pattern starting at offset
+     */
+    void FindPostings(Feature feature, uint64_t first, uint64_t last, int offset, std::vector<Posting> &postings) const;
+
+    /**
+     * Return true if the pattern is found in the document at the position
+     */
+    bool Matches(Feature feature, const std::vector<uint8_t> &pattern, const Posting &posting) const;
+
+    /**
+     * Convert a feature value to the value stored in the keys (from 1 to 255, 0 being the padding)
+     */
+    static uint8_t ToKeyValue(int value);
+
+public:
+    //
+private:
+    /** The version of the file format */
+    static constexpr int FORMAT_VERSION = 1;
+
+    /** The length of the n-grams */
+    int m_ngramLength;
+    /** The documents indexed */
+    std::vector<Document> m_documents;
+    /** For each feature, the sorted keys of the n-grams and the offsets of their postings */
+    std::vector<uint64_t> m_keys[FEATURE_COUNT];
+    std::vector<uint32_t> m_offsets[FEATURE_COUNT];
+    /** For each feature, the postings sorted by key, document and position */
+    std::vector<Posting> m_postings[FEATURE_COUNT];
+};
+
+} // namespace vrv
+
+#endif // __VRV_FEATURE_INDEX_H__
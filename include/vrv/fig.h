@@ -38,10 +38,10 @@ public:
      * @name Getter to interfaces
      */
     ///@{
-    AreaPosInterface *GetAreaPosInterface() override { return dynamic_cast<AreaPosInterface *>(this); }
+    AreaPosInterface *GetAreaPosInterface() override { return vrv_cast<AreaPosInterface *>(this); }
     const AreaPosInterface *GetAreaPosInterface() const override
     {
-        return dynamic_cast<const AreaPosInterface *>(this);
+        return vrv_cast<const AreaPosInterface *>(this);
     }
     ///@}
 
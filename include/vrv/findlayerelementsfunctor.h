@@ -166,6 +166,8 @@ public:
      * Set the horizontal boundary to search for
      */
     void SetMinMaxPos(int minPos, int maxPos);
+    int GetMinPos() const { return m_minPos; }
+    int GetMaxPos() const { return m_maxPos; }
 
     /*
      * Set the minimal and maximal layerN to consider
@@ -176,6 +178,12 @@ public:
      * Set the staff numbers to consider
      */
     void SetStaffNs(const std::set<int> &staffNs) { m_staffNs = staffNs; }
+    const std::set<int> &GetStaffNs() const { return m_staffNs; }
+
+    /*
+     * Retrieve the spanning element
+     */
+    const TimeSpanningInterface *GetInterface() const { return m_interface; }
 
     /*
      * Set the classes to search for
@@ -225,6 +233,123 @@ private:
     std::vector<const LayerElement *> m_elements;
 };
 
+//----------------------------------------------------------------------------
+// LayerElementIndex
+//----------------------------------------------------------------------------
+
+/**
+ * This class indexes the layer elements of a system by staff and by horizontal position.
+ * It is filled by the IndexLayerElementsFunctor and makes it possible to find spanned elements without processing
+ * all the measures of the system. The positions are the ones at the time of the indexing and the index needs to be
+ * rebuilt when the horizontal layout changes.
+ */
+class LayerElementIndex {
+public:
+    /**
+     * @name Constructors, destructors
+     */
+    ///@{
+    LayerElementIndex();
+    ///@}
+
+    /**
+     * @name Add a measure or a layer element (in the order of the tree)
+     */
+    ///@{
+    void AddMeasure(const Measure *measure);
+    void AddLayerElement(const LayerElement *layerElement);
+    ///@}
+
+    /**
+     * Sort the elements by horizontal position once all have been added
+     */
+    void Sort();
+
+    /**
+     * Pass the elements possibly spanned to the FindSpannedLayerElementsFunctor, in the order of the tree.
+     * Only the elements in the horizontal range of the functor and in its staves are passed.
+     */
+    void Process(FindSpannedLayerElementsFunctor &findSpannedLayerElements) const;
+
+private:
+    /**
+     * An indexed element with its content left and right position
+     */
+    struct Entry {
+        const LayerElement *m_element;
+        int m_left;
+        int m_right;
+        int m_order;
+        int m_measureIdx;
+    };
+
+    /**
+     * The elements of a staff sorted by their left position and the ones without bounding box.
+     */
+    struct StaffEntries {
+        std::vector<Entry> m_entries;
+        std::vector<Entry> m_unbounded;
+        int m_maxWidth = 0;
+    };
+
+    /**
+     * Add to the list the entries in the range and within the measures to consider
+     */
+    void CollectEntries(const StaffEntries &staffEntries, int minPos, int maxPos, int firstMeasureIdx,
+        int lastMeasureIdx, std::vector<const Entry *> &entries) const;
+
+private:
+    /** The measures in the order of the tree and their position in it */
+    std::vector<const Measure *> m_measures;
+    std::map<const Measure *, int> m_measureIndices;
+    /** The elements by staff number (including the cross-staff ones) */
+    std::map<int, StaffEntries> m_staves;
+    /** The number of elements added */
+    int m_count;
+};
+
+//----------------------------------------------------------------------------
+// IndexLayerElementsFunctor
+//----------------------------------------------------------------------------
+
+/**
+ * This class fills a LayerElementIndex with the measures and the layer elements.
+ * Layer elements within scoreDef elements are skipped.
+ */
+class IndexLayerElementsFunctor : public ConstFunctor {
+public:
+    /**
+     * @name Constructors, destructors
+     */
+    ///@{
+    IndexLayerElementsFunctor(LayerElementIndex *index);
+    virtual ~IndexLayerElementsFunctor() = default;
+    ///@}
+
+    /*
+     * Abstract base implementation
+     */
+    bool ImplementsEndInterface() const override { return false; }
+
+    /*
+     * Functor interface
+     */
+    ///@{
+    FunctorCode VisitLayerElement(const LayerElement *layerElement) override;
+    FunctorCode VisitMeasure(const Measure *measure) override;
+    ///@}
+
+protected:
+    //
+private:
+    //
+public:
+    //
+private:
+    // The index to fill
+    LayerElementIndex *m_index;
+};
+
 //----------------------------------------------------------------------------
 // GetRelativeLayerElementFunctor
 //----------------------------------------------------------------------------
@@ -54,6 +54,16 @@ public:
     void SetDirection(bool direction) { m_direction = direction; }
     ///@}
 
+    /**
+     * Getters/Setters for the processing state used for profiling
+     */
+    ///@{
+    bool IsProcessing() const { return m_processing; }
+    void SetProcessing(bool processing) { m_processing = processing; }
+    int GetVisitCount() const { return m_visitCount; }
+    void IncrementVisitCount() { ++m_visitCount; }
+    ///@}
+
     /**
      * Return true if the functor implements the end interface
      */
@@ -72,6 +82,9 @@ private:
     bool m_visibleOnly = true;
     // Direction
     bool m_direction = FORWARD;
+    // Processing flag and number of objects visited
+    bool m_processing = false;
+    int m_visitCount = 0;
 };
 
 //----------------------------------------------------------------------------
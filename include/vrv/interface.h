@@ -43,13 +43,21 @@ public:
 
     /**
      * Method for registering an MEI att classes in the interface.
+     * It is called from the constructor of the interface, e.g., this->RegisterInterfaceAttClass<AttPitch>(ATT_PITCH,
+     * this), so the offset of the att class base from the interface is resolved statically.
      */
-    void RegisterInterfaceAttClass(AttClassId attClassId) { m_interfaceAttClasses.push_back(attClassId); }
+    template <class ATT, class INTERFACE> void RegisterInterfaceAttClass(AttClassId attClassId, INTERFACE *interface)
+    {
+        const int offset
+            = (int)(reinterpret_cast<char *>(static_cast<ATT *>(interface)) - reinterpret_cast<char *>(this));
+        m_interfaceAttClasses.push_back({ attClassId, offset });
+    }
 
     /**
      * Method for obtaining a pointer to the attribute class vector of the interface.
+     * Each att class is given with the offset of its base from the interface.
      */
-    std::vector<AttClassId> *GetAttClasses() { return &m_interfaceAttClasses; }
+    const std::vector<std::pair<AttClassId, int>> *GetAttClasses() const { return &m_interfaceAttClasses; }
 
     /**
      * Virtual reset method.
@@ -67,7 +75,7 @@ private:
     /**
      * A vector for storing all the MEI att classes grouped in the interface.
      */
-    std::vector<AttClassId> m_interfaceAttClasses;
+    std::vector<std::pair<AttClassId, int>> m_interfaceAttClasses;
 };
 
 } // namespace vrv
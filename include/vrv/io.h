@@ -72,6 +72,12 @@ public:
     // read
     virtual bool Import(std::string const &data) { return true; }
 
+    /**
+     * Import data owned by the caller that can be modified by the import, e.g., for parsing XML in place.
+     * The content of the data is undefined afterwards. By default, the data is not modified.
+     */
+    virtual bool ImportInPlace(std::string &data) { return this->Import(data); }
+
     /**
      * Getter for layoutInformation flag that is set to true during import
      * if layout information is found (and not to be ignored).
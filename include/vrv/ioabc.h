@@ -8,6 +8,7 @@
 #ifndef __VRV_IOABC_H__
 #define __VRV_IOABC_H__
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -37,6 +38,100 @@ class Slur;
 class Staff;
 class Tie;
 
+//----------------------------------------------------------------------------
+// ABCTuneInfo
+//----------------------------------------------------------------------------
+
+/**
+ * The position and the main fields of a tune in an ABC collection.
+ * The offset and the length are in bytes and cover the tune from its X: line to the next one.
+ */
+struct ABCTuneInfo {
+    int m_referenceNumber = 0;
+    std::string m_title;
+    std::string m_key;
+    size_t m_offset = 0;
+    size_t m_length = 0;
+};
+
+//----------------------------------------------------------------------------
+// ABCCollection
+//----------------------------------------------------------------------------
+
+/**
+ * This class holds an ABC file with several tunes and an index of them.
+ * The index is built with a single pass over the data and without parsing the music code.
+ * It can be stored as JSON and be given back when the same data is loaded again.
+ * Tunes can then be imported one by one with ABCInput without going through the whole file.
+ */
+class ABCCollection {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    ABCCollection() = default;
+    virtual ~ABCCollection() = default;
+    ///@}
+
+    void Reset();
+
+    /**
+     * Set the data and build the index.
+     * If a JSON index is given, it is used if it matches the data. Otherwise the index is built again.
+     * Return false if no tune is found in the data.
+     */
+    bool Load(const std::string &data, const std::string &jsonIndex = "");
+
+    /**
+     * Return the index as a stringified JSON object.
+     */
+    std::string GetIndexAsJson() const;
+
+    /**
+     * @name Getters for the tunes
+     */
+    ///@{
+    int GetTuneCount() const { return (int)m_tunes.size(); }
+    const ABCTuneInfo *GetTune(int index) const;
+    ///@}
+
+    /**
+     * Return the position of the tune with the given X: reference number.
+     * Return -1 if not found.
+     */
+    int GetTuneIndex(int referenceNumber) const;
+
+    /**
+     * Return the ABC data of a single tune, i.e., the file header followed by the tune.
+     * Return an empty string if the index is out of range.
+     */
+    std::string GetTuneData(int index) const;
+
+private:
+    /**
+     * Build the index from m_data with a single pass.
+     */
+    void BuildIndex();
+
+    /**
+     * Restore the index from JSON. Return false if it does not match m_data.
+     */
+    bool ReadIndex(const std::string &jsonIndex);
+
+public:
+    //
+private:
+    /** The data of the whole collection */
+    std::string m_data;
+    /** The length of the file header, i.e., the data before the first tune */
+    size_t m_headerLength = 0;
+    /** The tunes in the order of the file */
+    std::vector<ABCTuneInfo> m_tunes;
+    /** The position of the tunes by reference number (the first one if not unique) */
+    std::map<int, int> m_referenceNumbers;
+};
+
 //----------------------------------------------------------------------------
 // ABCInput
 //----------------------------------------------------------------------------
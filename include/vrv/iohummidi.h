@@ -0,0 +1,104 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        iohummidi.h
+// Author:      Laurent Pugin
+// Created:     2023
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef __VRV_IOHUMMIDI_H__
+#define __VRV_IOHUMMIDI_H__
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+#ifndef NO_HUMDRUM_SUPPORT
+#include "humlib.h"
+#endif /* NO_HUMDRUM_SUPPORT */
+
+//----------------------------------------------------------------------------
+
+namespace smf {
+class MidiFile;
+}
+
+namespace vrv {
+
+#ifndef NO_HUMDRUM_SUPPORT
+
+//----------------------------------------------------------------------------
+// HumdrumMIDIConverter
+//----------------------------------------------------------------------------
+
+/**
+ * This class converts **kern data directly to MIDI.
+ * It walks the spines of the hum::HumdrumFile line by line and writes the notes to the smf::MidiFile
+ * without building a Doc. Tracks, tempo, key and time signatures, instruments and transpositions are the ones
+ * written by Doc::ExportMIDI when the same data is loaded by the HumdrumInput.
+ * Grace notes, expansion lists and Humdrum filters are not taken into account.
+ */
+class HumdrumMIDIConverter {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    HumdrumMIDIConverter();
+    virtual ~HumdrumMIDIConverter();
+    ///@}
+
+    /**
+     * Convert the Humdrum data and add the events to the MIDI file.
+     * The MIDI file is expected to be in absolute ticks.
+     * Return false if the data cannot be parsed or has no **kern spine.
+     */
+    bool Convert(const std::string &humdrumData, smf::MidiFile *midiFile);
+
+private:
+    /**
+     * Write the staff information (name, instrument, key and time signatures) from the interpretations before
+     * the first data line.
+     */
+    void ConvertStaffInfo(hum::HTp spineStart, int midiTrack);
+
+    /**
+     * Return the initial tempo (as in HumdrumInput::addMidiTempo).
+     */
+    double GetInitialTempo(hum::HumdrumFile &infile, hum::HTp spineStart);
+
+    /**
+     * Write the notes of a data token.
+     */
+    void ConvertDataToken(hum::HTp token, int midiTrack);
+
+    /**
+     * Write the notes with a tie still open at the end of the data.
+     */
+    void FlushTiedNotes();
+
+public:
+    //
+private:
+    /**
+     * A note being held by a tie.
+     */
+    struct TiedNote {
+        double m_startTime;
+        double m_stopTime;
+    };
+
+    smf::MidiFile *m_midiFile;
+    /** The semitone transposition per track */
+    std::map<int, int> m_transSemi;
+    /** The notes being held by a tie per track and pitch */
+    std::map<std::pair<int, int>, TiedNote> m_tiedNotes;
+};
+
+#endif /* NO_HUMDRUM_SUPPORT */
+
+} // namespace vrv
+
+#endif // __VRV_IOHUMMIDI_H__
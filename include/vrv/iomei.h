@@ -602,11 +602,28 @@ public:
     virtual ~MEIInput();
 
     bool Import(const std::string &mei) override;
+    bool ImportInPlace(std::string &mei) override;
 
 private:
+    /**
+     * Import the data, parsing it in place if inPlaceData (the same string as mei) is given and not streaming it
+     */
+    bool ImportData(const std::string &mei, std::string *inPlaceData);
+
     bool ReadDoc(pugi::xml_node root);
     bool ReadIncipits(pugi::xml_node root);
 
+    /**
+     * @name Methods for the streaming import
+     * The skeleton is the data with the measures replaced by chunk elements giving their offset and length.
+     * Extracting the chunks fails with page-based MEI or if the data cannot be scanned.
+     * The chunks are parsed and read one by one when they are reached.
+     */
+    ///@{
+    bool ExtractMeasureChunks(const std::string &mei, std::string &skeleton);
+    bool ReadMeasureChunk(Object *parent, pugi::xml_node chunk);
+    ///@}
+
     ///@{
     bool ReadMdiv(Object *parent, pugi::xml_node parentNode, bool isVisible);
     bool ReadMdivChildren(Object *parent, pugi::xml_node parentNode, bool isVisible);
@@ -929,6 +946,11 @@ private:
      */
     bool m_hasScoreDef;
 
+    /**
+     * The data being imported in streaming mode, NULL otherwise
+     */
+    const std::string *m_streamedData;
+
     /**
      * Check if an element is allowed within a given parent
      */
@@ -953,6 +975,11 @@ private:
      * A static array for storing the implemented editorial elements
      */
     static const std::vector<std::string> s_editorialElementNames;
+
+    /**
+     * The name of the chunk elements in the skeleton of the streaming import
+     */
+    static const std::string s_measureChunkName;
 };
 
 } // namespace vrv
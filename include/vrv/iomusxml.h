@@ -199,6 +199,7 @@ public:
 
 #ifndef NO_MUSICXML_SUPPORT
     bool Import(const std::string &musicxml) override;
+    bool ImportInPlace(std::string &musicxml) override;
 
 private:
     /*
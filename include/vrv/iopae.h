@@ -526,6 +526,12 @@ public:
      */
     void SetScoreBased(bool scoreBased) { m_scoreBased = scoreBased; }
 
+    /**
+     * Setter for the validation only flag (false by default).
+     * With it, the MEI header is not generated and the document is kept score-based.
+     */
+    void SetValidationOnly(bool validationOnly) { m_validationOnly = validationOnly; }
+
 #ifndef NO_PAE_SUPPORT
     bool Import(const std::string &input) override;
 
@@ -631,7 +637,7 @@ private:
      * to the one of the repetition marker (f or i).
      * We also need to clone all objects in the tokens
      */
-    void PrepareInsertion(int position, std::list<pae::Token> &insertion);
+    void PrepareInsertion(int position, std::vector<pae::Token> &insertion);
 
     /**
      * Check that the token list is a valid opening / closing tag successing.
@@ -678,7 +684,7 @@ public:
 
 private:
     /**
-     * The list of tokens representing the incipit
+     * The buffer of tokens representing the incipit
      * Each token is a characther that needs to be processed.
      * When processing the tokens, the token can be assigned an Object.
      * When processed, the token::m_char is set to 0.
@@ -688,8 +694,10 @@ private:
      * - closing tags are missing (in non-pendantic modes)
      * - opening tags are not part of the PAE syntax (e.g., a chord)
      * Each token also stores the original position in the PAE string.
+     * Tokens are stored contiguously. Insertions are rare and the token buffer is short, so this is faster than
+     * a linked list. It means that iterators and pointers to tokens must not be kept across insertions.
      */
-    std::list<pae::Token> m_pae;
+    std::vector<pae::Token> m_pae;
 
     /**
      * A flag indicating the incipit is mensural.
@@ -714,6 +722,11 @@ private:
      */
     bool m_scoreBased;
 
+    /**
+     * A flag indicating the input is only validated and the document will not be rendered.
+     */
+    bool m_validationOnly;
+
     /**
      * @name The scoreDef clef, keysig and timesig.
      * Mensur is used with mensural incipits (i.e., with clefs with a + second sign.
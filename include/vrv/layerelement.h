@@ -184,6 +184,16 @@ public:
     void CacheYRel(bool restore = false);
     ///@}
 
+    /**
+     * @name Get and set the cached X and Y relative positions (used by the persistent layout cache)
+     */
+    ///@{
+    int GetCachedXRel() const { return m_cachedXRel; }
+    void SetCachedXRel(int cachedXRel) { m_cachedXRel = cachedXRel; }
+    int GetCachedYRel() const { return m_cachedYRel; }
+    void SetCachedYRel(int cachedYRel) { m_cachedYRel = cachedYRel; }
+    ///@}
+
     /**
      * Adjust the m_drawingYRel for the element to be centered on the inner content of the measure
      */
@@ -0,0 +1,83 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        layoutcache.h
+// Author:      Laurent Pugin
+// Created:     2023
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef __VRV_LAYOUT_CACHE_H__
+#define __VRV_LAYOUT_CACHE_H__
+
+#include <string>
+#include <vector>
+
+namespace vrv {
+
+class Doc;
+class Page;
+
+//----------------------------------------------------------------------------
+// LayoutCache
+//----------------------------------------------------------------------------
+
+/**
+ * This class persists the cached horizontal layout of the cast-off in a cache directory (option layoutCacheDir).
+ * A file is keyed by a hash of the input data, of the options affecting the layout, of the selection, of the font
+ * and of the version. The file is validated before it is used, and any mismatch falls back to doing the layout.
+ * The cache is disabled when the input data has no hash, e.g., when the content has been edited.
+ */
+class LayoutCache {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    explicit LayoutCache(Doc *doc);
+    virtual ~LayoutCache() = default;
+    ///@}
+
+    /**
+     * Return true if the cache directory is set and the input data has a hash
+     */
+    bool IsEnabled() const { return !m_filename.empty(); }
+
+    /**
+     * Restore the cached horizontal layout of the page from the cache file.
+     * Reset the aligners of the page and set the cached values as done by Page::LayOutHorizontallyWithCache.
+     * Return false if the cache is disabled, or if the file is missing or does not match.
+     */
+    bool Load(Page *page);
+
+    /**
+     * Write the cached horizontal layout of the page to the cache file.
+     * The file is written to a temporary file first and then renamed.
+     */
+    bool Save(Page *page);
+
+    /**
+     * Return the 64-bit FNV-1a hash of the data as a hexadecimal string
+     */
+    static std::string Hash(const std::string &data);
+
+private:
+    /**
+     * Return the key for the current options, selection, font and version
+     */
+    std::string GetKey() const;
+
+public:
+    //
+private:
+    /** The version of the file format */
+    static constexpr int FORMAT_VERSION = 2;
+
+    /** The document */
+    Doc *m_doc;
+    /** The key of the document and the path of the cache file, empty when the cache is disabled */
+    std::string m_key;
+    std::string m_filename;
+};
+
+} // namespace vrv
+
+#endif // __VRV_LAYOUT_CACHE_H__
@@ -0,0 +1,156 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        logsink.h
+// Author:      Laurent Pugin
+// Created:     2023
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef __VRV_LOG_SINK_H__
+#define __VRV_LOG_SINK_H__
+
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+
+//----------------------------------------------------------------------------
+
+#include "toolkitdef.h"
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// LogSink
+//----------------------------------------------------------------------------
+
+/**
+ * This class buffers the log messages of a toolkit when logging to a buffer is enabled.
+ * Messages are de-duplicated with a hash set and the number of messages kept is limited. The duplicates and the
+ * messages beyond the limit are only counted.
+ * Messages are added to the sink that is current in the thread (see LogSinkScope). A sink can be shared by
+ * several threads working on the same document.
+ * Each sink has its own log level and logging to buffer flag. Until they are set, the defaults set with EnableLog
+ * and EnableLogToBuffer are used, which also apply to the messages logged without a current sink.
+ */
+class LogSink {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    LogSink();
+    virtual ~LogSink() = default;
+    LogSink(const LogSink &) = delete;
+    LogSink &operator=(const LogSink &) = delete;
+    ///@}
+
+    /**
+     * Add a message unless it is already in the sink or the limit is reached
+     */
+    void Add(const std::string &message);
+
+    /**
+     * Clear the messages and the counters
+     */
+    void Reset();
+
+    /**
+     * Return the messages concatenated, followed by a warning if messages were dropped
+     */
+    std::string GetLog() const;
+
+    /**
+     * @name Getters for the counters
+     */
+    ///@{
+    int GetMessageCount() const;
+    int GetDuplicateCount() const;
+    int GetDroppedCount() const;
+    ///@}
+
+    /**
+     * @name Getter and setter for the maximum number of messages kept
+     */
+    ///@{
+    int GetMaxMessages() const;
+    void SetMaxMessages(int maxMessages);
+    ///@}
+
+    /**
+     * @name Getter and setter for the sink used by the logging functions in the current thread
+     */
+    ///@{
+    static LogSink *GetCurrent() { return s_current; }
+    static void SetCurrent(LogSink *sink) { s_current = sink; }
+    ///@}
+
+    /**
+     * @name Getters and setters for the log level and the logging to buffer flag of the sink
+     */
+    ///@{
+    LogLevel GetLogLevel() const;
+    void SetLogLevel(LogLevel level) { m_logLevel = level; }
+    bool IsLoggingToBuffer() const;
+    void SetLoggingToBuffer(bool value) { m_loggingToBuffer = value; }
+    ///@}
+
+    /**
+     * @name Getters and setters for the defaults
+     */
+    ///@{
+    static LogLevel GetDefaultLogLevel() { return s_defaultLogLevel; }
+    static void SetDefaultLogLevel(LogLevel level) { s_defaultLogLevel = level; }
+    static bool IsDefaultLoggingToBuffer() { return s_defaultLoggingToBuffer; }
+    static void SetDefaultLoggingToBuffer(bool value) { s_defaultLoggingToBuffer = value; }
+    ///@}
+
+private:
+    /** The default maximum number of messages kept */
+    static constexpr int MAX_MESSAGES = 1000;
+
+    /** The mutex protecting the content */
+    mutable std::mutex m_mutex;
+    /** The messages in the order they were added - a deque keeps the strings in place for the index */
+    std::deque<std::string> m_messages;
+    /** The index of the messages */
+    std::unordered_set<std::string_view> m_index;
+    /** The length of the concatenated messages */
+    std::size_t m_length;
+    /** The counters */
+    int m_duplicateCount;
+    int m_droppedCount;
+    int m_maxMessages;
+    /** The log level and the logging to buffer flag (-1 until set) */
+    std::atomic<int> m_logLevel;
+    std::atomic<int> m_loggingToBuffer;
+
+    /** The current sink in the thread */
+    static thread_local LogSink *s_current;
+    /** The defaults - warning level and output to stderr or JS console */
+    static std::atomic<LogLevel> s_defaultLogLevel;
+    static std::atomic<bool> s_defaultLoggingToBuffer;
+};
+
+//----------------------------------------------------------------------------
+// LogSinkScope
+//----------------------------------------------------------------------------
+
+/**
+ * This class sets the current log sink for the lifetime of the instance and restores the previous one.
+ */
+class LogSinkScope {
+public:
+    explicit LogSinkScope(LogSink *sink) : m_previous(LogSink::GetCurrent()) { LogSink::SetCurrent(sink); }
+    ~LogSinkScope() { LogSink::SetCurrent(m_previous); }
+    LogSinkScope(const LogSinkScope &) = delete;
+    LogSinkScope &operator=(const LogSinkScope &) = delete;
+
+private:
+    LogSink *m_previous;
+};
+
+} // namespace vrv
+
+#endif // __VRV_LOG_SINK_H__
@@ -109,6 +109,7 @@ public:
     void SetDrawingXRel(int drawingXRel);
     void CacheXRel(bool restore = false);
     int GetCachedXRel() const { return m_cachedXRel; }
+    void SetCachedXRel(int cachedXRel) { m_cachedXRel = cachedXRel; }
     void ResetCachedXRel() { m_cachedXRel = VRV_UNSET; }
     ///@}
 
@@ -218,11 +219,13 @@ public:
     int GetInnerCenterX() const;
 
     /**
-     * Return and reset the cached width / overflow
+     * Return, set and reset the cached width / overflow
      */
     ///@{
     int GetCachedWidth() const { return m_cachedWidth; }
     int GetCachedOverflow() const { return m_cachedOverflow; }
+    void SetCachedWidth(int cachedWidth) { m_cachedWidth = cachedWidth; }
+    void SetCachedOverflow(int cachedOverflow) { m_cachedOverflow = cachedOverflow; }
     void ResetCachedWidth() { m_cachedWidth = VRV_UNSET; }
     void ResetCachedOverflow() { m_cachedOverflow = VRV_UNSET; }
     ///@}
@@ -248,6 +251,12 @@ public:
     void ResetDrawingScoreDef();
     ///@}
 
+    /**
+     * Move the drawing scoreDef to a measure without one and keep a copy of it.
+     * The staves pointing to it (e.g., in the following measures) remain valid when this measure is reset.
+     */
+    void MoveDrawingScoreDefTo(Measure *measure);
+
     /**
      * @name Setter and getter of the drawing ending
      */
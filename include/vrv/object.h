@@ -8,17 +8,24 @@
 #ifndef __VRV_OBJECT_H__
 #define __VRV_OBJECT_H__
 
+#include <atomic>
+#include <bitset>
+#include <cassert>
+#include <climits>
 #include <cstdlib>
 #include <functional>
 #include <iterator>
 #include <map>
+#include <memory>
 #include <string>
+#include <vector>
 
 //----------------------------------------------------------------------------
 
 #include "attclasses.h"
 #include "attmodule.h"
 #include "boundingbox.h"
+#include "objectarena.h"
 #include "vrvdef.h"
 
 namespace vrv {
@@ -36,6 +43,7 @@ class Functor;
 class ConstFunctor;
 class LinkingInterface;
 class FacsimileInterface;
+class Interface;
 class PitchInterface;
 class PositionInterface;
 class Resources;
@@ -50,6 +58,92 @@ class Zone;
 #define FORWARD true
 #define BACKWARD false
 
+//----------------------------------------------------------------------------
+// ObjectTraits
+//----------------------------------------------------------------------------
+
+/**
+ * This class stores the MEI att classes and the interfaces implemented by an object.
+ * All the objects of a class register the same att classes and interfaces in the same order. The lists are
+ * therefore interned in a tree (with one root per ClassId) in which each registration leads to a shared instance,
+ * and each object only keeps a pointer to it. The instance reached at the end of the construction is specific to
+ * the class. Each registration also gives the offset of the att class base, resolved statically by the class
+ * registering it, which makes it possible to reach the bases without RTTI.
+ * Instances are never deleted.
+ */
+class ObjectTraits {
+public:
+    /**
+     * Return the shared instance without att class and interface for a ClassId
+     */
+    static const ObjectTraits *GetRoot(ClassId classId);
+
+    /**
+     * @name Return the shared instance with the att class or the interface (and its att classes) added.
+     */
+    ///@{
+    const ObjectTraits *WithAttClass(AttClassId attClassId, int offset) const;
+    const ObjectTraits *WithInterface(
+        const std::vector<std::pair<AttClassId, int>> *attClasses, InterfaceId interfaceId, int offset) const;
+    ///@}
+
+    /**
+     * @name Getters and checkers
+     */
+    ///@{
+    const std::vector<AttClassId> &GetAttClasses() const { return m_attClasses; }
+    bool HasAttClass(AttClassId attClassId) const { return m_attClassSet.test(attClassId); }
+    const std::vector<InterfaceId> &GetInterfaces() const { return m_interfaces; }
+    bool HasInterface(InterfaceId interfaceId) const { return (m_interfaceMask & (1u << interfaceId)); }
+    ///@}
+
+    /**
+     * Return the offset of an att class base from the Object base.
+     * Return NO_OFFSET if the att class is registered with different bases (i.e., an ambiguous base).
+     * The att class must be registered.
+     */
+    int GetAttOffset(AttClassId attClassId) const
+    {
+        assert(this->HasAttClass(attClassId));
+        const int *offsets = m_attOffsetTable.load(std::memory_order_acquire);
+        if (!offsets) offsets = this->CreateAttOffsetTable();
+        return offsets[attClassId];
+    }
+
+private:
+    ObjectTraits();
+
+    /**
+     * Return the instance following this one for the registration key, creating it if necessary
+     */
+    const ObjectTraits *GetNext(
+        int key, const std::vector<std::pair<AttClassId, int>> &attClasses, InterfaceId interfaceId, int offset) const;
+
+    /**
+     * Create the table of the offsets indexed by AttClassId on the first lookup
+     */
+    const int *CreateAttOffsetTable() const;
+
+public:
+    /** The value for att classes registered with different bases */
+    static constexpr int NO_OFFSET = INT_MAX;
+
+private:
+    /** The att classes in the order of registration */
+    std::vector<AttClassId> m_attClasses;
+    /** The offsets of the att class bases in the order of registration */
+    std::vector<int> m_attOffsets;
+    /** The interfaces in the order of registration */
+    std::vector<InterfaceId> m_interfaces;
+    /** The att classes and the interfaces as sets for constant time checks */
+    std::bitset<ATT_CLASS_max> m_attClassSet;
+    uint32_t m_interfaceMask;
+    /** The offsets of the att class bases indexed by AttClassId, created on the first lookup */
+    mutable std::atomic<const int *> m_attOffsetTable;
+    /** The instances following this one by registration key */
+    mutable std::map<int, const ObjectTraits *> m_next;
+};
+
 //----------------------------------------------------------------------------
 // Object
 //----------------------------------------------------------------------------
@@ -112,18 +206,32 @@ public:
 
     /**
      * @name Methods for registering a MEI att class and for registering interfaces regrouping MEI att classes.
+     * They are called from the constructor of the class with the att class or the interface as a template
+     * argument, e.g., this->RegisterAttClass<AttColor>(ATT_COLOR, this), so the offset of the base is resolved
+     * statically. GetAtt returns the att class base of the object (or NULL) and is to be used instead of a
+     * dynamic_cast.
      */
     ///@{
-    void RegisterAttClass(AttClassId attClassId) { m_attClasses.push_back(attClassId); }
-    bool HasAttClass(AttClassId attClassId) const
+    template <class ATT, class ELEMENT> void RegisterAttClass(AttClassId attClassId, ELEMENT *element)
     {
-        return std::find(m_attClasses.begin(), m_attClasses.end(), attClassId) != m_attClasses.end();
+        const int offset
+            = (int)(reinterpret_cast<char *>(static_cast<ATT *>(element)) - reinterpret_cast<char *>(this));
+        m_traits = m_traits->WithAttClass(attClassId, offset);
     }
-    void RegisterInterface(std::vector<AttClassId> *attClasses, InterfaceId interfaceId);
-    bool HasInterface(InterfaceId interfaceId) const
+    bool HasAttClass(AttClassId attClassId) const { return m_traits->HasAttClass(attClassId); }
+    template <class ATT> ATT *GetAtt(AttClassId attClassId);
+    template <class ATT> const ATT *GetAtt(AttClassId attClassId) const
     {
-        return std::find(m_interfaces.begin(), m_interfaces.end(), interfaceId) != m_interfaces.end();
+        return const_cast<Object *>(this)->GetAtt<ATT>(attClassId);
     }
+    template <class INTERFACE, class ELEMENT> void RegisterInterface(ELEMENT *element)
+    {
+        INTERFACE *interface = static_cast<INTERFACE *>(element);
+        const int offset
+            = (int)(reinterpret_cast<char *>(static_cast<Interface *>(interface)) - reinterpret_cast<char *>(this));
+        m_traits = m_traits->WithInterface(interface->GetAttClasses(), interface->INTERFACE::IsInterface(), offset);
+    }
+    bool HasInterface(InterfaceId interfaceId) const { return m_traits->HasInterface(interfaceId); }
     ///@}
 
     /**
@@ -186,6 +294,14 @@ public:
      */
     Object &operator=(const Object &object);
 
+    /**
+     * @name Allocation of the objects in the current ObjectArena (usually the one of the Doc being loaded)
+     */
+    ///@{
+    static void *operator new(std::size_t size) { return ObjectArena::New(size); }
+    static void operator delete(void *ptr) { ObjectArena::Delete(ptr); }
+    ///@}
+
     /**
      * Move all the children of the object passed as parameter to this one.
      * Objects must be of the same type.
@@ -242,20 +358,32 @@ public:
      */
     virtual void CloneReset();
 
-    const std::string &GetID() const { return m_id; }
-    void SetID(const std::string &id) { m_id = id; }
+    /**
+     * Methods for getting and setting the id.
+     * The generated id is only formatted when accessed for the first time.
+     * HasID compares an id without formatting it.
+     */
+    ///@{
+    const std::string &GetID() const
+    {
+        if (m_idState.load(std::memory_order_acquire) != ID_FORMATTED) this->FormatID();
+        return m_id;
+    }
+    void SetID(const std::string &id);
+    bool HasID(const std::string &id) const;
     void SwapID(Object *other);
     void ResetID();
+    ///@}
 
     /**
      * Methods for setting / getting comments
      */
-    std::string GetComment() const { return m_comment; }
-    void SetComment(std::string comment) { m_comment = comment; }
-    bool HasComment() { return !m_comment.empty(); }
-    std::string GetClosingComment() const { return m_closingComment; }
-    void SetClosingComment(std::string endComment) { m_closingComment = endComment; }
-    bool HasClosingComment() { return !m_closingComment.empty(); }
+    std::string GetComment() const { return (m_comments) ? m_comments->first : ""; }
+    void SetComment(std::string comment);
+    bool HasComment() { return (m_comments && !m_comments->first.empty()); }
+    std::string GetClosingComment() const { return (m_comments) ? m_comments->second : ""; }
+    void SetClosingComment(std::string endComment);
+    bool HasClosingComment() { return (m_comments && !m_comments->second.empty()); }
 
     /**
      * @name Children count, with or without a ClassId.
@@ -680,9 +808,21 @@ public:
 private:
     /**
      * Method for generating the id.
+     * Only the number is reserved, the string is formatted by FormatID when accessed.
      */
     void GenerateID();
 
+    /**
+     * The states of the id, with the generated id formatted only once
+     */
+    enum IdState : uint8_t { ID_GENERATED = 0, ID_FORMATTING, ID_FORMATTED };
+
+    /**
+     * Format the generated id from its number and the class prefix.
+     * The state is set atomically per object, so concurrent calls only wait for each other on the same object.
+     */
+    void FormatID() const;
+
     /**
      * Initialisation method taking the class id and a id prefix argument.
      */
@@ -719,31 +859,26 @@ private:
     Object *m_parent;
 
     /**
-     * The class id representing the actual (derived) class
+     * The MEI att classes and the interfaces implemented, shared by all the objects of the class
      */
-    ClassId m_classId;
+    const ObjectTraits *m_traits;
 
     /**
-     * Members for storing / generating ids
+     * Strings for storing a comments attached to the object when printing an MEI element.
+     * The first one is to be printed immediately before the element, the second one before the closing tag of
+     * the element. They are allocated only when set.
      */
-    ///@{
-    std::string m_id;
-    std::string m_classIdStr;
-    ///@}
+    std::unique_ptr<std::pair<std::string, std::string>> m_comments;
 
     /**
-     * A reference object do not own children.
-     * Destructor will not delete them.
+     * The id of the object.
+     * Generated ids are kept as a number in m_idNumber until m_id is formatted.
      */
-    bool m_isReferenceObject;
-
-    /**
-     * Indicates whether the object content is up-to-date or not.
-     * This is useful for object using sub-lists of objects when drawing.
-     * For example, Beam has a list of children notes and this value indicates if the
-     * list needs to be updated or not. Is is mostly an optimization feature.
-     */
-    mutable bool m_isModified;
+    ///@{
+    mutable std::string m_id;
+    uint32_t m_idNumber;
+    mutable std::atomic<uint8_t> m_idState;
+    ///@}
 
     /**
      * Members used for caching iterator values.
@@ -756,23 +891,28 @@ private:
     ///@}
 
     /**
-     * A vector for storing the list of AttClassId (MEI att classes) implemented.
+     * The class id representing the actual (derived) class
      */
-    std::vector<AttClassId> m_attClasses;
+    ClassId m_classId;
 
     /**
-     * A vector for storing the list of InterfaceId (group of MEI att classes) implemented.
+     * The first character of the class id string, used as prefix when generating ids
      */
-    std::vector<InterfaceId> m_interfaces;
+    char m_classIdPrefix;
 
     /**
-     * String for storing a comments attached to the object when printing an MEI element.
-     * m_comment is to be printed immediately before the element
-     * m_closingComment is to be printed before the closing tag of the element
+     * A reference object do not own children.
+     * Destructor will not delete them.
      */
-    std::string m_comment;
-    std::string m_closingComment;
-    ///@}
+    bool m_isReferenceObject;
+
+    /**
+     * Indicates whether the object content is up-to-date or not.
+     * This is useful for object using sub-lists of objects when drawing.
+     * For example, Beam has a list of children notes and this value indicates if the
+     * list needs to be updated or not. Is is mostly an optimization feature.
+     */
+    mutable bool m_isModified;
 
     /**
      * A flag indicating if the Object represents an attribute in the original MEI.
@@ -800,6 +940,19 @@ private:
     static thread_local uint32_t s_xmlIDCounter;
 };
 
+template <class ATT> ATT *Object::GetAtt(AttClassId attClassId)
+{
+    if (!m_traits->HasAttClass(attClassId)) return NULL;
+
+    const int offset = m_traits->GetAttOffset(attClassId);
+    if (offset == ObjectTraits::NO_OFFSET) return NULL;
+    ATT *att = reinterpret_cast<ATT *>(reinterpret_cast<char *>(this) + offset);
+#ifdef VRV_DYNAMIC_CAST
+    assert(att == dynamic_cast<ATT *>(this));
+#endif
+    return att;
+}
+
 //----------------------------------------------------------------------------
 // ObjectListInterface
 //----------------------------------------------------------------------------
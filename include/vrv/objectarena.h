@@ -0,0 +1,131 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        objectarena.h
+// Author:      Laurent Pugin
+// Created:     2023
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef __VRV_OBJECT_ARENA_H__
+#define __VRV_OBJECT_ARENA_H__
+
+#include <cstddef>
+#include <vector>
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// ObjectArena
+//----------------------------------------------------------------------------
+
+/**
+ * This class is a pool allocator for the objects of a Doc tree.
+ * Memory is taken from large chunks and the blocks are kept in free lists per size class when the objects are
+ * deleted. Chunks are freed all at once when the arena has been released and all its objects deleted.
+ * Each block starts with a header pointing to its arena, which means an object can outlive the scope in which
+ * it was created. Objects created when no arena is current are allocated on the heap.
+ * An arena is not thread-safe and its objects have to be created and deleted by one thread at a time.
+ */
+class ObjectArena {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    ObjectArena();
+    ObjectArena(const ObjectArena &) = delete;
+    ObjectArena &operator=(const ObjectArena &) = delete;
+    ///@}
+
+    /**
+     * Allocate a block from the current arena (or from the heap if none)
+     */
+    static void *New(std::size_t size);
+
+    /**
+     * Free a block allocated with ObjectArena::New
+     */
+    static void Delete(void *ptr);
+
+    /**
+     * @name Getter and setter for the arena used by ObjectArena::New in the current thread
+     */
+    ///@{
+    static ObjectArena *GetCurrent() { return s_current; }
+    static void SetCurrent(ObjectArena *arena) { s_current = arena; }
+    ///@}
+
+    /**
+     * Mark the arena as released by its owner.
+     * The arena is deleted immediately if no object is alive, or when its last object is deleted.
+     */
+    void Release();
+
+    /**
+     * @name Getters for the number of objects alive and the memory reserved
+     */
+    ///@{
+    std::size_t GetLiveCount() const { return m_liveCount; }
+    std::size_t GetReservedSize() const { return m_chunks.size() * CHUNK_SIZE; }
+    ///@}
+
+private:
+    /**
+     * The header preceding each block, with the arena (NULL for the heap) and the size class
+     */
+    struct BlockHeader;
+
+    ~ObjectArena();
+
+    void *Allocate(std::size_t sizeClass);
+    void Free(void *block, std::size_t sizeClass);
+
+public:
+    //
+private:
+    /** The size of the chunks */
+    static constexpr std::size_t CHUNK_SIZE = 256 * 1024;
+    /** The granularity of the size classes, which is also the size of the block header */
+    static constexpr std::size_t GRANULE = 16;
+    /** The number of size classes - larger blocks are allocated on the heap */
+    static constexpr std::size_t SIZE_CLASSES = 512;
+
+    /** The chunks owned by the arena */
+    std::vector<char *> m_chunks;
+    /** The position and the end of the free space in the last chunk */
+    char *m_chunkPos;
+    char *m_chunkEnd;
+    /** The heads of the free lists per size class */
+    std::vector<void *> m_freeLists;
+    /** The number of blocks currently allocated */
+    std::size_t m_liveCount;
+    /** A flag indicating that the owner released the arena */
+    bool m_released;
+
+    /** The current arena in the thread */
+    static thread_local ObjectArena *s_current;
+};
+
+//----------------------------------------------------------------------------
+// ObjectArenaScope
+//----------------------------------------------------------------------------
+
+/**
+ * This class sets the current arena for the lifetime of the instance and restores the previous one.
+ */
+class ObjectArenaScope {
+public:
+    explicit ObjectArenaScope(ObjectArena *arena) : m_previous(ObjectArena::GetCurrent())
+    {
+        ObjectArena::SetCurrent(arena);
+    }
+    ~ObjectArenaScope() { ObjectArena::SetCurrent(m_previous); }
+    ObjectArenaScope(const ObjectArenaScope &) = delete;
+    ObjectArenaScope &operator=(const ObjectArenaScope &) = delete;
+
+private:
+    ObjectArena *m_previous;
+};
+
+} // namespace vrv
+
+#endif // __VRV_OBJECT_ARENA_H__
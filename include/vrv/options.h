@@ -88,6 +88,13 @@ enum option_SMUFLTEXTFONT { SMUFLTEXTFONT_embedded = 0, SMUFLTEXTFONT_linked, SM
 
 enum class OptionsCategory { None, Base, General, Layout, Margins, Midi, Selectors, Full };
 
+/**
+ * The stages of the pipeline invalidated by a change of an option, from the cheapest to the most expensive to redo.
+ * Drawing is for options used only when rendering or writing the output.
+ * Data is for options used only when the data is loaded, which need the data to be loaded again to take effect.
+ */
+enum class OptionStage { Drawing = 0, VerticalLayout, CastOff, HorizontalLayout, Data };
+
 /**
  * This class is a base class of each styling parameter
  */
@@ -98,6 +105,7 @@ public:
     {
         m_shortOption = 0;
         m_isCmdOnly = false;
+        m_stage = OptionStage::HorizontalLayout;
     }
     virtual ~Option() {}
     virtual void CopyTo(Option *option) = 0;
@@ -123,6 +131,12 @@ public:
     char GetShortOption() const { return m_shortOption; }
     bool IsCmdOnly() const { return m_isCmdOnly; }
 
+    /**
+     * The stage invalidated by a change of the option - the horizontal layout by default
+     */
+    void SetStage(OptionStage stage) { m_stage = stage; }
+    OptionStage GetStage() const { return m_stage; }
+
     /**
      * Return a JSON object for the option
      */
@@ -156,6 +170,8 @@ private:
     char m_shortOption;
     /* a flag indicating that the option is available only on the command line */
     bool m_isCmdOnly;
+    /* the stage invalidated by a change of the option */
+    OptionStage m_stage;
 };
 
 //----------------------------------------------------------------------------
@@ -595,6 +611,7 @@ public:
     OptionBool m_standardOutput;
     OptionBool m_help;
     OptionBool m_allPages;
+    OptionBool m_allTunes;
     OptionString m_inputFrom;
     OptionString m_logLevel;
     OptionString m_outfile;
@@ -618,14 +635,18 @@ public:
     OptionBool m_condenseFirstPage;
     OptionBool m_condenseNotLastSystem;
     OptionBool m_condenseTempoPages;
+    OptionBool m_dataOnly;
     OptionBool m_evenNoteSpacing;
     OptionString m_expand;
     OptionIntMap m_footer;
     OptionIntMap m_header;
     OptionBool m_humType;
     OptionBool m_incip;
+    OptionBool m_incipitMode;
     OptionBool m_justifyVertically;
     OptionBool m_landscape;
+    OptionString m_layoutCacheDir;
+    OptionInt m_layoutThreads;
     OptionBool m_ligatureAsBracket;
     OptionBool m_mensuralToMeasure;
     OptionDbl m_minLastJustification;
@@ -645,18 +666,22 @@ public:
     OptionInt m_pageWidth;
     OptionIntMap m_pedalStyle;
     OptionBool m_preserveAnalyticalMarkup;
+    OptionBool m_profile;
     OptionBool m_removeIds;
     OptionBool m_scaleToPageSize;
     OptionBool m_showRuntime;
     OptionBool m_shrinkToFit;
     OptionIntMap m_smuflTextFont;
     OptionBool m_staccatoCenter;
+    OptionBool m_streamingImport;
     OptionBool m_svgBoundingBoxes;
     OptionString m_svgCss;
     OptionBool m_svgViewBox;
     OptionBool m_svgHtml5;
     OptionBool m_svgFormatRaw;
     OptionBool m_svgRemoveXlink;
+    OptionBool m_svgGlyphSprite;
+    OptionString m_svgGlyphSpriteUrl;
     OptionArray m_svgAdditionalAttribute;
     OptionDbl m_unit;
     OptionBool m_useFacsimile;
@@ -125,6 +125,12 @@ public:
      */
     void JustifyVertically();
 
+    /**
+     * Reset and set the horizontal alignment of the content in time only.
+     * No graphical layout is done, but this is enough for calculating the timemap.
+     */
+    void AlignDurations();
+
     /**
      * Reset and set the horizontal and vertical alignment
      */
@@ -165,6 +171,12 @@ public:
     ///@}
 
 private:
+    /**
+     * Adjust the horizontal position of the layer elements measure by measure.
+     * The measures are processed in parallel according to the layoutThreads option.
+     */
+    void AdjustHorizontallyByMeasure(Doc *doc);
+
     /**
      * Adjust the horizontal position of the syl processing verse by verse
      */
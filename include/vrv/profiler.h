@@ -0,0 +1,231 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        profiler.h
+// Author:      Laurent Pugin
+// Created:     2023
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef __VRV_PROFILER_H__
+#define __VRV_PROFILER_H__
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// ProfilerCategory
+//----------------------------------------------------------------------------
+
+/**
+ * The categories of the events recorded by the profiler
+ */
+enum ProfilerCategory {
+    PROFILER_TOOLKIT = 0,
+    PROFILER_IMPORT,
+    PROFILER_STAGE,
+    PROFILER_FUNCTOR,
+    PROFILER_DRAWING,
+    PROFILER_EXPORT
+};
+
+//----------------------------------------------------------------------------
+// Profiler
+//----------------------------------------------------------------------------
+
+/**
+ * This class records the time spent in the processing stages, functors, device contexts, importers and exporters.
+ * The events are aggregated by category and name, with the number of objects visited for the functors, and are also
+ * kept individually (up to a limit) for producing a trace in the Chrome trace event format.
+ * The events are recorded on the profiler that is current in the thread (see ProfilerScope). When there is no
+ * current profiler, a ProfilerEvent does nothing beyond a check of the current profiler.
+ */
+class Profiler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    Profiler();
+    virtual ~Profiler() = default;
+    Profiler(const Profiler &) = delete;
+    Profiler &operator=(const Profiler &) = delete;
+    ///@}
+
+    /**
+     * Clear the events recorded
+     */
+    void Reset();
+
+    /**
+     * Record an event with the name given either as a string or as a type
+     */
+    void AddEvent(ProfilerCategory category, const char *name, const std::type_info *type, Clock::time_point start,
+        Clock::time_point end, int visits);
+
+    /**
+     * Return the events aggregated by category and name as a JSON string, sorted by total time
+     */
+    std::string GetReport() const;
+
+    /**
+     * Return the events in the Chrome trace event format as a JSON string
+     */
+    std::string GetTrace() const;
+
+    /**
+     * @name Getter and setter for the profiler recording the events in the current thread
+     */
+    ///@{
+    static Profiler *GetCurrent() { return s_current; }
+    static void SetCurrent(Profiler *profiler) { s_current = profiler; }
+    ///@}
+
+    /**
+     * Return the name of a type without namespace
+     */
+    static std::string GetTypeName(const std::type_info &type);
+
+    /**
+     * Return the name of a category
+     */
+    static std::string CategoryToStr(ProfilerCategory category);
+
+private:
+    /**
+     * Return the index of the entry for the category and the name, creating it if necessary
+     */
+    int GetEntryIndex(ProfilerCategory category, const std::string &name);
+
+public:
+    //
+private:
+    /** The maximum number of events kept for the trace */
+    static constexpr int MAX_EVENTS = 100000;
+
+    /**
+     * The aggregation of the events with the same category and name
+     */
+    struct Entry {
+        ProfilerCategory m_category;
+        std::string m_name;
+        int m_count = 0;
+        long long m_visits = 0;
+        // In microseconds
+        long long m_total = 0;
+        long long m_max = 0;
+    };
+
+    /**
+     * An event kept for the trace
+     */
+    struct Event {
+        int m_entry;
+        int m_thread;
+        int m_visits;
+        // In microseconds from the start of the profiler
+        long long m_start;
+        long long m_duration;
+    };
+
+    /** The mutex protecting the content */
+    mutable std::mutex m_mutex;
+    /** The time point at which the profiler was started or reset */
+    Clock::time_point m_start;
+    /** The entries and their index by category and name */
+    std::vector<Entry> m_entries;
+    std::map<std::pair<ProfilerCategory, std::string>, int> m_entryIndex;
+    /** The events kept for the trace and the number of events not kept */
+    std::vector<Event> m_events;
+    int m_droppedEvents;
+    /** A sequential number for each thread with events */
+    std::map<std::thread::id, int> m_threads;
+    /** The cached names of the types */
+    std::unordered_map<std::type_index, std::string> m_typeNames;
+
+    /** The current profiler in the thread */
+    static thread_local Profiler *s_current;
+};
+
+//----------------------------------------------------------------------------
+// ProfilerEvent
+//----------------------------------------------------------------------------
+
+/**
+ * This class records an event on the current profiler (if any) for the lifetime of the instance.
+ * The name is either a string literal or a type (e.g., of the functor) that is resolved only when recording.
+ */
+class ProfilerEvent {
+public:
+    ProfilerEvent(ProfilerCategory category, const char *name) : ProfilerEvent(category, name, NULL) {}
+    ProfilerEvent(ProfilerCategory category, const std::type_info &type) : ProfilerEvent(category, NULL, &type) {}
+    ~ProfilerEvent()
+    {
+        if (m_profiler) m_profiler->AddEvent(m_category, m_name, m_type, m_start, Profiler::Clock::now(), m_visits);
+    }
+    ProfilerEvent(const ProfilerEvent &) = delete;
+    ProfilerEvent &operator=(const ProfilerEvent &) = delete;
+
+    /**
+     * Set the number of objects visited during the event
+     */
+    void SetVisits(int visits) { m_visits = visits; }
+
+private:
+    ProfilerEvent(ProfilerCategory category, const char *name, const std::type_info *type)
+        : m_profiler(Profiler::GetCurrent()), m_category(category), m_name(name), m_type(type), m_visits(0)
+    {
+        if (m_profiler) m_start = Profiler::Clock::now();
+    }
+
+    Profiler *m_profiler;
+    ProfilerCategory m_category;
+    const char *m_name;
+    const std::type_info *m_type;
+    Profiler::Clock::time_point m_start;
+    int m_visits;
+};
+
+//----------------------------------------------------------------------------
+// ProfilerScope
+//----------------------------------------------------------------------------
+
+/**
+ * This class sets the current profiler for the lifetime of the instance and restores the previous one.
+ * It also records an event for the scope (typically a toolkit method) on the profiler.
+ * Passing NULL disables the profiling within the scope.
+ */
+class ProfilerScope {
+public:
+    ProfilerScope(Profiler *profiler, const char *name) : m_previous(Swap(profiler)), m_event(PROFILER_TOOLKIT, name)
+    {
+    }
+    ~ProfilerScope() { Profiler::SetCurrent(m_previous); }
+    ProfilerScope(const ProfilerScope &) = delete;
+    ProfilerScope &operator=(const ProfilerScope &) = delete;
+
+private:
+    /** Set the current profiler before the event is created and return the previous one */
+    static Profiler *Swap(Profiler *profiler)
+    {
+        Profiler *previous = Profiler::GetCurrent();
+        Profiler::SetCurrent(profiler);
+        return previous;
+    }
+
+    Profiler *m_previous;
+    ProfilerEvent m_event;
+};
+
+} // namespace vrv
+
+#endif // __VRV_PROFILER_H__
@@ -0,0 +1,101 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        scoredefchanges.h
+// Author:      Laurent Pugin
+// Created:     2023
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef __VRV_SCOREDEF_CHANGES_H__
+#define __VRV_SCOREDEF_CHANGES_H__
+
+#include <map>
+#include <set>
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+#include "vrvdef.h"
+
+namespace vrv {
+
+class Layer;
+class LayerElement;
+class Measure;
+class Staff;
+
+//----------------------------------------------------------------------------
+// ScoreDefChanges
+//----------------------------------------------------------------------------
+
+/**
+ * This class records by measure the content looked at when setting and optimizing the current scoreDef.
+ * This includes the clefs, key signatures and mensurs changing the scoreDef within the layers and the invisible
+ * staves. It also includes the staves with a clef or with a note, and the fermatas and tempi for the optimization.
+ * It is filled by a full ScoreDefSetCurrentFunctor pass and makes it possible to propagate the scoreDef again
+ * (e.g., after a change of the breaks) without processing the content of the layers.
+ * It needs to be reset whenever the content of the measures changes.
+ */
+class ScoreDefChanges {
+public:
+    /**
+     * The content recorded for a measure
+     */
+    struct MeasureChanges {
+        /** The clefs, key signatures and mensurs by layer in the order of the tree */
+        std::map<const Layer *, std::vector<LayerElement *>> m_layerElements;
+        /** The invisible staves of the measure */
+        ListOfObjects m_invisibleStaves;
+        /** The staves with a clef and the staves with a note */
+        std::set<const Staff *> m_stavesWithClef;
+        std::set<const Staff *> m_stavesWithNote;
+        /** Flags indicating that the measure has a fermata or a tempo */
+        bool m_hasFermata = false;
+        bool m_hasTempo = false;
+    };
+
+    /**
+     * @name Constructors, destructors
+     */
+    ///@{
+    ScoreDefChanges();
+    virtual ~ScoreDefChanges() = default;
+    ///@}
+
+    /**
+     * Clear the content and mark the recording as incomplete
+     */
+    void Reset();
+
+    /**
+     * @name Getter and setter for the flag indicating that all the measures of the document have been recorded
+     */
+    ///@{
+    bool IsComplete() const { return m_isComplete; }
+    void SetComplete() { m_isComplete = true; }
+    ///@}
+
+    /**
+     * Add a measure to be recorded and return its (empty) content
+     */
+    MeasureChanges *AddMeasure(const Measure *measure);
+
+    /**
+     * Return the content recorded for a measure.
+     * Return NULL if the recording is not complete or if the measure was not recorded.
+     */
+    const MeasureChanges *GetMeasureChanges(const Measure *measure) const;
+
+private:
+    //
+public:
+    //
+private:
+    /** The content recorded by measure */
+    std::map<const Measure *, MeasureChanges> m_measures;
+    /** A flag indicating that the recording is complete */
+    bool m_isComplete;
+};
+
+} // namespace vrv
+
+#endif // __VRV_SCOREDEF_CHANGES_H__
@@ -9,6 +9,7 @@
 #define __VRV_SETSCOREDEFFUNCTOR_H__
 
 #include "functor.h"
+#include "scoredefchanges.h"
 
 namespace vrv {
 
@@ -108,6 +109,8 @@ private:
  * This class sets the current scoreDef wherever needed.
  * This includes a scoreDef for each system. It also includes a scoreDef for each measure where a change occured before.
  * A change can be either a scoreDef before or a clef, meterSig, etc. within the previous measure.
+ * The content of the measures is recorded in the ScoreDefChanges of the document the first time. Once recorded, the
+ * content of the layers is not processed anymore.
  */
 class ScoreDefSetCurrentFunctor : public DocFunctor {
 public:
@@ -134,7 +137,16 @@ public:
 protected:
     //
 private:
-    //
+    /**
+     * Change the upcoming scoreDef for a clef, a key signature or a mensur within a layer
+     */
+    void SetUpcomingValues(LayerElement *element);
+
+    /**
+     * Record the content of the current measure when it is processed for the first time
+     */
+    void RecordMeasureContent(Object *object);
+
 public:
     //
 private:
@@ -156,6 +168,12 @@ private:
     bool m_restart;
     // Flag indicating if we already have a measure in the system
     bool m_hasMeasure;
+    // The invisible staves of the previous measure
+    ListOfObjects m_previousInvisibleStaves;
+    // The content of the current measure being recorded (NULL if none)
+    ScoreDefChanges::MeasureChanges *m_recordedMeasure;
+    // The content of the current measure already recorded (NULL if none)
+    const ScoreDefChanges::MeasureChanges *m_measureChanges;
 };
 
 //----------------------------------------------------------------------------
@@ -210,6 +228,8 @@ private:
     bool m_hasFermata;
     // Flag indicating if a Tempo element is present
     bool m_hasTempo;
+    // The content recorded for the current measure (if any)
+    const ScoreDefChanges::MeasureChanges *m_measureChanges;
 };
 
 //----------------------------------------------------------------------------
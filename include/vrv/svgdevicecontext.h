@@ -246,6 +246,49 @@ public:
      */
     void SetSmuflTextFont(option_SMUFLTEXTFONT smuflTextFont) { m_smuflTextFont = smuflTextFont; }
 
+    /**
+     * Setting m_glyphSprite flag (false by default).
+     * In sprite mode, the glyphs are not included as <defs> but referenced with stable IDs (e.g., "Leipzig-E0A4")
+     * from a shared sprite, optionally located at the given URL.
+     */
+    void SetGlyphSprite(bool glyphSprite, const std::string &spriteUrl = "")
+    {
+        m_glyphSprite = glyphSprite;
+        m_glyphSpriteUrl = spriteUrl;
+    }
+
+    /**
+     * @name Getter and setter for the postfix of the glyph IDs.
+     * The postfix is generated for each device context but can be set for keeping the glyph IDs stable between
+     * renderings.
+     */
+    ///@{
+    const std::string &GetGlyphPostfixId() const { return m_glyphPostfixId; }
+    void SetGlyphPostfixId(const std::string &glyphPostfixId) { m_glyphPostfixId = glyphPostfixId; }
+    ///@}
+
+    /**
+     * Return the root <svg> node.
+     * The SVG is complete only once committed with GetStringSVG.
+     */
+    pugi::xml_node GetSvgNode() const { return m_svgNode; }
+
+    /**
+     * Return the glyphs used so far
+     */
+    const std::set<const Glyph *> &GetSmuflGlyphs() const { return m_smuflGlyphs; }
+
+    /**
+     * Return the code points of the glyphs used so far when referencing a glyph sprite
+     */
+    const std::set<char32_t> &GetSmuflGlyphCodes() const { return m_smuflGlyphCodes; }
+
+    /**
+     * Return a standalone SVG with the glyphs as <symbol> elements in <defs>.
+     * The IDs are the ones used in sprite mode.
+     */
+    std::string GetStringGlyphSprite(const std::set<const Glyph *> &glyphs);
+
 private:
     /**
      * Copy the content of a file to the output stream.
@@ -278,6 +321,17 @@ private:
      */
     void IncludeTextFont(const std::string &fontname, const Resources *resources);
 
+    /**
+     * Return the ID of the glyph <symbol>.
+     * In sprite mode it is qualified by the font name, otherwise by the postfix unique to the SVG.
+     */
+    std::string GetGlyphId(const Glyph *glyph);
+
+    /**
+     * Load the glyphs from their XML files and append them to the <defs>
+     */
+    void AppendGlyphDefs(pugi::xml_node defs, const std::set<const Glyph *> &glyphs);
+
     /**
      * Flush the data to the internal buffer.
      * Adds the xml tag if necessary and the <defs> from m_smuflGlyphs
@@ -326,6 +380,8 @@ private:
     // holds the list of glyphs from the smufl font used so far
     // they will be added at the end of the file as <defs>
     std::set<const Glyph *> m_smuflGlyphs;
+    // the code points of the glyphs used with a glyph sprite
+    std::set<char32_t> m_smuflGlyphCodes;
 
     // pugixml data
     pugi::xml_document m_svgDoc;
@@ -355,6 +411,10 @@ private:
     int m_indent;
     // prefix to be added to font glyphs
     std::string m_glyphPostfixId;
+    // reference the glyphs from a shared sprite instead of including them
+    bool m_glyphSprite;
+    // URL of the sprite (empty for a sprite in the same document)
+    std::string m_glyphSpriteUrl;
     // embedding of the smufl text font
     option_SMUFLTEXTFONT m_smuflTextFont;
 };
@@ -0,0 +1,136 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        svgpatch.h
+// Author:      Laurent Pugin
+// Created:     2023
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef __VRV_SVG_PATCH_H__
+#define __VRV_SVG_PATCH_H__
+
+#include <map>
+#include <string>
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+#include "pugixml.hpp"
+
+namespace vrv {
+
+class SvgDeviceContext;
+
+//----------------------------------------------------------------------------
+// SvgPatch
+//----------------------------------------------------------------------------
+
+/**
+ * This class keeps the state of the SVG pages rendered for producing patches of the groups that changed since the
+ * last rendering of a page.
+ * The state of a page is a hash of the system groups and of their measure groups, and a hash of the content outside
+ * the systems (page frame, running elements, number of systems) that requires a full page when changed.
+ * Because the systems are re-created by the layout, they are matched by position and the IDs of the system groups
+ * are the ones of the last rendering sent.
+ * The postfix of the glyph IDs is kept for each page so the IDs remain stable between renderings.
+ */
+class SvgPatch {
+public:
+    /**
+     * @name Constructors, destructors
+     */
+    ///@{
+    SvgPatch() = default;
+    virtual ~SvgPatch() = default;
+    ///@}
+
+    /**
+     * Clear the state of all the pages
+     */
+    void Reset() { m_pages.clear(); }
+
+    /**
+     * Clear the state of a page, for example when it was rendered without a patch
+     */
+    void ResetPage(int pageNo) { m_pages.erase(pageNo); }
+
+    /**
+     * Set the glyph postfix of the page on the device context.
+     * To be called before rendering the page.
+     */
+    void InitDeviceContext(int pageNo, SvgDeviceContext &svg) const;
+
+    /**
+     * Compare the page rendered and committed in the device context with the state of the page, update the state and
+     * return the patch as a JSON string.
+     * The full SVG is included in the patch when the page was not rendered before or when the content outside the
+     * systems changed.
+     */
+    std::string MakePatch(int pageNo, SvgDeviceContext &svg);
+
+private:
+    /**
+     * Return the hash of the node and its children combined into the seed, optionally ignoring the IDs
+     */
+    static std::size_t HashNode(pugi::xml_node node, bool ignoreIds, std::size_t seed);
+
+    /**
+     * Return the serialization of the node without formatting
+     */
+    static std::string PrintNode(pugi::xml_node node);
+
+    /**
+     * Return the hash of the attributes of the node (without its children) combined into the seed
+     */
+    static std::size_t HashAttributes(pugi::xml_node node, std::size_t seed, bool ignoreIds);
+
+    /**
+     * Return the ID of a group (or its data-id in HTML5 mode), or an empty string
+     */
+    static std::string GetGroupId(pugi::xml_node node);
+
+    /**
+     * Check if the first token of the class of a group is the given one
+     */
+    static bool HasBaseClass(pugi::xml_node node, const std::string &baseClass);
+
+    /**
+     * Combine a hash value into a seed
+     */
+    static std::size_t Combine(std::size_t seed, std::size_t value);
+
+public:
+    //
+private:
+    /**
+     * The state of a system group
+     */
+    struct SystemState {
+        // The ID of the system group as last sent
+        std::string m_id;
+        // The hash of the full system group
+        std::size_t m_hash = 0;
+        // The hash of the system group without its measure groups
+        std::size_t m_frameHash = 0;
+        // The hash of the measure groups by ID
+        std::map<std::string, std::size_t> m_measureHashes;
+    };
+
+    /**
+     * The state of a page
+     */
+    struct PageState {
+        std::string m_glyphPostfixId;
+        // The hash of everything outside the systems
+        std::size_t m_frameHash = 0;
+        // The hash of the glyph definitions
+        std::size_t m_defsHash = 0;
+        std::vector<SystemState> m_systems;
+    };
+
+    /** The state by page number */
+    std::map<int, PageState> m_pages;
+};
+
+} // namespace vrv
+
+#endif // __VRV_SVG_PATCH_H__
@@ -19,6 +19,8 @@ namespace vrv {
 class SystemMilestoneEnd;
 class DeviceContext;
 class Ending;
+class FindSpannedLayerElementsFunctor;
+class LayerElementIndex;
 class Measure;
 class ScoreDef;
 class Slur;
@@ -116,6 +118,17 @@ public:
      */
     bool HasMixedDrawingStemDir(const LayerElement *start, const LayerElement *end) const;
 
+    /**
+     * Find the spanned layer elements using the index of the layer elements of the system.
+     * The index is built on the first call with the current horizontal positions, i.e., when calculating the slur
+     * directions in Page::ResetAligners. It is reset with the vertical alignment and built again with the final
+     * positions for the vertical layout.
+     */
+    ///@{
+    void FindSpannedLayerElements(FindSpannedLayerElementsFunctor &findSpannedLayerElements) const;
+    void ResetLayerElementIndex();
+    ///@}
+
     /**
      * Get preferred curve direction based on the starting and ending point of the slur
      */
@@ -238,6 +251,11 @@ private:
      */
     ScoreDef *m_drawingScoreDef;
 
+    /**
+     * The index of the layer elements by staff and horizontal position, built on demand.
+     */
+    mutable LayerElementIndex *m_layerElementIndex;
+
     /**
      * A flag indicating if the system is optimized.
      * This does not mean that a staff is hidden, but only that it can be optimized.
@@ -0,0 +1,115 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        threadpool.h
+// Author:      Laurent Pugin
+// Created:     2023
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef __VRV_THREAD_POOL_H__
+#define __VRV_THREAD_POOL_H__
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace vrv {
+
+class LogSink;
+class Profiler;
+
+//----------------------------------------------------------------------------
+// ThreadPool
+//----------------------------------------------------------------------------
+
+/**
+ * This class runs indexed tasks on a set of threads.
+ * The tasks are distributed in contiguous ranges, one per thread, and a thread that has finished its range steals the
+ * tasks from the end of the range of another thread.
+ * The calling thread takes part in the work and the log sink and the profiler of the calling thread are made current
+ * in the worker threads. Objects created in the tasks are not allocated in the arena of the calling thread.
+ */
+class ThreadPool {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     * The number of threads includes the calling thread.
+     */
+    ///@{
+    explicit ThreadPool(int threadCount);
+    virtual ~ThreadPool();
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+    ///@}
+
+    /**
+     * Return the number of threads, including the calling thread
+     */
+    int GetThreadCount() const { return (int)m_threads.size() + 1; }
+
+    /**
+     * Run the task for each index from 0 to taskCount - 1 and return when all of them are done.
+     * The tasks can be run in any order and have to be independent from each other.
+     */
+    void Run(int taskCount, const std::function<void(int)> &task);
+
+    /**
+     * Return the number of threads for the value of an option, 0 meaning the number of hardware threads
+     */
+    static int GetThreadCount(int option);
+
+private:
+    /**
+     * The loop of a worker thread
+     */
+    void WorkerLoop(int worker);
+
+    /**
+     * Run the tasks of the range of the worker and then the ones stolen from the other ranges
+     */
+    void Work(int worker);
+
+    /**
+     * Take the next task from the beginning of the range of the worker, or from the end of another range.
+     * Return false when no task is left.
+     */
+    bool TakeTask(int worker, int &task);
+
+public:
+    //
+private:
+    /**
+     * A range of task indexes
+     */
+    struct Range {
+        std::mutex m_mutex;
+        int m_begin = 0;
+        int m_end = 0;
+    };
+
+    /** The worker threads */
+    std::vector<std::thread> m_threads;
+    /** The range of each thread, the first one being the one of the calling thread */
+    std::vector<std::unique_ptr<Range>> m_ranges;
+
+    /** The synchronization of the runs */
+    std::mutex m_mutex;
+    std::condition_variable m_startCondition;
+    std::condition_variable m_doneCondition;
+    /** The number of the current run, the number of workers still running it, and the stop flag */
+    int m_run;
+    int m_pendingWorkers;
+    bool m_stop;
+
+    /** The task of the current run */
+    const std::function<void(int)> *m_task;
+    /** The log sink and the profiler of the calling thread */
+    LogSink *m_logSink;
+    Profiler *m_profiler;
+};
+
+} // namespace vrv
+
+#endif // __VRV_THREAD_POOL_H__
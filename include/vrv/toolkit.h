@@ -8,12 +8,16 @@
 #ifndef __VRV_TOOLKIT_H__
 #define __VRV_TOOLKIT_H__
 
+#include <map>
+#include <set>
 #include <string>
 
 //----------------------------------------------------------------------------
 
 #include "doc.h"
 #include "docselection.h"
+#include "logsink.h"
+#include "profiler.h"
 #include "toolkitdef.h"
 #include "view.h"
 
@@ -21,8 +25,12 @@
 
 namespace vrv {
 
+class ABCCollection;
 class EditorToolkit;
+class FeatureIndex;
 class RuntimeClock;
+class SvgDeviceContext;
+class SvgPatch;
 
 /**
  * @defgroup nodoc Public methods that are not listed in the documentation
@@ -96,6 +104,49 @@ public:
      */
     std::string GetLog();
 
+    /**
+     * Set the log level for the toolkit.
+     *
+     * This applies only to the messages of this toolkit instead of the level set with the global enableLog.
+     *
+     * @param level The log level (see the LOG_* constants)
+     */
+    void EnableLog(LogLevel level);
+
+    /**
+     * Enable or disable logging to the buffer of the toolkit.
+     *
+     * This applies only to this toolkit instead of the value set with the global enableLogToBuffer.
+     *
+     * @param value True for logging to the buffer returned by getLog
+     */
+    void EnableLogToBuffer(bool value);
+
+    /**
+     * Get the profiling report of the operations since the last reset.
+     *
+     * The time spent in the toolkit methods, the processing stages, the functors (with the number of objects
+     * visited), the drawing by device context, and the import and export is recorded when the profile option is set.
+     * The entries are aggregated by category and name and sorted by total time.
+     *
+     * @return The report as a JSON string with the times in milliseconds
+     */
+    std::string GetProfilingReport() const;
+
+    /**
+     * Get the events recorded since the last reset in the Chrome trace event format.
+     *
+     * The output can be loaded in a trace viewer (e.g., chrome://tracing or Perfetto) for a flame graph.
+     *
+     * @return The trace as a JSON string
+     */
+    std::string GetProfilingTrace() const;
+
+    /**
+     * Reset the profiling report and trace.
+     */
+    void ResetProfiling();
+
     /**
      * Return the version number.
      *
@@ -144,6 +195,17 @@ public:
      */
     bool LoadData(const std::string &data);
 
+    /**
+     * Load a buffer of bytes with the type previously specified in the options.
+     *
+     * The data does not need to be null-terminated. It is copied once and parsed in place.
+     *
+     * @param data A buffer with the data (e.g., MEI data) to be loaded
+     * @param length The size of the data buffer
+     * @return True if the data was successfully loaded
+     */
+    bool LoadDataBuffer(const char *data, int length);
+
     /**
      * Load a MusicXML compressed file passed as base64 encoded string.
      *
@@ -161,6 +223,37 @@ public:
      */
     bool LoadZipDataBuffer(const unsigned char *data, int length);
 
+    /**
+     * Load an ABC file with several tunes and index them without importing them.
+     *
+     * The index is built with a single pass over the data. It can be retrieved with
+     * Toolkit::GetABCCollectionIndex and be passed back when the same data is loaded again.
+     * Tunes are then loaded one by one with Toolkit::LoadABCTune.
+     *
+     * @param data A string with the ABC data
+     * @param jsonIndex A stringified JSON object with a previously retrieved index (optional)
+     * @return True if at least one tune was found in the data
+     */
+    bool LoadABCCollection(const std::string &data, const std::string &jsonIndex = "");
+
+    /**
+     * Return the index of the ABC collection previously loaded.
+     *
+     * The index lists the tunes with their reference number (n), title, key, offset and length.
+     *
+     * @return A stringified JSON object with the index
+     */
+    std::string GetABCCollectionIndex() const;
+
+    /**
+     * Load one tune of the ABC collection previously loaded.
+     *
+     * @param tune The position of the tune in the collection (0-based) or its X: reference number
+     * @param byReferenceNumber True if the tune is given by its reference number
+     * @return True if the tune was successfully loaded
+     */
+    bool LoadABCTune(int tune, bool byReferenceNumber = false);
+
     /**
      * Validate the Plaine & Easie code from a file.
      *
@@ -297,6 +390,8 @@ public:
      * The selection will be applied only when some data is loaded or the layout is redone.
      * The selection can be reset (cancelled) by passing an empty string or an empty JSON object.
      * A selection across multiple mdivs is not possible.
+     * With "excerpt": true, only the selected measures are laid out and the cached horizontal layout
+     * is kept when the layout is redone without resetting the cache.
      *
      * @param selection The selection as a stringified JSON object
      * @return True if the selection was successfully parsed or reset
@@ -368,6 +463,40 @@ public:
      */
     bool RenderToSVGFile(const std::string &filename, int pageNo = 1);
 
+    /**
+     * Render a page to SVG and return only the groups that changed since the last rendering of the page.
+     *
+     * The patch is a JSON object with the page number, the viewBox of the page and a full flag.
+     * When the page was not rendered as patch before, or when the content outside the systems changed, the full
+     * SVG is given in svg. Otherwise, the system or measure groups that changed are given in groups by ID,
+     * and the glyph definitions in defs when new glyphs are used.
+     * Rendering the page with renderToSVG resets the patch state of the page.
+     *
+     * @param pageNo The page to render (1-based)
+     * @return A stringified JSON object with the patch
+     */
+    std::string RenderToSVGPatch(int pageNo = 1);
+
+    /**
+     * Render the glyphs referenced by the SVG pages rendered with --svg-glyph-sprite to a standalone SVG sprite.
+     *
+     * The glyphs are the ones of all the pages rendered since the font was last changed.
+     * The sprite can be inlined once in a HTML page or stored at the URL given with --svg-glyph-sprite-url.
+     *
+     * @return The SVG sprite as a string
+     */
+    std::string RenderToGlyphSprite();
+
+    /**
+     * Render the glyphs referenced by the SVG pages in sprite mode and save them to the file.
+     *
+     * @remark nojs
+     *
+     * @param filename The output filename
+     * @return True if the file was successfully written
+     */
+    bool RenderToGlyphSpriteFile(const std::string &filename);
+
     /**
      * Render the document to MIDI.
      *
@@ -474,6 +603,9 @@ public:
     /**
      * Convert Humdrum data to MIDI.
      *
+     * The **kern spines are converted directly without loading the data into the toolkit.
+     * Grace notes, expansion lists and Humdrum filters are ignored.
+     *
      * @return The MIDI file as a base64-encoded string
      */
     std::string ConvertHumdrumToMIDI(const std::string &humdrumData);
@@ -537,6 +669,48 @@ public:
      */
     std::string GetDescriptiveFeatures(const std::string &jsonOptions);
 
+    /**
+     * Build an index of the melodic n-grams of a set of files for incipit and melody search.
+     *
+     * The files are loaded in parallel without layout, and the chromatic and diatonic intervals and the refined
+     * contour of their descriptive features are indexed. The index replaces the one previously built or loaded.
+     * Files that cannot be loaded are skipped. The IDs generated for notes without one are reproducible only with the
+     * xmlIdSeed option.
+     *
+     * @remark nojs
+     *
+     * @param jsonOptions A stringified JSON object with the files to index (files), the length of the n-grams
+     * (ngramLength, from 2 to 8, 4 by default), the number of threads (threads, 0 for the number of hardware threads)
+     * and the file to which the index is written (output, optional)
+     * @return True if at least one file was indexed and the index was written
+     */
+    bool BuildFeatureIndex(const std::string &jsonOptions);
+
+    /**
+     * Load an index written by Toolkit::BuildFeatureIndex.
+     *
+     * @remark nojs
+     *
+     * @param filename The index filename
+     * @return True if the index was successfully read
+     */
+    bool LoadFeatureIndex(const std::string &filename);
+
+    /**
+     * Search a melodic pattern in the feature index built or loaded.
+     *
+     * The pattern is given with one of intervalsChromatic, intervalsDiatonic (arrays of intervals) or
+     * intervalRefinedContour (an array or a string, e.g., "uuD"), and the number of matches returned with limit (100
+     * by default, 0 for all of them).
+     *
+     * @remark nojs
+     *
+     * @param jsonQuery A stringified JSON object with the pattern
+     * @return A stringified JSON object with the total number of matches (count) and the matches, each with the
+     * document, the position of its first pitch and the IDs of the notes
+     */
+    std::string QueryFeatureIndex(const std::string &jsonQuery);
+
     /**
      * Return array of IDs of elements being currently played.
      *
@@ -624,12 +798,41 @@ public:
      *
      * This can be called once the rendering option were changed, for example with a new page (sceen) height or a new
      * zoom level.
+     * Only the stages invalidated by the options changed since the last layout are redone. The document is cast-off
+     * again from the cached horizontal layout when only the page or the vertical layout options changed, and nothing
+     * is redone when only drawing options changed.
      *
      * @param jsonOptions A stringified JSON object with the action options
-     * resetCache: true or false; true by default;
+     * resetCache: true or false; given explicitly, the layout is fully redone and the horizontal layout cache is reset
+     * accordingly;
      */
     void RedoLayout(const std::string &jsonOptions = "");
 
+    /**
+     * Cast off the loaded data for several page widths.
+     *
+     * The horizontal layout is done only once and each width is cast off from it. The breaks are kept for switching
+     * to one of the widths with Toolkit::SwitchLayoutWidth without casting off the content again. The document
+     * remains laid out for the current page width.
+     * Only automatic and smart breaks depend on the page width.
+     *
+     * @param jsonWidths A stringified JSON array with the page widths
+     * @return A stringified JSON array with, for each width, the page count and the IDs of the first measure of each
+     * system and of each page
+     */
+    std::string RedoLayoutForWidths(const std::string &jsonWidths);
+
+    /**
+     * Switch to one of the page widths for which the data was cast off with Toolkit::RedoLayoutForWidths.
+     *
+     * The page width option is changed and the document is cast off with the breaks kept for the width. The data is
+     * cast off again for all the widths when other options changed or the content was edited in the meantime.
+     *
+     * @param pageWidth The page width
+     * @return True if the data was cast off for the page width with Toolkit::RedoLayoutForWidths
+     */
+    bool SwitchLayoutWidth(int pageWidth);
+
     /**
      * Redo the layout of the pitch postitions of the current drawing page.
      *
@@ -757,19 +960,42 @@ protected:
     void PrintOptionUsageOutput(const vrv::Option *option, std::ostream &output) const;
 
     /**
-     * Resets the vrv::logBuffer.
+     * Resets the log sink of the toolkit.
      */
     void ResetLogBuffer();
 
+    /**
+     * Return the profiler of the toolkit if the profile option is set, NULL otherwise.
+     */
+    Profiler *GetActiveProfiler() { return (m_options->m_profile.GetValue()) ? &m_profiler : NULL; }
+
 private:
+    /**
+     * Make the log sink and the profiler of the toolkit the current ones for the duration of a toolkit method.
+     */
+    class MethodScope {
+    public:
+        MethodScope(Toolkit *toolkit, const char *name);
+        MethodScope(const MethodScope &) = delete;
+        MethodScope &operator=(const MethodScope &) = delete;
+
+    private:
+        LogSinkScope m_logSinkScope;
+        ProfilerScope m_profilerScope;
+    };
+
     bool SetFont(const std::string &fontName);
-    bool IsUTF16(const std::string &filename);
-    bool LoadUTF16File(const std::string &filename);
-    bool IsZip(const std::string &filename);
-    bool LoadZipFile(const std::string &filename);
-    bool LoadZipData(const std::vector<unsigned char> &bytes);
+    bool ReadFile(const std::string &filename, std::string &content);
+    bool LoadUTF16Data(const std::string &content);
+    bool LoadZipData(const unsigned char *data, size_t size);
     void GetClassIds(const std::vector<std::string> &classStrings, std::vector<ClassId> &classIds);
 
+    /**
+     * Load the data, parsing it in place when the content is owned by the caller and passed as inPlaceData.
+     * In that case, inPlaceData is the same string as data and its content is undefined afterwards.
+     */
+    bool LoadData(const std::string &data, std::string *inPlaceData);
+
     /**
      * Return a dictionary of all the options
      *
@@ -778,6 +1004,26 @@ private:
      */
     std::string GetOptions(bool defaultValues) const;
 
+    /**
+     * Set the SVG options on the device context and render the page into it
+     */
+    void RenderToSvgDeviceContext(int pageNo, SvgDeviceContext &svg);
+
+    /**
+     * Store the option values with which the layout was done and the stage to redo in any case
+     */
+    void StoreLayoutOptions(OptionStage invalidatedStage);
+
+    /**
+     * Return the most expensive stage invalidated since the layout was done with the option values given
+     */
+    OptionStage GetInvalidatedStage(const std::map<std::string, std::string> &optionValues) const;
+
+    /**
+     * Cast off the document according to the breaks option
+     */
+    void CastOffDoc();
+
 public:
     //
 private:
@@ -796,16 +1042,40 @@ private:
 
     EditorToolkit *m_editorToolkit;
 
+    /** The ABC collection loaded with LoadABCCollection */
+    ABCCollection *m_abcCollection;
+
+    /** The feature index built with BuildFeatureIndex or loaded with LoadFeatureIndex */
+    FeatureIndex *m_featureIndex;
+
+    /** The log messages of the toolkit when logging to a buffer */
+    LogSink m_logSink;
+
+    /** The events recorded when the profile option is set */
+    Profiler m_profiler;
+
+    /** The glyphs referenced by the SVG pages rendered in glyph sprite mode */
+    std::set<char32_t> m_glyphSpriteCodes;
+
+    /** The state of the pages rendered with RenderToSVGPatch */
+    SvgPatch *m_svgPatch;
+
+    /** The option values with which the layout was done, empty if it has to be fully redone */
+    std::map<std::string, std::string> m_layoutOptionValues;
+    /** The stage invalidated since the layout was done by something else than an option change */
+    OptionStage m_invalidatedStage;
+
+    /** The breaks for the page widths of RedoLayoutForWidths and the option values they were found with */
+    std::map<int, CastOffBreaks> m_widthBreaks;
+    std::map<std::string, std::string> m_widthOptionValues;
+
 #ifndef NO_RUNTIME
     /** Measuring runtime */
     RuntimeClock *m_runtimeClock;
 #endif
 
-    //----------------//
-    // Static members //
-    //----------------//
-
-    static char *m_humdrumBuffer;
+    /** The Humdrum buffer - it is owned by each toolkit since toolkits can be used from several threads */
+    char *m_humdrumBuffer;
 };
 
 } // namespace vrv
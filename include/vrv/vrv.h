@@ -40,11 +40,10 @@ void LogInfo(const char *fmt, ...);
 void LogWarning(const char *fmt, ...);
 
 /**
- * Member and functions specific to logging that uses a vector of string to buffer the logs.
+ * Output a log message.
+ * When the current LogSink of the thread logs to a buffer, the message is added to it, otherwise it is output directly.
  */
-extern std::vector<std::string> logBuffer;
-bool LogBufferContains(const std::string &s);
-void LogString(std::string message, LogLevel level);
+void LogString(const std::string &message, LogLevel level);
 
 /**
  * Convert a string to a logLevel
@@ -121,12 +120,6 @@ std::string FromCamelCase(const std::string &s);
  */
 std::string ToCamelCase(const std::string &s);
 
-/**
- *
- */
-extern LogLevel logLevel;
-extern bool loggingToBuffer;
-
 /**
  * Functions for logging in milliseconds the elapsed time of an
  * operation (for debugging purposes).
@@ -19,6 +19,8 @@
 
 namespace vrv {
 
+class ZoneIndex;
+
 //----------------------------------------------------------------------------
 // Zone
 //----------------------------------------------------------------------------
@@ -34,6 +36,7 @@ public:
      */
     ///@{
     Zone();
+    Zone(const Zone &zone);
     virtual ~Zone();
     Object *Clone() const override { return new Zone(*this); }
     void Reset() override;
@@ -43,10 +46,20 @@ public:
     int GetLogicalUly() const;
     int GetLogicalLry() const;
 
+    /**
+     * @name Setter and getter for the index the zone is registered in (if any).
+     * The index is updated when the zone is shifted or deleted.
+     */
+    ///@{
+    void SetZoneIndex(ZoneIndex *zoneIndex) { m_zoneIndex = zoneIndex; }
+    ZoneIndex *GetZoneIndex() const { return m_zoneIndex; }
+    ///@}
+
 protected:
     //
 private:
-    //
+    /** The index the zone is registered in */
+    ZoneIndex *m_zoneIndex;
 };
 
 } // namespace vrv
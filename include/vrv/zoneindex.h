@@ -0,0 +1,154 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        zoneindex.h
+// Author:      Laurent Pugin
+// Created:     2023
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#ifndef __VRV_ZONE_INDEX_H__
+#define __VRV_ZONE_INDEX_H__
+
+#include <map>
+#include <vector>
+
+//----------------------------------------------------------------------------
+
+#include "vrvdef.h"
+
+namespace vrv {
+
+class Object;
+class Zone;
+class ZoneIndexNode;
+
+//----------------------------------------------------------------------------
+// ZoneRect
+//----------------------------------------------------------------------------
+
+/**
+ * A simple axis-aligned rectangle in facsimile coordinates.
+ */
+struct ZoneRect {
+    int m_ulx = 0;
+    int m_uly = 0;
+    int m_lrx = 0;
+    int m_lry = 0;
+};
+
+//----------------------------------------------------------------------------
+// ZoneIndexEntry
+//----------------------------------------------------------------------------
+
+/**
+ * An entry in the ZoneIndex, i.e., a zone with the object pointing to it.
+ */
+class ZoneIndexEntry {
+public:
+    Zone *m_zone = NULL;
+    Object *m_owner = NULL;
+    ZoneRect m_rect;
+    bool m_isRotated = false;
+    /** The insertion order, used for keeping query results deterministic */
+    int m_order = 0;
+    /** The leaf node holding the entry */
+    ZoneIndexNode *m_leaf = NULL;
+};
+
+//----------------------------------------------------------------------------
+// ZoneIndex
+//----------------------------------------------------------------------------
+
+/**
+ * This class is an R-tree over the zones attached to objects through their FacsimileInterface.
+ * It is used by the neume editor for nearest-staff queries without scanning and sorting the staves of the document.
+ * A point within a zone is at a distance of 0, so the staff containing a point is the closest one.
+ * Zones hold a back-pointer to the index they are registered in, so moving (Zone::ShiftByXY) and deleting
+ * a zone keep the index up-to-date. Other changes to the zone coordinates need a call to ZoneIndex::Update.
+ */
+class ZoneIndex {
+public:
+    /**
+     * @name Constructors, destructors, and other standard methods
+     */
+    ///@{
+    ZoneIndex();
+    virtual ~ZoneIndex();
+    ZoneIndex(const ZoneIndex &) = delete;
+    ZoneIndex &operator=(const ZoneIndex &) = delete;
+    ///@}
+
+    /**
+     * Remove all entries and mark the index as not built.
+     */
+    void Reset();
+
+    /**
+     * Build the index with all the objects with a zone in the subtree.
+     * Objects are added in document order.
+     */
+    void Build(Object *root);
+
+    /**
+     * Return true if the index was built and not reset since then.
+     */
+    bool IsBuilt() const { return m_isBuilt; }
+
+    /**
+     * @name Add, remove or update an entry.
+     * Update adds the zone if not already in the index.
+     */
+    ///@{
+    void Insert(Zone *zone, Object *owner);
+    void Remove(Zone *zone);
+    void Update(Zone *zone, Object *owner);
+    ///@}
+
+    /**
+     * Add or update all the objects with a zone in the subtree (including the root).
+     */
+    void UpdateSubtree(Object *root);
+
+    /**
+     * Return the object of the given classId with the zone closest to the point.
+     * The distance takes the rotation of the zone into account.
+     * Return NULL if no object of this type is in the index.
+     */
+    Object *FindClosest(ClassId classId, int x, int y) const;
+
+    /**
+     * Return the number of zones in the index.
+     */
+    int GetSize() const { return (int)m_entries.size(); }
+
+    /**
+     * The distance between a point and a (possibly rotated) zone.
+     */
+    static int GetDistance(const Zone *zone, int x, int y);
+
+private:
+    /**
+     * Add the entry to the tree and split the nodes if necessary.
+     */
+    void InsertEntry(ZoneIndexEntry *entry);
+
+    /**
+     * Split an overfull node and propagate the split upwards.
+     */
+    void SplitNode(ZoneIndexNode *node);
+
+public:
+    //
+private:
+    /** The root node of the R-tree */
+    ZoneIndexNode *m_root;
+    /** The entries by zone */
+    std::map<const Zone *, ZoneIndexEntry *> m_entries;
+    /** The counter for the insertion order */
+    int m_order;
+    /** The flag indicating that the index was built */
+    bool m_isBuilt;
+};
+
+} // namespace vrv
+
+#endif
@@ -33,7 +33,7 @@ namespace vrv {
 bool AttModule::SetMei(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_NOTATIONTYPE)) {
-        AttNotationType *att = dynamic_cast<AttNotationType *>(element);
+        AttNotationType *att = element->GetAtt<AttNotationType>(ATT_NOTATIONTYPE);
         assert(att);
         if (attrType == "notationtype") {
             att->SetNotationtype(att->StrToNotationtype(attrValue));
@@ -51,7 +51,7 @@ bool AttModule::SetMei(Object *element, const std::string &attrType, const std::
 void AttModule::GetMei(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_NOTATIONTYPE)) {
-        const AttNotationType *att = dynamic_cast<const AttNotationType *>(element);
+        const AttNotationType *att = element->GetAtt<AttNotationType>(ATT_NOTATIONTYPE);
         assert(att);
         if (att->HasNotationtype()) {
             attributes->push_back({ "notationtype", att->NotationtypeToStr(att->GetNotationtype()) });
@@ -75,7 +75,7 @@ namespace vrv {
 bool AttModule::SetAnalytical(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_HARMANL)) {
-        AttHarmAnl *att = dynamic_cast<AttHarmAnl *>(element);
+        AttHarmAnl *att = element->GetAtt<AttHarmAnl>(ATT_HARMANL);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToHarmAnlForm(attrValue));
@@ -83,7 +83,7 @@ bool AttModule::SetAnalytical(Object *element, const std::string &attrType, cons
         }
     }
     if (element->HasAttClass(ATT_HARMONICFUNCTION)) {
-        AttHarmonicFunction *att = dynamic_cast<AttHarmonicFunction *>(element);
+        AttHarmonicFunction *att = element->GetAtt<AttHarmonicFunction>(ATT_HARMONICFUNCTION);
         assert(att);
         if (attrType == "deg") {
             att->SetDeg(att->StrToStr(attrValue));
@@ -91,7 +91,7 @@ bool AttModule::SetAnalytical(Object *element, const std::string &attrType, cons
         }
     }
     if (element->HasAttClass(ATT_INTERVALHARMONIC)) {
-        AttIntervalHarmonic *att = dynamic_cast<AttIntervalHarmonic *>(element);
+        AttIntervalHarmonic *att = element->GetAtt<AttIntervalHarmonic>(ATT_INTERVALHARMONIC);
         assert(att);
         if (attrType == "inth") {
             att->SetInth(att->StrToStr(attrValue));
@@ -99,7 +99,7 @@ bool AttModule::SetAnalytical(Object *element, const std::string &attrType, cons
         }
     }
     if (element->HasAttClass(ATT_INTERVALMELODIC)) {
-        AttIntervalMelodic *att = dynamic_cast<AttIntervalMelodic *>(element);
+        AttIntervalMelodic *att = element->GetAtt<AttIntervalMelodic>(ATT_INTERVALMELODIC);
         assert(att);
         if (attrType == "intm") {
             att->SetIntm(att->StrToStr(attrValue));
@@ -107,7 +107,7 @@ bool AttModule::SetAnalytical(Object *element, const std::string &attrType, cons
         }
     }
     if (element->HasAttClass(ATT_KEYSIGANL)) {
-        AttKeySigAnl *att = dynamic_cast<AttKeySigAnl *>(element);
+        AttKeySigAnl *att = element->GetAtt<AttKeySigAnl>(ATT_KEYSIGANL);
         assert(att);
         if (attrType == "mode") {
             att->SetMode(att->StrToMode(attrValue));
@@ -115,7 +115,7 @@ bool AttModule::SetAnalytical(Object *element, const std::string &attrType, cons
         }
     }
     if (element->HasAttClass(ATT_KEYSIGDEFAULTANL)) {
-        AttKeySigDefaultAnl *att = dynamic_cast<AttKeySigDefaultAnl *>(element);
+        AttKeySigDefaultAnl *att = element->GetAtt<AttKeySigDefaultAnl>(ATT_KEYSIGDEFAULTANL);
         assert(att);
         if (attrType == "key.accid") {
             att->SetKeyAccid(att->StrToAccidentalGestural(attrValue));
@@ -131,7 +131,7 @@ bool AttModule::SetAnalytical(Object *element, const std::string &attrType, cons
         }
     }
     if (element->HasAttClass(ATT_MELODICFUNCTION)) {
-        AttMelodicFunction *att = dynamic_cast<AttMelodicFunction *>(element);
+        AttMelodicFunction *att = element->GetAtt<AttMelodicFunction>(ATT_MELODICFUNCTION);
         assert(att);
         if (attrType == "mfunc") {
             att->SetMfunc(att->StrToMelodicfunction(attrValue));
@@ -139,7 +139,7 @@ bool AttModule::SetAnalytical(Object *element, const std::string &attrType, cons
         }
     }
     if (element->HasAttClass(ATT_PITCHCLASS)) {
-        AttPitchClass *att = dynamic_cast<AttPitchClass *>(element);
+        AttPitchClass *att = element->GetAtt<AttPitchClass>(ATT_PITCHCLASS);
         assert(att);
         if (attrType == "pclass") {
             att->SetPclass(att->StrToInt(attrValue));
@@ -147,7 +147,7 @@ bool AttModule::SetAnalytical(Object *element, const std::string &attrType, cons
         }
     }
     if (element->HasAttClass(ATT_SOLFA)) {
-        AttSolfa *att = dynamic_cast<AttSolfa *>(element);
+        AttSolfa *att = element->GetAtt<AttSolfa>(ATT_SOLFA);
         assert(att);
         if (attrType == "psolfa") {
             att->SetPsolfa(att->StrToStr(attrValue));
@@ -161,42 +161,42 @@ bool AttModule::SetAnalytical(Object *element, const std::string &attrType, cons
 void AttModule::GetAnalytical(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_HARMANL)) {
-        const AttHarmAnl *att = dynamic_cast<const AttHarmAnl *>(element);
+        const AttHarmAnl *att = element->GetAtt<AttHarmAnl>(ATT_HARMANL);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back({ "form", att->HarmAnlFormToStr(att->GetForm()) });
         }
     }
     if (element->HasAttClass(ATT_HARMONICFUNCTION)) {
-        const AttHarmonicFunction *att = dynamic_cast<const AttHarmonicFunction *>(element);
+        const AttHarmonicFunction *att = element->GetAtt<AttHarmonicFunction>(ATT_HARMONICFUNCTION);
         assert(att);
         if (att->HasDeg()) {
             attributes->push_back({ "deg", att->StrToStr(att->GetDeg()) });
         }
     }
     if (element->HasAttClass(ATT_INTERVALHARMONIC)) {
-        const AttIntervalHarmonic *att = dynamic_cast<const AttIntervalHarmonic *>(element);
+        const AttIntervalHarmonic *att = element->GetAtt<AttIntervalHarmonic>(ATT_INTERVALHARMONIC);
         assert(att);
         if (att->HasInth()) {
             attributes->push_back({ "inth", att->StrToStr(att->GetInth()) });
         }
     }
     if (element->HasAttClass(ATT_INTERVALMELODIC)) {
-        const AttIntervalMelodic *att = dynamic_cast<const AttIntervalMelodic *>(element);
+        const AttIntervalMelodic *att = element->GetAtt<AttIntervalMelodic>(ATT_INTERVALMELODIC);
         assert(att);
         if (att->HasIntm()) {
             attributes->push_back({ "intm", att->StrToStr(att->GetIntm()) });
         }
     }
     if (element->HasAttClass(ATT_KEYSIGANL)) {
-        const AttKeySigAnl *att = dynamic_cast<const AttKeySigAnl *>(element);
+        const AttKeySigAnl *att = element->GetAtt<AttKeySigAnl>(ATT_KEYSIGANL);
         assert(att);
         if (att->HasMode()) {
             attributes->push_back({ "mode", att->ModeToStr(att->GetMode()) });
         }
     }
     if (element->HasAttClass(ATT_KEYSIGDEFAULTANL)) {
-        const AttKeySigDefaultAnl *att = dynamic_cast<const AttKeySigDefaultAnl *>(element);
+        const AttKeySigDefaultAnl *att = element->GetAtt<AttKeySigDefaultAnl>(ATT_KEYSIGDEFAULTANL);
         assert(att);
         if (att->HasKeyAccid()) {
             attributes->push_back({ "key.accid", att->AccidentalGesturalToStr(att->GetKeyAccid()) });
@@ -209,21 +209,21 @@ void AttModule::GetAnalytical(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_MELODICFUNCTION)) {
-        const AttMelodicFunction *att = dynamic_cast<const AttMelodicFunction *>(element);
+        const AttMelodicFunction *att = element->GetAtt<AttMelodicFunction>(ATT_MELODICFUNCTION);
         assert(att);
         if (att->HasMfunc()) {
             attributes->push_back({ "mfunc", att->MelodicfunctionToStr(att->GetMfunc()) });
         }
     }
     if (element->HasAttClass(ATT_PITCHCLASS)) {
-        const AttPitchClass *att = dynamic_cast<const AttPitchClass *>(element);
+        const AttPitchClass *att = element->GetAtt<AttPitchClass>(ATT_PITCHCLASS);
         assert(att);
         if (att->HasPclass()) {
             attributes->push_back({ "pclass", att->IntToStr(att->GetPclass()) });
         }
     }
     if (element->HasAttClass(ATT_SOLFA)) {
-        const AttSolfa *att = dynamic_cast<const AttSolfa *>(element);
+        const AttSolfa *att = element->GetAtt<AttSolfa>(ATT_SOLFA);
         assert(att);
         if (att->HasPsolfa()) {
             attributes->push_back({ "psolfa", att->StrToStr(att->GetPsolfa()) });
@@ -244,7 +244,7 @@ namespace vrv {
 bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_ARPEGLOG)) {
-        AttArpegLog *att = dynamic_cast<AttArpegLog *>(element);
+        AttArpegLog *att = element->GetAtt<AttArpegLog>(ATT_ARPEGLOG);
         assert(att);
         if (attrType == "order") {
             att->SetOrder(att->StrToArpegLogOrder(attrValue));
@@ -252,7 +252,7 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_BTREMLOG)) {
-        AttBTremLog *att = dynamic_cast<AttBTremLog *>(element);
+        AttBTremLog *att = element->GetAtt<AttBTremLog>(ATT_BTREMLOG);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToBTremLogForm(attrValue));
@@ -260,7 +260,7 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_BEAMPRESENT)) {
-        AttBeamPresent *att = dynamic_cast<AttBeamPresent *>(element);
+        AttBeamPresent *att = element->GetAtt<AttBeamPresent>(ATT_BEAMPRESENT);
         assert(att);
         if (attrType == "beam") {
             att->SetBeam(att->StrToStr(attrValue));
@@ -268,7 +268,7 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_BEAMREND)) {
-        AttBeamRend *att = dynamic_cast<AttBeamRend *>(element);
+        AttBeamRend *att = element->GetAtt<AttBeamRend>(ATT_BEAMREND);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToBeamRendForm(attrValue));
@@ -288,7 +288,7 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_BEAMSECONDARY)) {
-        AttBeamSecondary *att = dynamic_cast<AttBeamSecondary *>(element);
+        AttBeamSecondary *att = element->GetAtt<AttBeamSecondary>(ATT_BEAMSECONDARY);
         assert(att);
         if (attrType == "breaksec") {
             att->SetBreaksec(att->StrToInt(attrValue));
@@ -296,7 +296,7 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_BEAMEDWITH)) {
-        AttBeamedWith *att = dynamic_cast<AttBeamedWith *>(element);
+        AttBeamedWith *att = element->GetAtt<AttBeamedWith>(ATT_BEAMEDWITH);
         assert(att);
         if (attrType == "beam.with") {
             att->SetBeamWith(att->StrToNeighboringlayer(attrValue));
@@ -304,7 +304,7 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_BEAMINGLOG)) {
-        AttBeamingLog *att = dynamic_cast<AttBeamingLog *>(element);
+        AttBeamingLog *att = element->GetAtt<AttBeamingLog>(ATT_BEAMINGLOG);
         assert(att);
         if (attrType == "beam.group") {
             att->SetBeamGroup(att->StrToStr(attrValue));
@@ -316,7 +316,7 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_BEATRPTLOG)) {
-        AttBeatRptLog *att = dynamic_cast<AttBeatRptLog *>(element);
+        AttBeatRptLog *att = element->GetAtt<AttBeatRptLog>(ATT_BEATRPTLOG);
         assert(att);
         if (attrType == "beatdef") {
             att->SetBeatdef(att->StrToDbl(attrValue));
@@ -324,7 +324,7 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_BRACKETSPANLOG)) {
-        AttBracketSpanLog *att = dynamic_cast<AttBracketSpanLog *>(element);
+        AttBracketSpanLog *att = element->GetAtt<AttBracketSpanLog>(ATT_BRACKETSPANLOG);
         assert(att);
         if (attrType == "func") {
             att->SetFunc(att->StrToStr(attrValue));
@@ -332,7 +332,7 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_CUTOUT)) {
-        AttCutout *att = dynamic_cast<AttCutout *>(element);
+        AttCutout *att = element->GetAtt<AttCutout>(ATT_CUTOUT);
         assert(att);
         if (attrType == "cutout") {
             att->SetCutout(att->StrToCutoutCutout(attrValue));
@@ -340,7 +340,7 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_EXPANDABLE)) {
-        AttExpandable *att = dynamic_cast<AttExpandable *>(element);
+        AttExpandable *att = element->GetAtt<AttExpandable>(ATT_EXPANDABLE);
         assert(att);
         if (attrType == "expand") {
             att->SetExpand(att->StrToBoolean(attrValue));
@@ -348,7 +348,7 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_FTREMLOG)) {
-        AttFTremLog *att = dynamic_cast<AttFTremLog *>(element);
+        AttFTremLog *att = element->GetAtt<AttFTremLog>(ATT_FTREMLOG);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToFTremLogForm(attrValue));
@@ -356,7 +356,7 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_GLISSPRESENT)) {
-        AttGlissPresent *att = dynamic_cast<AttGlissPresent *>(element);
+        AttGlissPresent *att = element->GetAtt<AttGlissPresent>(ATT_GLISSPRESENT);
         assert(att);
         if (attrType == "gliss") {
             att->SetGliss(att->StrToGlissando(attrValue));
@@ -364,7 +364,7 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_GRACEGRPLOG)) {
-        AttGraceGrpLog *att = dynamic_cast<AttGraceGrpLog *>(element);
+        AttGraceGrpLog *att = element->GetAtt<AttGraceGrpLog>(ATT_GRACEGRPLOG);
         assert(att);
         if (attrType == "attach") {
             att->SetAttach(att->StrToGraceGrpLogAttach(attrValue));
@@ -372,7 +372,7 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_GRACED)) {
-        AttGraced *att = dynamic_cast<AttGraced *>(element);
+        AttGraced *att = element->GetAtt<AttGraced>(ATT_GRACED);
         assert(att);
         if (attrType == "grace") {
             att->SetGrace(att->StrToGrace(attrValue));
@@ -384,7 +384,7 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_HAIRPINLOG)) {
-        AttHairpinLog *att = dynamic_cast<AttHairpinLog *>(element);
+        AttHairpinLog *att = element->GetAtt<AttHairpinLog>(ATT_HAIRPINLOG);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToHairpinLogForm(attrValue));
@@ -396,7 +396,7 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_HARPPEDALLOG)) {
-        AttHarpPedalLog *att = dynamic_cast<AttHarpPedalLog *>(element);
+        AttHarpPedalLog *att = element->GetAtt<AttHarpPedalLog>(ATT_HARPPEDALLOG);
         assert(att);
         if (attrType == "c") {
             att->SetC(att->StrToHarpPedalLogC(attrValue));
@@ -428,7 +428,7 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_LVPRESENT)) {
-        AttLvPresent *att = dynamic_cast<AttLvPresent *>(element);
+        AttLvPresent *att = element->GetAtt<AttLvPresent>(ATT_LVPRESENT);
         assert(att);
         if (attrType == "lv") {
             att->SetLv(att->StrToBoolean(attrValue));
@@ -436,7 +436,7 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_MEASURELOG)) {
-        AttMeasureLog *att = dynamic_cast<AttMeasureLog *>(element);
+        AttMeasureLog *att = element->GetAtt<AttMeasureLog>(ATT_MEASURELOG);
         assert(att);
         if (attrType == "left") {
             att->SetLeft(att->StrToBarrendition(attrValue));
@@ -448,7 +448,7 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_METERSIGGRPLOG)) {
-        AttMeterSigGrpLog *att = dynamic_cast<AttMeterSigGrpLog *>(element);
+        AttMeterSigGrpLog *att = element->GetAtt<AttMeterSigGrpLog>(ATT_METERSIGGRPLOG);
         assert(att);
         if (attrType == "func") {
             att->SetFunc(att->StrToMeterSigGrpLogFunc(attrValue));
@@ -456,7 +456,7 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_NUMBERPLACEMENT)) {
-        AttNumberPlacement *att = dynamic_cast<AttNumberPlacement *>(element);
+        AttNumberPlacement *att = element->GetAtt<AttNumberPlacement>(ATT_NUMBERPLACEMENT);
         assert(att);
         if (attrType == "num.place") {
             att->SetNumPlace(att->StrToStaffrelBasic(attrValue));
@@ -468,7 +468,7 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_NUMBERED)) {
-        AttNumbered *att = dynamic_cast<AttNumbered *>(element);
+        AttNumbered *att = element->GetAtt<AttNumbered>(ATT_NUMBERED);
         assert(att);
         if (attrType == "num") {
             att->SetNum(att->StrToInt(attrValue));
@@ -476,7 +476,7 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_OCTAVELOG)) {
-        AttOctaveLog *att = dynamic_cast<AttOctaveLog *>(element);
+        AttOctaveLog *att = element->GetAtt<AttOctaveLog>(ATT_OCTAVELOG);
         assert(att);
         if (attrType == "coll") {
             att->SetColl(att->StrToOctaveLogColl(attrValue));
@@ -484,7 +484,7 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_PEDALLOG)) {
-        AttPedalLog *att = dynamic_cast<AttPedalLog *>(element);
+        AttPedalLog *att = element->GetAtt<AttPedalLog>(ATT_PEDALLOG);
         assert(att);
         if (attrType == "dir") {
             att->SetDir(att->StrToPedalLogDir(attrValue));
@@ -496,7 +496,7 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_PIANOPEDALS)) {
-        AttPianoPedals *att = dynamic_cast<AttPianoPedals *>(element);
+        AttPianoPedals *att = element->GetAtt<AttPianoPedals>(ATT_PIANOPEDALS);
         assert(att);
         if (attrType == "pedal.style") {
             att->SetPedalStyle(att->StrToPedalstyle(attrValue));
@@ -504,7 +504,7 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_REHEARSAL)) {
-        AttRehearsal *att = dynamic_cast<AttRehearsal *>(element);
+        AttRehearsal *att = element->GetAtt<AttRehearsal>(ATT_REHEARSAL);
         assert(att);
         if (attrType == "reh.enclose") {
             att->SetRehEnclose(att->StrToRehearsalRehenclose(attrValue));
@@ -512,7 +512,7 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_SCOREDEFVISCMN)) {
-        AttScoreDefVisCmn *att = dynamic_cast<AttScoreDefVisCmn *>(element);
+        AttScoreDefVisCmn *att = element->GetAtt<AttScoreDefVisCmn>(ATT_SCOREDEFVISCMN);
         assert(att);
         if (attrType == "grid.show") {
             att->SetGridShow(att->StrToBoolean(attrValue));
@@ -520,7 +520,7 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_SLURREND)) {
-        AttSlurRend *att = dynamic_cast<AttSlurRend *>(element);
+        AttSlurRend *att = element->GetAtt<AttSlurRend>(ATT_SLURREND);
         assert(att);
         if (attrType == "slur.lform") {
             att->SetSlurLform(att->StrToLineform(attrValue));
@@ -532,7 +532,7 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_STEMSCMN)) {
-        AttStemsCmn *att = dynamic_cast<AttStemsCmn *>(element);
+        AttStemsCmn *att = element->GetAtt<AttStemsCmn>(ATT_STEMSCMN);
         assert(att);
         if (attrType == "stem.with") {
             att->SetStemWith(att->StrToNeighboringlayer(attrValue));
@@ -540,7 +540,7 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_TIEREND)) {
-        AttTieRend *att = dynamic_cast<AttTieRend *>(element);
+        AttTieRend *att = element->GetAtt<AttTieRend>(ATT_TIEREND);
         assert(att);
         if (attrType == "tie.lform") {
             att->SetTieLform(att->StrToLineform(attrValue));
@@ -552,7 +552,7 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
         }
     }
     if (element->HasAttClass(ATT_TREMMEASURED)) {
-        AttTremMeasured *att = dynamic_cast<AttTremMeasured *>(element);
+        AttTremMeasured *att = element->GetAtt<AttTremMeasured>(ATT_TREMMEASURED);
         assert(att);
         if (attrType == "unitdur") {
             att->SetUnitdur(att->StrToDuration(attrValue));
@@ -566,28 +566,28 @@ bool AttModule::SetCmn(Object *element, const std::string &attrType, const std::
 void AttModule::GetCmn(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_ARPEGLOG)) {
-        const AttArpegLog *att = dynamic_cast<const AttArpegLog *>(element);
+        const AttArpegLog *att = element->GetAtt<AttArpegLog>(ATT_ARPEGLOG);
         assert(att);
         if (att->HasOrder()) {
             attributes->push_back({ "order", att->ArpegLogOrderToStr(att->GetOrder()) });
         }
     }
     if (element->HasAttClass(ATT_BTREMLOG)) {
-        const AttBTremLog *att = dynamic_cast<const AttBTremLog *>(element);
+        const AttBTremLog *att = element->GetAtt<AttBTremLog>(ATT_BTREMLOG);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back({ "form", att->BTremLogFormToStr(att->GetForm()) });
         }
     }
     if (element->HasAttClass(ATT_BEAMPRESENT)) {
-        const AttBeamPresent *att = dynamic_cast<const AttBeamPresent *>(element);
+        const AttBeamPresent *att = element->GetAtt<AttBeamPresent>(ATT_BEAMPRESENT);
         assert(att);
         if (att->HasBeam()) {
             attributes->push_back({ "beam", att->StrToStr(att->GetBeam()) });
         }
     }
     if (element->HasAttClass(ATT_BEAMREND)) {
-        const AttBeamRend *att = dynamic_cast<const AttBeamRend *>(element);
+        const AttBeamRend *att = element->GetAtt<AttBeamRend>(ATT_BEAMREND);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back({ "form", att->BeamRendFormToStr(att->GetForm()) });
@@ -603,21 +603,21 @@ void AttModule::GetCmn(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_BEAMSECONDARY)) {
-        const AttBeamSecondary *att = dynamic_cast<const AttBeamSecondary *>(element);
+        const AttBeamSecondary *att = element->GetAtt<AttBeamSecondary>(ATT_BEAMSECONDARY);
         assert(att);
         if (att->HasBreaksec()) {
             attributes->push_back({ "breaksec", att->IntToStr(att->GetBreaksec()) });
         }
     }
     if (element->HasAttClass(ATT_BEAMEDWITH)) {
-        const AttBeamedWith *att = dynamic_cast<const AttBeamedWith *>(element);
+        const AttBeamedWith *att = element->GetAtt<AttBeamedWith>(ATT_BEAMEDWITH);
         assert(att);
         if (att->HasBeamWith()) {
             attributes->push_back({ "beam.with", att->NeighboringlayerToStr(att->GetBeamWith()) });
         }
     }
     if (element->HasAttClass(ATT_BEAMINGLOG)) {
-        const AttBeamingLog *att = dynamic_cast<const AttBeamingLog *>(element);
+        const AttBeamingLog *att = element->GetAtt<AttBeamingLog>(ATT_BEAMINGLOG);
         assert(att);
         if (att->HasBeamGroup()) {
             attributes->push_back({ "beam.group", att->StrToStr(att->GetBeamGroup()) });
@@ -627,56 +627,56 @@ void AttModule::GetCmn(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_BEATRPTLOG)) {
-        const AttBeatRptLog *att = dynamic_cast<const AttBeatRptLog *>(element);
+        const AttBeatRptLog *att = element->GetAtt<AttBeatRptLog>(ATT_BEATRPTLOG);
         assert(att);
         if (att->HasBeatdef()) {
             attributes->push_back({ "beatdef", att->DblToStr(att->GetBeatdef()) });
         }
     }
     if (element->HasAttClass(ATT_BRACKETSPANLOG)) {
-        const AttBracketSpanLog *att = dynamic_cast<const AttBracketSpanLog *>(element);
+        const AttBracketSpanLog *att = element->GetAtt<AttBracketSpanLog>(ATT_BRACKETSPANLOG);
         assert(att);
         if (att->HasFunc()) {
             attributes->push_back({ "func", att->StrToStr(att->GetFunc()) });
         }
     }
     if (element->HasAttClass(ATT_CUTOUT)) {
-        const AttCutout *att = dynamic_cast<const AttCutout *>(element);
+        const AttCutout *att = element->GetAtt<AttCutout>(ATT_CUTOUT);
         assert(att);
         if (att->HasCutout()) {
             attributes->push_back({ "cutout", att->CutoutCutoutToStr(att->GetCutout()) });
         }
     }
     if (element->HasAttClass(ATT_EXPANDABLE)) {
-        const AttExpandable *att = dynamic_cast<const AttExpandable *>(element);
+        const AttExpandable *att = element->GetAtt<AttExpandable>(ATT_EXPANDABLE);
         assert(att);
         if (att->HasExpand()) {
             attributes->push_back({ "expand", att->BooleanToStr(att->GetExpand()) });
         }
     }
     if (element->HasAttClass(ATT_FTREMLOG)) {
-        const AttFTremLog *att = dynamic_cast<const AttFTremLog *>(element);
+        const AttFTremLog *att = element->GetAtt<AttFTremLog>(ATT_FTREMLOG);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back({ "form", att->FTremLogFormToStr(att->GetForm()) });
         }
     }
     if (element->HasAttClass(ATT_GLISSPRESENT)) {
-        const AttGlissPresent *att = dynamic_cast<const AttGlissPresent *>(element);
+        const AttGlissPresent *att = element->GetAtt<AttGlissPresent>(ATT_GLISSPRESENT);
         assert(att);
         if (att->HasGliss()) {
             attributes->push_back({ "gliss", att->GlissandoToStr(att->GetGliss()) });
         }
     }
     if (element->HasAttClass(ATT_GRACEGRPLOG)) {
-        const AttGraceGrpLog *att = dynamic_cast<const AttGraceGrpLog *>(element);
+        const AttGraceGrpLog *att = element->GetAtt<AttGraceGrpLog>(ATT_GRACEGRPLOG);
         assert(att);
         if (att->HasAttach()) {
             attributes->push_back({ "attach", att->GraceGrpLogAttachToStr(att->GetAttach()) });
         }
     }
     if (element->HasAttClass(ATT_GRACED)) {
-        const AttGraced *att = dynamic_cast<const AttGraced *>(element);
+        const AttGraced *att = element->GetAtt<AttGraced>(ATT_GRACED);
         assert(att);
         if (att->HasGrace()) {
             attributes->push_back({ "grace", att->GraceToStr(att->GetGrace()) });
@@ -686,7 +686,7 @@ void AttModule::GetCmn(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_HAIRPINLOG)) {
-        const AttHairpinLog *att = dynamic_cast<const AttHairpinLog *>(element);
+        const AttHairpinLog *att = element->GetAtt<AttHairpinLog>(ATT_HAIRPINLOG);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back({ "form", att->HairpinLogFormToStr(att->GetForm()) });
@@ -696,7 +696,7 @@ void AttModule::GetCmn(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_HARPPEDALLOG)) {
-        const AttHarpPedalLog *att = dynamic_cast<const AttHarpPedalLog *>(element);
+        const AttHarpPedalLog *att = element->GetAtt<AttHarpPedalLog>(ATT_HARPPEDALLOG);
         assert(att);
         if (att->HasC()) {
             attributes->push_back({ "c", att->HarpPedalLogCToStr(att->GetC()) });
@@ -721,14 +721,14 @@ void AttModule::GetCmn(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_LVPRESENT)) {
-        const AttLvPresent *att = dynamic_cast<const AttLvPresent *>(element);
+        const AttLvPresent *att = element->GetAtt<AttLvPresent>(ATT_LVPRESENT);
         assert(att);
         if (att->HasLv()) {
             attributes->push_back({ "lv", att->BooleanToStr(att->GetLv()) });
         }
     }
     if (element->HasAttClass(ATT_MEASURELOG)) {
-        const AttMeasureLog *att = dynamic_cast<const AttMeasureLog *>(element);
+        const AttMeasureLog *att = element->GetAtt<AttMeasureLog>(ATT_MEASURELOG);
         assert(att);
         if (att->HasLeft()) {
             attributes->push_back({ "left", att->BarrenditionToStr(att->GetLeft()) });
@@ -738,14 +738,14 @@ void AttModule::GetCmn(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_METERSIGGRPLOG)) {
-        const AttMeterSigGrpLog *att = dynamic_cast<const AttMeterSigGrpLog *>(element);
+        const AttMeterSigGrpLog *att = element->GetAtt<AttMeterSigGrpLog>(ATT_METERSIGGRPLOG);
         assert(att);
         if (att->HasFunc()) {
             attributes->push_back({ "func", att->MeterSigGrpLogFuncToStr(att->GetFunc()) });
         }
     }
     if (element->HasAttClass(ATT_NUMBERPLACEMENT)) {
-        const AttNumberPlacement *att = dynamic_cast<const AttNumberPlacement *>(element);
+        const AttNumberPlacement *att = element->GetAtt<AttNumberPlacement>(ATT_NUMBERPLACEMENT);
         assert(att);
         if (att->HasNumPlace()) {
             attributes->push_back({ "num.place", att->StaffrelBasicToStr(att->GetNumPlace()) });
@@ -755,21 +755,21 @@ void AttModule::GetCmn(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_NUMBERED)) {
-        const AttNumbered *att = dynamic_cast<const AttNumbered *>(element);
+        const AttNumbered *att = element->GetAtt<AttNumbered>(ATT_NUMBERED);
         assert(att);
         if (att->HasNum()) {
             attributes->push_back({ "num", att->IntToStr(att->GetNum()) });
         }
     }
     if (element->HasAttClass(ATT_OCTAVELOG)) {
-        const AttOctaveLog *att = dynamic_cast<const AttOctaveLog *>(element);
+        const AttOctaveLog *att = element->GetAtt<AttOctaveLog>(ATT_OCTAVELOG);
         assert(att);
         if (att->HasColl()) {
             attributes->push_back({ "coll", att->OctaveLogCollToStr(att->GetColl()) });
         }
     }
     if (element->HasAttClass(ATT_PEDALLOG)) {
-        const AttPedalLog *att = dynamic_cast<const AttPedalLog *>(element);
+        const AttPedalLog *att = element->GetAtt<AttPedalLog>(ATT_PEDALLOG);
         assert(att);
         if (att->HasDir()) {
             attributes->push_back({ "dir", att->PedalLogDirToStr(att->GetDir()) });
@@ -779,28 +779,28 @@ void AttModule::GetCmn(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_PIANOPEDALS)) {
-        const AttPianoPedals *att = dynamic_cast<const AttPianoPedals *>(element);
+        const AttPianoPedals *att = element->GetAtt<AttPianoPedals>(ATT_PIANOPEDALS);
         assert(att);
         if (att->HasPedalStyle()) {
             attributes->push_back({ "pedal.style", att->PedalstyleToStr(att->GetPedalStyle()) });
         }
     }
     if (element->HasAttClass(ATT_REHEARSAL)) {
-        const AttRehearsal *att = dynamic_cast<const AttRehearsal *>(element);
+        const AttRehearsal *att = element->GetAtt<AttRehearsal>(ATT_REHEARSAL);
         assert(att);
         if (att->HasRehEnclose()) {
             attributes->push_back({ "reh.enclose", att->RehearsalRehencloseToStr(att->GetRehEnclose()) });
         }
     }
     if (element->HasAttClass(ATT_SCOREDEFVISCMN)) {
-        const AttScoreDefVisCmn *att = dynamic_cast<const AttScoreDefVisCmn *>(element);
+        const AttScoreDefVisCmn *att = element->GetAtt<AttScoreDefVisCmn>(ATT_SCOREDEFVISCMN);
         assert(att);
         if (att->HasGridShow()) {
             attributes->push_back({ "grid.show", att->BooleanToStr(att->GetGridShow()) });
         }
     }
     if (element->HasAttClass(ATT_SLURREND)) {
-        const AttSlurRend *att = dynamic_cast<const AttSlurRend *>(element);
+        const AttSlurRend *att = element->GetAtt<AttSlurRend>(ATT_SLURREND);
         assert(att);
         if (att->HasSlurLform()) {
             attributes->push_back({ "slur.lform", att->LineformToStr(att->GetSlurLform()) });
@@ -810,14 +810,14 @@ void AttModule::GetCmn(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_STEMSCMN)) {
-        const AttStemsCmn *att = dynamic_cast<const AttStemsCmn *>(element);
+        const AttStemsCmn *att = element->GetAtt<AttStemsCmn>(ATT_STEMSCMN);
         assert(att);
         if (att->HasStemWith()) {
             attributes->push_back({ "stem.with", att->NeighboringlayerToStr(att->GetStemWith()) });
         }
     }
     if (element->HasAttClass(ATT_TIEREND)) {
-        const AttTieRend *att = dynamic_cast<const AttTieRend *>(element);
+        const AttTieRend *att = element->GetAtt<AttTieRend>(ATT_TIEREND);
         assert(att);
         if (att->HasTieLform()) {
             attributes->push_back({ "tie.lform", att->LineformToStr(att->GetTieLform()) });
@@ -827,7 +827,7 @@ void AttModule::GetCmn(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_TREMMEASURED)) {
-        const AttTremMeasured *att = dynamic_cast<const AttTremMeasured *>(element);
+        const AttTremMeasured *att = element->GetAtt<AttTremMeasured>(ATT_TREMMEASURED);
         assert(att);
         if (att->HasUnitdur()) {
             attributes->push_back({ "unitdur", att->DurationToStr(att->GetUnitdur()) });
@@ -848,7 +848,7 @@ namespace vrv {
 bool AttModule::SetCmnornaments(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_MORDENTLOG)) {
-        AttMordentLog *att = dynamic_cast<AttMordentLog *>(element);
+        AttMordentLog *att = element->GetAtt<AttMordentLog>(ATT_MORDENTLOG);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToMordentLogForm(attrValue));
@@ -860,7 +860,7 @@ bool AttModule::SetCmnornaments(Object *element, const std::string &attrType, co
         }
     }
     if (element->HasAttClass(ATT_ORNAMPRESENT)) {
-        AttOrnamPresent *att = dynamic_cast<AttOrnamPresent *>(element);
+        AttOrnamPresent *att = element->GetAtt<AttOrnamPresent>(ATT_ORNAMPRESENT);
         assert(att);
         if (attrType == "ornam") {
             att->SetOrnam(att->StrToStr(attrValue));
@@ -868,7 +868,7 @@ bool AttModule::SetCmnornaments(Object *element, const std::string &attrType, co
         }
     }
     if (element->HasAttClass(ATT_ORNAMENTACCID)) {
-        AttOrnamentAccid *att = dynamic_cast<AttOrnamentAccid *>(element);
+        AttOrnamentAccid *att = element->GetAtt<AttOrnamentAccid>(ATT_ORNAMENTACCID);
         assert(att);
         if (attrType == "accidupper") {
             att->SetAccidupper(att->StrToAccidentalWritten(attrValue));
@@ -880,7 +880,7 @@ bool AttModule::SetCmnornaments(Object *element, const std::string &attrType, co
         }
     }
     if (element->HasAttClass(ATT_TURNLOG)) {
-        AttTurnLog *att = dynamic_cast<AttTurnLog *>(element);
+        AttTurnLog *att = element->GetAtt<AttTurnLog>(ATT_TURNLOG);
         assert(att);
         if (attrType == "delayed") {
             att->SetDelayed(att->StrToBoolean(attrValue));
@@ -898,7 +898,7 @@ bool AttModule::SetCmnornaments(Object *element, const std::string &attrType, co
 void AttModule::GetCmnornaments(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_MORDENTLOG)) {
-        const AttMordentLog *att = dynamic_cast<const AttMordentLog *>(element);
+        const AttMordentLog *att = element->GetAtt<AttMordentLog>(ATT_MORDENTLOG);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back({ "form", att->MordentLogFormToStr(att->GetForm()) });
@@ -908,14 +908,14 @@ void AttModule::GetCmnornaments(const Object *element, ArrayOfStrAttr *attribute
         }
     }
     if (element->HasAttClass(ATT_ORNAMPRESENT)) {
-        const AttOrnamPresent *att = dynamic_cast<const AttOrnamPresent *>(element);
+        const AttOrnamPresent *att = element->GetAtt<AttOrnamPresent>(ATT_ORNAMPRESENT);
         assert(att);
         if (att->HasOrnam()) {
             attributes->push_back({ "ornam", att->StrToStr(att->GetOrnam()) });
         }
     }
     if (element->HasAttClass(ATT_ORNAMENTACCID)) {
-        const AttOrnamentAccid *att = dynamic_cast<const AttOrnamentAccid *>(element);
+        const AttOrnamentAccid *att = element->GetAtt<AttOrnamentAccid>(ATT_ORNAMENTACCID);
         assert(att);
         if (att->HasAccidupper()) {
             attributes->push_back({ "accidupper", att->AccidentalWrittenToStr(att->GetAccidupper()) });
@@ -925,7 +925,7 @@ void AttModule::GetCmnornaments(const Object *element, ArrayOfStrAttr *attribute
         }
     }
     if (element->HasAttClass(ATT_TURNLOG)) {
-        const AttTurnLog *att = dynamic_cast<const AttTurnLog *>(element);
+        const AttTurnLog *att = element->GetAtt<AttTurnLog>(ATT_TURNLOG);
         assert(att);
         if (att->HasDelayed()) {
             attributes->push_back({ "delayed", att->BooleanToStr(att->GetDelayed()) });
@@ -949,7 +949,7 @@ namespace vrv {
 bool AttModule::SetCritapp(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_CRIT)) {
-        AttCrit *att = dynamic_cast<AttCrit *>(element);
+        AttCrit *att = element->GetAtt<AttCrit>(ATT_CRIT);
         assert(att);
         if (attrType == "cause") {
             att->SetCause(att->StrToStr(attrValue));
@@ -963,7 +963,7 @@ bool AttModule::SetCritapp(Object *element, const std::string &attrType, const s
 void AttModule::GetCritapp(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_CRIT)) {
-        const AttCrit *att = dynamic_cast<const AttCrit *>(element);
+        const AttCrit *att = element->GetAtt<AttCrit>(ATT_CRIT);
         assert(att);
         if (att->HasCause()) {
             attributes->push_back({ "cause", att->StrToStr(att->GetCause()) });
@@ -984,7 +984,7 @@ namespace vrv {
 bool AttModule::SetEdittrans(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_AGENTIDENT)) {
-        AttAgentIdent *att = dynamic_cast<AttAgentIdent *>(element);
+        AttAgentIdent *att = element->GetAtt<AttAgentIdent>(ATT_AGENTIDENT);
         assert(att);
         if (attrType == "agent") {
             att->SetAgent(att->StrToStr(attrValue));
@@ -992,7 +992,7 @@ bool AttModule::SetEdittrans(Object *element, const std::string &attrType, const
         }
     }
     if (element->HasAttClass(ATT_REASONIDENT)) {
-        AttReasonIdent *att = dynamic_cast<AttReasonIdent *>(element);
+        AttReasonIdent *att = element->GetAtt<AttReasonIdent>(ATT_REASONIDENT);
         assert(att);
         if (attrType == "reason") {
             att->SetReason(att->StrToStr(attrValue));
@@ -1006,14 +1006,14 @@ bool AttModule::SetEdittrans(Object *element, const std::string &attrType, const
 void AttModule::GetEdittrans(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_AGENTIDENT)) {
-        const AttAgentIdent *att = dynamic_cast<const AttAgentIdent *>(element);
+        const AttAgentIdent *att = element->GetAtt<AttAgentIdent>(ATT_AGENTIDENT);
         assert(att);
         if (att->HasAgent()) {
             attributes->push_back({ "agent", att->StrToStr(att->GetAgent()) });
         }
     }
     if (element->HasAttClass(ATT_REASONIDENT)) {
-        const AttReasonIdent *att = dynamic_cast<const AttReasonIdent *>(element);
+        const AttReasonIdent *att = element->GetAtt<AttReasonIdent>(ATT_REASONIDENT);
         assert(att);
         if (att->HasReason()) {
             attributes->push_back({ "reason", att->StrToStr(att->GetReason()) });
@@ -1034,7 +1034,7 @@ namespace vrv {
 bool AttModule::SetExternalsymbols(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_EXTSYM)) {
-        AttExtSym *att = dynamic_cast<AttExtSym *>(element);
+        AttExtSym *att = element->GetAtt<AttExtSym>(ATT_EXTSYM);
         assert(att);
         if (attrType == "glyph.auth") {
             att->SetGlyphAuth(att->StrToStr(attrValue));
@@ -1060,7 +1060,7 @@ bool AttModule::SetExternalsymbols(Object *element, const std::string &attrType,
 void AttModule::GetExternalsymbols(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_EXTSYM)) {
-        const AttExtSym *att = dynamic_cast<const AttExtSym *>(element);
+        const AttExtSym *att = element->GetAtt<AttExtSym>(ATT_EXTSYM);
         assert(att);
         if (att->HasGlyphAuth()) {
             attributes->push_back({ "glyph.auth", att->StrToStr(att->GetGlyphAuth()) });
@@ -1090,7 +1090,7 @@ namespace vrv {
 bool AttModule::SetFacsimile(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_FACSIMILE)) {
-        AttFacsimile *att = dynamic_cast<AttFacsimile *>(element);
+        AttFacsimile *att = element->GetAtt<AttFacsimile>(ATT_FACSIMILE);
         assert(att);
         if (attrType == "facs") {
             att->SetFacs(att->StrToStr(attrValue));
@@ -1104,7 +1104,7 @@ bool AttModule::SetFacsimile(Object *element, const std::string &attrType, const
 void AttModule::GetFacsimile(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_FACSIMILE)) {
-        const AttFacsimile *att = dynamic_cast<const AttFacsimile *>(element);
+        const AttFacsimile *att = element->GetAtt<AttFacsimile>(ATT_FACSIMILE);
         assert(att);
         if (att->HasFacs()) {
             attributes->push_back({ "facs", att->StrToStr(att->GetFacs()) });
@@ -1125,7 +1125,7 @@ namespace vrv {
 bool AttModule::SetFigtable(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_TABULAR)) {
-        AttTabular *att = dynamic_cast<AttTabular *>(element);
+        AttTabular *att = element->GetAtt<AttTabular>(ATT_TABULAR);
         assert(att);
         if (attrType == "colspan") {
             att->SetColspan(att->StrToInt(attrValue));
@@ -1143,7 +1143,7 @@ bool AttModule::SetFigtable(Object *element, const std::string &attrType, const
 void AttModule::GetFigtable(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_TABULAR)) {
-        const AttTabular *att = dynamic_cast<const AttTabular *>(element);
+        const AttTabular *att = element->GetAtt<AttTabular>(ATT_TABULAR);
         assert(att);
         if (att->HasColspan()) {
             attributes->push_back({ "colspan", att->IntToStr(att->GetColspan()) });
@@ -1167,7 +1167,7 @@ namespace vrv {
 bool AttModule::SetFingering(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_FINGGRPLOG)) {
-        AttFingGrpLog *att = dynamic_cast<AttFingGrpLog *>(element);
+        AttFingGrpLog *att = element->GetAtt<AttFingGrpLog>(ATT_FINGGRPLOG);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToFingGrpLogForm(attrValue));
@@ -1181,7 +1181,7 @@ bool AttModule::SetFingering(Object *element, const std::string &attrType, const
 void AttModule::GetFingering(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_FINGGRPLOG)) {
-        const AttFingGrpLog *att = dynamic_cast<const AttFingGrpLog *>(element);
+        const AttFingGrpLog *att = element->GetAtt<AttFingGrpLog>(ATT_FINGGRPLOG);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back({ "form", att->FingGrpLogFormToStr(att->GetForm()) });
@@ -1202,7 +1202,7 @@ namespace vrv {
 bool AttModule::SetFrettab(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_COURSELOG)) {
-        AttCourseLog *att = dynamic_cast<AttCourseLog *>(element);
+        AttCourseLog *att = element->GetAtt<AttCourseLog>(ATT_COURSELOG);
         assert(att);
         if (attrType == "tuning.standard") {
             att->SetTuningStandard(att->StrToCoursetuning(attrValue));
@@ -1210,7 +1210,7 @@ bool AttModule::SetFrettab(Object *element, const std::string &attrType, const s
         }
     }
     if (element->HasAttClass(ATT_NOTEGESTAB)) {
-        AttNoteGesTab *att = dynamic_cast<AttNoteGesTab *>(element);
+        AttNoteGesTab *att = element->GetAtt<AttNoteGesTab>(ATT_NOTEGESTAB);
         assert(att);
         if (attrType == "tab.course") {
             att->SetTabCourse(att->StrToInt(attrValue));
@@ -1228,14 +1228,14 @@ bool AttModule::SetFrettab(Object *element, const std::string &attrType, const s
 void AttModule::GetFrettab(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_COURSELOG)) {
-        const AttCourseLog *att = dynamic_cast<const AttCourseLog *>(element);
+        const AttCourseLog *att = element->GetAtt<AttCourseLog>(ATT_COURSELOG);
         assert(att);
         if (att->HasTuningStandard()) {
             attributes->push_back({ "tuning.standard", att->CoursetuningToStr(att->GetTuningStandard()) });
         }
     }
     if (element->HasAttClass(ATT_NOTEGESTAB)) {
-        const AttNoteGesTab *att = dynamic_cast<const AttNoteGesTab *>(element);
+        const AttNoteGesTab *att = element->GetAtt<AttNoteGesTab>(ATT_NOTEGESTAB);
         assert(att);
         if (att->HasTabCourse()) {
             attributes->push_back({ "tab.course", att->IntToStr(att->GetTabCourse()) });
@@ -1259,7 +1259,7 @@ namespace vrv {
 bool AttModule::SetGestural(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_ACCIDENTALGES)) {
-        AttAccidentalGes *att = dynamic_cast<AttAccidentalGes *>(element);
+        AttAccidentalGes *att = element->GetAtt<AttAccidentalGes>(ATT_ACCIDENTALGES);
         assert(att);
         if (attrType == "accid.ges") {
             att->SetAccidGes(att->StrToAccidentalGestural(attrValue));
@@ -1267,7 +1267,7 @@ bool AttModule::SetGestural(Object *element, const std::string &attrType, const
         }
     }
     if (element->HasAttClass(ATT_ARTICULATIONGES)) {
-        AttArticulationGes *att = dynamic_cast<AttArticulationGes *>(element);
+        AttArticulationGes *att = element->GetAtt<AttArticulationGes>(ATT_ARTICULATIONGES);
         assert(att);
         if (attrType == "artic.ges") {
             att->SetArticGes(att->StrToArticulationList(attrValue));
@@ -1275,7 +1275,7 @@ bool AttModule::SetGestural(Object *element, const std::string &attrType, const
         }
     }
     if (element->HasAttClass(ATT_BENDGES)) {
-        AttBendGes *att = dynamic_cast<AttBendGes *>(element);
+        AttBendGes *att = element->GetAtt<AttBendGes>(ATT_BENDGES);
         assert(att);
         if (attrType == "amount") {
             att->SetAmount(att->StrToDbl(attrValue));
@@ -1283,7 +1283,7 @@ bool AttModule::SetGestural(Object *element, const std::string &attrType, const
         }
     }
     if (element->HasAttClass(ATT_DURATIONGES)) {
-        AttDurationGes *att = dynamic_cast<AttDurationGes *>(element);
+        AttDurationGes *att = element->GetAtt<AttDurationGes>(ATT_DURATIONGES);
         assert(att);
         if (attrType == "dur.ges") {
             att->SetDurGes(att->StrToDuration(attrValue));
@@ -1311,7 +1311,7 @@ bool AttModule::SetGestural(Object *element, const std::string &attrType, const
         }
     }
     if (element->HasAttClass(ATT_MDIVGES)) {
-        AttMdivGes *att = dynamic_cast<AttMdivGes *>(element);
+        AttMdivGes *att = element->GetAtt<AttMdivGes>(ATT_MDIVGES);
         assert(att);
         if (attrType == "attacca") {
             att->SetAttacca(att->StrToBoolean(attrValue));
@@ -1319,7 +1319,7 @@ bool AttModule::SetGestural(Object *element, const std::string &attrType, const
         }
     }
     if (element->HasAttClass(ATT_NCGES)) {
-        AttNcGes *att = dynamic_cast<AttNcGes *>(element);
+        AttNcGes *att = element->GetAtt<AttNcGes>(ATT_NCGES);
         assert(att);
         if (attrType == "oct.ges") {
             att->SetOctGes(att->StrToOctave(attrValue));
@@ -1335,7 +1335,7 @@ bool AttModule::SetGestural(Object *element, const std::string &attrType, const
         }
     }
     if (element->HasAttClass(ATT_NOTEGES)) {
-        AttNoteGes *att = dynamic_cast<AttNoteGes *>(element);
+        AttNoteGes *att = element->GetAtt<AttNoteGes>(ATT_NOTEGES);
         assert(att);
         if (attrType == "extremis") {
             att->SetExtremis(att->StrToNoteGesExtremis(attrValue));
@@ -1355,7 +1355,7 @@ bool AttModule::SetGestural(Object *element, const std::string &attrType, const
         }
     }
     if (element->HasAttClass(ATT_ORNAMENTACCIDGES)) {
-        AttOrnamentAccidGes *att = dynamic_cast<AttOrnamentAccidGes *>(element);
+        AttOrnamentAccidGes *att = element->GetAtt<AttOrnamentAccidGes>(ATT_ORNAMENTACCIDGES);
         assert(att);
         if (attrType == "accidupper.ges") {
             att->SetAccidupperGes(att->StrToAccidentalGestural(attrValue));
@@ -1367,7 +1367,7 @@ bool AttModule::SetGestural(Object *element, const std::string &attrType, const
         }
     }
     if (element->HasAttClass(ATT_SECTIONGES)) {
-        AttSectionGes *att = dynamic_cast<AttSectionGes *>(element);
+        AttSectionGes *att = element->GetAtt<AttSectionGes>(ATT_SECTIONGES);
         assert(att);
         if (attrType == "attacca") {
             att->SetAttacca(att->StrToBoolean(attrValue));
@@ -1375,7 +1375,7 @@ bool AttModule::SetGestural(Object *element, const std::string &attrType, const
         }
     }
     if (element->HasAttClass(ATT_SOUNDLOCATION)) {
-        AttSoundLocation *att = dynamic_cast<AttSoundLocation *>(element);
+        AttSoundLocation *att = element->GetAtt<AttSoundLocation>(ATT_SOUNDLOCATION);
         assert(att);
         if (attrType == "azimuth") {
             att->SetAzimuth(att->StrToDbl(attrValue));
@@ -1387,7 +1387,7 @@ bool AttModule::SetGestural(Object *element, const std::string &attrType, const
         }
     }
     if (element->HasAttClass(ATT_TIMESTAMPGES)) {
-        AttTimestampGes *att = dynamic_cast<AttTimestampGes *>(element);
+        AttTimestampGes *att = element->GetAtt<AttTimestampGes>(ATT_TIMESTAMPGES);
         assert(att);
         if (attrType == "tstamp.ges") {
             att->SetTstampGes(att->StrToDbl(attrValue));
@@ -1399,7 +1399,7 @@ bool AttModule::SetGestural(Object *element, const std::string &attrType, const
         }
     }
     if (element->HasAttClass(ATT_TIMESTAMP2GES)) {
-        AttTimestamp2Ges *att = dynamic_cast<AttTimestamp2Ges *>(element);
+        AttTimestamp2Ges *att = element->GetAtt<AttTimestamp2Ges>(ATT_TIMESTAMP2GES);
         assert(att);
         if (attrType == "tstamp2.ges") {
             att->SetTstamp2Ges(att->StrToMeasurebeat(attrValue));
@@ -1417,28 +1417,28 @@ bool AttModule::SetGestural(Object *element, const std::string &attrType, const
 void AttModule::GetGestural(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_ACCIDENTALGES)) {
-        const AttAccidentalGes *att = dynamic_cast<const AttAccidentalGes *>(element);
+        const AttAccidentalGes *att = element->GetAtt<AttAccidentalGes>(ATT_ACCIDENTALGES);
         assert(att);
         if (att->HasAccidGes()) {
             attributes->push_back({ "accid.ges", att->AccidentalGesturalToStr(att->GetAccidGes()) });
         }
     }
     if (element->HasAttClass(ATT_ARTICULATIONGES)) {
-        const AttArticulationGes *att = dynamic_cast<const AttArticulationGes *>(element);
+        const AttArticulationGes *att = element->GetAtt<AttArticulationGes>(ATT_ARTICULATIONGES);
         assert(att);
         if (att->HasArticGes()) {
             attributes->push_back({ "artic.ges", att->ArticulationListToStr(att->GetArticGes()) });
         }
     }
     if (element->HasAttClass(ATT_BENDGES)) {
-        const AttBendGes *att = dynamic_cast<const AttBendGes *>(element);
+        const AttBendGes *att = element->GetAtt<AttBendGes>(ATT_BENDGES);
         assert(att);
         if (att->HasAmount()) {
             attributes->push_back({ "amount", att->DblToStr(att->GetAmount()) });
         }
     }
     if (element->HasAttClass(ATT_DURATIONGES)) {
-        const AttDurationGes *att = dynamic_cast<const AttDurationGes *>(element);
+        const AttDurationGes *att = element->GetAtt<AttDurationGes>(ATT_DURATIONGES);
         assert(att);
         if (att->HasDurGes()) {
             attributes->push_back({ "dur.ges", att->DurationToStr(att->GetDurGes()) });
@@ -1460,14 +1460,14 @@ void AttModule::GetGestural(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_MDIVGES)) {
-        const AttMdivGes *att = dynamic_cast<const AttMdivGes *>(element);
+        const AttMdivGes *att = element->GetAtt<AttMdivGes>(ATT_MDIVGES);
         assert(att);
         if (att->HasAttacca()) {
             attributes->push_back({ "attacca", att->BooleanToStr(att->GetAttacca()) });
         }
     }
     if (element->HasAttClass(ATT_NCGES)) {
-        const AttNcGes *att = dynamic_cast<const AttNcGes *>(element);
+        const AttNcGes *att = element->GetAtt<AttNcGes>(ATT_NCGES);
         assert(att);
         if (att->HasOctGes()) {
             attributes->push_back({ "oct.ges", att->OctaveToStr(att->GetOctGes()) });
@@ -1480,7 +1480,7 @@ void AttModule::GetGestural(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_NOTEGES)) {
-        const AttNoteGes *att = dynamic_cast<const AttNoteGes *>(element);
+        const AttNoteGes *att = element->GetAtt<AttNoteGes>(ATT_NOTEGES);
         assert(att);
         if (att->HasExtremis()) {
             attributes->push_back({ "extremis", att->NoteGesExtremisToStr(att->GetExtremis()) });
@@ -1496,7 +1496,7 @@ void AttModule::GetGestural(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_ORNAMENTACCIDGES)) {
-        const AttOrnamentAccidGes *att = dynamic_cast<const AttOrnamentAccidGes *>(element);
+        const AttOrnamentAccidGes *att = element->GetAtt<AttOrnamentAccidGes>(ATT_ORNAMENTACCIDGES);
         assert(att);
         if (att->HasAccidupperGes()) {
             attributes->push_back({ "accidupper.ges", att->AccidentalGesturalToStr(att->GetAccidupperGes()) });
@@ -1506,14 +1506,14 @@ void AttModule::GetGestural(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_SECTIONGES)) {
-        const AttSectionGes *att = dynamic_cast<const AttSectionGes *>(element);
+        const AttSectionGes *att = element->GetAtt<AttSectionGes>(ATT_SECTIONGES);
         assert(att);
         if (att->HasAttacca()) {
             attributes->push_back({ "attacca", att->BooleanToStr(att->GetAttacca()) });
         }
     }
     if (element->HasAttClass(ATT_SOUNDLOCATION)) {
-        const AttSoundLocation *att = dynamic_cast<const AttSoundLocation *>(element);
+        const AttSoundLocation *att = element->GetAtt<AttSoundLocation>(ATT_SOUNDLOCATION);
         assert(att);
         if (att->HasAzimuth()) {
             attributes->push_back({ "azimuth", att->DblToStr(att->GetAzimuth()) });
@@ -1523,7 +1523,7 @@ void AttModule::GetGestural(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_TIMESTAMPGES)) {
-        const AttTimestampGes *att = dynamic_cast<const AttTimestampGes *>(element);
+        const AttTimestampGes *att = element->GetAtt<AttTimestampGes>(ATT_TIMESTAMPGES);
         assert(att);
         if (att->HasTstampGes()) {
             attributes->push_back({ "tstamp.ges", att->DblToStr(att->GetTstampGes()) });
@@ -1533,7 +1533,7 @@ void AttModule::GetGestural(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_TIMESTAMP2GES)) {
-        const AttTimestamp2Ges *att = dynamic_cast<const AttTimestamp2Ges *>(element);
+        const AttTimestamp2Ges *att = element->GetAtt<AttTimestamp2Ges>(ATT_TIMESTAMP2GES);
         assert(att);
         if (att->HasTstamp2Ges()) {
             attributes->push_back({ "tstamp2.ges", att->MeasurebeatToStr(att->GetTstamp2Ges()) });
@@ -1557,7 +1557,7 @@ namespace vrv {
 bool AttModule::SetHarmony(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_HARMLOG)) {
-        AttHarmLog *att = dynamic_cast<AttHarmLog *>(element);
+        AttHarmLog *att = element->GetAtt<AttHarmLog>(ATT_HARMLOG);
         assert(att);
         if (attrType == "chordref") {
             att->SetChordref(att->StrToStr(attrValue));
@@ -1571,7 +1571,7 @@ bool AttModule::SetHarmony(Object *element, const std::string &attrType, const s
 void AttModule::GetHarmony(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_HARMLOG)) {
-        const AttHarmLog *att = dynamic_cast<const AttHarmLog *>(element);
+        const AttHarmLog *att = element->GetAtt<AttHarmLog>(ATT_HARMLOG);
         assert(att);
         if (att->HasChordref()) {
             attributes->push_back({ "chordref", att->StrToStr(att->GetChordref()) });
@@ -1592,7 +1592,7 @@ namespace vrv {
 bool AttModule::SetHeader(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_BIFOLIUMSURFACES)) {
-        AttBifoliumSurfaces *att = dynamic_cast<AttBifoliumSurfaces *>(element);
+        AttBifoliumSurfaces *att = element->GetAtt<AttBifoliumSurfaces>(ATT_BIFOLIUMSURFACES);
         assert(att);
         if (attrType == "outer.recto") {
             att->SetOuterRecto(att->StrToStr(attrValue));
@@ -1612,7 +1612,7 @@ bool AttModule::SetHeader(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_FOLIUMSURFACES)) {
-        AttFoliumSurfaces *att = dynamic_cast<AttFoliumSurfaces *>(element);
+        AttFoliumSurfaces *att = element->GetAtt<AttFoliumSurfaces>(ATT_FOLIUMSURFACES);
         assert(att);
         if (attrType == "recto") {
             att->SetRecto(att->StrToStr(attrValue));
@@ -1624,7 +1624,7 @@ bool AttModule::SetHeader(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_RECORDTYPE)) {
-        AttRecordType *att = dynamic_cast<AttRecordType *>(element);
+        AttRecordType *att = element->GetAtt<AttRecordType>(ATT_RECORDTYPE);
         assert(att);
         if (attrType == "recordtype") {
             att->SetRecordtype(att->StrToRecordTypeRecordtype(attrValue));
@@ -1632,7 +1632,7 @@ bool AttModule::SetHeader(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_REGULARMETHOD)) {
-        AttRegularMethod *att = dynamic_cast<AttRegularMethod *>(element);
+        AttRegularMethod *att = element->GetAtt<AttRegularMethod>(ATT_REGULARMETHOD);
         assert(att);
         if (attrType == "method") {
             att->SetMethod(att->StrToRegularMethodMethod(attrValue));
@@ -1646,7 +1646,7 @@ bool AttModule::SetHeader(Object *element, const std::string &attrType, const st
 void AttModule::GetHeader(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_BIFOLIUMSURFACES)) {
-        const AttBifoliumSurfaces *att = dynamic_cast<const AttBifoliumSurfaces *>(element);
+        const AttBifoliumSurfaces *att = element->GetAtt<AttBifoliumSurfaces>(ATT_BIFOLIUMSURFACES);
         assert(att);
         if (att->HasOuterRecto()) {
             attributes->push_back({ "outer.recto", att->StrToStr(att->GetOuterRecto()) });
@@ -1662,7 +1662,7 @@ void AttModule::GetHeader(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_FOLIUMSURFACES)) {
-        const AttFoliumSurfaces *att = dynamic_cast<const AttFoliumSurfaces *>(element);
+        const AttFoliumSurfaces *att = element->GetAtt<AttFoliumSurfaces>(ATT_FOLIUMSURFACES);
         assert(att);
         if (att->HasRecto()) {
             attributes->push_back({ "recto", att->StrToStr(att->GetRecto()) });
@@ -1672,14 +1672,14 @@ void AttModule::GetHeader(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_RECORDTYPE)) {
-        const AttRecordType *att = dynamic_cast<const AttRecordType *>(element);
+        const AttRecordType *att = element->GetAtt<AttRecordType>(ATT_RECORDTYPE);
         assert(att);
         if (att->HasRecordtype()) {
             attributes->push_back({ "recordtype", att->RecordTypeRecordtypeToStr(att->GetRecordtype()) });
         }
     }
     if (element->HasAttClass(ATT_REGULARMETHOD)) {
-        const AttRegularMethod *att = dynamic_cast<const AttRegularMethod *>(element);
+        const AttRegularMethod *att = element->GetAtt<AttRegularMethod>(ATT_REGULARMETHOD);
         assert(att);
         if (att->HasMethod()) {
             attributes->push_back({ "method", att->RegularMethodMethodToStr(att->GetMethod()) });
@@ -1700,7 +1700,7 @@ namespace vrv {
 bool AttModule::SetMensural(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_DURATIONQUALITY)) {
-        AttDurationQuality *att = dynamic_cast<AttDurationQuality *>(element);
+        AttDurationQuality *att = element->GetAtt<AttDurationQuality>(ATT_DURATIONQUALITY);
         assert(att);
         if (attrType == "dur.quality") {
             att->SetDurQuality(att->StrToDurqualityMensural(attrValue));
@@ -1708,7 +1708,7 @@ bool AttModule::SetMensural(Object *element, const std::string &attrType, const
         }
     }
     if (element->HasAttClass(ATT_MENSURALLOG)) {
-        AttMensuralLog *att = dynamic_cast<AttMensuralLog *>(element);
+        AttMensuralLog *att = element->GetAtt<AttMensuralLog>(ATT_MENSURALLOG);
         assert(att);
         if (attrType == "proport.num") {
             att->SetProportNum(att->StrToInt(attrValue));
@@ -1720,7 +1720,7 @@ bool AttModule::SetMensural(Object *element, const std::string &attrType, const
         }
     }
     if (element->HasAttClass(ATT_MENSURALSHARED)) {
-        AttMensuralShared *att = dynamic_cast<AttMensuralShared *>(element);
+        AttMensuralShared *att = element->GetAtt<AttMensuralShared>(ATT_MENSURALSHARED);
         assert(att);
         if (attrType == "modusmaior") {
             att->SetModusmaior(att->StrToModusmaior(attrValue));
@@ -1744,7 +1744,7 @@ bool AttModule::SetMensural(Object *element, const std::string &attrType, const
         }
     }
     if (element->HasAttClass(ATT_NOTEVISMENSURAL)) {
-        AttNoteVisMensural *att = dynamic_cast<AttNoteVisMensural *>(element);
+        AttNoteVisMensural *att = element->GetAtt<AttNoteVisMensural>(ATT_NOTEVISMENSURAL);
         assert(att);
         if (attrType == "lig") {
             att->SetLig(att->StrToLigatureform(attrValue));
@@ -1752,7 +1752,7 @@ bool AttModule::SetMensural(Object *element, const std::string &attrType, const
         }
     }
     if (element->HasAttClass(ATT_RESTVISMENSURAL)) {
-        AttRestVisMensural *att = dynamic_cast<AttRestVisMensural *>(element);
+        AttRestVisMensural *att = element->GetAtt<AttRestVisMensural>(ATT_RESTVISMENSURAL);
         assert(att);
         if (attrType == "spaces") {
             att->SetSpaces(att->StrToInt(attrValue));
@@ -1760,7 +1760,7 @@ bool AttModule::SetMensural(Object *element, const std::string &attrType, const
         }
     }
     if (element->HasAttClass(ATT_STEMSMENSURAL)) {
-        AttStemsMensural *att = dynamic_cast<AttStemsMensural *>(element);
+        AttStemsMensural *att = element->GetAtt<AttStemsMensural>(ATT_STEMSMENSURAL);
         assert(att);
         if (attrType == "stem.form") {
             att->SetStemForm(att->StrToStemformMensural(attrValue));
@@ -1774,14 +1774,14 @@ bool AttModule::SetMensural(Object *element, const std::string &attrType, const
 void AttModule::GetMensural(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_DURATIONQUALITY)) {
-        const AttDurationQuality *att = dynamic_cast<const AttDurationQuality *>(element);
+        const AttDurationQuality *att = element->GetAtt<AttDurationQuality>(ATT_DURATIONQUALITY);
         assert(att);
         if (att->HasDurQuality()) {
             attributes->push_back({ "dur.quality", att->DurqualityMensuralToStr(att->GetDurQuality()) });
         }
     }
     if (element->HasAttClass(ATT_MENSURALLOG)) {
-        const AttMensuralLog *att = dynamic_cast<const AttMensuralLog *>(element);
+        const AttMensuralLog *att = element->GetAtt<AttMensuralLog>(ATT_MENSURALLOG);
         assert(att);
         if (att->HasProportNum()) {
             attributes->push_back({ "proport.num", att->IntToStr(att->GetProportNum()) });
@@ -1791,7 +1791,7 @@ void AttModule::GetMensural(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_MENSURALSHARED)) {
-        const AttMensuralShared *att = dynamic_cast<const AttMensuralShared *>(element);
+        const AttMensuralShared *att = element->GetAtt<AttMensuralShared>(ATT_MENSURALSHARED);
         assert(att);
         if (att->HasModusmaior()) {
             attributes->push_back({ "modusmaior", att->ModusmaiorToStr(att->GetModusmaior()) });
@@ -1810,21 +1810,21 @@ void AttModule::GetMensural(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_NOTEVISMENSURAL)) {
-        const AttNoteVisMensural *att = dynamic_cast<const AttNoteVisMensural *>(element);
+        const AttNoteVisMensural *att = element->GetAtt<AttNoteVisMensural>(ATT_NOTEVISMENSURAL);
         assert(att);
         if (att->HasLig()) {
             attributes->push_back({ "lig", att->LigatureformToStr(att->GetLig()) });
         }
     }
     if (element->HasAttClass(ATT_RESTVISMENSURAL)) {
-        const AttRestVisMensural *att = dynamic_cast<const AttRestVisMensural *>(element);
+        const AttRestVisMensural *att = element->GetAtt<AttRestVisMensural>(ATT_RESTVISMENSURAL);
         assert(att);
         if (att->HasSpaces()) {
             attributes->push_back({ "spaces", att->IntToStr(att->GetSpaces()) });
         }
     }
     if (element->HasAttClass(ATT_STEMSMENSURAL)) {
-        const AttStemsMensural *att = dynamic_cast<const AttStemsMensural *>(element);
+        const AttStemsMensural *att = element->GetAtt<AttStemsMensural>(ATT_STEMSMENSURAL);
         assert(att);
         if (att->HasStemForm()) {
             attributes->push_back({ "stem.form", att->StemformMensuralToStr(att->GetStemForm()) });
@@ -1845,7 +1845,7 @@ namespace vrv {
 bool AttModule::SetMidi(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_CHANNELIZED)) {
-        AttChannelized *att = dynamic_cast<AttChannelized *>(element);
+        AttChannelized *att = element->GetAtt<AttChannelized>(ATT_CHANNELIZED);
         assert(att);
         if (attrType == "midi.channel") {
             att->SetMidiChannel(att->StrToMidichannel(attrValue));
@@ -1865,7 +1865,7 @@ bool AttModule::SetMidi(Object *element, const std::string &attrType, const std:
         }
     }
     if (element->HasAttClass(ATT_INSTRUMENTIDENT)) {
-        AttInstrumentIdent *att = dynamic_cast<AttInstrumentIdent *>(element);
+        AttInstrumentIdent *att = element->GetAtt<AttInstrumentIdent>(ATT_INSTRUMENTIDENT);
         assert(att);
         if (attrType == "instr") {
             att->SetInstr(att->StrToStr(attrValue));
@@ -1873,7 +1873,7 @@ bool AttModule::SetMidi(Object *element, const std::string &attrType, const std:
         }
     }
     if (element->HasAttClass(ATT_MIDIINSTRUMENT)) {
-        AttMidiInstrument *att = dynamic_cast<AttMidiInstrument *>(element);
+        AttMidiInstrument *att = element->GetAtt<AttMidiInstrument>(ATT_MIDIINSTRUMENT);
         assert(att);
         if (attrType == "midi.instrnum") {
             att->SetMidiInstrnum(att->StrToMidivalue(attrValue));
@@ -1901,7 +1901,7 @@ bool AttModule::SetMidi(Object *element, const std::string &attrType, const std:
         }
     }
     if (element->HasAttClass(ATT_MIDINUMBER)) {
-        AttMidiNumber *att = dynamic_cast<AttMidiNumber *>(element);
+        AttMidiNumber *att = element->GetAtt<AttMidiNumber>(ATT_MIDINUMBER);
         assert(att);
         if (attrType == "num") {
             att->SetNum(att->StrToMidivalue(attrValue));
@@ -1909,7 +1909,7 @@ bool AttModule::SetMidi(Object *element, const std::string &attrType, const std:
         }
     }
     if (element->HasAttClass(ATT_MIDITEMPO)) {
-        AttMidiTempo *att = dynamic_cast<AttMidiTempo *>(element);
+        AttMidiTempo *att = element->GetAtt<AttMidiTempo>(ATT_MIDITEMPO);
         assert(att);
         if (attrType == "midi.bpm") {
             att->SetMidiBpm(att->StrToDbl(attrValue));
@@ -1921,7 +1921,7 @@ bool AttModule::SetMidi(Object *element, const std::string &attrType, const std:
         }
     }
     if (element->HasAttClass(ATT_MIDIVALUE)) {
-        AttMidiValue *att = dynamic_cast<AttMidiValue *>(element);
+        AttMidiValue *att = element->GetAtt<AttMidiValue>(ATT_MIDIVALUE);
         assert(att);
         if (attrType == "val") {
             att->SetVal(att->StrToMidivalue(attrValue));
@@ -1929,7 +1929,7 @@ bool AttModule::SetMidi(Object *element, const std::string &attrType, const std:
         }
     }
     if (element->HasAttClass(ATT_MIDIVALUE2)) {
-        AttMidiValue2 *att = dynamic_cast<AttMidiValue2 *>(element);
+        AttMidiValue2 *att = element->GetAtt<AttMidiValue2>(ATT_MIDIVALUE2);
         assert(att);
         if (attrType == "val2") {
             att->SetVal2(att->StrToMidivalue(attrValue));
@@ -1937,7 +1937,7 @@ bool AttModule::SetMidi(Object *element, const std::string &attrType, const std:
         }
     }
     if (element->HasAttClass(ATT_MIDIVELOCITY)) {
-        AttMidiVelocity *att = dynamic_cast<AttMidiVelocity *>(element);
+        AttMidiVelocity *att = element->GetAtt<AttMidiVelocity>(ATT_MIDIVELOCITY);
         assert(att);
         if (attrType == "vel") {
             att->SetVel(att->StrToMidivalue(attrValue));
@@ -1945,7 +1945,7 @@ bool AttModule::SetMidi(Object *element, const std::string &attrType, const std:
         }
     }
     if (element->HasAttClass(ATT_TIMEBASE)) {
-        AttTimeBase *att = dynamic_cast<AttTimeBase *>(element);
+        AttTimeBase *att = element->GetAtt<AttTimeBase>(ATT_TIMEBASE);
         assert(att);
         if (attrType == "ppq") {
             att->SetPpq(att->StrToInt(attrValue));
@@ -1959,7 +1959,7 @@ bool AttModule::SetMidi(Object *element, const std::string &attrType, const std:
 void AttModule::GetMidi(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_CHANNELIZED)) {
-        const AttChannelized *att = dynamic_cast<const AttChannelized *>(element);
+        const AttChannelized *att = element->GetAtt<AttChannelized>(ATT_CHANNELIZED);
         assert(att);
         if (att->HasMidiChannel()) {
             attributes->push_back({ "midi.channel", att->MidichannelToStr(att->GetMidiChannel()) });
@@ -1975,14 +1975,14 @@ void AttModule::GetMidi(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_INSTRUMENTIDENT)) {
-        const AttInstrumentIdent *att = dynamic_cast<const AttInstrumentIdent *>(element);
+        const AttInstrumentIdent *att = element->GetAtt<AttInstrumentIdent>(ATT_INSTRUMENTIDENT);
         assert(att);
         if (att->HasInstr()) {
             attributes->push_back({ "instr", att->StrToStr(att->GetInstr()) });
         }
     }
     if (element->HasAttClass(ATT_MIDIINSTRUMENT)) {
-        const AttMidiInstrument *att = dynamic_cast<const AttMidiInstrument *>(element);
+        const AttMidiInstrument *att = element->GetAtt<AttMidiInstrument>(ATT_MIDIINSTRUMENT);
         assert(att);
         if (att->HasMidiInstrnum()) {
             attributes->push_back({ "midi.instrnum", att->MidivalueToStr(att->GetMidiInstrnum()) });
@@ -2004,14 +2004,14 @@ void AttModule::GetMidi(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_MIDINUMBER)) {
-        const AttMidiNumber *att = dynamic_cast<const AttMidiNumber *>(element);
+        const AttMidiNumber *att = element->GetAtt<AttMidiNumber>(ATT_MIDINUMBER);
         assert(att);
         if (att->HasNum()) {
             attributes->push_back({ "num", att->MidivalueToStr(att->GetNum()) });
         }
     }
     if (element->HasAttClass(ATT_MIDITEMPO)) {
-        const AttMidiTempo *att = dynamic_cast<const AttMidiTempo *>(element);
+        const AttMidiTempo *att = element->GetAtt<AttMidiTempo>(ATT_MIDITEMPO);
         assert(att);
         if (att->HasMidiBpm()) {
             attributes->push_back({ "midi.bpm", att->DblToStr(att->GetMidiBpm()) });
@@ -2021,28 +2021,28 @@ void AttModule::GetMidi(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_MIDIVALUE)) {
-        const AttMidiValue *att = dynamic_cast<const AttMidiValue *>(element);
+        const AttMidiValue *att = element->GetAtt<AttMidiValue>(ATT_MIDIVALUE);
         assert(att);
         if (att->HasVal()) {
             attributes->push_back({ "val", att->MidivalueToStr(att->GetVal()) });
         }
     }
     if (element->HasAttClass(ATT_MIDIVALUE2)) {
-        const AttMidiValue2 *att = dynamic_cast<const AttMidiValue2 *>(element);
+        const AttMidiValue2 *att = element->GetAtt<AttMidiValue2>(ATT_MIDIVALUE2);
         assert(att);
         if (att->HasVal2()) {
             attributes->push_back({ "val2", att->MidivalueToStr(att->GetVal2()) });
         }
     }
     if (element->HasAttClass(ATT_MIDIVELOCITY)) {
-        const AttMidiVelocity *att = dynamic_cast<const AttMidiVelocity *>(element);
+        const AttMidiVelocity *att = element->GetAtt<AttMidiVelocity>(ATT_MIDIVELOCITY);
         assert(att);
         if (att->HasVel()) {
             attributes->push_back({ "vel", att->MidivalueToStr(att->GetVel()) });
         }
     }
     if (element->HasAttClass(ATT_TIMEBASE)) {
-        const AttTimeBase *att = dynamic_cast<const AttTimeBase *>(element);
+        const AttTimeBase *att = element->GetAtt<AttTimeBase>(ATT_TIMEBASE);
         assert(att);
         if (att->HasPpq()) {
             attributes->push_back({ "ppq", att->IntToStr(att->GetPpq()) });
@@ -2063,7 +2063,7 @@ namespace vrv {
 bool AttModule::SetNeumes(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_NCLOG)) {
-        AttNcLog *att = dynamic_cast<AttNcLog *>(element);
+        AttNcLog *att = element->GetAtt<AttNcLog>(ATT_NCLOG);
         assert(att);
         if (attrType == "oct") {
             att->SetOct(att->StrToStr(attrValue));
@@ -2075,7 +2075,7 @@ bool AttModule::SetNeumes(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_NCFORM)) {
-        AttNcForm *att = dynamic_cast<AttNcForm *>(element);
+        AttNcForm *att = element->GetAtt<AttNcForm>(ATT_NCFORM);
         assert(att);
         if (attrType == "angled") {
             att->SetAngled(att->StrToBoolean(attrValue));
@@ -2117,7 +2117,7 @@ bool AttModule::SetNeumes(Object *element, const std::string &attrType, const st
 void AttModule::GetNeumes(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_NCLOG)) {
-        const AttNcLog *att = dynamic_cast<const AttNcLog *>(element);
+        const AttNcLog *att = element->GetAtt<AttNcLog>(ATT_NCLOG);
         assert(att);
         if (att->HasOct()) {
             attributes->push_back({ "oct", att->StrToStr(att->GetOct()) });
@@ -2127,7 +2127,7 @@ void AttModule::GetNeumes(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_NCFORM)) {
-        const AttNcForm *att = dynamic_cast<const AttNcForm *>(element);
+        const AttNcForm *att = element->GetAtt<AttNcForm>(ATT_NCFORM);
         assert(att);
         if (att->HasAngled()) {
             attributes->push_back({ "angled", att->BooleanToStr(att->GetAngled()) });
@@ -2169,7 +2169,7 @@ namespace vrv {
 bool AttModule::SetPagebased(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_MARGINS)) {
-        AttMargins *att = dynamic_cast<AttMargins *>(element);
+        AttMargins *att = element->GetAtt<AttMargins>(ATT_MARGINS);
         assert(att);
         if (attrType == "topmar") {
             att->SetTopmar(att->StrToMeasurementunsigned(attrValue));
@@ -2195,7 +2195,7 @@ bool AttModule::SetPagebased(Object *element, const std::string &attrType, const
 void AttModule::GetPagebased(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_MARGINS)) {
-        const AttMargins *att = dynamic_cast<const AttMargins *>(element);
+        const AttMargins *att = element->GetAtt<AttMargins>(ATT_MARGINS);
         assert(att);
         if (att->HasTopmar()) {
             attributes->push_back({ "topmar", att->MeasurementunsignedToStr(att->GetTopmar()) });
@@ -2225,7 +2225,7 @@ namespace vrv {
 bool AttModule::SetPerformance(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_ALIGNMENT)) {
-        AttAlignment *att = dynamic_cast<AttAlignment *>(element);
+        AttAlignment *att = element->GetAtt<AttAlignment>(ATT_ALIGNMENT);
         assert(att);
         if (attrType == "when") {
             att->SetWhen(att->StrToStr(attrValue));
@@ -2239,7 +2239,7 @@ bool AttModule::SetPerformance(Object *element, const std::string &attrType, con
 void AttModule::GetPerformance(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_ALIGNMENT)) {
-        const AttAlignment *att = dynamic_cast<const AttAlignment *>(element);
+        const AttAlignment *att = element->GetAtt<AttAlignment>(ATT_ALIGNMENT);
         assert(att);
         if (att->HasWhen()) {
             attributes->push_back({ "when", att->StrToStr(att->GetWhen()) });
@@ -2260,7 +2260,7 @@ namespace vrv {
 bool AttModule::SetShared(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_ACCIDLOG)) {
-        AttAccidLog *att = dynamic_cast<AttAccidLog *>(element);
+        AttAccidLog *att = element->GetAtt<AttAccidLog>(ATT_ACCIDLOG);
         assert(att);
         if (attrType == "func") {
             att->SetFunc(att->StrToAccidLogFunc(attrValue));
@@ -2268,7 +2268,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_ACCIDENTAL)) {
-        AttAccidental *att = dynamic_cast<AttAccidental *>(element);
+        AttAccidental *att = element->GetAtt<AttAccidental>(ATT_ACCIDENTAL);
         assert(att);
         if (attrType == "accid") {
             att->SetAccid(att->StrToAccidentalWritten(attrValue));
@@ -2276,7 +2276,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_ARTICULATION)) {
-        AttArticulation *att = dynamic_cast<AttArticulation *>(element);
+        AttArticulation *att = element->GetAtt<AttArticulation>(ATT_ARTICULATION);
         assert(att);
         if (attrType == "artic") {
             att->SetArtic(att->StrToArticulationList(attrValue));
@@ -2284,7 +2284,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_ATTACCALOG)) {
-        AttAttaccaLog *att = dynamic_cast<AttAttaccaLog *>(element);
+        AttAttaccaLog *att = element->GetAtt<AttAttaccaLog>(ATT_ATTACCALOG);
         assert(att);
         if (attrType == "target") {
             att->SetTarget(att->StrToStr(attrValue));
@@ -2292,7 +2292,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_AUDIENCE)) {
-        AttAudience *att = dynamic_cast<AttAudience *>(element);
+        AttAudience *att = element->GetAtt<AttAudience>(ATT_AUDIENCE);
         assert(att);
         if (attrType == "audience") {
             att->SetAudience(att->StrToAudienceAudience(attrValue));
@@ -2300,7 +2300,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_AUGMENTDOTS)) {
-        AttAugmentDots *att = dynamic_cast<AttAugmentDots *>(element);
+        AttAugmentDots *att = element->GetAtt<AttAugmentDots>(ATT_AUGMENTDOTS);
         assert(att);
         if (attrType == "dots") {
             att->SetDots(att->StrToInt(attrValue));
@@ -2308,7 +2308,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_AUTHORIZED)) {
-        AttAuthorized *att = dynamic_cast<AttAuthorized *>(element);
+        AttAuthorized *att = element->GetAtt<AttAuthorized>(ATT_AUTHORIZED);
         assert(att);
         if (attrType == "auth") {
             att->SetAuth(att->StrToStr(attrValue));
@@ -2320,7 +2320,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_BARLINELOG)) {
-        AttBarLineLog *att = dynamic_cast<AttBarLineLog *>(element);
+        AttBarLineLog *att = element->GetAtt<AttBarLineLog>(ATT_BARLINELOG);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToBarrendition(attrValue));
@@ -2328,7 +2328,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_BARRING)) {
-        AttBarring *att = dynamic_cast<AttBarring *>(element);
+        AttBarring *att = element->GetAtt<AttBarring>(ATT_BARRING);
         assert(att);
         if (attrType == "bar.len") {
             att->SetBarLen(att->StrToDbl(attrValue));
@@ -2344,7 +2344,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_BASIC)) {
-        AttBasic *att = dynamic_cast<AttBasic *>(element);
+        AttBasic *att = element->GetAtt<AttBasic>(ATT_BASIC);
         assert(att);
         if (attrType == "xml:base") {
             att->SetBase(att->StrToStr(attrValue));
@@ -2352,7 +2352,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_BIBL)) {
-        AttBibl *att = dynamic_cast<AttBibl *>(element);
+        AttBibl *att = element->GetAtt<AttBibl>(ATT_BIBL);
         assert(att);
         if (attrType == "analog") {
             att->SetAnalog(att->StrToStr(attrValue));
@@ -2360,7 +2360,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_CALENDARED)) {
-        AttCalendared *att = dynamic_cast<AttCalendared *>(element);
+        AttCalendared *att = element->GetAtt<AttCalendared>(ATT_CALENDARED);
         assert(att);
         if (attrType == "calendar") {
             att->SetCalendar(att->StrToStr(attrValue));
@@ -2368,7 +2368,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_CANONICAL)) {
-        AttCanonical *att = dynamic_cast<AttCanonical *>(element);
+        AttCanonical *att = element->GetAtt<AttCanonical>(ATT_CANONICAL);
         assert(att);
         if (attrType == "codedval") {
             att->SetCodedval(att->StrToStr(attrValue));
@@ -2376,7 +2376,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_CLASSED)) {
-        AttClassed *att = dynamic_cast<AttClassed *>(element);
+        AttClassed *att = element->GetAtt<AttClassed>(ATT_CLASSED);
         assert(att);
         if (attrType == "class") {
             att->SetClass(att->StrToStr(attrValue));
@@ -2384,7 +2384,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_CLEFLOG)) {
-        AttClefLog *att = dynamic_cast<AttClefLog *>(element);
+        AttClefLog *att = element->GetAtt<AttClefLog>(ATT_CLEFLOG);
         assert(att);
         if (attrType == "cautionary") {
             att->SetCautionary(att->StrToBoolean(attrValue));
@@ -2392,7 +2392,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_CLEFSHAPE)) {
-        AttClefShape *att = dynamic_cast<AttClefShape *>(element);
+        AttClefShape *att = element->GetAtt<AttClefShape>(ATT_CLEFSHAPE);
         assert(att);
         if (attrType == "shape") {
             att->SetShape(att->StrToClefshape(attrValue));
@@ -2400,7 +2400,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_CLEFFINGLOG)) {
-        AttCleffingLog *att = dynamic_cast<AttCleffingLog *>(element);
+        AttCleffingLog *att = element->GetAtt<AttCleffingLog>(ATT_CLEFFINGLOG);
         assert(att);
         if (attrType == "clef.shape") {
             att->SetClefShape(att->StrToClefshape(attrValue));
@@ -2420,7 +2420,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_COLOR)) {
-        AttColor *att = dynamic_cast<AttColor *>(element);
+        AttColor *att = element->GetAtt<AttColor>(ATT_COLOR);
         assert(att);
         if (attrType == "color") {
             att->SetColor(att->StrToStr(attrValue));
@@ -2428,7 +2428,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_COLORATION)) {
-        AttColoration *att = dynamic_cast<AttColoration *>(element);
+        AttColoration *att = element->GetAtt<AttColoration>(ATT_COLORATION);
         assert(att);
         if (attrType == "colored") {
             att->SetColored(att->StrToBoolean(attrValue));
@@ -2436,7 +2436,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_COORDX1)) {
-        AttCoordX1 *att = dynamic_cast<AttCoordX1 *>(element);
+        AttCoordX1 *att = element->GetAtt<AttCoordX1>(ATT_COORDX1);
         assert(att);
         if (attrType == "coord.x1") {
             att->SetCoordX1(att->StrToDbl(attrValue));
@@ -2444,7 +2444,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_COORDX2)) {
-        AttCoordX2 *att = dynamic_cast<AttCoordX2 *>(element);
+        AttCoordX2 *att = element->GetAtt<AttCoordX2>(ATT_COORDX2);
         assert(att);
         if (attrType == "coord.x2") {
             att->SetCoordX2(att->StrToDbl(attrValue));
@@ -2452,7 +2452,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_COORDY1)) {
-        AttCoordY1 *att = dynamic_cast<AttCoordY1 *>(element);
+        AttCoordY1 *att = element->GetAtt<AttCoordY1>(ATT_COORDY1);
         assert(att);
         if (attrType == "coord.y1") {
             att->SetCoordY1(att->StrToDbl(attrValue));
@@ -2460,7 +2460,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_COORDINATED)) {
-        AttCoordinated *att = dynamic_cast<AttCoordinated *>(element);
+        AttCoordinated *att = element->GetAtt<AttCoordinated>(ATT_COORDINATED);
         assert(att);
         if (attrType == "ulx") {
             att->SetUlx(att->StrToInt(attrValue));
@@ -2484,7 +2484,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_CUE)) {
-        AttCue *att = dynamic_cast<AttCue *>(element);
+        AttCue *att = element->GetAtt<AttCue>(ATT_CUE);
         assert(att);
         if (attrType == "cue") {
             att->SetCue(att->StrToBoolean(attrValue));
@@ -2492,7 +2492,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_CURVATURE)) {
-        AttCurvature *att = dynamic_cast<AttCurvature *>(element);
+        AttCurvature *att = element->GetAtt<AttCurvature>(ATT_CURVATURE);
         assert(att);
         if (attrType == "bezier") {
             att->SetBezier(att->StrToStr(attrValue));
@@ -2508,7 +2508,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_CURVEREND)) {
-        AttCurveRend *att = dynamic_cast<AttCurveRend *>(element);
+        AttCurveRend *att = element->GetAtt<AttCurveRend>(ATT_CURVEREND);
         assert(att);
         if (attrType == "lform") {
             att->SetLform(att->StrToLineform(attrValue));
@@ -2520,7 +2520,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_CUSTOSLOG)) {
-        AttCustosLog *att = dynamic_cast<AttCustosLog *>(element);
+        AttCustosLog *att = element->GetAtt<AttCustosLog>(ATT_CUSTOSLOG);
         assert(att);
         if (attrType == "target") {
             att->SetTarget(att->StrToStr(attrValue));
@@ -2528,7 +2528,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_DATAPOINTING)) {
-        AttDataPointing *att = dynamic_cast<AttDataPointing *>(element);
+        AttDataPointing *att = element->GetAtt<AttDataPointing>(ATT_DATAPOINTING);
         assert(att);
         if (attrType == "data") {
             att->SetData(att->StrToStr(attrValue));
@@ -2536,7 +2536,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_DATABLE)) {
-        AttDatable *att = dynamic_cast<AttDatable *>(element);
+        AttDatable *att = element->GetAtt<AttDatable>(ATT_DATABLE);
         assert(att);
         if (attrType == "enddate") {
             att->SetEnddate(att->StrToStr(attrValue));
@@ -2560,7 +2560,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_DISTANCES)) {
-        AttDistances *att = dynamic_cast<AttDistances *>(element);
+        AttDistances *att = element->GetAtt<AttDistances>(ATT_DISTANCES);
         assert(att);
         if (attrType == "dir.dist") {
             att->SetDirDist(att->StrToMeasurementsigned(attrValue));
@@ -2584,7 +2584,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_DOTLOG)) {
-        AttDotLog *att = dynamic_cast<AttDotLog *>(element);
+        AttDotLog *att = element->GetAtt<AttDotLog>(ATT_DOTLOG);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToDotLogForm(attrValue));
@@ -2592,7 +2592,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_DURATIONADDITIVE)) {
-        AttDurationAdditive *att = dynamic_cast<AttDurationAdditive *>(element);
+        AttDurationAdditive *att = element->GetAtt<AttDurationAdditive>(ATT_DURATIONADDITIVE);
         assert(att);
         if (attrType == "dur") {
             att->SetDur(att->StrToDuration(attrValue));
@@ -2600,7 +2600,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_DURATIONDEFAULT)) {
-        AttDurationDefault *att = dynamic_cast<AttDurationDefault *>(element);
+        AttDurationDefault *att = element->GetAtt<AttDurationDefault>(ATT_DURATIONDEFAULT);
         assert(att);
         if (attrType == "dur.default") {
             att->SetDurDefault(att->StrToDuration(attrValue));
@@ -2616,7 +2616,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_DURATIONLOG)) {
-        AttDurationLog *att = dynamic_cast<AttDurationLog *>(element);
+        AttDurationLog *att = element->GetAtt<AttDurationLog>(ATT_DURATIONLOG);
         assert(att);
         if (attrType == "dur") {
             att->SetDur(att->StrToDuration(attrValue));
@@ -2624,7 +2624,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_DURATIONRATIO)) {
-        AttDurationRatio *att = dynamic_cast<AttDurationRatio *>(element);
+        AttDurationRatio *att = element->GetAtt<AttDurationRatio>(ATT_DURATIONRATIO);
         assert(att);
         if (attrType == "num") {
             att->SetNum(att->StrToInt(attrValue));
@@ -2636,7 +2636,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_ENCLOSINGCHARS)) {
-        AttEnclosingChars *att = dynamic_cast<AttEnclosingChars *>(element);
+        AttEnclosingChars *att = element->GetAtt<AttEnclosingChars>(ATT_ENCLOSINGCHARS);
         assert(att);
         if (attrType == "enclose") {
             att->SetEnclose(att->StrToEnclosure(attrValue));
@@ -2644,7 +2644,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_ENDINGS)) {
-        AttEndings *att = dynamic_cast<AttEndings *>(element);
+        AttEndings *att = element->GetAtt<AttEndings>(ATT_ENDINGS);
         assert(att);
         if (attrType == "ending.rend") {
             att->SetEndingRend(att->StrToEndingsEndingrend(attrValue));
@@ -2652,7 +2652,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_EVIDENCE)) {
-        AttEvidence *att = dynamic_cast<AttEvidence *>(element);
+        AttEvidence *att = element->GetAtt<AttEvidence>(ATT_EVIDENCE);
         assert(att);
         if (attrType == "cert") {
             att->SetCert(att->StrToCertainty(attrValue));
@@ -2664,7 +2664,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_EXTENDER)) {
-        AttExtender *att = dynamic_cast<AttExtender *>(element);
+        AttExtender *att = element->GetAtt<AttExtender>(ATT_EXTENDER);
         assert(att);
         if (attrType == "extender") {
             att->SetExtender(att->StrToBoolean(attrValue));
@@ -2672,7 +2672,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_EXTENT)) {
-        AttExtent *att = dynamic_cast<AttExtent *>(element);
+        AttExtent *att = element->GetAtt<AttExtent>(ATT_EXTENT);
         assert(att);
         if (attrType == "extent") {
             att->SetExtent(att->StrToStr(attrValue));
@@ -2680,7 +2680,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_FERMATAPRESENT)) {
-        AttFermataPresent *att = dynamic_cast<AttFermataPresent *>(element);
+        AttFermataPresent *att = element->GetAtt<AttFermataPresent>(ATT_FERMATAPRESENT);
         assert(att);
         if (attrType == "fermata") {
             att->SetFermata(att->StrToStaffrelBasic(attrValue));
@@ -2688,7 +2688,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_FILING)) {
-        AttFiling *att = dynamic_cast<AttFiling *>(element);
+        AttFiling *att = element->GetAtt<AttFiling>(ATT_FILING);
         assert(att);
         if (attrType == "nonfiling") {
             att->SetNonfiling(att->StrToInt(attrValue));
@@ -2696,7 +2696,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_GRPSYMLOG)) {
-        AttGrpSymLog *att = dynamic_cast<AttGrpSymLog *>(element);
+        AttGrpSymLog *att = element->GetAtt<AttGrpSymLog>(ATT_GRPSYMLOG);
         assert(att);
         if (attrType == "level") {
             att->SetLevel(att->StrToInt(attrValue));
@@ -2704,7 +2704,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_HANDIDENT)) {
-        AttHandIdent *att = dynamic_cast<AttHandIdent *>(element);
+        AttHandIdent *att = element->GetAtt<AttHandIdent>(ATT_HANDIDENT);
         assert(att);
         if (attrType == "hand") {
             att->SetHand(att->StrToStr(attrValue));
@@ -2712,7 +2712,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_HEIGHT)) {
-        AttHeight *att = dynamic_cast<AttHeight *>(element);
+        AttHeight *att = element->GetAtt<AttHeight>(ATT_HEIGHT);
         assert(att);
         if (attrType == "height") {
             att->SetHeight(att->StrToMeasurementunsigned(attrValue));
@@ -2720,7 +2720,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_HORIZONTALALIGN)) {
-        AttHorizontalAlign *att = dynamic_cast<AttHorizontalAlign *>(element);
+        AttHorizontalAlign *att = element->GetAtt<AttHorizontalAlign>(ATT_HORIZONTALALIGN);
         assert(att);
         if (attrType == "halign") {
             att->SetHalign(att->StrToHorizontalalignment(attrValue));
@@ -2728,7 +2728,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_INTERNETMEDIA)) {
-        AttInternetMedia *att = dynamic_cast<AttInternetMedia *>(element);
+        AttInternetMedia *att = element->GetAtt<AttInternetMedia>(ATT_INTERNETMEDIA);
         assert(att);
         if (attrType == "mimetype") {
             att->SetMimetype(att->StrToStr(attrValue));
@@ -2736,7 +2736,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_JOINED)) {
-        AttJoined *att = dynamic_cast<AttJoined *>(element);
+        AttJoined *att = element->GetAtt<AttJoined>(ATT_JOINED);
         assert(att);
         if (attrType == "join") {
             att->SetJoin(att->StrToStr(attrValue));
@@ -2744,7 +2744,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_KEYSIGLOG)) {
-        AttKeySigLog *att = dynamic_cast<AttKeySigLog *>(element);
+        AttKeySigLog *att = element->GetAtt<AttKeySigLog>(ATT_KEYSIGLOG);
         assert(att);
         if (attrType == "sig") {
             att->SetSig(att->StrToKeysignature(attrValue));
@@ -2752,7 +2752,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_KEYSIGDEFAULTLOG)) {
-        AttKeySigDefaultLog *att = dynamic_cast<AttKeySigDefaultLog *>(element);
+        AttKeySigDefaultLog *att = element->GetAtt<AttKeySigDefaultLog>(ATT_KEYSIGDEFAULTLOG);
         assert(att);
         if (attrType == "key.sig") {
             att->SetKeySig(att->StrToKeysignature(attrValue));
@@ -2760,7 +2760,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_LABELLED)) {
-        AttLabelled *att = dynamic_cast<AttLabelled *>(element);
+        AttLabelled *att = element->GetAtt<AttLabelled>(ATT_LABELLED);
         assert(att);
         if (attrType == "label") {
             att->SetLabel(att->StrToStr(attrValue));
@@ -2768,7 +2768,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_LANG)) {
-        AttLang *att = dynamic_cast<AttLang *>(element);
+        AttLang *att = element->GetAtt<AttLang>(ATT_LANG);
         assert(att);
         if (attrType == "xml:lang") {
             att->SetLang(att->StrToStr(attrValue));
@@ -2780,7 +2780,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_LAYERLOG)) {
-        AttLayerLog *att = dynamic_cast<AttLayerLog *>(element);
+        AttLayerLog *att = element->GetAtt<AttLayerLog>(ATT_LAYERLOG);
         assert(att);
         if (attrType == "def") {
             att->SetDef(att->StrToStr(attrValue));
@@ -2788,7 +2788,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_LAYERIDENT)) {
-        AttLayerIdent *att = dynamic_cast<AttLayerIdent *>(element);
+        AttLayerIdent *att = element->GetAtt<AttLayerIdent>(ATT_LAYERIDENT);
         assert(att);
         if (attrType == "layer") {
             att->SetLayer(att->StrToInt(attrValue));
@@ -2796,7 +2796,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_LINELOC)) {
-        AttLineLoc *att = dynamic_cast<AttLineLoc *>(element);
+        AttLineLoc *att = element->GetAtt<AttLineLoc>(ATT_LINELOC);
         assert(att);
         if (attrType == "line") {
             att->SetLine(att->StrToInt(attrValue));
@@ -2804,7 +2804,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_LINEREND)) {
-        AttLineRend *att = dynamic_cast<AttLineRend *>(element);
+        AttLineRend *att = element->GetAtt<AttLineRend>(ATT_LINEREND);
         assert(att);
         if (attrType == "lendsym") {
             att->SetLendsym(att->StrToLinestartendsymbol(attrValue));
@@ -2824,7 +2824,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_LINERENDBASE)) {
-        AttLineRendBase *att = dynamic_cast<AttLineRendBase *>(element);
+        AttLineRendBase *att = element->GetAtt<AttLineRendBase>(ATT_LINERENDBASE);
         assert(att);
         if (attrType == "lform") {
             att->SetLform(att->StrToLineform(attrValue));
@@ -2840,7 +2840,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_LINKING)) {
-        AttLinking *att = dynamic_cast<AttLinking *>(element);
+        AttLinking *att = element->GetAtt<AttLinking>(ATT_LINKING);
         assert(att);
         if (attrType == "copyof") {
             att->SetCopyof(att->StrToStr(attrValue));
@@ -2876,7 +2876,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_LYRICSTYLE)) {
-        AttLyricStyle *att = dynamic_cast<AttLyricStyle *>(element);
+        AttLyricStyle *att = element->GetAtt<AttLyricStyle>(ATT_LYRICSTYLE);
         assert(att);
         if (attrType == "lyric.align") {
             att->SetLyricAlign(att->StrToMeasurementsigned(attrValue));
@@ -2904,7 +2904,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_MEASURENUMBERS)) {
-        AttMeasureNumbers *att = dynamic_cast<AttMeasureNumbers *>(element);
+        AttMeasureNumbers *att = element->GetAtt<AttMeasureNumbers>(ATT_MEASURENUMBERS);
         assert(att);
         if (attrType == "mnum.visible") {
             att->SetMnumVisible(att->StrToBoolean(attrValue));
@@ -2912,7 +2912,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_MEASUREMENT)) {
-        AttMeasurement *att = dynamic_cast<AttMeasurement *>(element);
+        AttMeasurement *att = element->GetAtt<AttMeasurement>(ATT_MEASUREMENT);
         assert(att);
         if (attrType == "unit") {
             att->SetUnit(att->StrToStr(attrValue));
@@ -2920,7 +2920,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_MEDIABOUNDS)) {
-        AttMediaBounds *att = dynamic_cast<AttMediaBounds *>(element);
+        AttMediaBounds *att = element->GetAtt<AttMediaBounds>(ATT_MEDIABOUNDS);
         assert(att);
         if (attrType == "begin") {
             att->SetBegin(att->StrToStr(attrValue));
@@ -2936,7 +2936,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_MEDIUM)) {
-        AttMedium *att = dynamic_cast<AttMedium *>(element);
+        AttMedium *att = element->GetAtt<AttMedium>(ATT_MEDIUM);
         assert(att);
         if (attrType == "medium") {
             att->SetMedium(att->StrToStr(attrValue));
@@ -2944,7 +2944,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_MEIVERSION)) {
-        AttMeiVersion *att = dynamic_cast<AttMeiVersion *>(element);
+        AttMeiVersion *att = element->GetAtt<AttMeiVersion>(ATT_MEIVERSION);
         assert(att);
         if (attrType == "meiversion") {
             att->SetMeiversion(att->StrToMeiVersionMeiversion(attrValue));
@@ -2952,7 +2952,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_METADATAPOINTING)) {
-        AttMetadataPointing *att = dynamic_cast<AttMetadataPointing *>(element);
+        AttMetadataPointing *att = element->GetAtt<AttMetadataPointing>(ATT_METADATAPOINTING);
         assert(att);
         if (attrType == "decls") {
             att->SetDecls(att->StrToStr(attrValue));
@@ -2960,7 +2960,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_METERCONFORMANCE)) {
-        AttMeterConformance *att = dynamic_cast<AttMeterConformance *>(element);
+        AttMeterConformance *att = element->GetAtt<AttMeterConformance>(ATT_METERCONFORMANCE);
         assert(att);
         if (attrType == "metcon") {
             att->SetMetcon(att->StrToMeterConformanceMetcon(attrValue));
@@ -2968,7 +2968,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_METERCONFORMANCEBAR)) {
-        AttMeterConformanceBar *att = dynamic_cast<AttMeterConformanceBar *>(element);
+        AttMeterConformanceBar *att = element->GetAtt<AttMeterConformanceBar>(ATT_METERCONFORMANCEBAR);
         assert(att);
         if (attrType == "metcon") {
             att->SetMetcon(att->StrToBoolean(attrValue));
@@ -2980,7 +2980,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_METERSIGLOG)) {
-        AttMeterSigLog *att = dynamic_cast<AttMeterSigLog *>(element);
+        AttMeterSigLog *att = element->GetAtt<AttMeterSigLog>(ATT_METERSIGLOG);
         assert(att);
         if (attrType == "count") {
             att->SetCount(att->StrToMetercountPair(attrValue));
@@ -2996,7 +2996,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_METERSIGDEFAULTLOG)) {
-        AttMeterSigDefaultLog *att = dynamic_cast<AttMeterSigDefaultLog *>(element);
+        AttMeterSigDefaultLog *att = element->GetAtt<AttMeterSigDefaultLog>(ATT_METERSIGDEFAULTLOG);
         assert(att);
         if (attrType == "meter.count") {
             att->SetMeterCount(att->StrToMetercountPair(attrValue));
@@ -3012,7 +3012,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_MMTEMPO)) {
-        AttMmTempo *att = dynamic_cast<AttMmTempo *>(element);
+        AttMmTempo *att = element->GetAtt<AttMmTempo>(ATT_MMTEMPO);
         assert(att);
         if (attrType == "mm") {
             att->SetMm(att->StrToDbl(attrValue));
@@ -3028,7 +3028,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_MULTINUMMEASURES)) {
-        AttMultinumMeasures *att = dynamic_cast<AttMultinumMeasures *>(element);
+        AttMultinumMeasures *att = element->GetAtt<AttMultinumMeasures>(ATT_MULTINUMMEASURES);
         assert(att);
         if (attrType == "multi.number") {
             att->SetMultiNumber(att->StrToBoolean(attrValue));
@@ -3036,7 +3036,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_NINTEGER)) {
-        AttNInteger *att = dynamic_cast<AttNInteger *>(element);
+        AttNInteger *att = element->GetAtt<AttNInteger>(ATT_NINTEGER);
         assert(att);
         if (attrType == "n") {
             att->SetN(att->StrToInt(attrValue));
@@ -3044,7 +3044,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_NNUMBERLIKE)) {
-        AttNNumberLike *att = dynamic_cast<AttNNumberLike *>(element);
+        AttNNumberLike *att = element->GetAtt<AttNNumberLike>(ATT_NNUMBERLIKE);
         assert(att);
         if (attrType == "n") {
             att->SetN(att->StrToStr(attrValue));
@@ -3052,7 +3052,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_NAME)) {
-        AttName *att = dynamic_cast<AttName *>(element);
+        AttName *att = element->GetAtt<AttName>(ATT_NAME);
         assert(att);
         if (attrType == "nymref") {
             att->SetNymref(att->StrToStr(attrValue));
@@ -3064,7 +3064,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_NOTATIONSTYLE)) {
-        AttNotationStyle *att = dynamic_cast<AttNotationStyle *>(element);
+        AttNotationStyle *att = element->GetAtt<AttNotationStyle>(ATT_NOTATIONSTYLE);
         assert(att);
         if (attrType == "music.name") {
             att->SetMusicName(att->StrToStr(attrValue));
@@ -3076,7 +3076,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_NOTEHEADS)) {
-        AttNoteHeads *att = dynamic_cast<AttNoteHeads *>(element);
+        AttNoteHeads *att = element->GetAtt<AttNoteHeads>(ATT_NOTEHEADS);
         assert(att);
         if (attrType == "head.altsym") {
             att->SetHeadAltsym(att->StrToStr(attrValue));
@@ -3116,7 +3116,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_OCTAVE)) {
-        AttOctave *att = dynamic_cast<AttOctave *>(element);
+        AttOctave *att = element->GetAtt<AttOctave>(ATT_OCTAVE);
         assert(att);
         if (attrType == "oct") {
             att->SetOct(att->StrToOctave(attrValue));
@@ -3124,7 +3124,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_OCTAVEDEFAULT)) {
-        AttOctaveDefault *att = dynamic_cast<AttOctaveDefault *>(element);
+        AttOctaveDefault *att = element->GetAtt<AttOctaveDefault>(ATT_OCTAVEDEFAULT);
         assert(att);
         if (attrType == "oct.default") {
             att->SetOctDefault(att->StrToOctave(attrValue));
@@ -3132,7 +3132,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_OCTAVEDISPLACEMENT)) {
-        AttOctaveDisplacement *att = dynamic_cast<AttOctaveDisplacement *>(element);
+        AttOctaveDisplacement *att = element->GetAtt<AttOctaveDisplacement>(ATT_OCTAVEDISPLACEMENT);
         assert(att);
         if (attrType == "dis") {
             att->SetDis(att->StrToOctaveDis(attrValue));
@@ -3144,7 +3144,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_ONELINESTAFF)) {
-        AttOneLineStaff *att = dynamic_cast<AttOneLineStaff *>(element);
+        AttOneLineStaff *att = element->GetAtt<AttOneLineStaff>(ATT_ONELINESTAFF);
         assert(att);
         if (attrType == "ontheline") {
             att->SetOntheline(att->StrToBoolean(attrValue));
@@ -3152,7 +3152,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_OPTIMIZATION)) {
-        AttOptimization *att = dynamic_cast<AttOptimization *>(element);
+        AttOptimization *att = element->GetAtt<AttOptimization>(ATT_OPTIMIZATION);
         assert(att);
         if (attrType == "optimize") {
             att->SetOptimize(att->StrToBoolean(attrValue));
@@ -3160,7 +3160,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_ORIGINLAYERIDENT)) {
-        AttOriginLayerIdent *att = dynamic_cast<AttOriginLayerIdent *>(element);
+        AttOriginLayerIdent *att = element->GetAtt<AttOriginLayerIdent>(ATT_ORIGINLAYERIDENT);
         assert(att);
         if (attrType == "origin.layer") {
             att->SetOriginLayer(att->StrToStr(attrValue));
@@ -3168,7 +3168,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_ORIGINSTAFFIDENT)) {
-        AttOriginStaffIdent *att = dynamic_cast<AttOriginStaffIdent *>(element);
+        AttOriginStaffIdent *att = element->GetAtt<AttOriginStaffIdent>(ATT_ORIGINSTAFFIDENT);
         assert(att);
         if (attrType == "origin.staff") {
             att->SetOriginStaff(att->StrToStr(attrValue));
@@ -3176,7 +3176,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_ORIGINSTARTENDID)) {
-        AttOriginStartEndId *att = dynamic_cast<AttOriginStartEndId *>(element);
+        AttOriginStartEndId *att = element->GetAtt<AttOriginStartEndId>(ATT_ORIGINSTARTENDID);
         assert(att);
         if (attrType == "origin.startid") {
             att->SetOriginStartid(att->StrToStr(attrValue));
@@ -3188,7 +3188,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_ORIGINTIMESTAMPLOG)) {
-        AttOriginTimestampLog *att = dynamic_cast<AttOriginTimestampLog *>(element);
+        AttOriginTimestampLog *att = element->GetAtt<AttOriginTimestampLog>(ATT_ORIGINTIMESTAMPLOG);
         assert(att);
         if (attrType == "origin.tstamp") {
             att->SetOriginTstamp(att->StrToMeasurebeat(attrValue));
@@ -3200,7 +3200,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_PAGES)) {
-        AttPages *att = dynamic_cast<AttPages *>(element);
+        AttPages *att = element->GetAtt<AttPages>(ATT_PAGES);
         assert(att);
         if (attrType == "page.height") {
             att->SetPageHeight(att->StrToMeasurementunsigned(attrValue));
@@ -3236,7 +3236,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_PARTIDENT)) {
-        AttPartIdent *att = dynamic_cast<AttPartIdent *>(element);
+        AttPartIdent *att = element->GetAtt<AttPartIdent>(ATT_PARTIDENT);
         assert(att);
         if (attrType == "part") {
             att->SetPart(att->StrToStr(attrValue));
@@ -3248,7 +3248,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_PITCH)) {
-        AttPitch *att = dynamic_cast<AttPitch *>(element);
+        AttPitch *att = element->GetAtt<AttPitch>(ATT_PITCH);
         assert(att);
         if (attrType == "pname") {
             att->SetPname(att->StrToPitchname(attrValue));
@@ -3256,7 +3256,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_PLACEMENTONSTAFF)) {
-        AttPlacementOnStaff *att = dynamic_cast<AttPlacementOnStaff *>(element);
+        AttPlacementOnStaff *att = element->GetAtt<AttPlacementOnStaff>(ATT_PLACEMENTONSTAFF);
         assert(att);
         if (attrType == "onstaff") {
             att->SetOnstaff(att->StrToBoolean(attrValue));
@@ -3264,7 +3264,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_PLACEMENTRELEVENT)) {
-        AttPlacementRelEvent *att = dynamic_cast<AttPlacementRelEvent *>(element);
+        AttPlacementRelEvent *att = element->GetAtt<AttPlacementRelEvent>(ATT_PLACEMENTRELEVENT);
         assert(att);
         if (attrType == "place") {
             att->SetPlace(att->StrToStaffrel(attrValue));
@@ -3272,7 +3272,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_PLACEMENTRELSTAFF)) {
-        AttPlacementRelStaff *att = dynamic_cast<AttPlacementRelStaff *>(element);
+        AttPlacementRelStaff *att = element->GetAtt<AttPlacementRelStaff>(ATT_PLACEMENTRELSTAFF);
         assert(att);
         if (attrType == "place") {
             att->SetPlace(att->StrToStaffrel(attrValue));
@@ -3280,7 +3280,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_PLIST)) {
-        AttPlist *att = dynamic_cast<AttPlist *>(element);
+        AttPlist *att = element->GetAtt<AttPlist>(ATT_PLIST);
         assert(att);
         if (attrType == "plist") {
             att->SetPlist(att->StrToXsdAnyURIList(attrValue));
@@ -3288,7 +3288,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_POINTING)) {
-        AttPointing *att = dynamic_cast<AttPointing *>(element);
+        AttPointing *att = element->GetAtt<AttPointing>(ATT_POINTING);
         assert(att);
         if (attrType == "xlink:actuate") {
             att->SetActuate(att->StrToStr(attrValue));
@@ -3312,7 +3312,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_QUANTITY)) {
-        AttQuantity *att = dynamic_cast<AttQuantity *>(element);
+        AttQuantity *att = element->GetAtt<AttQuantity>(ATT_QUANTITY);
         assert(att);
         if (attrType == "quantity") {
             att->SetQuantity(att->StrToDbl(attrValue));
@@ -3320,7 +3320,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_RANGING)) {
-        AttRanging *att = dynamic_cast<AttRanging *>(element);
+        AttRanging *att = element->GetAtt<AttRanging>(ATT_RANGING);
         assert(att);
         if (attrType == "atleast") {
             att->SetAtleast(att->StrToDbl(attrValue));
@@ -3344,7 +3344,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_RESPONSIBILITY)) {
-        AttResponsibility *att = dynamic_cast<AttResponsibility *>(element);
+        AttResponsibility *att = element->GetAtt<AttResponsibility>(ATT_RESPONSIBILITY);
         assert(att);
         if (attrType == "resp") {
             att->SetResp(att->StrToStr(attrValue));
@@ -3352,7 +3352,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_RESTDURATIONLOG)) {
-        AttRestdurationLog *att = dynamic_cast<AttRestdurationLog *>(element);
+        AttRestdurationLog *att = element->GetAtt<AttRestdurationLog>(ATT_RESTDURATIONLOG);
         assert(att);
         if (attrType == "dur") {
             att->SetDur(att->StrToDuration(attrValue));
@@ -3360,7 +3360,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_SCALABLE)) {
-        AttScalable *att = dynamic_cast<AttScalable *>(element);
+        AttScalable *att = element->GetAtt<AttScalable>(ATT_SCALABLE);
         assert(att);
         if (attrType == "scale") {
             att->SetScale(att->StrToPercent(attrValue));
@@ -3368,7 +3368,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_SEQUENCE)) {
-        AttSequence *att = dynamic_cast<AttSequence *>(element);
+        AttSequence *att = element->GetAtt<AttSequence>(ATT_SEQUENCE);
         assert(att);
         if (attrType == "seq") {
             att->SetSeq(att->StrToInt(attrValue));
@@ -3376,7 +3376,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_SLASHCOUNT)) {
-        AttSlashCount *att = dynamic_cast<AttSlashCount *>(element);
+        AttSlashCount *att = element->GetAtt<AttSlashCount>(ATT_SLASHCOUNT);
         assert(att);
         if (attrType == "slash") {
             att->SetSlash(att->StrToInt(attrValue));
@@ -3384,7 +3384,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_SLURPRESENT)) {
-        AttSlurPresent *att = dynamic_cast<AttSlurPresent *>(element);
+        AttSlurPresent *att = element->GetAtt<AttSlurPresent>(ATT_SLURPRESENT);
         assert(att);
         if (attrType == "slur") {
             att->SetSlur(att->StrToStr(attrValue));
@@ -3392,7 +3392,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_SOURCE)) {
-        AttSource *att = dynamic_cast<AttSource *>(element);
+        AttSource *att = element->GetAtt<AttSource>(ATT_SOURCE);
         assert(att);
         if (attrType == "source") {
             att->SetSource(att->StrToStr(attrValue));
@@ -3400,7 +3400,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_SPACING)) {
-        AttSpacing *att = dynamic_cast<AttSpacing *>(element);
+        AttSpacing *att = element->GetAtt<AttSpacing>(ATT_SPACING);
         assert(att);
         if (attrType == "spacing.packexp") {
             att->SetSpacingPackexp(att->StrToDbl(attrValue));
@@ -3420,7 +3420,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_STAFFLOG)) {
-        AttStaffLog *att = dynamic_cast<AttStaffLog *>(element);
+        AttStaffLog *att = element->GetAtt<AttStaffLog>(ATT_STAFFLOG);
         assert(att);
         if (attrType == "def") {
             att->SetDef(att->StrToStr(attrValue));
@@ -3428,7 +3428,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_STAFFDEFLOG)) {
-        AttStaffDefLog *att = dynamic_cast<AttStaffDefLog *>(element);
+        AttStaffDefLog *att = element->GetAtt<AttStaffDefLog>(ATT_STAFFDEFLOG);
         assert(att);
         if (attrType == "lines") {
             att->SetLines(att->StrToInt(attrValue));
@@ -3436,7 +3436,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_STAFFGROUPINGSYM)) {
-        AttStaffGroupingSym *att = dynamic_cast<AttStaffGroupingSym *>(element);
+        AttStaffGroupingSym *att = element->GetAtt<AttStaffGroupingSym>(ATT_STAFFGROUPINGSYM);
         assert(att);
         if (attrType == "symbol") {
             att->SetSymbol(att->StrToStaffGroupingSymSymbol(attrValue));
@@ -3444,7 +3444,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_STAFFIDENT)) {
-        AttStaffIdent *att = dynamic_cast<AttStaffIdent *>(element);
+        AttStaffIdent *att = element->GetAtt<AttStaffIdent>(ATT_STAFFIDENT);
         assert(att);
         if (attrType == "staff") {
             att->SetStaff(att->StrToXsdPositiveIntegerList(attrValue));
@@ -3452,7 +3452,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_STAFFITEMS)) {
-        AttStaffItems *att = dynamic_cast<AttStaffItems *>(element);
+        AttStaffItems *att = element->GetAtt<AttStaffItems>(ATT_STAFFITEMS);
         assert(att);
         if (attrType == "aboveorder") {
             att->SetAboveorder(att->StrToStaffitem(attrValue));
@@ -3468,7 +3468,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_STAFFLOC)) {
-        AttStaffLoc *att = dynamic_cast<AttStaffLoc *>(element);
+        AttStaffLoc *att = element->GetAtt<AttStaffLoc>(ATT_STAFFLOC);
         assert(att);
         if (attrType == "loc") {
             att->SetLoc(att->StrToInt(attrValue));
@@ -3476,7 +3476,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_STAFFLOCPITCHED)) {
-        AttStaffLocPitched *att = dynamic_cast<AttStaffLocPitched *>(element);
+        AttStaffLocPitched *att = element->GetAtt<AttStaffLocPitched>(ATT_STAFFLOCPITCHED);
         assert(att);
         if (attrType == "ploc") {
             att->SetPloc(att->StrToPitchname(attrValue));
@@ -3488,7 +3488,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_STARTENDID)) {
-        AttStartEndId *att = dynamic_cast<AttStartEndId *>(element);
+        AttStartEndId *att = element->GetAtt<AttStartEndId>(ATT_STARTENDID);
         assert(att);
         if (attrType == "endid") {
             att->SetEndid(att->StrToStr(attrValue));
@@ -3496,7 +3496,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_STARTID)) {
-        AttStartId *att = dynamic_cast<AttStartId *>(element);
+        AttStartId *att = element->GetAtt<AttStartId>(ATT_STARTID);
         assert(att);
         if (attrType == "startid") {
             att->SetStartid(att->StrToStr(attrValue));
@@ -3504,7 +3504,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_STEMS)) {
-        AttStems *att = dynamic_cast<AttStems *>(element);
+        AttStems *att = element->GetAtt<AttStems>(ATT_STEMS);
         assert(att);
         if (attrType == "stem.dir") {
             att->SetStemDir(att->StrToStemdirection(attrValue));
@@ -3540,7 +3540,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_SYLLOG)) {
-        AttSylLog *att = dynamic_cast<AttSylLog *>(element);
+        AttSylLog *att = element->GetAtt<AttSylLog>(ATT_SYLLOG);
         assert(att);
         if (attrType == "con") {
             att->SetCon(att->StrToSylLogCon(attrValue));
@@ -3552,7 +3552,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_SYLTEXT)) {
-        AttSylText *att = dynamic_cast<AttSylText *>(element);
+        AttSylText *att = element->GetAtt<AttSylText>(ATT_SYLTEXT);
         assert(att);
         if (attrType == "syl") {
             att->SetSyl(att->StrToStr(attrValue));
@@ -3560,7 +3560,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_SYSTEMS)) {
-        AttSystems *att = dynamic_cast<AttSystems *>(element);
+        AttSystems *att = element->GetAtt<AttSystems>(ATT_SYSTEMS);
         assert(att);
         if (attrType == "system.leftline") {
             att->SetSystemLeftline(att->StrToBoolean(attrValue));
@@ -3580,7 +3580,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_TARGETEVAL)) {
-        AttTargetEval *att = dynamic_cast<AttTargetEval *>(element);
+        AttTargetEval *att = element->GetAtt<AttTargetEval>(ATT_TARGETEVAL);
         assert(att);
         if (attrType == "evaluate") {
             att->SetEvaluate(att->StrToTargetEvalEvaluate(attrValue));
@@ -3588,7 +3588,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_TEMPOLOG)) {
-        AttTempoLog *att = dynamic_cast<AttTempoLog *>(element);
+        AttTempoLog *att = element->GetAtt<AttTempoLog>(ATT_TEMPOLOG);
         assert(att);
         if (attrType == "func") {
             att->SetFunc(att->StrToTempoLogFunc(attrValue));
@@ -3596,7 +3596,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_TEXTRENDITION)) {
-        AttTextRendition *att = dynamic_cast<AttTextRendition *>(element);
+        AttTextRendition *att = element->GetAtt<AttTextRendition>(ATT_TEXTRENDITION);
         assert(att);
         if (attrType == "altrend") {
             att->SetAltrend(att->StrToStr(attrValue));
@@ -3608,7 +3608,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_TEXTSTYLE)) {
-        AttTextStyle *att = dynamic_cast<AttTextStyle *>(element);
+        AttTextStyle *att = element->GetAtt<AttTextStyle>(ATT_TEXTSTYLE);
         assert(att);
         if (attrType == "text.fam") {
             att->SetTextFam(att->StrToStr(attrValue));
@@ -3632,7 +3632,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_TIEPRESENT)) {
-        AttTiePresent *att = dynamic_cast<AttTiePresent *>(element);
+        AttTiePresent *att = element->GetAtt<AttTiePresent>(ATT_TIEPRESENT);
         assert(att);
         if (attrType == "tie") {
             att->SetTie(att->StrToTie(attrValue));
@@ -3640,7 +3640,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_TIMESTAMPLOG)) {
-        AttTimestampLog *att = dynamic_cast<AttTimestampLog *>(element);
+        AttTimestampLog *att = element->GetAtt<AttTimestampLog>(ATT_TIMESTAMPLOG);
         assert(att);
         if (attrType == "tstamp") {
             att->SetTstamp(att->StrToDbl(attrValue));
@@ -3648,7 +3648,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_TIMESTAMP2LOG)) {
-        AttTimestamp2Log *att = dynamic_cast<AttTimestamp2Log *>(element);
+        AttTimestamp2Log *att = element->GetAtt<AttTimestamp2Log>(ATT_TIMESTAMP2LOG);
         assert(att);
         if (attrType == "tstamp2") {
             att->SetTstamp2(att->StrToMeasurebeat(attrValue));
@@ -3656,7 +3656,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_TRANSPOSITION)) {
-        AttTransposition *att = dynamic_cast<AttTransposition *>(element);
+        AttTransposition *att = element->GetAtt<AttTransposition>(ATT_TRANSPOSITION);
         assert(att);
         if (attrType == "trans.diat") {
             att->SetTransDiat(att->StrToInt(attrValue));
@@ -3668,7 +3668,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_TUNING)) {
-        AttTuning *att = dynamic_cast<AttTuning *>(element);
+        AttTuning *att = element->GetAtt<AttTuning>(ATT_TUNING);
         assert(att);
         if (attrType == "tune.Hz") {
             att->SetTuneHz(att->StrToDbl(attrValue));
@@ -3684,7 +3684,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_TUPLETPRESENT)) {
-        AttTupletPresent *att = dynamic_cast<AttTupletPresent *>(element);
+        AttTupletPresent *att = element->GetAtt<AttTupletPresent>(ATT_TUPLETPRESENT);
         assert(att);
         if (attrType == "tuplet") {
             att->SetTuplet(att->StrToStr(attrValue));
@@ -3692,7 +3692,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_TYPED)) {
-        AttTyped *att = dynamic_cast<AttTyped *>(element);
+        AttTyped *att = element->GetAtt<AttTyped>(ATT_TYPED);
         assert(att);
         if (attrType == "type") {
             att->SetType(att->StrToStr(attrValue));
@@ -3700,7 +3700,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_TYPOGRAPHY)) {
-        AttTypography *att = dynamic_cast<AttTypography *>(element);
+        AttTypography *att = element->GetAtt<AttTypography>(ATT_TYPOGRAPHY);
         assert(att);
         if (attrType == "fontfam") {
             att->SetFontfam(att->StrToStr(attrValue));
@@ -3732,7 +3732,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_VERTICALALIGN)) {
-        AttVerticalAlign *att = dynamic_cast<AttVerticalAlign *>(element);
+        AttVerticalAlign *att = element->GetAtt<AttVerticalAlign>(ATT_VERTICALALIGN);
         assert(att);
         if (attrType == "valign") {
             att->SetValign(att->StrToVerticalalignment(attrValue));
@@ -3740,7 +3740,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_VERTICALGROUP)) {
-        AttVerticalGroup *att = dynamic_cast<AttVerticalGroup *>(element);
+        AttVerticalGroup *att = element->GetAtt<AttVerticalGroup>(ATT_VERTICALGROUP);
         assert(att);
         if (attrType == "vgrp") {
             att->SetVgrp(att->StrToInt(attrValue));
@@ -3748,7 +3748,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_VISIBILITY)) {
-        AttVisibility *att = dynamic_cast<AttVisibility *>(element);
+        AttVisibility *att = element->GetAtt<AttVisibility>(ATT_VISIBILITY);
         assert(att);
         if (attrType == "visible") {
             att->SetVisible(att->StrToBoolean(attrValue));
@@ -3756,7 +3756,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_VISUALOFFSETHO)) {
-        AttVisualOffsetHo *att = dynamic_cast<AttVisualOffsetHo *>(element);
+        AttVisualOffsetHo *att = element->GetAtt<AttVisualOffsetHo>(ATT_VISUALOFFSETHO);
         assert(att);
         if (attrType == "ho") {
             att->SetHo(att->StrToMeasurementsigned(attrValue));
@@ -3764,7 +3764,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_VISUALOFFSETTO)) {
-        AttVisualOffsetTo *att = dynamic_cast<AttVisualOffsetTo *>(element);
+        AttVisualOffsetTo *att = element->GetAtt<AttVisualOffsetTo>(ATT_VISUALOFFSETTO);
         assert(att);
         if (attrType == "to") {
             att->SetTo(att->StrToDbl(attrValue));
@@ -3772,7 +3772,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_VISUALOFFSETVO)) {
-        AttVisualOffsetVo *att = dynamic_cast<AttVisualOffsetVo *>(element);
+        AttVisualOffsetVo *att = element->GetAtt<AttVisualOffsetVo>(ATT_VISUALOFFSETVO);
         assert(att);
         if (attrType == "vo") {
             att->SetVo(att->StrToMeasurementsigned(attrValue));
@@ -3780,7 +3780,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_VISUALOFFSET2HO)) {
-        AttVisualOffset2Ho *att = dynamic_cast<AttVisualOffset2Ho *>(element);
+        AttVisualOffset2Ho *att = element->GetAtt<AttVisualOffset2Ho>(ATT_VISUALOFFSET2HO);
         assert(att);
         if (attrType == "startho") {
             att->SetStartho(att->StrToMeasurementsigned(attrValue));
@@ -3792,7 +3792,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_VISUALOFFSET2TO)) {
-        AttVisualOffset2To *att = dynamic_cast<AttVisualOffset2To *>(element);
+        AttVisualOffset2To *att = element->GetAtt<AttVisualOffset2To>(ATT_VISUALOFFSET2TO);
         assert(att);
         if (attrType == "startto") {
             att->SetStartto(att->StrToDbl(attrValue));
@@ -3804,7 +3804,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_VISUALOFFSET2VO)) {
-        AttVisualOffset2Vo *att = dynamic_cast<AttVisualOffset2Vo *>(element);
+        AttVisualOffset2Vo *att = element->GetAtt<AttVisualOffset2Vo>(ATT_VISUALOFFSET2VO);
         assert(att);
         if (attrType == "startvo") {
             att->SetStartvo(att->StrToMeasurementsigned(attrValue));
@@ -3816,7 +3816,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_VOLTAGROUPINGSYM)) {
-        AttVoltaGroupingSym *att = dynamic_cast<AttVoltaGroupingSym *>(element);
+        AttVoltaGroupingSym *att = element->GetAtt<AttVoltaGroupingSym>(ATT_VOLTAGROUPINGSYM);
         assert(att);
         if (attrType == "voltasym") {
             att->SetVoltasym(att->StrToVoltaGroupingSymVoltasym(attrValue));
@@ -3824,7 +3824,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_WHITESPACE)) {
-        AttWhitespace *att = dynamic_cast<AttWhitespace *>(element);
+        AttWhitespace *att = element->GetAtt<AttWhitespace>(ATT_WHITESPACE);
         assert(att);
         if (attrType == "xml:space") {
             att->SetSpace(att->StrToStr(attrValue));
@@ -3832,7 +3832,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_WIDTH)) {
-        AttWidth *att = dynamic_cast<AttWidth *>(element);
+        AttWidth *att = element->GetAtt<AttWidth>(ATT_WIDTH);
         assert(att);
         if (attrType == "width") {
             att->SetWidth(att->StrToMeasurementunsigned(attrValue));
@@ -3840,7 +3840,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_XY)) {
-        AttXy *att = dynamic_cast<AttXy *>(element);
+        AttXy *att = element->GetAtt<AttXy>(ATT_XY);
         assert(att);
         if (attrType == "x") {
             att->SetX(att->StrToDbl(attrValue));
@@ -3852,7 +3852,7 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_XY2)) {
-        AttXy2 *att = dynamic_cast<AttXy2 *>(element);
+        AttXy2 *att = element->GetAtt<AttXy2>(ATT_XY2);
         assert(att);
         if (attrType == "x2") {
             att->SetX2(att->StrToDbl(attrValue));
@@ -3870,49 +3870,49 @@ bool AttModule::SetShared(Object *element, const std::string &attrType, const st
 void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_ACCIDLOG)) {
-        const AttAccidLog *att = dynamic_cast<const AttAccidLog *>(element);
+        const AttAccidLog *att = element->GetAtt<AttAccidLog>(ATT_ACCIDLOG);
         assert(att);
         if (att->HasFunc()) {
             attributes->push_back({ "func", att->AccidLogFuncToStr(att->GetFunc()) });
         }
     }
     if (element->HasAttClass(ATT_ACCIDENTAL)) {
-        const AttAccidental *att = dynamic_cast<const AttAccidental *>(element);
+        const AttAccidental *att = element->GetAtt<AttAccidental>(ATT_ACCIDENTAL);
         assert(att);
         if (att->HasAccid()) {
             attributes->push_back({ "accid", att->AccidentalWrittenToStr(att->GetAccid()) });
         }
     }
     if (element->HasAttClass(ATT_ARTICULATION)) {
-        const AttArticulation *att = dynamic_cast<const AttArticulation *>(element);
+        const AttArticulation *att = element->GetAtt<AttArticulation>(ATT_ARTICULATION);
         assert(att);
         if (att->HasArtic()) {
             attributes->push_back({ "artic", att->ArticulationListToStr(att->GetArtic()) });
         }
     }
     if (element->HasAttClass(ATT_ATTACCALOG)) {
-        const AttAttaccaLog *att = dynamic_cast<const AttAttaccaLog *>(element);
+        const AttAttaccaLog *att = element->GetAtt<AttAttaccaLog>(ATT_ATTACCALOG);
         assert(att);
         if (att->HasTarget()) {
             attributes->push_back({ "target", att->StrToStr(att->GetTarget()) });
         }
     }
     if (element->HasAttClass(ATT_AUDIENCE)) {
-        const AttAudience *att = dynamic_cast<const AttAudience *>(element);
+        const AttAudience *att = element->GetAtt<AttAudience>(ATT_AUDIENCE);
         assert(att);
         if (att->HasAudience()) {
             attributes->push_back({ "audience", att->AudienceAudienceToStr(att->GetAudience()) });
         }
     }
     if (element->HasAttClass(ATT_AUGMENTDOTS)) {
-        const AttAugmentDots *att = dynamic_cast<const AttAugmentDots *>(element);
+        const AttAugmentDots *att = element->GetAtt<AttAugmentDots>(ATT_AUGMENTDOTS);
         assert(att);
         if (att->HasDots()) {
             attributes->push_back({ "dots", att->IntToStr(att->GetDots()) });
         }
     }
     if (element->HasAttClass(ATT_AUTHORIZED)) {
-        const AttAuthorized *att = dynamic_cast<const AttAuthorized *>(element);
+        const AttAuthorized *att = element->GetAtt<AttAuthorized>(ATT_AUTHORIZED);
         assert(att);
         if (att->HasAuth()) {
             attributes->push_back({ "auth", att->StrToStr(att->GetAuth()) });
@@ -3922,14 +3922,14 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_BARLINELOG)) {
-        const AttBarLineLog *att = dynamic_cast<const AttBarLineLog *>(element);
+        const AttBarLineLog *att = element->GetAtt<AttBarLineLog>(ATT_BARLINELOG);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back({ "form", att->BarrenditionToStr(att->GetForm()) });
         }
     }
     if (element->HasAttClass(ATT_BARRING)) {
-        const AttBarring *att = dynamic_cast<const AttBarring *>(element);
+        const AttBarring *att = element->GetAtt<AttBarring>(ATT_BARRING);
         assert(att);
         if (att->HasBarLen()) {
             attributes->push_back({ "bar.len", att->DblToStr(att->GetBarLen()) });
@@ -3942,56 +3942,56 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_BASIC)) {
-        const AttBasic *att = dynamic_cast<const AttBasic *>(element);
+        const AttBasic *att = element->GetAtt<AttBasic>(ATT_BASIC);
         assert(att);
         if (att->HasBase()) {
             attributes->push_back({ "xml:base", att->StrToStr(att->GetBase()) });
         }
     }
     if (element->HasAttClass(ATT_BIBL)) {
-        const AttBibl *att = dynamic_cast<const AttBibl *>(element);
+        const AttBibl *att = element->GetAtt<AttBibl>(ATT_BIBL);
         assert(att);
         if (att->HasAnalog()) {
             attributes->push_back({ "analog", att->StrToStr(att->GetAnalog()) });
         }
     }
     if (element->HasAttClass(ATT_CALENDARED)) {
-        const AttCalendared *att = dynamic_cast<const AttCalendared *>(element);
+        const AttCalendared *att = element->GetAtt<AttCalendared>(ATT_CALENDARED);
         assert(att);
         if (att->HasCalendar()) {
             attributes->push_back({ "calendar", att->StrToStr(att->GetCalendar()) });
         }
     }
     if (element->HasAttClass(ATT_CANONICAL)) {
-        const AttCanonical *att = dynamic_cast<const AttCanonical *>(element);
+        const AttCanonical *att = element->GetAtt<AttCanonical>(ATT_CANONICAL);
         assert(att);
         if (att->HasCodedval()) {
             attributes->push_back({ "codedval", att->StrToStr(att->GetCodedval()) });
         }
     }
     if (element->HasAttClass(ATT_CLASSED)) {
-        const AttClassed *att = dynamic_cast<const AttClassed *>(element);
+        const AttClassed *att = element->GetAtt<AttClassed>(ATT_CLASSED);
         assert(att);
         if (att->HasClass()) {
             attributes->push_back({ "class", att->StrToStr(att->GetClass()) });
         }
     }
     if (element->HasAttClass(ATT_CLEFLOG)) {
-        const AttClefLog *att = dynamic_cast<const AttClefLog *>(element);
+        const AttClefLog *att = element->GetAtt<AttClefLog>(ATT_CLEFLOG);
         assert(att);
         if (att->HasCautionary()) {
             attributes->push_back({ "cautionary", att->BooleanToStr(att->GetCautionary()) });
         }
     }
     if (element->HasAttClass(ATT_CLEFSHAPE)) {
-        const AttClefShape *att = dynamic_cast<const AttClefShape *>(element);
+        const AttClefShape *att = element->GetAtt<AttClefShape>(ATT_CLEFSHAPE);
         assert(att);
         if (att->HasShape()) {
             attributes->push_back({ "shape", att->ClefshapeToStr(att->GetShape()) });
         }
     }
     if (element->HasAttClass(ATT_CLEFFINGLOG)) {
-        const AttCleffingLog *att = dynamic_cast<const AttCleffingLog *>(element);
+        const AttCleffingLog *att = element->GetAtt<AttCleffingLog>(ATT_CLEFFINGLOG);
         assert(att);
         if (att->HasClefShape()) {
             attributes->push_back({ "clef.shape", att->ClefshapeToStr(att->GetClefShape()) });
@@ -4007,42 +4007,42 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_COLOR)) {
-        const AttColor *att = dynamic_cast<const AttColor *>(element);
+        const AttColor *att = element->GetAtt<AttColor>(ATT_COLOR);
         assert(att);
         if (att->HasColor()) {
             attributes->push_back({ "color", att->StrToStr(att->GetColor()) });
         }
     }
     if (element->HasAttClass(ATT_COLORATION)) {
-        const AttColoration *att = dynamic_cast<const AttColoration *>(element);
+        const AttColoration *att = element->GetAtt<AttColoration>(ATT_COLORATION);
         assert(att);
         if (att->HasColored()) {
             attributes->push_back({ "colored", att->BooleanToStr(att->GetColored()) });
         }
     }
     if (element->HasAttClass(ATT_COORDX1)) {
-        const AttCoordX1 *att = dynamic_cast<const AttCoordX1 *>(element);
+        const AttCoordX1 *att = element->GetAtt<AttCoordX1>(ATT_COORDX1);
         assert(att);
         if (att->HasCoordX1()) {
             attributes->push_back({ "coord.x1", att->DblToStr(att->GetCoordX1()) });
         }
     }
     if (element->HasAttClass(ATT_COORDX2)) {
-        const AttCoordX2 *att = dynamic_cast<const AttCoordX2 *>(element);
+        const AttCoordX2 *att = element->GetAtt<AttCoordX2>(ATT_COORDX2);
         assert(att);
         if (att->HasCoordX2()) {
             attributes->push_back({ "coord.x2", att->DblToStr(att->GetCoordX2()) });
         }
     }
     if (element->HasAttClass(ATT_COORDY1)) {
-        const AttCoordY1 *att = dynamic_cast<const AttCoordY1 *>(element);
+        const AttCoordY1 *att = element->GetAtt<AttCoordY1>(ATT_COORDY1);
         assert(att);
         if (att->HasCoordY1()) {
             attributes->push_back({ "coord.y1", att->DblToStr(att->GetCoordY1()) });
         }
     }
     if (element->HasAttClass(ATT_COORDINATED)) {
-        const AttCoordinated *att = dynamic_cast<const AttCoordinated *>(element);
+        const AttCoordinated *att = element->GetAtt<AttCoordinated>(ATT_COORDINATED);
         assert(att);
         if (att->HasUlx()) {
             attributes->push_back({ "ulx", att->IntToStr(att->GetUlx()) });
@@ -4061,14 +4061,14 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_CUE)) {
-        const AttCue *att = dynamic_cast<const AttCue *>(element);
+        const AttCue *att = element->GetAtt<AttCue>(ATT_CUE);
         assert(att);
         if (att->HasCue()) {
             attributes->push_back({ "cue", att->BooleanToStr(att->GetCue()) });
         }
     }
     if (element->HasAttClass(ATT_CURVATURE)) {
-        const AttCurvature *att = dynamic_cast<const AttCurvature *>(element);
+        const AttCurvature *att = element->GetAtt<AttCurvature>(ATT_CURVATURE);
         assert(att);
         if (att->HasBezier()) {
             attributes->push_back({ "bezier", att->StrToStr(att->GetBezier()) });
@@ -4081,7 +4081,7 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_CURVEREND)) {
-        const AttCurveRend *att = dynamic_cast<const AttCurveRend *>(element);
+        const AttCurveRend *att = element->GetAtt<AttCurveRend>(ATT_CURVEREND);
         assert(att);
         if (att->HasLform()) {
             attributes->push_back({ "lform", att->LineformToStr(att->GetLform()) });
@@ -4091,21 +4091,21 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_CUSTOSLOG)) {
-        const AttCustosLog *att = dynamic_cast<const AttCustosLog *>(element);
+        const AttCustosLog *att = element->GetAtt<AttCustosLog>(ATT_CUSTOSLOG);
         assert(att);
         if (att->HasTarget()) {
             attributes->push_back({ "target", att->StrToStr(att->GetTarget()) });
         }
     }
     if (element->HasAttClass(ATT_DATAPOINTING)) {
-        const AttDataPointing *att = dynamic_cast<const AttDataPointing *>(element);
+        const AttDataPointing *att = element->GetAtt<AttDataPointing>(ATT_DATAPOINTING);
         assert(att);
         if (att->HasData()) {
             attributes->push_back({ "data", att->StrToStr(att->GetData()) });
         }
     }
     if (element->HasAttClass(ATT_DATABLE)) {
-        const AttDatable *att = dynamic_cast<const AttDatable *>(element);
+        const AttDatable *att = element->GetAtt<AttDatable>(ATT_DATABLE);
         assert(att);
         if (att->HasEnddate()) {
             attributes->push_back({ "enddate", att->StrToStr(att->GetEnddate()) });
@@ -4124,7 +4124,7 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_DISTANCES)) {
-        const AttDistances *att = dynamic_cast<const AttDistances *>(element);
+        const AttDistances *att = element->GetAtt<AttDistances>(ATT_DISTANCES);
         assert(att);
         if (att->HasDirDist()) {
             attributes->push_back({ "dir.dist", att->MeasurementsignedToStr(att->GetDirDist()) });
@@ -4143,21 +4143,21 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_DOTLOG)) {
-        const AttDotLog *att = dynamic_cast<const AttDotLog *>(element);
+        const AttDotLog *att = element->GetAtt<AttDotLog>(ATT_DOTLOG);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back({ "form", att->DotLogFormToStr(att->GetForm()) });
         }
     }
     if (element->HasAttClass(ATT_DURATIONADDITIVE)) {
-        const AttDurationAdditive *att = dynamic_cast<const AttDurationAdditive *>(element);
+        const AttDurationAdditive *att = element->GetAtt<AttDurationAdditive>(ATT_DURATIONADDITIVE);
         assert(att);
         if (att->HasDur()) {
             attributes->push_back({ "dur", att->DurationToStr(att->GetDur()) });
         }
     }
     if (element->HasAttClass(ATT_DURATIONDEFAULT)) {
-        const AttDurationDefault *att = dynamic_cast<const AttDurationDefault *>(element);
+        const AttDurationDefault *att = element->GetAtt<AttDurationDefault>(ATT_DURATIONDEFAULT);
         assert(att);
         if (att->HasDurDefault()) {
             attributes->push_back({ "dur.default", att->DurationToStr(att->GetDurDefault()) });
@@ -4170,14 +4170,14 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_DURATIONLOG)) {
-        const AttDurationLog *att = dynamic_cast<const AttDurationLog *>(element);
+        const AttDurationLog *att = element->GetAtt<AttDurationLog>(ATT_DURATIONLOG);
         assert(att);
         if (att->HasDur()) {
             attributes->push_back({ "dur", att->DurationToStr(att->GetDur()) });
         }
     }
     if (element->HasAttClass(ATT_DURATIONRATIO)) {
-        const AttDurationRatio *att = dynamic_cast<const AttDurationRatio *>(element);
+        const AttDurationRatio *att = element->GetAtt<AttDurationRatio>(ATT_DURATIONRATIO);
         assert(att);
         if (att->HasNum()) {
             attributes->push_back({ "num", att->IntToStr(att->GetNum()) });
@@ -4187,21 +4187,21 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_ENCLOSINGCHARS)) {
-        const AttEnclosingChars *att = dynamic_cast<const AttEnclosingChars *>(element);
+        const AttEnclosingChars *att = element->GetAtt<AttEnclosingChars>(ATT_ENCLOSINGCHARS);
         assert(att);
         if (att->HasEnclose()) {
             attributes->push_back({ "enclose", att->EnclosureToStr(att->GetEnclose()) });
         }
     }
     if (element->HasAttClass(ATT_ENDINGS)) {
-        const AttEndings *att = dynamic_cast<const AttEndings *>(element);
+        const AttEndings *att = element->GetAtt<AttEndings>(ATT_ENDINGS);
         assert(att);
         if (att->HasEndingRend()) {
             attributes->push_back({ "ending.rend", att->EndingsEndingrendToStr(att->GetEndingRend()) });
         }
     }
     if (element->HasAttClass(ATT_EVIDENCE)) {
-        const AttEvidence *att = dynamic_cast<const AttEvidence *>(element);
+        const AttEvidence *att = element->GetAtt<AttEvidence>(ATT_EVIDENCE);
         assert(att);
         if (att->HasCert()) {
             attributes->push_back({ "cert", att->CertaintyToStr(att->GetCert()) });
@@ -4211,98 +4211,98 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_EXTENDER)) {
-        const AttExtender *att = dynamic_cast<const AttExtender *>(element);
+        const AttExtender *att = element->GetAtt<AttExtender>(ATT_EXTENDER);
         assert(att);
         if (att->HasExtender()) {
             attributes->push_back({ "extender", att->BooleanToStr(att->GetExtender()) });
         }
     }
     if (element->HasAttClass(ATT_EXTENT)) {
-        const AttExtent *att = dynamic_cast<const AttExtent *>(element);
+        const AttExtent *att = element->GetAtt<AttExtent>(ATT_EXTENT);
         assert(att);
         if (att->HasExtent()) {
             attributes->push_back({ "extent", att->StrToStr(att->GetExtent()) });
         }
     }
     if (element->HasAttClass(ATT_FERMATAPRESENT)) {
-        const AttFermataPresent *att = dynamic_cast<const AttFermataPresent *>(element);
+        const AttFermataPresent *att = element->GetAtt<AttFermataPresent>(ATT_FERMATAPRESENT);
         assert(att);
         if (att->HasFermata()) {
             attributes->push_back({ "fermata", att->StaffrelBasicToStr(att->GetFermata()) });
         }
     }
     if (element->HasAttClass(ATT_FILING)) {
-        const AttFiling *att = dynamic_cast<const AttFiling *>(element);
+        const AttFiling *att = element->GetAtt<AttFiling>(ATT_FILING);
         assert(att);
         if (att->HasNonfiling()) {
             attributes->push_back({ "nonfiling", att->IntToStr(att->GetNonfiling()) });
         }
     }
     if (element->HasAttClass(ATT_GRPSYMLOG)) {
-        const AttGrpSymLog *att = dynamic_cast<const AttGrpSymLog *>(element);
+        const AttGrpSymLog *att = element->GetAtt<AttGrpSymLog>(ATT_GRPSYMLOG);
         assert(att);
         if (att->HasLevel()) {
             attributes->push_back({ "level", att->IntToStr(att->GetLevel()) });
         }
     }
     if (element->HasAttClass(ATT_HANDIDENT)) {
-        const AttHandIdent *att = dynamic_cast<const AttHandIdent *>(element);
+        const AttHandIdent *att = element->GetAtt<AttHandIdent>(ATT_HANDIDENT);
         assert(att);
         if (att->HasHand()) {
             attributes->push_back({ "hand", att->StrToStr(att->GetHand()) });
         }
     }
     if (element->HasAttClass(ATT_HEIGHT)) {
-        const AttHeight *att = dynamic_cast<const AttHeight *>(element);
+        const AttHeight *att = element->GetAtt<AttHeight>(ATT_HEIGHT);
         assert(att);
         if (att->HasHeight()) {
             attributes->push_back({ "height", att->MeasurementunsignedToStr(att->GetHeight()) });
         }
     }
     if (element->HasAttClass(ATT_HORIZONTALALIGN)) {
-        const AttHorizontalAlign *att = dynamic_cast<const AttHorizontalAlign *>(element);
+        const AttHorizontalAlign *att = element->GetAtt<AttHorizontalAlign>(ATT_HORIZONTALALIGN);
         assert(att);
         if (att->HasHalign()) {
             attributes->push_back({ "halign", att->HorizontalalignmentToStr(att->GetHalign()) });
         }
     }
     if (element->HasAttClass(ATT_INTERNETMEDIA)) {
-        const AttInternetMedia *att = dynamic_cast<const AttInternetMedia *>(element);
+        const AttInternetMedia *att = element->GetAtt<AttInternetMedia>(ATT_INTERNETMEDIA);
         assert(att);
         if (att->HasMimetype()) {
             attributes->push_back({ "mimetype", att->StrToStr(att->GetMimetype()) });
         }
     }
     if (element->HasAttClass(ATT_JOINED)) {
-        const AttJoined *att = dynamic_cast<const AttJoined *>(element);
+        const AttJoined *att = element->GetAtt<AttJoined>(ATT_JOINED);
         assert(att);
         if (att->HasJoin()) {
             attributes->push_back({ "join", att->StrToStr(att->GetJoin()) });
         }
     }
     if (element->HasAttClass(ATT_KEYSIGLOG)) {
-        const AttKeySigLog *att = dynamic_cast<const AttKeySigLog *>(element);
+        const AttKeySigLog *att = element->GetAtt<AttKeySigLog>(ATT_KEYSIGLOG);
         assert(att);
         if (att->HasSig()) {
             attributes->push_back({ "sig", att->KeysignatureToStr(att->GetSig()) });
         }
     }
     if (element->HasAttClass(ATT_KEYSIGDEFAULTLOG)) {
-        const AttKeySigDefaultLog *att = dynamic_cast<const AttKeySigDefaultLog *>(element);
+        const AttKeySigDefaultLog *att = element->GetAtt<AttKeySigDefaultLog>(ATT_KEYSIGDEFAULTLOG);
         assert(att);
         if (att->HasKeySig()) {
             attributes->push_back({ "key.sig", att->KeysignatureToStr(att->GetKeySig()) });
         }
     }
     if (element->HasAttClass(ATT_LABELLED)) {
-        const AttLabelled *att = dynamic_cast<const AttLabelled *>(element);
+        const AttLabelled *att = element->GetAtt<AttLabelled>(ATT_LABELLED);
         assert(att);
         if (att->HasLabel()) {
             attributes->push_back({ "label", att->StrToStr(att->GetLabel()) });
         }
     }
     if (element->HasAttClass(ATT_LANG)) {
-        const AttLang *att = dynamic_cast<const AttLang *>(element);
+        const AttLang *att = element->GetAtt<AttLang>(ATT_LANG);
         assert(att);
         if (att->HasLang()) {
             attributes->push_back({ "xml:lang", att->StrToStr(att->GetLang()) });
@@ -4312,28 +4312,28 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_LAYERLOG)) {
-        const AttLayerLog *att = dynamic_cast<const AttLayerLog *>(element);
+        const AttLayerLog *att = element->GetAtt<AttLayerLog>(ATT_LAYERLOG);
         assert(att);
         if (att->HasDef()) {
             attributes->push_back({ "def", att->StrToStr(att->GetDef()) });
         }
     }
     if (element->HasAttClass(ATT_LAYERIDENT)) {
-        const AttLayerIdent *att = dynamic_cast<const AttLayerIdent *>(element);
+        const AttLayerIdent *att = element->GetAtt<AttLayerIdent>(ATT_LAYERIDENT);
         assert(att);
         if (att->HasLayer()) {
             attributes->push_back({ "layer", att->IntToStr(att->GetLayer()) });
         }
     }
     if (element->HasAttClass(ATT_LINELOC)) {
-        const AttLineLoc *att = dynamic_cast<const AttLineLoc *>(element);
+        const AttLineLoc *att = element->GetAtt<AttLineLoc>(ATT_LINELOC);
         assert(att);
         if (att->HasLine()) {
             attributes->push_back({ "line", att->IntToStr(att->GetLine()) });
         }
     }
     if (element->HasAttClass(ATT_LINEREND)) {
-        const AttLineRend *att = dynamic_cast<const AttLineRend *>(element);
+        const AttLineRend *att = element->GetAtt<AttLineRend>(ATT_LINEREND);
         assert(att);
         if (att->HasLendsym()) {
             attributes->push_back({ "lendsym", att->LinestartendsymbolToStr(att->GetLendsym()) });
@@ -4349,7 +4349,7 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_LINERENDBASE)) {
-        const AttLineRendBase *att = dynamic_cast<const AttLineRendBase *>(element);
+        const AttLineRendBase *att = element->GetAtt<AttLineRendBase>(ATT_LINERENDBASE);
         assert(att);
         if (att->HasLform()) {
             attributes->push_back({ "lform", att->LineformToStr(att->GetLform()) });
@@ -4362,7 +4362,7 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_LINKING)) {
-        const AttLinking *att = dynamic_cast<const AttLinking *>(element);
+        const AttLinking *att = element->GetAtt<AttLinking>(ATT_LINKING);
         assert(att);
         if (att->HasCopyof()) {
             attributes->push_back({ "copyof", att->StrToStr(att->GetCopyof()) });
@@ -4390,7 +4390,7 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_LYRICSTYLE)) {
-        const AttLyricStyle *att = dynamic_cast<const AttLyricStyle *>(element);
+        const AttLyricStyle *att = element->GetAtt<AttLyricStyle>(ATT_LYRICSTYLE);
         assert(att);
         if (att->HasLyricAlign()) {
             attributes->push_back({ "lyric.align", att->MeasurementsignedToStr(att->GetLyricAlign()) });
@@ -4412,21 +4412,21 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_MEASURENUMBERS)) {
-        const AttMeasureNumbers *att = dynamic_cast<const AttMeasureNumbers *>(element);
+        const AttMeasureNumbers *att = element->GetAtt<AttMeasureNumbers>(ATT_MEASURENUMBERS);
         assert(att);
         if (att->HasMnumVisible()) {
             attributes->push_back({ "mnum.visible", att->BooleanToStr(att->GetMnumVisible()) });
         }
     }
     if (element->HasAttClass(ATT_MEASUREMENT)) {
-        const AttMeasurement *att = dynamic_cast<const AttMeasurement *>(element);
+        const AttMeasurement *att = element->GetAtt<AttMeasurement>(ATT_MEASUREMENT);
         assert(att);
         if (att->HasUnit()) {
             attributes->push_back({ "unit", att->StrToStr(att->GetUnit()) });
         }
     }
     if (element->HasAttClass(ATT_MEDIABOUNDS)) {
-        const AttMediaBounds *att = dynamic_cast<const AttMediaBounds *>(element);
+        const AttMediaBounds *att = element->GetAtt<AttMediaBounds>(ATT_MEDIABOUNDS);
         assert(att);
         if (att->HasBegin()) {
             attributes->push_back({ "begin", att->StrToStr(att->GetBegin()) });
@@ -4439,35 +4439,35 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_MEDIUM)) {
-        const AttMedium *att = dynamic_cast<const AttMedium *>(element);
+        const AttMedium *att = element->GetAtt<AttMedium>(ATT_MEDIUM);
         assert(att);
         if (att->HasMedium()) {
             attributes->push_back({ "medium", att->StrToStr(att->GetMedium()) });
         }
     }
     if (element->HasAttClass(ATT_MEIVERSION)) {
-        const AttMeiVersion *att = dynamic_cast<const AttMeiVersion *>(element);
+        const AttMeiVersion *att = element->GetAtt<AttMeiVersion>(ATT_MEIVERSION);
         assert(att);
         if (att->HasMeiversion()) {
             attributes->push_back({ "meiversion", att->MeiVersionMeiversionToStr(att->GetMeiversion()) });
         }
     }
     if (element->HasAttClass(ATT_METADATAPOINTING)) {
-        const AttMetadataPointing *att = dynamic_cast<const AttMetadataPointing *>(element);
+        const AttMetadataPointing *att = element->GetAtt<AttMetadataPointing>(ATT_METADATAPOINTING);
         assert(att);
         if (att->HasDecls()) {
             attributes->push_back({ "decls", att->StrToStr(att->GetDecls()) });
         }
     }
     if (element->HasAttClass(ATT_METERCONFORMANCE)) {
-        const AttMeterConformance *att = dynamic_cast<const AttMeterConformance *>(element);
+        const AttMeterConformance *att = element->GetAtt<AttMeterConformance>(ATT_METERCONFORMANCE);
         assert(att);
         if (att->HasMetcon()) {
             attributes->push_back({ "metcon", att->MeterConformanceMetconToStr(att->GetMetcon()) });
         }
     }
     if (element->HasAttClass(ATT_METERCONFORMANCEBAR)) {
-        const AttMeterConformanceBar *att = dynamic_cast<const AttMeterConformanceBar *>(element);
+        const AttMeterConformanceBar *att = element->GetAtt<AttMeterConformanceBar>(ATT_METERCONFORMANCEBAR);
         assert(att);
         if (att->HasMetcon()) {
             attributes->push_back({ "metcon", att->BooleanToStr(att->GetMetcon()) });
@@ -4477,7 +4477,7 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_METERSIGLOG)) {
-        const AttMeterSigLog *att = dynamic_cast<const AttMeterSigLog *>(element);
+        const AttMeterSigLog *att = element->GetAtt<AttMeterSigLog>(ATT_METERSIGLOG);
         assert(att);
         if (att->HasCount()) {
             attributes->push_back({ "count", att->MetercountPairToStr(att->GetCount()) });
@@ -4490,7 +4490,7 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_METERSIGDEFAULTLOG)) {
-        const AttMeterSigDefaultLog *att = dynamic_cast<const AttMeterSigDefaultLog *>(element);
+        const AttMeterSigDefaultLog *att = element->GetAtt<AttMeterSigDefaultLog>(ATT_METERSIGDEFAULTLOG);
         assert(att);
         if (att->HasMeterCount()) {
             attributes->push_back({ "meter.count", att->MetercountPairToStr(att->GetMeterCount()) });
@@ -4503,7 +4503,7 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_MMTEMPO)) {
-        const AttMmTempo *att = dynamic_cast<const AttMmTempo *>(element);
+        const AttMmTempo *att = element->GetAtt<AttMmTempo>(ATT_MMTEMPO);
         assert(att);
         if (att->HasMm()) {
             attributes->push_back({ "mm", att->DblToStr(att->GetMm()) });
@@ -4516,28 +4516,28 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_MULTINUMMEASURES)) {
-        const AttMultinumMeasures *att = dynamic_cast<const AttMultinumMeasures *>(element);
+        const AttMultinumMeasures *att = element->GetAtt<AttMultinumMeasures>(ATT_MULTINUMMEASURES);
         assert(att);
         if (att->HasMultiNumber()) {
             attributes->push_back({ "multi.number", att->BooleanToStr(att->GetMultiNumber()) });
         }
     }
     if (element->HasAttClass(ATT_NINTEGER)) {
-        const AttNInteger *att = dynamic_cast<const AttNInteger *>(element);
+        const AttNInteger *att = element->GetAtt<AttNInteger>(ATT_NINTEGER);
         assert(att);
         if (att->HasN()) {
             attributes->push_back({ "n", att->IntToStr(att->GetN()) });
         }
     }
     if (element->HasAttClass(ATT_NNUMBERLIKE)) {
-        const AttNNumberLike *att = dynamic_cast<const AttNNumberLike *>(element);
+        const AttNNumberLike *att = element->GetAtt<AttNNumberLike>(ATT_NNUMBERLIKE);
         assert(att);
         if (att->HasN()) {
             attributes->push_back({ "n", att->StrToStr(att->GetN()) });
         }
     }
     if (element->HasAttClass(ATT_NAME)) {
-        const AttName *att = dynamic_cast<const AttName *>(element);
+        const AttName *att = element->GetAtt<AttName>(ATT_NAME);
         assert(att);
         if (att->HasNymref()) {
             attributes->push_back({ "nymref", att->StrToStr(att->GetNymref()) });
@@ -4547,7 +4547,7 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_NOTATIONSTYLE)) {
-        const AttNotationStyle *att = dynamic_cast<const AttNotationStyle *>(element);
+        const AttNotationStyle *att = element->GetAtt<AttNotationStyle>(ATT_NOTATIONSTYLE);
         assert(att);
         if (att->HasMusicName()) {
             attributes->push_back({ "music.name", att->StrToStr(att->GetMusicName()) });
@@ -4557,7 +4557,7 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_NOTEHEADS)) {
-        const AttNoteHeads *att = dynamic_cast<const AttNoteHeads *>(element);
+        const AttNoteHeads *att = element->GetAtt<AttNoteHeads>(ATT_NOTEHEADS);
         assert(att);
         if (att->HasHeadAltsym()) {
             attributes->push_back({ "head.altsym", att->StrToStr(att->GetHeadAltsym()) });
@@ -4588,21 +4588,21 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_OCTAVE)) {
-        const AttOctave *att = dynamic_cast<const AttOctave *>(element);
+        const AttOctave *att = element->GetAtt<AttOctave>(ATT_OCTAVE);
         assert(att);
         if (att->HasOct()) {
             attributes->push_back({ "oct", att->OctaveToStr(att->GetOct()) });
         }
     }
     if (element->HasAttClass(ATT_OCTAVEDEFAULT)) {
-        const AttOctaveDefault *att = dynamic_cast<const AttOctaveDefault *>(element);
+        const AttOctaveDefault *att = element->GetAtt<AttOctaveDefault>(ATT_OCTAVEDEFAULT);
         assert(att);
         if (att->HasOctDefault()) {
             attributes->push_back({ "oct.default", att->OctaveToStr(att->GetOctDefault()) });
         }
     }
     if (element->HasAttClass(ATT_OCTAVEDISPLACEMENT)) {
-        const AttOctaveDisplacement *att = dynamic_cast<const AttOctaveDisplacement *>(element);
+        const AttOctaveDisplacement *att = element->GetAtt<AttOctaveDisplacement>(ATT_OCTAVEDISPLACEMENT);
         assert(att);
         if (att->HasDis()) {
             attributes->push_back({ "dis", att->OctaveDisToStr(att->GetDis()) });
@@ -4612,35 +4612,35 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_ONELINESTAFF)) {
-        const AttOneLineStaff *att = dynamic_cast<const AttOneLineStaff *>(element);
+        const AttOneLineStaff *att = element->GetAtt<AttOneLineStaff>(ATT_ONELINESTAFF);
         assert(att);
         if (att->HasOntheline()) {
             attributes->push_back({ "ontheline", att->BooleanToStr(att->GetOntheline()) });
         }
     }
     if (element->HasAttClass(ATT_OPTIMIZATION)) {
-        const AttOptimization *att = dynamic_cast<const AttOptimization *>(element);
+        const AttOptimization *att = element->GetAtt<AttOptimization>(ATT_OPTIMIZATION);
         assert(att);
         if (att->HasOptimize()) {
             attributes->push_back({ "optimize", att->BooleanToStr(att->GetOptimize()) });
         }
     }
     if (element->HasAttClass(ATT_ORIGINLAYERIDENT)) {
-        const AttOriginLayerIdent *att = dynamic_cast<const AttOriginLayerIdent *>(element);
+        const AttOriginLayerIdent *att = element->GetAtt<AttOriginLayerIdent>(ATT_ORIGINLAYERIDENT);
         assert(att);
         if (att->HasOriginLayer()) {
             attributes->push_back({ "origin.layer", att->StrToStr(att->GetOriginLayer()) });
         }
     }
     if (element->HasAttClass(ATT_ORIGINSTAFFIDENT)) {
-        const AttOriginStaffIdent *att = dynamic_cast<const AttOriginStaffIdent *>(element);
+        const AttOriginStaffIdent *att = element->GetAtt<AttOriginStaffIdent>(ATT_ORIGINSTAFFIDENT);
         assert(att);
         if (att->HasOriginStaff()) {
             attributes->push_back({ "origin.staff", att->StrToStr(att->GetOriginStaff()) });
         }
     }
     if (element->HasAttClass(ATT_ORIGINSTARTENDID)) {
-        const AttOriginStartEndId *att = dynamic_cast<const AttOriginStartEndId *>(element);
+        const AttOriginStartEndId *att = element->GetAtt<AttOriginStartEndId>(ATT_ORIGINSTARTENDID);
         assert(att);
         if (att->HasOriginStartid()) {
             attributes->push_back({ "origin.startid", att->StrToStr(att->GetOriginStartid()) });
@@ -4650,7 +4650,7 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_ORIGINTIMESTAMPLOG)) {
-        const AttOriginTimestampLog *att = dynamic_cast<const AttOriginTimestampLog *>(element);
+        const AttOriginTimestampLog *att = element->GetAtt<AttOriginTimestampLog>(ATT_ORIGINTIMESTAMPLOG);
         assert(att);
         if (att->HasOriginTstamp()) {
             attributes->push_back({ "origin.tstamp", att->MeasurebeatToStr(att->GetOriginTstamp()) });
@@ -4660,7 +4660,7 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_PAGES)) {
-        const AttPages *att = dynamic_cast<const AttPages *>(element);
+        const AttPages *att = element->GetAtt<AttPages>(ATT_PAGES);
         assert(att);
         if (att->HasPageHeight()) {
             attributes->push_back({ "page.height", att->MeasurementunsignedToStr(att->GetPageHeight()) });
@@ -4688,7 +4688,7 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_PARTIDENT)) {
-        const AttPartIdent *att = dynamic_cast<const AttPartIdent *>(element);
+        const AttPartIdent *att = element->GetAtt<AttPartIdent>(ATT_PARTIDENT);
         assert(att);
         if (att->HasPart()) {
             attributes->push_back({ "part", att->StrToStr(att->GetPart()) });
@@ -4698,42 +4698,42 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_PITCH)) {
-        const AttPitch *att = dynamic_cast<const AttPitch *>(element);
+        const AttPitch *att = element->GetAtt<AttPitch>(ATT_PITCH);
         assert(att);
         if (att->HasPname()) {
             attributes->push_back({ "pname", att->PitchnameToStr(att->GetPname()) });
         }
     }
     if (element->HasAttClass(ATT_PLACEMENTONSTAFF)) {
-        const AttPlacementOnStaff *att = dynamic_cast<const AttPlacementOnStaff *>(element);
+        const AttPlacementOnStaff *att = element->GetAtt<AttPlacementOnStaff>(ATT_PLACEMENTONSTAFF);
         assert(att);
         if (att->HasOnstaff()) {
             attributes->push_back({ "onstaff", att->BooleanToStr(att->GetOnstaff()) });
         }
     }
     if (element->HasAttClass(ATT_PLACEMENTRELEVENT)) {
-        const AttPlacementRelEvent *att = dynamic_cast<const AttPlacementRelEvent *>(element);
+        const AttPlacementRelEvent *att = element->GetAtt<AttPlacementRelEvent>(ATT_PLACEMENTRELEVENT);
         assert(att);
         if (att->HasPlace()) {
             attributes->push_back({ "place", att->StaffrelToStr(att->GetPlace()) });
         }
     }
     if (element->HasAttClass(ATT_PLACEMENTRELSTAFF)) {
-        const AttPlacementRelStaff *att = dynamic_cast<const AttPlacementRelStaff *>(element);
+        const AttPlacementRelStaff *att = element->GetAtt<AttPlacementRelStaff>(ATT_PLACEMENTRELSTAFF);
         assert(att);
         if (att->HasPlace()) {
             attributes->push_back({ "place", att->StaffrelToStr(att->GetPlace()) });
         }
     }
     if (element->HasAttClass(ATT_PLIST)) {
-        const AttPlist *att = dynamic_cast<const AttPlist *>(element);
+        const AttPlist *att = element->GetAtt<AttPlist>(ATT_PLIST);
         assert(att);
         if (att->HasPlist()) {
             attributes->push_back({ "plist", att->XsdAnyURIListToStr(att->GetPlist()) });
         }
     }
     if (element->HasAttClass(ATT_POINTING)) {
-        const AttPointing *att = dynamic_cast<const AttPointing *>(element);
+        const AttPointing *att = element->GetAtt<AttPointing>(ATT_POINTING);
         assert(att);
         if (att->HasActuate()) {
             attributes->push_back({ "xlink:actuate", att->StrToStr(att->GetActuate()) });
@@ -4752,14 +4752,14 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_QUANTITY)) {
-        const AttQuantity *att = dynamic_cast<const AttQuantity *>(element);
+        const AttQuantity *att = element->GetAtt<AttQuantity>(ATT_QUANTITY);
         assert(att);
         if (att->HasQuantity()) {
             attributes->push_back({ "quantity", att->DblToStr(att->GetQuantity()) });
         }
     }
     if (element->HasAttClass(ATT_RANGING)) {
-        const AttRanging *att = dynamic_cast<const AttRanging *>(element);
+        const AttRanging *att = element->GetAtt<AttRanging>(ATT_RANGING);
         assert(att);
         if (att->HasAtleast()) {
             attributes->push_back({ "atleast", att->DblToStr(att->GetAtleast()) });
@@ -4778,56 +4778,56 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_RESPONSIBILITY)) {
-        const AttResponsibility *att = dynamic_cast<const AttResponsibility *>(element);
+        const AttResponsibility *att = element->GetAtt<AttResponsibility>(ATT_RESPONSIBILITY);
         assert(att);
         if (att->HasResp()) {
             attributes->push_back({ "resp", att->StrToStr(att->GetResp()) });
         }
     }
     if (element->HasAttClass(ATT_RESTDURATIONLOG)) {
-        const AttRestdurationLog *att = dynamic_cast<const AttRestdurationLog *>(element);
+        const AttRestdurationLog *att = element->GetAtt<AttRestdurationLog>(ATT_RESTDURATIONLOG);
         assert(att);
         if (att->HasDur()) {
             attributes->push_back({ "dur", att->DurationToStr(att->GetDur()) });
         }
     }
     if (element->HasAttClass(ATT_SCALABLE)) {
-        const AttScalable *att = dynamic_cast<const AttScalable *>(element);
+        const AttScalable *att = element->GetAtt<AttScalable>(ATT_SCALABLE);
         assert(att);
         if (att->HasScale()) {
             attributes->push_back({ "scale", att->PercentToStr(att->GetScale()) });
         }
     }
     if (element->HasAttClass(ATT_SEQUENCE)) {
-        const AttSequence *att = dynamic_cast<const AttSequence *>(element);
+        const AttSequence *att = element->GetAtt<AttSequence>(ATT_SEQUENCE);
         assert(att);
         if (att->HasSeq()) {
             attributes->push_back({ "seq", att->IntToStr(att->GetSeq()) });
         }
     }
     if (element->HasAttClass(ATT_SLASHCOUNT)) {
-        const AttSlashCount *att = dynamic_cast<const AttSlashCount *>(element);
+        const AttSlashCount *att = element->GetAtt<AttSlashCount>(ATT_SLASHCOUNT);
         assert(att);
         if (att->HasSlash()) {
             attributes->push_back({ "slash", att->IntToStr(att->GetSlash()) });
         }
     }
     if (element->HasAttClass(ATT_SLURPRESENT)) {
-        const AttSlurPresent *att = dynamic_cast<const AttSlurPresent *>(element);
+        const AttSlurPresent *att = element->GetAtt<AttSlurPresent>(ATT_SLURPRESENT);
         assert(att);
         if (att->HasSlur()) {
             attributes->push_back({ "slur", att->StrToStr(att->GetSlur()) });
         }
     }
     if (element->HasAttClass(ATT_SOURCE)) {
-        const AttSource *att = dynamic_cast<const AttSource *>(element);
+        const AttSource *att = element->GetAtt<AttSource>(ATT_SOURCE);
         assert(att);
         if (att->HasSource()) {
             attributes->push_back({ "source", att->StrToStr(att->GetSource()) });
         }
     }
     if (element->HasAttClass(ATT_SPACING)) {
-        const AttSpacing *att = dynamic_cast<const AttSpacing *>(element);
+        const AttSpacing *att = element->GetAtt<AttSpacing>(ATT_SPACING);
         assert(att);
         if (att->HasSpacingPackexp()) {
             attributes->push_back({ "spacing.packexp", att->DblToStr(att->GetSpacingPackexp()) });
@@ -4843,35 +4843,35 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_STAFFLOG)) {
-        const AttStaffLog *att = dynamic_cast<const AttStaffLog *>(element);
+        const AttStaffLog *att = element->GetAtt<AttStaffLog>(ATT_STAFFLOG);
         assert(att);
         if (att->HasDef()) {
             attributes->push_back({ "def", att->StrToStr(att->GetDef()) });
         }
     }
     if (element->HasAttClass(ATT_STAFFDEFLOG)) {
-        const AttStaffDefLog *att = dynamic_cast<const AttStaffDefLog *>(element);
+        const AttStaffDefLog *att = element->GetAtt<AttStaffDefLog>(ATT_STAFFDEFLOG);
         assert(att);
         if (att->HasLines()) {
             attributes->push_back({ "lines", att->IntToStr(att->GetLines()) });
         }
     }
     if (element->HasAttClass(ATT_STAFFGROUPINGSYM)) {
-        const AttStaffGroupingSym *att = dynamic_cast<const AttStaffGroupingSym *>(element);
+        const AttStaffGroupingSym *att = element->GetAtt<AttStaffGroupingSym>(ATT_STAFFGROUPINGSYM);
         assert(att);
         if (att->HasSymbol()) {
             attributes->push_back({ "symbol", att->StaffGroupingSymSymbolToStr(att->GetSymbol()) });
         }
     }
     if (element->HasAttClass(ATT_STAFFIDENT)) {
-        const AttStaffIdent *att = dynamic_cast<const AttStaffIdent *>(element);
+        const AttStaffIdent *att = element->GetAtt<AttStaffIdent>(ATT_STAFFIDENT);
         assert(att);
         if (att->HasStaff()) {
             attributes->push_back({ "staff", att->XsdPositiveIntegerListToStr(att->GetStaff()) });
         }
     }
     if (element->HasAttClass(ATT_STAFFITEMS)) {
-        const AttStaffItems *att = dynamic_cast<const AttStaffItems *>(element);
+        const AttStaffItems *att = element->GetAtt<AttStaffItems>(ATT_STAFFITEMS);
         assert(att);
         if (att->HasAboveorder()) {
             attributes->push_back({ "aboveorder", att->StaffitemToStr(att->GetAboveorder()) });
@@ -4884,14 +4884,14 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_STAFFLOC)) {
-        const AttStaffLoc *att = dynamic_cast<const AttStaffLoc *>(element);
+        const AttStaffLoc *att = element->GetAtt<AttStaffLoc>(ATT_STAFFLOC);
         assert(att);
         if (att->HasLoc()) {
             attributes->push_back({ "loc", att->IntToStr(att->GetLoc()) });
         }
     }
     if (element->HasAttClass(ATT_STAFFLOCPITCHED)) {
-        const AttStaffLocPitched *att = dynamic_cast<const AttStaffLocPitched *>(element);
+        const AttStaffLocPitched *att = element->GetAtt<AttStaffLocPitched>(ATT_STAFFLOCPITCHED);
         assert(att);
         if (att->HasPloc()) {
             attributes->push_back({ "ploc", att->PitchnameToStr(att->GetPloc()) });
@@ -4901,21 +4901,21 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_STARTENDID)) {
-        const AttStartEndId *att = dynamic_cast<const AttStartEndId *>(element);
+        const AttStartEndId *att = element->GetAtt<AttStartEndId>(ATT_STARTENDID);
         assert(att);
         if (att->HasEndid()) {
             attributes->push_back({ "endid", att->StrToStr(att->GetEndid()) });
         }
     }
     if (element->HasAttClass(ATT_STARTID)) {
-        const AttStartId *att = dynamic_cast<const AttStartId *>(element);
+        const AttStartId *att = element->GetAtt<AttStartId>(ATT_STARTID);
         assert(att);
         if (att->HasStartid()) {
             attributes->push_back({ "startid", att->StrToStr(att->GetStartid()) });
         }
     }
     if (element->HasAttClass(ATT_STEMS)) {
-        const AttStems *att = dynamic_cast<const AttStems *>(element);
+        const AttStems *att = element->GetAtt<AttStems>(ATT_STEMS);
         assert(att);
         if (att->HasStemDir()) {
             attributes->push_back({ "stem.dir", att->StemdirectionToStr(att->GetStemDir()) });
@@ -4943,7 +4943,7 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_SYLLOG)) {
-        const AttSylLog *att = dynamic_cast<const AttSylLog *>(element);
+        const AttSylLog *att = element->GetAtt<AttSylLog>(ATT_SYLLOG);
         assert(att);
         if (att->HasCon()) {
             attributes->push_back({ "con", att->SylLogConToStr(att->GetCon()) });
@@ -4953,14 +4953,14 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_SYLTEXT)) {
-        const AttSylText *att = dynamic_cast<const AttSylText *>(element);
+        const AttSylText *att = element->GetAtt<AttSylText>(ATT_SYLTEXT);
         assert(att);
         if (att->HasSyl()) {
             attributes->push_back({ "syl", att->StrToStr(att->GetSyl()) });
         }
     }
     if (element->HasAttClass(ATT_SYSTEMS)) {
-        const AttSystems *att = dynamic_cast<const AttSystems *>(element);
+        const AttSystems *att = element->GetAtt<AttSystems>(ATT_SYSTEMS);
         assert(att);
         if (att->HasSystemLeftline()) {
             attributes->push_back({ "system.leftline", att->BooleanToStr(att->GetSystemLeftline()) });
@@ -4976,21 +4976,21 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_TARGETEVAL)) {
-        const AttTargetEval *att = dynamic_cast<const AttTargetEval *>(element);
+        const AttTargetEval *att = element->GetAtt<AttTargetEval>(ATT_TARGETEVAL);
         assert(att);
         if (att->HasEvaluate()) {
             attributes->push_back({ "evaluate", att->TargetEvalEvaluateToStr(att->GetEvaluate()) });
         }
     }
     if (element->HasAttClass(ATT_TEMPOLOG)) {
-        const AttTempoLog *att = dynamic_cast<const AttTempoLog *>(element);
+        const AttTempoLog *att = element->GetAtt<AttTempoLog>(ATT_TEMPOLOG);
         assert(att);
         if (att->HasFunc()) {
             attributes->push_back({ "func", att->TempoLogFuncToStr(att->GetFunc()) });
         }
     }
     if (element->HasAttClass(ATT_TEXTRENDITION)) {
-        const AttTextRendition *att = dynamic_cast<const AttTextRendition *>(element);
+        const AttTextRendition *att = element->GetAtt<AttTextRendition>(ATT_TEXTRENDITION);
         assert(att);
         if (att->HasAltrend()) {
             attributes->push_back({ "altrend", att->StrToStr(att->GetAltrend()) });
@@ -5000,7 +5000,7 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_TEXTSTYLE)) {
-        const AttTextStyle *att = dynamic_cast<const AttTextStyle *>(element);
+        const AttTextStyle *att = element->GetAtt<AttTextStyle>(ATT_TEXTSTYLE);
         assert(att);
         if (att->HasTextFam()) {
             attributes->push_back({ "text.fam", att->StrToStr(att->GetTextFam()) });
@@ -5019,28 +5019,28 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_TIEPRESENT)) {
-        const AttTiePresent *att = dynamic_cast<const AttTiePresent *>(element);
+        const AttTiePresent *att = element->GetAtt<AttTiePresent>(ATT_TIEPRESENT);
         assert(att);
         if (att->HasTie()) {
             attributes->push_back({ "tie", att->TieToStr(att->GetTie()) });
         }
     }
     if (element->HasAttClass(ATT_TIMESTAMPLOG)) {
-        const AttTimestampLog *att = dynamic_cast<const AttTimestampLog *>(element);
+        const AttTimestampLog *att = element->GetAtt<AttTimestampLog>(ATT_TIMESTAMPLOG);
         assert(att);
         if (att->HasTstamp()) {
             attributes->push_back({ "tstamp", att->DblToStr(att->GetTstamp()) });
         }
     }
     if (element->HasAttClass(ATT_TIMESTAMP2LOG)) {
-        const AttTimestamp2Log *att = dynamic_cast<const AttTimestamp2Log *>(element);
+        const AttTimestamp2Log *att = element->GetAtt<AttTimestamp2Log>(ATT_TIMESTAMP2LOG);
         assert(att);
         if (att->HasTstamp2()) {
             attributes->push_back({ "tstamp2", att->MeasurebeatToStr(att->GetTstamp2()) });
         }
     }
     if (element->HasAttClass(ATT_TRANSPOSITION)) {
-        const AttTransposition *att = dynamic_cast<const AttTransposition *>(element);
+        const AttTransposition *att = element->GetAtt<AttTransposition>(ATT_TRANSPOSITION);
         assert(att);
         if (att->HasTransDiat()) {
             attributes->push_back({ "trans.diat", att->IntToStr(att->GetTransDiat()) });
@@ -5050,7 +5050,7 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_TUNING)) {
-        const AttTuning *att = dynamic_cast<const AttTuning *>(element);
+        const AttTuning *att = element->GetAtt<AttTuning>(ATT_TUNING);
         assert(att);
         if (att->HasTuneHz()) {
             attributes->push_back({ "tune.Hz", att->DblToStr(att->GetTuneHz()) });
@@ -5063,21 +5063,21 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_TUPLETPRESENT)) {
-        const AttTupletPresent *att = dynamic_cast<const AttTupletPresent *>(element);
+        const AttTupletPresent *att = element->GetAtt<AttTupletPresent>(ATT_TUPLETPRESENT);
         assert(att);
         if (att->HasTuplet()) {
             attributes->push_back({ "tuplet", att->StrToStr(att->GetTuplet()) });
         }
     }
     if (element->HasAttClass(ATT_TYPED)) {
-        const AttTyped *att = dynamic_cast<const AttTyped *>(element);
+        const AttTyped *att = element->GetAtt<AttTyped>(ATT_TYPED);
         assert(att);
         if (att->HasType()) {
             attributes->push_back({ "type", att->StrToStr(att->GetType()) });
         }
     }
     if (element->HasAttClass(ATT_TYPOGRAPHY)) {
-        const AttTypography *att = dynamic_cast<const AttTypography *>(element);
+        const AttTypography *att = element->GetAtt<AttTypography>(ATT_TYPOGRAPHY);
         assert(att);
         if (att->HasFontfam()) {
             attributes->push_back({ "fontfam", att->StrToStr(att->GetFontfam()) });
@@ -5102,49 +5102,49 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_VERTICALALIGN)) {
-        const AttVerticalAlign *att = dynamic_cast<const AttVerticalAlign *>(element);
+        const AttVerticalAlign *att = element->GetAtt<AttVerticalAlign>(ATT_VERTICALALIGN);
         assert(att);
         if (att->HasValign()) {
             attributes->push_back({ "valign", att->VerticalalignmentToStr(att->GetValign()) });
         }
     }
     if (element->HasAttClass(ATT_VERTICALGROUP)) {
-        const AttVerticalGroup *att = dynamic_cast<const AttVerticalGroup *>(element);
+        const AttVerticalGroup *att = element->GetAtt<AttVerticalGroup>(ATT_VERTICALGROUP);
         assert(att);
         if (att->HasVgrp()) {
             attributes->push_back({ "vgrp", att->IntToStr(att->GetVgrp()) });
         }
     }
     if (element->HasAttClass(ATT_VISIBILITY)) {
-        const AttVisibility *att = dynamic_cast<const AttVisibility *>(element);
+        const AttVisibility *att = element->GetAtt<AttVisibility>(ATT_VISIBILITY);
         assert(att);
         if (att->HasVisible()) {
             attributes->push_back({ "visible", att->BooleanToStr(att->GetVisible()) });
         }
     }
     if (element->HasAttClass(ATT_VISUALOFFSETHO)) {
-        const AttVisualOffsetHo *att = dynamic_cast<const AttVisualOffsetHo *>(element);
+        const AttVisualOffsetHo *att = element->GetAtt<AttVisualOffsetHo>(ATT_VISUALOFFSETHO);
         assert(att);
         if (att->HasHo()) {
             attributes->push_back({ "ho", att->MeasurementsignedToStr(att->GetHo()) });
         }
     }
     if (element->HasAttClass(ATT_VISUALOFFSETTO)) {
-        const AttVisualOffsetTo *att = dynamic_cast<const AttVisualOffsetTo *>(element);
+        const AttVisualOffsetTo *att = element->GetAtt<AttVisualOffsetTo>(ATT_VISUALOFFSETTO);
         assert(att);
         if (att->HasTo()) {
             attributes->push_back({ "to", att->DblToStr(att->GetTo()) });
         }
     }
     if (element->HasAttClass(ATT_VISUALOFFSETVO)) {
-        const AttVisualOffsetVo *att = dynamic_cast<const AttVisualOffsetVo *>(element);
+        const AttVisualOffsetVo *att = element->GetAtt<AttVisualOffsetVo>(ATT_VISUALOFFSETVO);
         assert(att);
         if (att->HasVo()) {
             attributes->push_back({ "vo", att->MeasurementsignedToStr(att->GetVo()) });
         }
     }
     if (element->HasAttClass(ATT_VISUALOFFSET2HO)) {
-        const AttVisualOffset2Ho *att = dynamic_cast<const AttVisualOffset2Ho *>(element);
+        const AttVisualOffset2Ho *att = element->GetAtt<AttVisualOffset2Ho>(ATT_VISUALOFFSET2HO);
         assert(att);
         if (att->HasStartho()) {
             attributes->push_back({ "startho", att->MeasurementsignedToStr(att->GetStartho()) });
@@ -5154,7 +5154,7 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_VISUALOFFSET2TO)) {
-        const AttVisualOffset2To *att = dynamic_cast<const AttVisualOffset2To *>(element);
+        const AttVisualOffset2To *att = element->GetAtt<AttVisualOffset2To>(ATT_VISUALOFFSET2TO);
         assert(att);
         if (att->HasStartto()) {
             attributes->push_back({ "startto", att->DblToStr(att->GetStartto()) });
@@ -5164,7 +5164,7 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_VISUALOFFSET2VO)) {
-        const AttVisualOffset2Vo *att = dynamic_cast<const AttVisualOffset2Vo *>(element);
+        const AttVisualOffset2Vo *att = element->GetAtt<AttVisualOffset2Vo>(ATT_VISUALOFFSET2VO);
         assert(att);
         if (att->HasStartvo()) {
             attributes->push_back({ "startvo", att->MeasurementsignedToStr(att->GetStartvo()) });
@@ -5174,28 +5174,28 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_VOLTAGROUPINGSYM)) {
-        const AttVoltaGroupingSym *att = dynamic_cast<const AttVoltaGroupingSym *>(element);
+        const AttVoltaGroupingSym *att = element->GetAtt<AttVoltaGroupingSym>(ATT_VOLTAGROUPINGSYM);
         assert(att);
         if (att->HasVoltasym()) {
             attributes->push_back({ "voltasym", att->VoltaGroupingSymVoltasymToStr(att->GetVoltasym()) });
         }
     }
     if (element->HasAttClass(ATT_WHITESPACE)) {
-        const AttWhitespace *att = dynamic_cast<const AttWhitespace *>(element);
+        const AttWhitespace *att = element->GetAtt<AttWhitespace>(ATT_WHITESPACE);
         assert(att);
         if (att->HasSpace()) {
             attributes->push_back({ "xml:space", att->StrToStr(att->GetSpace()) });
         }
     }
     if (element->HasAttClass(ATT_WIDTH)) {
-        const AttWidth *att = dynamic_cast<const AttWidth *>(element);
+        const AttWidth *att = element->GetAtt<AttWidth>(ATT_WIDTH);
         assert(att);
         if (att->HasWidth()) {
             attributes->push_back({ "width", att->MeasurementunsignedToStr(att->GetWidth()) });
         }
     }
     if (element->HasAttClass(ATT_XY)) {
-        const AttXy *att = dynamic_cast<const AttXy *>(element);
+        const AttXy *att = element->GetAtt<AttXy>(ATT_XY);
         assert(att);
         if (att->HasX()) {
             attributes->push_back({ "x", att->DblToStr(att->GetX()) });
@@ -5205,7 +5205,7 @@ void AttModule::GetShared(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_XY2)) {
-        const AttXy2 *att = dynamic_cast<const AttXy2 *>(element);
+        const AttXy2 *att = element->GetAtt<AttXy2>(ATT_XY2);
         assert(att);
         if (att->HasX2()) {
             attributes->push_back({ "x2", att->DblToStr(att->GetX2()) });
@@ -5229,7 +5229,7 @@ namespace vrv {
 bool AttModule::SetUsersymbols(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_ALTSYM)) {
-        AttAltSym *att = dynamic_cast<AttAltSym *>(element);
+        AttAltSym *att = element->GetAtt<AttAltSym>(ATT_ALTSYM);
         assert(att);
         if (attrType == "altsym") {
             att->SetAltsym(att->StrToStr(attrValue));
@@ -5237,7 +5237,7 @@ bool AttModule::SetUsersymbols(Object *element, const std::string &attrType, con
         }
     }
     if (element->HasAttClass(ATT_ANCHOREDTEXTLOG)) {
-        AttAnchoredTextLog *att = dynamic_cast<AttAnchoredTextLog *>(element);
+        AttAnchoredTextLog *att = element->GetAtt<AttAnchoredTextLog>(ATT_ANCHOREDTEXTLOG);
         assert(att);
         if (attrType == "func") {
             att->SetFunc(att->StrToStr(attrValue));
@@ -5245,7 +5245,7 @@ bool AttModule::SetUsersymbols(Object *element, const std::string &attrType, con
         }
     }
     if (element->HasAttClass(ATT_CURVELOG)) {
-        AttCurveLog *att = dynamic_cast<AttCurveLog *>(element);
+        AttCurveLog *att = element->GetAtt<AttCurveLog>(ATT_CURVELOG);
         assert(att);
         if (attrType == "func") {
             att->SetFunc(att->StrToStr(attrValue));
@@ -5253,7 +5253,7 @@ bool AttModule::SetUsersymbols(Object *element, const std::string &attrType, con
         }
     }
     if (element->HasAttClass(ATT_LINELOG)) {
-        AttLineLog *att = dynamic_cast<AttLineLog *>(element);
+        AttLineLog *att = element->GetAtt<AttLineLog>(ATT_LINELOG);
         assert(att);
         if (attrType == "func") {
             att->SetFunc(att->StrToStr(attrValue));
@@ -5267,28 +5267,28 @@ bool AttModule::SetUsersymbols(Object *element, const std::string &attrType, con
 void AttModule::GetUsersymbols(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_ALTSYM)) {
-        const AttAltSym *att = dynamic_cast<const AttAltSym *>(element);
+        const AttAltSym *att = element->GetAtt<AttAltSym>(ATT_ALTSYM);
         assert(att);
         if (att->HasAltsym()) {
             attributes->push_back({ "altsym", att->StrToStr(att->GetAltsym()) });
         }
     }
     if (element->HasAttClass(ATT_ANCHOREDTEXTLOG)) {
-        const AttAnchoredTextLog *att = dynamic_cast<const AttAnchoredTextLog *>(element);
+        const AttAnchoredTextLog *att = element->GetAtt<AttAnchoredTextLog>(ATT_ANCHOREDTEXTLOG);
         assert(att);
         if (att->HasFunc()) {
             attributes->push_back({ "func", att->StrToStr(att->GetFunc()) });
         }
     }
     if (element->HasAttClass(ATT_CURVELOG)) {
-        const AttCurveLog *att = dynamic_cast<const AttCurveLog *>(element);
+        const AttCurveLog *att = element->GetAtt<AttCurveLog>(ATT_CURVELOG);
         assert(att);
         if (att->HasFunc()) {
             attributes->push_back({ "func", att->StrToStr(att->GetFunc()) });
         }
     }
     if (element->HasAttClass(ATT_LINELOG)) {
-        const AttLineLog *att = dynamic_cast<const AttLineLog *>(element);
+        const AttLineLog *att = element->GetAtt<AttLineLog>(ATT_LINELOG);
         assert(att);
         if (att->HasFunc()) {
             attributes->push_back({ "func", att->StrToStr(att->GetFunc()) });
@@ -5309,7 +5309,7 @@ namespace vrv {
 bool AttModule::SetVisual(Object *element, const std::string &attrType, const std::string &attrValue)
 {
     if (element->HasAttClass(ATT_ANNOTVIS)) {
-        AttAnnotVis *att = dynamic_cast<AttAnnotVis *>(element);
+        AttAnnotVis *att = element->GetAtt<AttAnnotVis>(ATT_ANNOTVIS);
         assert(att);
         if (attrType == "place") {
             att->SetPlace(att->StrToPlacement(attrValue));
@@ -5317,7 +5317,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_ARPEGVIS)) {
-        AttArpegVis *att = dynamic_cast<AttArpegVis *>(element);
+        AttArpegVis *att = element->GetAtt<AttArpegVis>(ATT_ARPEGVIS);
         assert(att);
         if (attrType == "arrow") {
             att->SetArrow(att->StrToBoolean(attrValue));
@@ -5349,7 +5349,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_BARLINEVIS)) {
-        AttBarLineVis *att = dynamic_cast<AttBarLineVis *>(element);
+        AttBarLineVis *att = element->GetAtt<AttBarLineVis>(ATT_BARLINEVIS);
         assert(att);
         if (attrType == "len") {
             att->SetLen(att->StrToDbl(attrValue));
@@ -5365,7 +5365,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_BEAMINGVIS)) {
-        AttBeamingVis *att = dynamic_cast<AttBeamingVis *>(element);
+        AttBeamingVis *att = element->GetAtt<AttBeamingVis>(ATT_BEAMINGVIS);
         assert(att);
         if (attrType == "beam.color") {
             att->SetBeamColor(att->StrToStr(attrValue));
@@ -5381,7 +5381,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_BEATRPTVIS)) {
-        AttBeatRptVis *att = dynamic_cast<AttBeatRptVis *>(element);
+        AttBeatRptVis *att = element->GetAtt<AttBeatRptVis>(ATT_BEATRPTVIS);
         assert(att);
         if (attrType == "slash") {
             att->SetSlash(att->StrToBeatrptRend(attrValue));
@@ -5389,7 +5389,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_CHORDVIS)) {
-        AttChordVis *att = dynamic_cast<AttChordVis *>(element);
+        AttChordVis *att = element->GetAtt<AttChordVis>(ATT_CHORDVIS);
         assert(att);
         if (attrType == "cluster") {
             att->SetCluster(att->StrToCluster(attrValue));
@@ -5397,7 +5397,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_CLEFFINGVIS)) {
-        AttCleffingVis *att = dynamic_cast<AttCleffingVis *>(element);
+        AttCleffingVis *att = element->GetAtt<AttCleffingVis>(ATT_CLEFFINGVIS);
         assert(att);
         if (attrType == "clef.color") {
             att->SetClefColor(att->StrToStr(attrValue));
@@ -5409,7 +5409,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_EPISEMAVIS)) {
-        AttEpisemaVis *att = dynamic_cast<AttEpisemaVis *>(element);
+        AttEpisemaVis *att = element->GetAtt<AttEpisemaVis>(ATT_EPISEMAVIS);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToEpisemaVisForm(attrValue));
@@ -5421,7 +5421,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_FTREMVIS)) {
-        AttFTremVis *att = dynamic_cast<AttFTremVis *>(element);
+        AttFTremVis *att = element->GetAtt<AttFTremVis>(ATT_FTREMVIS);
         assert(att);
         if (attrType == "beams") {
             att->SetBeams(att->StrToInt(attrValue));
@@ -5437,7 +5437,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_FERMATAVIS)) {
-        AttFermataVis *att = dynamic_cast<AttFermataVis *>(element);
+        AttFermataVis *att = element->GetAtt<AttFermataVis>(ATT_FERMATAVIS);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToFermataVisForm(attrValue));
@@ -5449,7 +5449,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_FINGGRPVIS)) {
-        AttFingGrpVis *att = dynamic_cast<AttFingGrpVis *>(element);
+        AttFingGrpVis *att = element->GetAtt<AttFingGrpVis>(ATT_FINGGRPVIS);
         assert(att);
         if (attrType == "orient") {
             att->SetOrient(att->StrToFingGrpVisOrient(attrValue));
@@ -5457,7 +5457,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_HAIRPINVIS)) {
-        AttHairpinVis *att = dynamic_cast<AttHairpinVis *>(element);
+        AttHairpinVis *att = element->GetAtt<AttHairpinVis>(ATT_HAIRPINVIS);
         assert(att);
         if (attrType == "opening") {
             att->SetOpening(att->StrToMeasurementunsigned(attrValue));
@@ -5477,7 +5477,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_HARMVIS)) {
-        AttHarmVis *att = dynamic_cast<AttHarmVis *>(element);
+        AttHarmVis *att = element->GetAtt<AttHarmVis>(ATT_HARMVIS);
         assert(att);
         if (attrType == "rendgrid") {
             att->SetRendgrid(att->StrToHarmVisRendgrid(attrValue));
@@ -5485,7 +5485,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_HISPANTICKVIS)) {
-        AttHispanTickVis *att = dynamic_cast<AttHispanTickVis *>(element);
+        AttHispanTickVis *att = element->GetAtt<AttHispanTickVis>(ATT_HISPANTICKVIS);
         assert(att);
         if (attrType == "place") {
             att->SetPlace(att->StrToEventrel(attrValue));
@@ -5497,7 +5497,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_KEYSIGVIS)) {
-        AttKeySigVis *att = dynamic_cast<AttKeySigVis *>(element);
+        AttKeySigVis *att = element->GetAtt<AttKeySigVis>(ATT_KEYSIGVIS);
         assert(att);
         if (attrType == "sig.showchange") {
             att->SetSigShowchange(att->StrToBoolean(attrValue));
@@ -5505,7 +5505,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_KEYSIGDEFAULTVIS)) {
-        AttKeySigDefaultVis *att = dynamic_cast<AttKeySigDefaultVis *>(element);
+        AttKeySigDefaultVis *att = element->GetAtt<AttKeySigDefaultVis>(ATT_KEYSIGDEFAULTVIS);
         assert(att);
         if (attrType == "keysig.show") {
             att->SetKeysigShow(att->StrToBoolean(attrValue));
@@ -5517,7 +5517,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_LIGATUREVIS)) {
-        AttLigatureVis *att = dynamic_cast<AttLigatureVis *>(element);
+        AttLigatureVis *att = element->GetAtt<AttLigatureVis>(ATT_LIGATUREVIS);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToLigatureform(attrValue));
@@ -5525,7 +5525,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_LINEVIS)) {
-        AttLineVis *att = dynamic_cast<AttLineVis *>(element);
+        AttLineVis *att = element->GetAtt<AttLineVis>(ATT_LINEVIS);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToLineform(attrValue));
@@ -5553,7 +5553,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_LIQUESCENTVIS)) {
-        AttLiquescentVis *att = dynamic_cast<AttLiquescentVis *>(element);
+        AttLiquescentVis *att = element->GetAtt<AttLiquescentVis>(ATT_LIQUESCENTVIS);
         assert(att);
         if (attrType == "curve") {
             att->SetCurve(att->StrToLiquescentVisCurve(attrValue));
@@ -5565,7 +5565,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_MENSURVIS)) {
-        AttMensurVis *att = dynamic_cast<AttMensurVis *>(element);
+        AttMensurVis *att = element->GetAtt<AttMensurVis>(ATT_MENSURVIS);
         assert(att);
         if (attrType == "dot") {
             att->SetDot(att->StrToBoolean(attrValue));
@@ -5585,7 +5585,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_MENSURALVIS)) {
-        AttMensuralVis *att = dynamic_cast<AttMensuralVis *>(element);
+        AttMensuralVis *att = element->GetAtt<AttMensuralVis>(ATT_MENSURALVIS);
         assert(att);
         if (attrType == "mensur.color") {
             att->SetMensurColor(att->StrToStr(attrValue));
@@ -5621,7 +5621,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_METERSIGVIS)) {
-        AttMeterSigVis *att = dynamic_cast<AttMeterSigVis *>(element);
+        AttMeterSigVis *att = element->GetAtt<AttMeterSigVis>(ATT_METERSIGVIS);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToMeterform(attrValue));
@@ -5629,7 +5629,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_METERSIGDEFAULTVIS)) {
-        AttMeterSigDefaultVis *att = dynamic_cast<AttMeterSigDefaultVis *>(element);
+        AttMeterSigDefaultVis *att = element->GetAtt<AttMeterSigDefaultVis>(ATT_METERSIGDEFAULTVIS);
         assert(att);
         if (attrType == "meter.form") {
             att->SetMeterForm(att->StrToMeterform(attrValue));
@@ -5641,7 +5641,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_MULTIRESTVIS)) {
-        AttMultiRestVis *att = dynamic_cast<AttMultiRestVis *>(element);
+        AttMultiRestVis *att = element->GetAtt<AttMultiRestVis>(ATT_MULTIRESTVIS);
         assert(att);
         if (attrType == "block") {
             att->SetBlock(att->StrToBoolean(attrValue));
@@ -5649,7 +5649,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_PBVIS)) {
-        AttPbVis *att = dynamic_cast<AttPbVis *>(element);
+        AttPbVis *att = element->GetAtt<AttPbVis>(ATT_PBVIS);
         assert(att);
         if (attrType == "folium") {
             att->SetFolium(att->StrToPbVisFolium(attrValue));
@@ -5657,7 +5657,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_PEDALVIS)) {
-        AttPedalVis *att = dynamic_cast<AttPedalVis *>(element);
+        AttPedalVis *att = element->GetAtt<AttPedalVis>(ATT_PEDALVIS);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToPedalstyle(attrValue));
@@ -5665,7 +5665,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_PLICAVIS)) {
-        AttPlicaVis *att = dynamic_cast<AttPlicaVis *>(element);
+        AttPlicaVis *att = element->GetAtt<AttPlicaVis>(ATT_PLICAVIS);
         assert(att);
         if (attrType == "dir") {
             att->SetDir(att->StrToStemdirectionBasic(attrValue));
@@ -5677,7 +5677,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_QUILISMAVIS)) {
-        AttQuilismaVis *att = dynamic_cast<AttQuilismaVis *>(element);
+        AttQuilismaVis *att = element->GetAtt<AttQuilismaVis>(ATT_QUILISMAVIS);
         assert(att);
         if (attrType == "waves") {
             att->SetWaves(att->StrToInt(attrValue));
@@ -5685,7 +5685,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_SBVIS)) {
-        AttSbVis *att = dynamic_cast<AttSbVis *>(element);
+        AttSbVis *att = element->GetAtt<AttSbVis>(ATT_SBVIS);
         assert(att);
         if (attrType == "form") {
             att->SetForm(att->StrToSbVisForm(attrValue));
@@ -5693,7 +5693,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_SCOREDEFVIS)) {
-        AttScoreDefVis *att = dynamic_cast<AttScoreDefVis *>(element);
+        AttScoreDefVis *att = element->GetAtt<AttScoreDefVis>(ATT_SCOREDEFVIS);
         assert(att);
         if (attrType == "vu.height") {
             att->SetVuHeight(att->StrToStr(attrValue));
@@ -5701,7 +5701,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_SECTIONVIS)) {
-        AttSectionVis *att = dynamic_cast<AttSectionVis *>(element);
+        AttSectionVis *att = element->GetAtt<AttSectionVis>(ATT_SECTIONVIS);
         assert(att);
         if (attrType == "restart") {
             att->SetRestart(att->StrToBoolean(attrValue));
@@ -5709,7 +5709,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_SIGNIFLETVIS)) {
-        AttSignifLetVis *att = dynamic_cast<AttSignifLetVis *>(element);
+        AttSignifLetVis *att = element->GetAtt<AttSignifLetVis>(ATT_SIGNIFLETVIS);
         assert(att);
         if (attrType == "place") {
             att->SetPlace(att->StrToEventrel(attrValue));
@@ -5717,7 +5717,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_SPACEVIS)) {
-        AttSpaceVis *att = dynamic_cast<AttSpaceVis *>(element);
+        AttSpaceVis *att = element->GetAtt<AttSpaceVis>(ATT_SPACEVIS);
         assert(att);
         if (attrType == "compressable") {
             att->SetCompressable(att->StrToBoolean(attrValue));
@@ -5725,7 +5725,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_STAFFDEFVIS)) {
-        AttStaffDefVis *att = dynamic_cast<AttStaffDefVis *>(element);
+        AttStaffDefVis *att = element->GetAtt<AttStaffDefVis>(ATT_STAFFDEFVIS);
         assert(att);
         if (attrType == "grid.show") {
             att->SetGridShow(att->StrToBoolean(attrValue));
@@ -5749,7 +5749,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_STAFFGRPVIS)) {
-        AttStaffGrpVis *att = dynamic_cast<AttStaffGrpVis *>(element);
+        AttStaffGrpVis *att = element->GetAtt<AttStaffGrpVis>(ATT_STAFFGRPVIS);
         assert(att);
         if (attrType == "bar.thru") {
             att->SetBarThru(att->StrToBoolean(attrValue));
@@ -5757,7 +5757,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_STEMVIS)) {
-        AttStemVis *att = dynamic_cast<AttStemVis *>(element);
+        AttStemVis *att = element->GetAtt<AttStemVis>(ATT_STEMVIS);
         assert(att);
         if (attrType == "pos") {
             att->SetPos(att->StrToStemposition(attrValue));
@@ -5785,7 +5785,7 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
         }
     }
     if (element->HasAttClass(ATT_TUPLETVIS)) {
-        AttTupletVis *att = dynamic_cast<AttTupletVis *>(element);
+        AttTupletVis *att = element->GetAtt<AttTupletVis>(ATT_TUPLETVIS);
         assert(att);
         if (attrType == "bracket.place") {
             att->SetBracketPlace(att->StrToStaffrelBasic(attrValue));
@@ -5811,14 +5811,14 @@ bool AttModule::SetVisual(Object *element, const std::string &attrType, const st
 void AttModule::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
 {
     if (element->HasAttClass(ATT_ANNOTVIS)) {
-        const AttAnnotVis *att = dynamic_cast<const AttAnnotVis *>(element);
+        const AttAnnotVis *att = element->GetAtt<AttAnnotVis>(ATT_ANNOTVIS);
         assert(att);
         if (att->HasPlace()) {
             attributes->push_back({ "place", att->PlacementToStr(att->GetPlace()) });
         }
     }
     if (element->HasAttClass(ATT_ARPEGVIS)) {
-        const AttArpegVis *att = dynamic_cast<const AttArpegVis *>(element);
+        const AttArpegVis *att = element->GetAtt<AttArpegVis>(ATT_ARPEGVIS);
         assert(att);
         if (att->HasArrow()) {
             attributes->push_back({ "arrow", att->BooleanToStr(att->GetArrow()) });
@@ -5843,7 +5843,7 @@ void AttModule::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_BARLINEVIS)) {
-        const AttBarLineVis *att = dynamic_cast<const AttBarLineVis *>(element);
+        const AttBarLineVis *att = element->GetAtt<AttBarLineVis>(ATT_BARLINEVIS);
         assert(att);
         if (att->HasLen()) {
             attributes->push_back({ "len", att->DblToStr(att->GetLen()) });
@@ -5856,7 +5856,7 @@ void AttModule::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_BEAMINGVIS)) {
-        const AttBeamingVis *att = dynamic_cast<const AttBeamingVis *>(element);
+        const AttBeamingVis *att = element->GetAtt<AttBeamingVis>(ATT_BEAMINGVIS);
         assert(att);
         if (att->HasBeamColor()) {
             attributes->push_back({ "beam.color", att->StrToStr(att->GetBeamColor()) });
@@ -5869,21 +5869,21 @@ void AttModule::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_BEATRPTVIS)) {
-        const AttBeatRptVis *att = dynamic_cast<const AttBeatRptVis *>(element);
+        const AttBeatRptVis *att = element->GetAtt<AttBeatRptVis>(ATT_BEATRPTVIS);
         assert(att);
         if (att->HasSlash()) {
             attributes->push_back({ "slash", att->BeatrptRendToStr(att->GetSlash()) });
         }
     }
     if (element->HasAttClass(ATT_CHORDVIS)) {
-        const AttChordVis *att = dynamic_cast<const AttChordVis *>(element);
+        const AttChordVis *att = element->GetAtt<AttChordVis>(ATT_CHORDVIS);
         assert(att);
         if (att->HasCluster()) {
             attributes->push_back({ "cluster", att->ClusterToStr(att->GetCluster()) });
         }
     }
     if (element->HasAttClass(ATT_CLEFFINGVIS)) {
-        const AttCleffingVis *att = dynamic_cast<const AttCleffingVis *>(element);
+        const AttCleffingVis *att = element->GetAtt<AttCleffingVis>(ATT_CLEFFINGVIS);
         assert(att);
         if (att->HasClefColor()) {
             attributes->push_back({ "clef.color", att->StrToStr(att->GetClefColor()) });
@@ -5893,7 +5893,7 @@ void AttModule::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_EPISEMAVIS)) {
-        const AttEpisemaVis *att = dynamic_cast<const AttEpisemaVis *>(element);
+        const AttEpisemaVis *att = element->GetAtt<AttEpisemaVis>(ATT_EPISEMAVIS);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back({ "form", att->EpisemaVisFormToStr(att->GetForm()) });
@@ -5903,7 +5903,7 @@ void AttModule::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_FTREMVIS)) {
-        const AttFTremVis *att = dynamic_cast<const AttFTremVis *>(element);
+        const AttFTremVis *att = element->GetAtt<AttFTremVis>(ATT_FTREMVIS);
         assert(att);
         if (att->HasBeams()) {
             attributes->push_back({ "beams", att->IntToStr(att->GetBeams()) });
@@ -5916,7 +5916,7 @@ void AttModule::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_FERMATAVIS)) {
-        const AttFermataVis *att = dynamic_cast<const AttFermataVis *>(element);
+        const AttFermataVis *att = element->GetAtt<AttFermataVis>(ATT_FERMATAVIS);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back({ "form", att->FermataVisFormToStr(att->GetForm()) });
@@ -5926,14 +5926,14 @@ void AttModule::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_FINGGRPVIS)) {
-        const AttFingGrpVis *att = dynamic_cast<const AttFingGrpVis *>(element);
+        const AttFingGrpVis *att = element->GetAtt<AttFingGrpVis>(ATT_FINGGRPVIS);
         assert(att);
         if (att->HasOrient()) {
             attributes->push_back({ "orient", att->FingGrpVisOrientToStr(att->GetOrient()) });
         }
     }
     if (element->HasAttClass(ATT_HAIRPINVIS)) {
-        const AttHairpinVis *att = dynamic_cast<const AttHairpinVis *>(element);
+        const AttHairpinVis *att = element->GetAtt<AttHairpinVis>(ATT_HAIRPINVIS);
         assert(att);
         if (att->HasOpening()) {
             attributes->push_back({ "opening", att->MeasurementunsignedToStr(att->GetOpening()) });
@@ -5949,14 +5949,14 @@ void AttModule::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_HARMVIS)) {
-        const AttHarmVis *att = dynamic_cast<const AttHarmVis *>(element);
+        const AttHarmVis *att = element->GetAtt<AttHarmVis>(ATT_HARMVIS);
         assert(att);
         if (att->HasRendgrid()) {
             attributes->push_back({ "rendgrid", att->HarmVisRendgridToStr(att->GetRendgrid()) });
         }
     }
     if (element->HasAttClass(ATT_HISPANTICKVIS)) {
-        const AttHispanTickVis *att = dynamic_cast<const AttHispanTickVis *>(element);
+        const AttHispanTickVis *att = element->GetAtt<AttHispanTickVis>(ATT_HISPANTICKVIS);
         assert(att);
         if (att->HasPlace()) {
             attributes->push_back({ "place", att->EventrelToStr(att->GetPlace()) });
@@ -5966,14 +5966,14 @@ void AttModule::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_KEYSIGVIS)) {
-        const AttKeySigVis *att = dynamic_cast<const AttKeySigVis *>(element);
+        const AttKeySigVis *att = element->GetAtt<AttKeySigVis>(ATT_KEYSIGVIS);
         assert(att);
         if (att->HasSigShowchange()) {
             attributes->push_back({ "sig.showchange", att->BooleanToStr(att->GetSigShowchange()) });
         }
     }
     if (element->HasAttClass(ATT_KEYSIGDEFAULTVIS)) {
-        const AttKeySigDefaultVis *att = dynamic_cast<const AttKeySigDefaultVis *>(element);
+        const AttKeySigDefaultVis *att = element->GetAtt<AttKeySigDefaultVis>(ATT_KEYSIGDEFAULTVIS);
         assert(att);
         if (att->HasKeysigShow()) {
             attributes->push_back({ "keysig.show", att->BooleanToStr(att->GetKeysigShow()) });
@@ -5983,14 +5983,14 @@ void AttModule::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_LIGATUREVIS)) {
-        const AttLigatureVis *att = dynamic_cast<const AttLigatureVis *>(element);
+        const AttLigatureVis *att = element->GetAtt<AttLigatureVis>(ATT_LIGATUREVIS);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back({ "form", att->LigatureformToStr(att->GetForm()) });
         }
     }
     if (element->HasAttClass(ATT_LINEVIS)) {
-        const AttLineVis *att = dynamic_cast<const AttLineVis *>(element);
+        const AttLineVis *att = element->GetAtt<AttLineVis>(ATT_LINEVIS);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back({ "form", att->LineformToStr(att->GetForm()) });
@@ -6012,7 +6012,7 @@ void AttModule::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_LIQUESCENTVIS)) {
-        const AttLiquescentVis *att = dynamic_cast<const AttLiquescentVis *>(element);
+        const AttLiquescentVis *att = element->GetAtt<AttLiquescentVis>(ATT_LIQUESCENTVIS);
         assert(att);
         if (att->HasCurve()) {
             attributes->push_back({ "curve", att->LiquescentVisCurveToStr(att->GetCurve()) });
@@ -6022,7 +6022,7 @@ void AttModule::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_MENSURVIS)) {
-        const AttMensurVis *att = dynamic_cast<const AttMensurVis *>(element);
+        const AttMensurVis *att = element->GetAtt<AttMensurVis>(ATT_MENSURVIS);
         assert(att);
         if (att->HasDot()) {
             attributes->push_back({ "dot", att->BooleanToStr(att->GetDot()) });
@@ -6038,7 +6038,7 @@ void AttModule::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_MENSURALVIS)) {
-        const AttMensuralVis *att = dynamic_cast<const AttMensuralVis *>(element);
+        const AttMensuralVis *att = element->GetAtt<AttMensuralVis>(ATT_MENSURALVIS);
         assert(att);
         if (att->HasMensurColor()) {
             attributes->push_back({ "mensur.color", att->StrToStr(att->GetMensurColor()) });
@@ -6066,14 +6066,14 @@ void AttModule::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_METERSIGVIS)) {
-        const AttMeterSigVis *att = dynamic_cast<const AttMeterSigVis *>(element);
+        const AttMeterSigVis *att = element->GetAtt<AttMeterSigVis>(ATT_METERSIGVIS);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back({ "form", att->MeterformToStr(att->GetForm()) });
         }
     }
     if (element->HasAttClass(ATT_METERSIGDEFAULTVIS)) {
-        const AttMeterSigDefaultVis *att = dynamic_cast<const AttMeterSigDefaultVis *>(element);
+        const AttMeterSigDefaultVis *att = element->GetAtt<AttMeterSigDefaultVis>(ATT_METERSIGDEFAULTVIS);
         assert(att);
         if (att->HasMeterForm()) {
             attributes->push_back({ "meter.form", att->MeterformToStr(att->GetMeterForm()) });
@@ -6083,28 +6083,28 @@ void AttModule::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_MULTIRESTVIS)) {
-        const AttMultiRestVis *att = dynamic_cast<const AttMultiRestVis *>(element);
+        const AttMultiRestVis *att = element->GetAtt<AttMultiRestVis>(ATT_MULTIRESTVIS);
         assert(att);
         if (att->HasBlock()) {
             attributes->push_back({ "block", att->BooleanToStr(att->GetBlock()) });
         }
     }
     if (element->HasAttClass(ATT_PBVIS)) {
-        const AttPbVis *att = dynamic_cast<const AttPbVis *>(element);
+        const AttPbVis *att = element->GetAtt<AttPbVis>(ATT_PBVIS);
         assert(att);
         if (att->HasFolium()) {
             attributes->push_back({ "folium", att->PbVisFoliumToStr(att->GetFolium()) });
         }
     }
     if (element->HasAttClass(ATT_PEDALVIS)) {
-        const AttPedalVis *att = dynamic_cast<const AttPedalVis *>(element);
+        const AttPedalVis *att = element->GetAtt<AttPedalVis>(ATT_PEDALVIS);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back({ "form", att->PedalstyleToStr(att->GetForm()) });
         }
     }
     if (element->HasAttClass(ATT_PLICAVIS)) {
-        const AttPlicaVis *att = dynamic_cast<const AttPlicaVis *>(element);
+        const AttPlicaVis *att = element->GetAtt<AttPlicaVis>(ATT_PLICAVIS);
         assert(att);
         if (att->HasDir()) {
             attributes->push_back({ "dir", att->StemdirectionBasicToStr(att->GetDir()) });
@@ -6114,49 +6114,49 @@ void AttModule::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_QUILISMAVIS)) {
-        const AttQuilismaVis *att = dynamic_cast<const AttQuilismaVis *>(element);
+        const AttQuilismaVis *att = element->GetAtt<AttQuilismaVis>(ATT_QUILISMAVIS);
         assert(att);
         if (att->HasWaves()) {
             attributes->push_back({ "waves", att->IntToStr(att->GetWaves()) });
         }
     }
     if (element->HasAttClass(ATT_SBVIS)) {
-        const AttSbVis *att = dynamic_cast<const AttSbVis *>(element);
+        const AttSbVis *att = element->GetAtt<AttSbVis>(ATT_SBVIS);
         assert(att);
         if (att->HasForm()) {
             attributes->push_back({ "form", att->SbVisFormToStr(att->GetForm()) });
         }
     }
     if (element->HasAttClass(ATT_SCOREDEFVIS)) {
-        const AttScoreDefVis *att = dynamic_cast<const AttScoreDefVis *>(element);
+        const AttScoreDefVis *att = element->GetAtt<AttScoreDefVis>(ATT_SCOREDEFVIS);
         assert(att);
         if (att->HasVuHeight()) {
             attributes->push_back({ "vu.height", att->StrToStr(att->GetVuHeight()) });
         }
     }
     if (element->HasAttClass(ATT_SECTIONVIS)) {
-        const AttSectionVis *att = dynamic_cast<const AttSectionVis *>(element);
+        const AttSectionVis *att = element->GetAtt<AttSectionVis>(ATT_SECTIONVIS);
         assert(att);
         if (att->HasRestart()) {
             attributes->push_back({ "restart", att->BooleanToStr(att->GetRestart()) });
         }
     }
     if (element->HasAttClass(ATT_SIGNIFLETVIS)) {
-        const AttSignifLetVis *att = dynamic_cast<const AttSignifLetVis *>(element);
+        const AttSignifLetVis *att = element->GetAtt<AttSignifLetVis>(ATT_SIGNIFLETVIS);
         assert(att);
         if (att->HasPlace()) {
             attributes->push_back({ "place", att->EventrelToStr(att->GetPlace()) });
         }
     }
     if (element->HasAttClass(ATT_SPACEVIS)) {
-        const AttSpaceVis *att = dynamic_cast<const AttSpaceVis *>(element);
+        const AttSpaceVis *att = element->GetAtt<AttSpaceVis>(ATT_SPACEVIS);
         assert(att);
         if (att->HasCompressable()) {
             attributes->push_back({ "compressable", att->BooleanToStr(att->GetCompressable()) });
         }
     }
     if (element->HasAttClass(ATT_STAFFDEFVIS)) {
-        const AttStaffDefVis *att = dynamic_cast<const AttStaffDefVis *>(element);
+        const AttStaffDefVis *att = element->GetAtt<AttStaffDefVis>(ATT_STAFFDEFVIS);
         assert(att);
         if (att->HasGridShow()) {
             attributes->push_back({ "grid.show", att->BooleanToStr(att->GetGridShow()) });
@@ -6175,14 +6175,14 @@ void AttModule::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_STAFFGRPVIS)) {
-        const AttStaffGrpVis *att = dynamic_cast<const AttStaffGrpVis *>(element);
+        const AttStaffGrpVis *att = element->GetAtt<AttStaffGrpVis>(ATT_STAFFGRPVIS);
         assert(att);
         if (att->HasBarThru()) {
             attributes->push_back({ "bar.thru", att->BooleanToStr(att->GetBarThru()) });
         }
     }
     if (element->HasAttClass(ATT_STEMVIS)) {
-        const AttStemVis *att = dynamic_cast<const AttStemVis *>(element);
+        const AttStemVis *att = element->GetAtt<AttStemVis>(ATT_STEMVIS);
         assert(att);
         if (att->HasPos()) {
             attributes->push_back({ "pos", att->StempositionToStr(att->GetPos()) });
@@ -6204,7 +6204,7 @@ void AttModule::GetVisual(const Object *element, ArrayOfStrAttr *attributes)
         }
     }
     if (element->HasAttClass(ATT_TUPLETVIS)) {
-        const AttTupletVis *att = dynamic_cast<const AttTupletVis *>(element);
+        const AttTupletVis *att = element->GetAtt<AttTupletVis>(ATT_TUPLETVIS);
         assert(att);
         if (att->HasBracketPlace()) {
             attributes->push_back({ "bracket.place", att->StaffrelBasicToStr(att->GetBracketPlace()) });
@@ -25,7 +25,7 @@ static const ClassRegistrar<Abbr> s_factory("abbr", ABBR);
 
 Abbr::Abbr() : EditorialElement(ABBR, "abbr-"), AttSource()
 {
-    this->RegisterAttClass(ATT_SOURCE);
+    this->RegisterAttClass<AttSource>(ATT_SOURCE, this);
 
     this->Reset();
 }
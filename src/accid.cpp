@@ -41,15 +41,15 @@ Accid::Accid()
     , AttPlacementRelEvent()
 {
 
-    this->RegisterInterface(PositionInterface::GetAttClasses(), PositionInterface::IsInterface());
-    this->RegisterAttClass(ATT_ACCIDENTAL);
-    this->RegisterAttClass(ATT_ACCIDENTALGES);
-    this->RegisterAttClass(ATT_ACCIDLOG);
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_ENCLOSINGCHARS);
-    this->RegisterAttClass(ATT_EXTSYM);
-    this->RegisterAttClass(ATT_PLACEMENTONSTAFF);
-    this->RegisterAttClass(ATT_PLACEMENTRELEVENT);
+    this->RegisterInterface<PositionInterface>(this);
+    this->RegisterAttClass<AttAccidental>(ATT_ACCIDENTAL, this);
+    this->RegisterAttClass<AttAccidentalGes>(ATT_ACCIDENTALGES, this);
+    this->RegisterAttClass<AttAccidLog>(ATT_ACCIDLOG, this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttEnclosingChars>(ATT_ENCLOSINGCHARS, this);
+    this->RegisterAttClass<AttExtSym>(ATT_EXTSYM, this);
+    this->RegisterAttClass<AttPlacementOnStaff>(ATT_PLACEMENTONSTAFF, this);
+    this->RegisterAttClass<AttPlacementRelEvent>(ATT_PLACEMENTRELEVENT, this);
 
     this->Reset();
 }
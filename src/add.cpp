@@ -25,7 +25,7 @@ static const ClassRegistrar<Add> s_factory("add", ADD);
 
 Add::Add() : EditorialElement(ADD, "add-"), AttSource()
 {
-    this->RegisterAttClass(ATT_SOURCE);
+    this->RegisterAttClass<AttSource>(ATT_SOURCE, this);
 
     this->Reset();
 }
@@ -22,6 +22,7 @@ namespace vrv {
 AdjustAccidXFunctor::AdjustAccidXFunctor(Doc *doc) : DocFunctor(doc)
 {
     m_currentMeasure = NULL;
+    m_scoreDef = NULL;
 }
 
 FunctorCode AdjustAccidXFunctor::VisitAlignment(Alignment *alignment)
@@ -39,7 +40,8 @@ FunctorCode AdjustAccidXFunctor::VisitAlignmentReference(AlignmentReference *ali
     if (accidSpace.empty()) return FUNCTOR_SIBLINGS;
 
     assert(m_doc);
-    StaffDef *staffDef = m_doc->GetCurrentScoreDef()->GetStaffDef(alignmentReference->GetN());
+    ScoreDef *scoreDef = (m_scoreDef) ? m_scoreDef : m_doc->GetCurrentScoreDef();
+    StaffDef *staffDef = scoreDef->GetStaffDef(alignmentReference->GetN());
     int staffSize = (staffDef && staffDef->HasScale()) ? staffDef->GetScale() : 100;
 
     std::sort(accidSpace.begin(), accidSpace.end(), AccidSpaceSort());
@@ -46,7 +46,7 @@ FunctorCode AdjustDotsFunctor::VisitAlignmentEnd(Alignment *alignment)
                 if (dots->HorizontalSelfOverlap(element, thirdUnit)
                     && dots->VerticalSelfOverlap(element, 2 * thirdUnit)) {
                     if (element->Is({ CHORD, NOTE })) {
-                        if (dynamic_cast<AttAugmentDots *>(element)->GetDots() < 1) continue;
+                        if (element->GetAtt<AttAugmentDots>(ATT_AUGMENTDOTS)->GetDots() < 1) continue;
                         overlapElements.emplace(dots, element);
                     }
                     else if (Object *chord = element->GetFirstAncestor(CHORD); chord) {
@@ -59,7 +59,8 @@ FunctorCode AdjustSlursFunctor::VisitStaffAlignment(StaffAlignment *staffAlignme
     }
 
     // Detection of inner slurs
-    std::map<FloatingCurvePositioner *, ArrayOfFloatingCurvePositioners> innerCurveMap;
+    // The outer slurs are kept in the order of the positioners and not by address for a reproducible adjustment
+    std::vector<std::pair<FloatingCurvePositioner *, ArrayOfFloatingCurvePositioners>> outerCurves;
     for (int i = 0; i < (int)positioners.size(); ++i) {
         Slur *firstSlur = vrv_cast<Slur *>(positioners[i]->GetObject());
         ArrayOfFloatingCurvePositioners innerCurves;
@@ -96,15 +97,15 @@ FunctorCode AdjustSlursFunctor::VisitStaffAlignment(StaffAlignment *staffAlignme
             }
         }
         if (!innerCurves.empty()) {
-            innerCurveMap[positioners[i]] = innerCurves;
+            outerCurves.push_back({ positioners[i], innerCurves });
         }
     }
 
     // Adjust outer slurs w.r.t. inner slurs
-    for (const auto &mapEntry : innerCurveMap) {
-        Slur *slur = vrv_cast<Slur *>(mapEntry.first->GetObject());
+    for (const auto &[curve, innerCurves] : outerCurves) {
+        Slur *slur = vrv_cast<Slur *>(curve->GetObject());
         assert(slur);
-        slur->AdjustOuterSlur(m_doc, mapEntry.first, mapEntry.second, unit);
+        slur->AdjustOuterSlur(m_doc, curve, innerCurves, unit);
     }
 
     return FUNCTOR_SIBLINGS;
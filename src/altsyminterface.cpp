@@ -26,7 +26,7 @@ namespace vrv {
 
 AltSymInterface::AltSymInterface() : Interface(), AttAltSym()
 {
-    this->RegisterInterfaceAttClass(ATT_ALTSYM);
+    this->RegisterInterfaceAttClass<AttAltSym>(ATT_ALTSYM, this);
 
     this->Reset();
 }
@@ -28,7 +28,7 @@ static const ClassRegistrar<AnchoredText> s_factory("anchoredText", ANCHOREDTEXT
 
 AnchoredText::AnchoredText() : ControlElement(ANCHOREDTEXT, "anchtxt-"), TextDirInterface()
 {
-    this->RegisterInterface(TextDirInterface::GetAttClasses(), TextDirInterface::IsInterface());
+    this->RegisterInterface<TextDirInterface>(this);
 
     this->Reset();
 }
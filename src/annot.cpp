@@ -26,8 +26,8 @@ static const ClassRegistrar<Annot> s_factory("annot", ANNOT);
 
 Annot::Annot() : EditorialElement(ANNOT, "annot-"), TextListInterface(), AttPlist(), AttSource()
 {
-    this->RegisterAttClass(ATT_PLIST);
-    this->RegisterAttClass(ATT_SOURCE);
+    this->RegisterAttClass<AttPlist>(ATT_PLIST, this);
+    this->RegisterAttClass<AttSource>(ATT_SOURCE, this);
 
     this->Reset();
 }
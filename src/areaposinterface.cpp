@@ -21,8 +21,8 @@ namespace vrv {
 
 AreaPosInterface::AreaPosInterface() : Interface(), AttHorizontalAlign(), AttVerticalAlign()
 {
-    this->RegisterInterfaceAttClass(ATT_HORIZONTALALIGN);
-    this->RegisterInterfaceAttClass(ATT_VERTICALALIGN);
+    this->RegisterInterfaceAttClass<AttHorizontalAlign>(ATT_HORIZONTALALIGN, this);
+    this->RegisterInterfaceAttClass<AttVerticalAlign>(ATT_VERTICALALIGN, this);
 
     this->Reset();
 }
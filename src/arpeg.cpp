@@ -32,12 +32,12 @@ static const ClassRegistrar<Arpeg> s_factory("arpeg", ARPEG);
 Arpeg::Arpeg()
     : ControlElement(ARPEG, "arpeg-"), PlistInterface(), TimePointInterface(), AttArpegLog(), AttArpegVis(), AttColor()
 {
-    this->RegisterInterface(PlistInterface::GetAttClasses(), PlistInterface::IsInterface());
-    this->RegisterInterface(TimePointInterface::GetAttClasses(), TimePointInterface::IsInterface());
-    this->RegisterAttClass(ATT_ARPEGLOG);
-    this->RegisterAttClass(ATT_ARPEGVIS);
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_ENCLOSINGCHARS);
+    this->RegisterInterface<PlistInterface>(this);
+    this->RegisterInterface<TimePointInterface>(this);
+    this->RegisterAttClass<AttArpegLog>(ATT_ARPEGLOG, this);
+    this->RegisterAttClass<AttArpegVis>(ATT_ARPEGVIS, this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttEnclosingChars>(ATT_ENCLOSINGCHARS, this);
 
     this->Reset();
 }
@@ -50,12 +50,12 @@ Artic::Artic()
     , AttExtSym()
     , AttPlacementRelEvent()
 {
-    this->RegisterAttClass(ATT_ARTICULATION);
-    this->RegisterAttClass(ATT_ARTICULATIONGES);
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_ENCLOSINGCHARS);
-    this->RegisterAttClass(ATT_EXTSYM);
-    this->RegisterAttClass(ATT_PLACEMENTRELEVENT);
+    this->RegisterAttClass<AttArticulation>(ATT_ARTICULATION, this);
+    this->RegisterAttClass<AttArticulationGes>(ATT_ARTICULATIONGES, this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttEnclosingChars>(ATT_ENCLOSINGCHARS, this);
+    this->RegisterAttClass<AttExtSym>(ATT_EXTSYM, this);
+    this->RegisterAttClass<AttPlacementRelEvent>(ATT_PLACEMENTRELEVENT, this);
 
     this->Reset();
 }
@@ -35,9 +35,9 @@ static const ClassRegistrar<BarLine> s_factory("barLine", BARLINE);
 
 BarLine::BarLine() : LayerElement(BARLINE, "bline-"), AttBarLineLog(), AttColor(), AttNNumberLike(), AttVisibility()
 {
-    this->RegisterAttClass(ATT_BARLINELOG);
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_VISIBILITY);
+    this->RegisterAttClass<AttBarLineLog>(ATT_BARLINELOG, this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttVisibility>(ATT_VISIBILITY, this);
 
     this->Reset();
 }
@@ -45,9 +45,9 @@ BarLine::BarLine() : LayerElement(BARLINE, "bline-"), AttBarLineLog(), AttColor(
 BarLine::BarLine(ClassId classId)
     : LayerElement(classId, "bline-"), AttBarLineLog(), AttColor(), AttNNumberLike(), AttVisibility()
 {
-    this->RegisterAttClass(ATT_BARLINELOG);
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_VISIBILITY);
+    this->RegisterAttClass<AttBarLineLog>(ATT_BARLINELOG, this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttVisibility>(ATT_VISIBILITY, this);
 
     this->Reset();
 }
@@ -103,7 +103,7 @@ std::pair<bool, double> BarLine::GetLength(const StaffDef *staffDef) const
     const Object *object = staffDef;
     while (object) {
         if (object->HasAttClass(ATT_BARRING)) {
-            const AttBarring *att = dynamic_cast<const AttBarring *>(object);
+            const AttBarring *att = object->GetAtt<AttBarring>(ATT_BARRING);
             assert(att);
             if (att->HasBarLen()) {
                 return { true, att->GetBarLen() };
@@ -128,7 +128,7 @@ std::pair<bool, data_BARMETHOD> BarLine::GetMethod(const StaffDef *staffDef) con
     const Object *object = staffDef;
     while (object) {
         if (object->HasAttClass(ATT_BARRING)) {
-            const AttBarring *att = dynamic_cast<const AttBarring *>(object);
+            const AttBarring *att = object->GetAtt<AttBarring>(ATT_BARRING);
             assert(att);
             if (att->HasBarMethod()) {
                 return { true, att->GetBarMethod() };
@@ -153,7 +153,7 @@ std::pair<bool, int> BarLine::GetPlace(const StaffDef *staffDef) const
     const Object *object = staffDef;
     while (object) {
         if (object->HasAttClass(ATT_BARRING)) {
-            const AttBarring *att = dynamic_cast<const AttBarring *>(object);
+            const AttBarring *att = object->GetAtt<AttBarring>(ATT_BARRING);
             assert(att);
             if (att->HasBarPlace()) {
                 return { true, att->GetBarPlace() };
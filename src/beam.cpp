@@ -1598,10 +1598,10 @@ static const ClassRegistrar<Beam> s_factory("beam", BEAM);
 
 Beam::Beam() : LayerElement(BEAM, "beam-"), BeamDrawingInterface(), AttBeamedWith(), AttBeamRend(), AttColor(), AttCue()
 {
-    this->RegisterAttClass(ATT_BEAMEDWITH);
-    this->RegisterAttClass(ATT_BEAMREND);
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_CUE);
+    this->RegisterAttClass<AttBeamedWith>(ATT_BEAMEDWITH, this);
+    this->RegisterAttClass<AttBeamRend>(ATT_BEAMREND, this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttCue>(ATT_CUE, this);
 
     this->Reset();
 }
@@ -1843,7 +1843,7 @@ data_STEMDIRECTION BeamElementCoord::GetStemDir() const
         return STEMDIRECTION_NONE;
     }
 
-    AttStems *stemInterface = dynamic_cast<AttStems *>(m_element);
+    AttStems *stemInterface = m_element->GetAtt<AttStems>(ATT_STEMS);
 
     if (!stemInterface) {
         LogDebug("Element is not an AttStems");
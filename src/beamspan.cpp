@@ -38,11 +38,11 @@ BeamSpan::BeamSpan()
     , AttBeamRend()
     , AttColor()
 {
-    RegisterInterface(PlistInterface::GetAttClasses(), PlistInterface::IsInterface());
-    RegisterInterface(TimeSpanningInterface::GetAttClasses(), TimeSpanningInterface::IsInterface());
-    RegisterAttClass(ATT_BEAMEDWITH);
-    RegisterAttClass(ATT_BEAMREND);
-    RegisterAttClass(ATT_COLOR);
+    RegisterInterface<PlistInterface>(this);
+    RegisterInterface<TimeSpanningInterface>(this);
+    RegisterAttClass<AttBeamedWith>(ATT_BEAMEDWITH, this);
+    RegisterAttClass<AttBeamRend>(ATT_BEAMREND, this);
+    RegisterAttClass<AttColor>(ATT_COLOR, this);
 
     Reset();
     InitBeamSegments();
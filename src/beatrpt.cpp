@@ -36,9 +36,9 @@ static const ClassRegistrar<BeatRpt> s_factory("beatRpt", BEATRPT);
 
 BeatRpt::BeatRpt() : LayerElement(BEATRPT, "beatrpt-"), AttColor(), AttBeatRptLog(), AttBeatRptVis()
 {
-    this->RegisterAttClass(ATT_BEATRPTLOG);
-    this->RegisterAttClass(ATT_BEATRPTVIS);
-    this->RegisterAttClass(ATT_COLOR);
+    this->RegisterAttClass<AttBeatRptLog>(ATT_BEATRPTLOG, this);
+    this->RegisterAttClass<AttBeatRptVis>(ATT_BEATRPTVIS, this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
     this->Reset();
 }
 
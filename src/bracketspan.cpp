@@ -35,11 +35,11 @@ BracketSpan::BracketSpan()
     , AttLineRend()
     , AttLineRendBase()
 {
-    this->RegisterInterface(TimeSpanningInterface::GetAttClasses(), TimeSpanningInterface::IsInterface());
-    this->RegisterAttClass(ATT_BRACKETSPANLOG);
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_LINEREND);
-    this->RegisterAttClass(ATT_LINERENDBASE);
+    this->RegisterInterface<TimeSpanningInterface>(this);
+    this->RegisterAttClass<AttBracketSpanLog>(ATT_BRACKETSPANLOG, this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttLineRend>(ATT_LINEREND, this);
+    this->RegisterAttClass<AttLineRendBase>(ATT_LINERENDBASE, this);
 
     this->Reset();
 }
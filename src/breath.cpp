@@ -26,9 +26,9 @@ static const ClassRegistrar<Breath> s_factory("breath", BREATH);
 
 Breath::Breath() : ControlElement(BREATH, "breath-"), TimePointInterface(), AttColor(), AttPlacementRelStaff()
 {
-    this->RegisterInterface(TimePointInterface::GetAttClasses(), TimePointInterface::IsInterface());
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_PLACEMENTRELSTAFF);
+    this->RegisterInterface<TimePointInterface>(this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttPlacementRelStaff>(ATT_PLACEMENTRELSTAFF, this);
 
     this->Reset();
 }
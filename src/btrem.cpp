@@ -33,10 +33,10 @@ static const ClassRegistrar<BTrem> s_factory("btrem", BTREM);
 
 BTrem::BTrem() : LayerElement(BTREM, "btrem-"), AttBTremLog(), AttNumbered(), AttNumberPlacement(), AttTremMeasured()
 {
-    this->RegisterAttClass(ATT_BTREMLOG);
-    this->RegisterAttClass(ATT_NUMBERED);
-    this->RegisterAttClass(ATT_NUMBERPLACEMENT);
-    this->RegisterAttClass(ATT_TREMMEASURED);
+    this->RegisterAttClass<AttBTremLog>(ATT_BTREMLOG, this);
+    this->RegisterAttClass<AttNumbered>(ATT_NUMBERED, this);
+    this->RegisterAttClass<AttNumberPlacement>(ATT_NUMBERPLACEMENT, this);
+    this->RegisterAttClass<AttTremMeasured>(ATT_TREMMEASURED, this);
 
     this->Reset();
 }
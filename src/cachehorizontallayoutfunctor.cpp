@@ -9,7 +9,13 @@
 
 //----------------------------------------------------------------------------
 
+#include "accid.h"
 #include "arpeg.h"
+#include "horizontalaligner.h"
+#include "measure.h"
+#include "page.h"
+#include "scoredef.h"
+#include "system.h"
 
 //----------------------------------------------------------------------------
 
@@ -49,4 +55,148 @@ FunctorCode CacheHorizontalLayoutFunctor::VisitMeasure(Measure *measure)
     return FUNCTOR_CONTINUE;
 }
 
+//----------------------------------------------------------------------------
+// PersistHorizontalLayoutFunctor
+//----------------------------------------------------------------------------
+
+PersistHorizontalLayoutFunctor::PersistHorizontalLayoutFunctor(std::vector<int> *values, bool load) : Functor()
+{
+    assert(values);
+
+    m_values = values;
+    m_load = load;
+    m_position = 0;
+    m_failed = false;
+}
+
+void PersistHorizontalLayoutFunctor::Persist(int &value)
+{
+    if (!m_load) {
+        m_values->push_back(value);
+    }
+    else if (m_position < (int)m_values->size()) {
+        value = m_values->at(m_position++);
+    }
+    else {
+        m_failed = true;
+    }
+}
+
+void PersistHorizontalLayoutFunctor::PersistAlignments(HorizontalAligner *aligner)
+{
+    // The number of alignments is persisted for checking that the aligner matches
+    int count = aligner->GetChildCount();
+    this->Persist(count);
+    if (count != aligner->GetChildCount()) {
+        m_failed = true;
+        return;
+    }
+
+    for (Object *child : aligner->GetChildren()) {
+        Alignment *alignment = vrv_cast<Alignment *>(child);
+        assert(alignment);
+        int xRel = alignment->GetXRel();
+        this->Persist(xRel);
+        if (m_load) alignment->SetXRel(xRel);
+
+        int graceAlignerCount = (int)alignment->GetGraceAligners().size();
+        this->Persist(graceAlignerCount);
+        if (graceAlignerCount != (int)alignment->GetGraceAligners().size()) {
+            m_failed = true;
+            return;
+        }
+        for (const auto &graceAligner : alignment->GetGraceAligners()) {
+            this->PersistAlignments(graceAligner.second);
+        }
+    }
+}
+
+FunctorCode PersistHorizontalLayoutFunctor::VisitAccid(Accid *accid)
+{
+    // The alignment with the same layer is set when adjusting the accidentals and is not reset with the aligners
+    int alignedWithSameLayer = accid->IsAlignedWithSameLayer();
+    this->Persist(alignedWithSameLayer);
+    if (m_load) accid->IsAlignedWithSameLayer(alignedWithSameLayer);
+
+    return this->VisitLayerElement(accid);
+}
+
+FunctorCode PersistHorizontalLayoutFunctor::VisitArpeg(Arpeg *arpeg)
+{
+    int cachedXRel = arpeg->GetCachedXRel();
+    this->Persist(cachedXRel);
+    if (m_load) arpeg->SetCachedXRel(cachedXRel);
+
+    return (m_failed) ? FUNCTOR_STOP : FUNCTOR_CONTINUE;
+}
+
+FunctorCode PersistHorizontalLayoutFunctor::VisitLayerElement(LayerElement *layerElement)
+{
+    int cachedXRel = layerElement->GetCachedXRel();
+    int cachedYRel = layerElement->GetCachedYRel();
+    this->Persist(cachedXRel);
+    this->Persist(cachedYRel);
+    if (m_load) {
+        layerElement->SetCachedXRel(cachedXRel);
+        layerElement->SetCachedYRel(cachedYRel);
+    }
+
+    return (m_failed) ? FUNCTOR_STOP : FUNCTOR_CONTINUE;
+}
+
+FunctorCode PersistHorizontalLayoutFunctor::VisitMeasure(Measure *measure)
+{
+    int cachedXRel = measure->GetCachedXRel();
+    int cachedWidth = measure->GetCachedWidth();
+    int cachedOverflow = measure->GetCachedOverflow();
+    this->Persist(cachedXRel);
+    this->Persist(cachedWidth);
+    this->Persist(cachedOverflow);
+    if (m_load) {
+        measure->SetCachedXRel(cachedXRel);
+        measure->SetCachedWidth(cachedWidth);
+        measure->SetCachedOverflow(cachedOverflow);
+    }
+
+    if (measure->GetLeftBarLine()) this->VisitBarLine(measure->GetLeftBarLine());
+    if (measure->GetRightBarLine()) this->VisitBarLine(measure->GetRightBarLine());
+
+    this->PersistAlignments(&measure->m_measureAligner);
+
+    return (m_failed) ? FUNCTOR_STOP : FUNCTOR_CONTINUE;
+}
+
+FunctorCode PersistHorizontalLayoutFunctor::VisitPage(Page *page)
+{
+    int drawingWidth = page->m_drawingScoreDef.GetDrawingWidth();
+    this->Persist(drawingWidth);
+    if (m_load) page->m_drawingScoreDef.SetDrawingWidth(drawingWidth);
+
+    return (m_failed) ? FUNCTOR_STOP : FUNCTOR_CONTINUE;
+}
+
+FunctorCode PersistHorizontalLayoutFunctor::VisitScoreDef(ScoreDef *scoreDef)
+{
+    int drawingWidth = scoreDef->GetDrawingWidth();
+    this->Persist(drawingWidth);
+    if (m_load) scoreDef->SetDrawingWidth(drawingWidth);
+
+    return (m_failed) ? FUNCTOR_STOP : FUNCTOR_CONTINUE;
+}
+
+FunctorCode PersistHorizontalLayoutFunctor::VisitSystem(System *system)
+{
+    // The widths are only increased by the setters, which is fine since the aligners are reset before loading
+    int labelsWidth = system->GetDrawingLabelsWidth();
+    int abbrLabelsWidth = system->GetDrawingAbbrLabelsWidth();
+    this->Persist(labelsWidth);
+    this->Persist(abbrLabelsWidth);
+    if (m_load) {
+        if (labelsWidth > 0) system->SetDrawingLabelsWidth(labelsWidth);
+        system->SetDrawingAbbrLabelsWidth(abbrLabelsWidth);
+    }
+
+    return (m_failed) ? FUNCTOR_STOP : FUNCTOR_CONTINUE;
+}
+
 } // namespace vrv
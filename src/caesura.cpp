@@ -29,10 +29,10 @@ static const ClassRegistrar<Caesura> s_factory("caesura", CAESURA);
 Caesura::Caesura()
     : ControlElement(CAESURA, "caesura-"), TimePointInterface(), AttColor(), AttExtSym(), AttPlacementRelStaff()
 {
-    this->RegisterInterface(TimePointInterface::GetAttClasses(), TimePointInterface::IsInterface());
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_EXTSYM);
-    this->RegisterAttClass(ATT_PLACEMENTRELSTAFF);
+    this->RegisterInterface<TimePointInterface>(this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttExtSym>(ATT_EXTSYM, this);
+    this->RegisterAttClass<AttPlacementRelStaff>(ATT_PLACEMENTRELSTAFF, this);
 
     this->Reset();
 }
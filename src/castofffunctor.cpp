@@ -40,6 +40,7 @@ CastOffSystemsFunctor::CastOffSystemsFunctor(Page *page, Doc *doc, bool smart) :
     m_systemWidth = 0;
     m_currentScoreDefWidth = 0;
     m_smart = smart;
+    m_breaks = NULL;
 }
 
 FunctorCode CastOffSystemsFunctor::VisitEditorialElement(EditorialElement *editorialElement)
@@ -86,8 +87,16 @@ FunctorCode CastOffSystemsFunctor::VisitMeasure(Measure *measure)
     const bool isLeftoverMeasure = ((NULL == nextMeasure) && m_doc->GetOptions()->m_breaksNoWidow.GetValue()
         && (m_doc->GetOptions()->m_breaks.GetValue() != BREAKS_encoded));
     if (m_currentSystem->GetChildCount() > 0) {
+        // Break it where a system started in the previous cast off, that is with its first pending element
+        if (m_breaks) {
+            const Object *first = (m_pendingElements.empty()) ? measure : m_pendingElements.front();
+            if (m_breaks->count(first->GetID())) {
+                m_currentSystem = new System();
+                m_page->AddChild(m_currentSystem);
+            }
+        }
         // We have overflowing content (dir, dynam, tempo) larger than 5 units, keep it as pending
-        if (overflow > (m_doc->GetDrawingUnit(100) * 5)) {
+        else if (overflow > (m_doc->GetDrawingUnit(100) * 5)) {
             measure = dynamic_cast<Measure *>(m_contentSystem->Relinquish(measure->GetIdx()));
             assert(measure);
             // move as pending since we want it not to be broken with the next measure
@@ -149,7 +158,14 @@ FunctorCode CastOffSystemsFunctor::VisitPageMilestone(PageMilestoneEnd *pageMile
 
 FunctorCode CastOffSystemsFunctor::VisitSb(Sb *sb)
 {
-    if (m_smart) {
+    if (m_breaks) {
+        // The system was broken at the <sb> in the previous cast off
+        if ((m_currentSystem->GetChildCount() > 0) && m_breaks->count(sb->GetID())) {
+            m_currentSystem = new System();
+            m_page->AddChild(m_currentSystem);
+        }
+    }
+    else if (m_smart) {
         // Get the last measure of the currentSystem
         Measure *measure = dynamic_cast<Measure *>(m_currentSystem->GetChild(m_currentSystem->GetChildCount() - 1));
         if (measure != NULL) {
@@ -267,6 +283,7 @@ CastOffPagesFunctor::CastOffPagesFunctor(Page *contentPage, Doc *doc, Page *curr
     m_pgHead2Height = 0;
     m_pgFoot2Height = 0;
     m_leftoverSystem = NULL;
+    m_breaks = NULL;
 }
 
 FunctorCode CastOffPagesFunctor::VisitPageEnd(Page *page)
@@ -334,8 +351,18 @@ FunctorCode CastOffPagesFunctor::VisitSystem(System *system)
 
     const int systemMaxPerPage = m_doc->GetOptions()->m_systemMaxPerPage.GetValue();
     const int systemChildCount = m_currentPage->GetChildCount(SYSTEM);
-    if ((systemMaxPerPage && (systemMaxPerPage == systemChildCount))
-        || ((systemChildCount > 0) && (system->GetDrawingYRel() - system->GetHeight() - currentShift < 0))) {
+    bool isPageBreak = false;
+    if (m_breaks) {
+        // Break it where a page started in the previous cast off
+        isPageBreak = (system == m_leftoverSystem)
+            || ((systemChildCount > 0) && (system->GetChildCount() > 0)
+                && m_breaks->count(system->GetChild(0)->GetID()));
+    }
+    else {
+        isPageBreak = (systemMaxPerPage && (systemMaxPerPage == systemChildCount))
+            || ((systemChildCount > 0) && (system->GetDrawingYRel() - system->GetHeight() - currentShift < 0));
+    }
+    if (isPageBreak) {
         // If this is the last system in the list, it doesn't fit the page and it's a leftover system (has just one
         // measure) => add the system content to the previous system
         Object *nextSystem = m_contentPage->GetNext(system, SYSTEM);
@@ -80,15 +80,15 @@ Chord::Chord()
     , AttTiePresent()
     , AttVisibility()
 {
-    this->RegisterInterface(DurationInterface::GetAttClasses(), DurationInterface::IsInterface());
-    this->RegisterAttClass(ATT_CHORDVIS);
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_CUE);
-    this->RegisterAttClass(ATT_GRACED);
-    this->RegisterAttClass(ATT_STEMS);
-    this->RegisterAttClass(ATT_STEMSCMN);
-    this->RegisterAttClass(ATT_TIEPRESENT);
-    this->RegisterAttClass(ATT_VISIBILITY);
+    this->RegisterInterface<DurationInterface>(this);
+    this->RegisterAttClass<AttChordVis>(ATT_CHORDVIS, this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttCue>(ATT_CUE, this);
+    this->RegisterAttClass<AttGraced>(ATT_GRACED, this);
+    this->RegisterAttClass<AttStems>(ATT_STEMS, this);
+    this->RegisterAttClass<AttStemsCmn>(ATT_STEMSCMN, this);
+    this->RegisterAttClass<AttTiePresent>(ATT_TIEPRESENT, this);
+    this->RegisterAttClass<AttVisibility>(ATT_VISIBILITY, this);
 
     this->Reset();
 }
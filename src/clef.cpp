@@ -41,16 +41,16 @@ Clef::Clef()
     , AttStaffIdent()
     , AttVisibility()
 {
-    this->RegisterAttClass(ATT_CLEFLOG);
-    this->RegisterAttClass(ATT_CLEFSHAPE);
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_ENCLOSINGCHARS);
-    this->RegisterAttClass(ATT_EXTSYM);
-    this->RegisterAttClass(ATT_LINELOC);
-    this->RegisterAttClass(ATT_OCTAVE);
-    this->RegisterAttClass(ATT_OCTAVEDISPLACEMENT);
-    this->RegisterAttClass(ATT_STAFFIDENT);
-    this->RegisterAttClass(ATT_VISIBILITY);
+    this->RegisterAttClass<AttClefLog>(ATT_CLEFLOG, this);
+    this->RegisterAttClass<AttClefShape>(ATT_CLEFSHAPE, this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttEnclosingChars>(ATT_ENCLOSINGCHARS, this);
+    this->RegisterAttClass<AttExtSym>(ATT_EXTSYM, this);
+    this->RegisterAttClass<AttLineLoc>(ATT_LINELOC, this);
+    this->RegisterAttClass<AttOctave>(ATT_OCTAVE, this);
+    this->RegisterAttClass<AttOctaveDisplacement>(ATT_OCTAVEDISPLACEMENT, this);
+    this->RegisterAttClass<AttStaffIdent>(ATT_STAFFIDENT, this);
+    this->RegisterAttClass<AttVisibility>(ATT_VISIBILITY, this);
 
     this->Reset();
 }
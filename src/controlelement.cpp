@@ -30,10 +30,10 @@ namespace vrv {
 ControlElement::ControlElement()
     : FloatingObject(CONTROL_ELEMENT, "ce"), AltSymInterface(), LinkingInterface(), AttLabelled(), AttTyped()
 {
-    this->RegisterInterface(AltSymInterface::GetAttClasses(), AltSymInterface::IsInterface());
-    this->RegisterInterface(LinkingInterface::GetAttClasses(), LinkingInterface::IsInterface());
-    this->RegisterAttClass(ATT_LABELLED);
-    this->RegisterAttClass(ATT_TYPED);
+    this->RegisterInterface<AltSymInterface>(this);
+    this->RegisterInterface<LinkingInterface>(this);
+    this->RegisterAttClass<AttLabelled>(ATT_LABELLED, this);
+    this->RegisterAttClass<AttTyped>(ATT_TYPED, this);
 
     this->Reset();
 }
@@ -41,10 +41,10 @@ ControlElement::ControlElement()
 ControlElement::ControlElement(ClassId classId)
     : FloatingObject(classId, "ce"), AltSymInterface(), LinkingInterface(), AttLabelled(), AttTyped()
 {
-    this->RegisterInterface(AltSymInterface::GetAttClasses(), AltSymInterface::IsInterface());
-    this->RegisterInterface(LinkingInterface::GetAttClasses(), LinkingInterface::IsInterface());
-    this->RegisterAttClass(ATT_LABELLED);
-    this->RegisterAttClass(ATT_TYPED);
+    this->RegisterInterface<AltSymInterface>(this);
+    this->RegisterInterface<LinkingInterface>(this);
+    this->RegisterAttClass<AttLabelled>(ATT_LABELLED, this);
+    this->RegisterAttClass<AttTyped>(ATT_TYPED, this);
 
     this->Reset();
 }
@@ -52,10 +52,10 @@ ControlElement::ControlElement(ClassId classId)
 ControlElement::ControlElement(ClassId classId, const std::string &classIdStr)
     : FloatingObject(classId, classIdStr), AltSymInterface(), LinkingInterface(), AttLabelled(), AttTyped()
 {
-    this->RegisterInterface(AltSymInterface::GetAttClasses(), AltSymInterface::IsInterface());
-    this->RegisterInterface(LinkingInterface::GetAttClasses(), LinkingInterface::IsInterface());
-    this->RegisterAttClass(ATT_LABELLED);
-    this->RegisterAttClass(ATT_TYPED);
+    this->RegisterInterface<AltSymInterface>(this);
+    this->RegisterInterface<LinkingInterface>(this);
+    this->RegisterAttClass<AttLabelled>(ATT_LABELLED, this);
+    this->RegisterAttClass<AttTyped>(ATT_TYPED, this);
 
     this->Reset();
 }
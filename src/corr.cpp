@@ -25,7 +25,7 @@ static const ClassRegistrar<Corr> s_factory("corr", CORR);
 
 Corr::Corr() : EditorialElement(CORR, "corr-"), AttSource()
 {
-    this->RegisterAttClass(ATT_SOURCE);
+    this->RegisterAttClass<AttSource>(ATT_SOURCE, this);
 
     this->Reset();
 }
@@ -25,10 +25,10 @@ static const ClassRegistrar<Course> s_factory("course", COURSE);
 
 Course::Course() : Object(COURSE, "course-"), AttAccidental(), AttNNumberLike(), AttOctave(), AttPitch()
 {
-    this->RegisterAttClass(ATT_ACCIDENTAL);
-    this->RegisterAttClass(ATT_NNUMBERLIKE);
-    this->RegisterAttClass(ATT_OCTAVE);
-    this->RegisterAttClass(ATT_PITCH);
+    this->RegisterAttClass<AttAccidental>(ATT_ACCIDENTAL, this);
+    this->RegisterAttClass<AttNNumberLike>(ATT_NNUMBERLIKE, this);
+    this->RegisterAttClass<AttOctave>(ATT_OCTAVE, this);
+    this->RegisterAttClass<AttPitch>(ATT_PITCH, this);
 
     this->Reset();
 }
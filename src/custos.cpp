@@ -27,10 +27,10 @@ static const ClassRegistrar<Custos> s_factory("custos", CUSTOS);
 
 Custos::Custos() : LayerElement(CUSTOS, "custos-"), PitchInterface(), PositionInterface(), AttColor(), AttExtSym()
 {
-    this->RegisterInterface(PitchInterface::GetAttClasses(), PitchInterface::IsInterface());
-    this->RegisterInterface(PositionInterface::GetAttClasses(), PositionInterface::IsInterface());
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_EXTSYM);
+    this->RegisterInterface<PitchInterface>(this);
+    this->RegisterInterface<PositionInterface>(this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttExtSym>(ATT_EXTSYM, this);
 
     this->Reset();
 }
@@ -25,7 +25,7 @@ static const ClassRegistrar<Damage> s_factory("damage", DAMAGE);
 
 Damage::Damage() : EditorialElement(DAMAGE, "damage-"), AttSource()
 {
-    this->RegisterAttClass(ATT_SOURCE);
+    this->RegisterAttClass<AttSource>(ATT_SOURCE, this);
 
     this->Reset();
 }
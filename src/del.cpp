@@ -25,7 +25,7 @@ static const ClassRegistrar<Del> s_factory("del", DEL);
 
 Del::Del() : EditorialElement(DEL, "del-"), AttSource()
 {
-    this->RegisterAttClass(ATT_SOURCE);
+    this->RegisterAttClass<AttSource>(ATT_SOURCE, this);
 
     this->Reset();
 }
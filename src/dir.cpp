@@ -39,12 +39,12 @@ Dir::Dir()
     , AttLineRendBase()
     , AttVerticalGroup()
 {
-    this->RegisterInterface(TextDirInterface::GetAttClasses(), TextDirInterface::IsInterface());
-    this->RegisterInterface(TimeSpanningInterface::GetAttClasses(), TimeSpanningInterface::IsInterface());
-    this->RegisterAttClass(ATT_LANG);
-    this->RegisterAttClass(ATT_EXTENDER);
-    this->RegisterAttClass(ATT_LINERENDBASE);
-    this->RegisterAttClass(ATT_VERTICALGROUP);
+    this->RegisterInterface<TextDirInterface>(this);
+    this->RegisterInterface<TimeSpanningInterface>(this);
+    this->RegisterAttClass<AttLang>(ATT_LANG, this);
+    this->RegisterAttClass<AttExtender>(ATT_EXTENDER, this);
+    this->RegisterAttClass<AttLineRendBase>(ATT_LINERENDBASE, this);
+    this->RegisterAttClass<AttVerticalGroup>(ATT_VERTICALGROUP, this);
 
     this->Reset();
 }
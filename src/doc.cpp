@@ -11,12 +11,14 @@
 
 #include <cassert>
 #include <math.h>
+#include <set>
 
 //----------------------------------------------------------------------------
 
 #include "alignfunctor.h"
 #include "barline.h"
 #include "beatrpt.h"
+#include "cachehorizontallayoutfunctor.h"
 #include "castofffunctor.h"
 #include "chord.h"
 #include "comparison.h"
@@ -31,6 +33,7 @@
 #include "keysig.h"
 #include "label.h"
 #include "layer.h"
+#include "layoutcache.h"
 #include "mdiv.h"
 #include "measure.h"
 #include "mensur.h"
@@ -51,6 +54,7 @@
 #include "pghead.h"
 #include "pghead2.h"
 #include "preparedatafunctor.h"
+#include "profiler.h"
 #include "resetfunctor.h"
 #include "runningelement.h"
 #include "score.h"
@@ -65,6 +69,7 @@
 #include "system.h"
 #include "tempo.h"
 #include "text.h"
+#include "threadpool.h"
 #include "timemap.h"
 #include "timestamp.h"
 #include "transposefunctor.h"
@@ -87,10 +92,13 @@ namespace vrv {
 Doc::Doc() : Object(DOC, "doc-")
 {
     m_options = new Options();
+    m_arena = NULL;
+    m_layoutThreadPool = NULL;
 
     // owned pointers need to be set to NULL;
     m_selectionPreceding = NULL;
     m_selectionFollowing = NULL;
+    m_selectionIsExcerpt = false;
 
     this->Reset();
 }
@@ -100,6 +108,14 @@ Doc::~Doc()
     this->ClearSelectionPages();
 
     delete m_options;
+
+    if (m_layoutThreadPool) {
+        delete m_layoutThreadPool;
+        m_layoutThreadPool = NULL;
+    }
+
+    // The arena will be deleted with the last child
+    m_arena->Release();
 }
 
 void Doc::Reset()
@@ -108,6 +124,14 @@ void Doc::Reset()
 
     this->ClearSelectionPages();
 
+    // Start with a new arena and release the previous one (deleted with its last object)
+    ObjectArena *arena = new ObjectArena();
+    if (m_arena) {
+        if (ObjectArena::GetCurrent() == m_arena) ObjectArena::SetCurrent(arena);
+        m_arena->Release();
+    }
+    m_arena = arena;
+
     m_type = Raw;
     m_notationType = NOTATIONTYPE_NONE;
     m_pageHeight = -1;
@@ -129,11 +153,16 @@ void Doc::Reset()
     m_drawingPage = NULL;
     m_currentScore = NULL;
     m_currentScoreDefDone = false;
+    m_scoreDefChanges.Reset();
     m_dataPreparationDone = false;
     m_timemapTempo = 0.0;
     m_markup = MARKUP_DEFAULT;
     m_isMensuralMusicOnly = false;
+    m_isIncipit = false;
     m_isCastOff = false;
+    m_dataHash = "";
+    m_horizontalLayout.clear();
+    m_castOffBreaks = CastOffBreaks();
 
     m_facsimile = NULL;
 
@@ -159,6 +188,21 @@ void Doc::ClearSelectionPages()
     m_selectionEnd = "";
 }
 
+ThreadPool *Doc::GetLayoutThreadPool()
+{
+    const int threadCount = ThreadPool::GetThreadCount(m_options->m_layoutThreads.GetValue());
+    if (m_layoutThreadPool && (m_layoutThreadPool->GetThreadCount() != threadCount)) {
+        delete m_layoutThreadPool;
+        m_layoutThreadPool = NULL;
+    }
+    if (threadCount <= 1) return NULL;
+
+    if (!m_layoutThreadPool) {
+        m_layoutThreadPool = new ThreadPool(threadCount);
+    }
+    return m_layoutThreadPool;
+}
+
 void Doc::SetType(DocType type)
 {
     m_type = type;
@@ -325,6 +369,8 @@ bool Doc::HasTimemap() const
 
 void Doc::CalculateTimemap()
 {
+    ProfilerEvent event(PROFILER_STAGE, "Doc::CalculateTimemap");
+
     // There is no data to calculate the timemap
     if (this->GetPageCount() == 0) {
         return;
@@ -332,12 +378,13 @@ void Doc::CalculateTimemap()
 
     m_timemapTempo = 0.0;
 
-    // This happens if the document was never cast off (breaks none option in the toolkit)
+    // This happens if the document was never cast off (breaks none or data-only options in the toolkit)
+    // Only the alignment of the content in time is needed, not the graphical layout
     if (!m_drawingPage) {
         Page *page = this->SetDrawingPage(0);
         assert(page);
         this->ScoreDefSetCurrentDoc();
-        page->LayOutHorizontally();
+        page->AlignDurations();
     }
 
     double tempo = MIDI_TEMPO;
@@ -370,6 +417,7 @@ void Doc::CalculateTimemap()
 
 void Doc::ExportMIDI(smf::MidiFile *midiFile)
 {
+    ProfilerEvent event(PROFILER_EXPORT, "Doc::ExportMIDI");
 
     if (!this->HasTimemap()) {
         // generate MIDI timemap before progressing
@@ -509,6 +557,8 @@ void Doc::ExportMIDI(smf::MidiFile *midiFile)
 
 bool Doc::ExportTimemap(std::string &output, bool includeRests, bool includeMeasures)
 {
+    ProfilerEvent event(PROFILER_EXPORT, "Doc::ExportTimemap");
+
     if (!this->HasTimemap()) {
         // generate MIDI timemap before progressing
         CalculateTimemap();
@@ -530,6 +580,8 @@ bool Doc::ExportTimemap(std::string &output, bool includeRests, bool includeMeas
 
 bool Doc::ExportExpansionMap(std::string &output)
 {
+    ProfilerEvent event(PROFILER_EXPORT, "Doc::ExportExpansionMap");
+
     if (m_expansionMap.HasExpansionMap()) {
         m_expansionMap.ToJson(output);
         return true;
@@ -539,6 +591,20 @@ bool Doc::ExportExpansionMap(std::string &output)
 }
 
 bool Doc::ExportFeatures(std::string &output, const std::string &options)
+{
+    ProfilerEvent event(PROFILER_EXPORT, "Doc::ExportFeatures");
+
+    FeatureExtractor extractor(options);
+    if (!this->ExtractFeatures(extractor)) {
+        output = "{}";
+        return false;
+    }
+    extractor.ToJson(output);
+
+    return true;
+}
+
+bool Doc::ExtractFeatures(FeatureExtractor &extractor)
 {
     if (!this->HasTimemap()) {
         // generate MIDI timemap before progressing
@@ -546,28 +612,42 @@ bool Doc::ExportFeatures(std::string &output, const std::string &options)
     }
     if (!this->HasTimemap()) {
         LogWarning("Calculation of the timemap failed, the features cannot be exported.");
-        output = "{}";
         return false;
     }
-    FeatureExtractor extractor(options);
     GenerateFeaturesFunctor generateFeatures(&extractor);
     this->Process(generateFeatures);
-    extractor.ToJson(output);
 
     return true;
 }
 
 void Doc::PrepareData()
 {
+    ProfilerEvent event(PROFILER_STAGE, "Doc::PrepareData");
+
     /************ Reset and initialization ************/
 
     if (m_dataPreparationDone) {
         ResetDataFunctor resetData;
         this->Process(resetData);
     }
+    // The content recorded when setting the current scoreDef might not be valid anymore
+    this->ResetScoreDefChanges();
+
     PrepareDataInitializationFunctor prepareDataInitialization(this);
     this->Process(prepareDataInitialization);
 
+    /************ Incipit mode ************/
+
+    // The incipit mode is only applied to content with a single staff
+    m_isIncipit = false;
+    if (m_options->m_incipitMode.GetValue()) {
+        const ListOfObjects staves = this->FindAllDescendantsByType(STAFF, false);
+        m_isIncipit = std::all_of(staves.begin(), staves.end(), [&staves](const Object *object) {
+            return (vrv_cast<const Staff *>(object)->GetN() == vrv_cast<const Staff *>(staves.front())->GetN());
+        });
+        if (!m_isIncipit) LogWarning("Incipit mode is ignored for content with more than one staff");
+    }
+
     /************ Generate measure indices ************/
 
     this->PrepareMeasureIndices();
@@ -679,9 +759,11 @@ void Doc::PrepareData()
 
     /************ Resolve cross staff ************/
 
-    // Prepare the cross-staff pointers
-    PrepareCrossStaffFunctor prepareCrossStaff;
-    this->Process(prepareCrossStaff);
+    // Prepare the cross-staff pointers - not needed with a single staff
+    if (!m_isIncipit) {
+        PrepareCrossStaffFunctor prepareCrossStaff;
+        this->Process(prepareCrossStaff);
+    }
 
     /************ Resolve beamspan elements ***********/
 
@@ -867,6 +949,8 @@ void Doc::PrepareData()
 
 void Doc::ScoreDefSetCurrentDoc(bool force)
 {
+    ProfilerEvent event(PROFILER_STAGE, "Doc::ScoreDefSetCurrentDoc");
+
     if (m_currentScoreDefDone && !force) {
         return;
     }
@@ -885,8 +969,10 @@ void Doc::ScoreDefSetCurrentDoc(bool force)
     scoreDefSetCurrentPage.SetDirection(FORWARD);
     this->Process(scoreDefSetCurrentPage, 3);
 
+    // The content of the measures is recorded the first time and then reused until it is reset
     ScoreDefSetCurrentFunctor scoreDefSetCurrent(this);
     this->Process(scoreDefSetCurrent);
+    m_scoreDefChanges.SetComplete();
 
     this->ScoreDefSetGrpSymDoc();
 
@@ -895,6 +981,8 @@ void Doc::ScoreDefSetCurrentDoc(bool force)
 
 void Doc::ScoreDefOptimizeDoc()
 {
+    ProfilerEvent event(PROFILER_STAGE, "Doc::ScoreDefOptimizeDoc");
+
     ScoreDefOptimizeFunctor scoreDefOptimize(this);
     this->Process(scoreDefOptimize);
 
@@ -925,8 +1013,15 @@ void Doc::CastOffSmartDoc()
     Doc::CastOffDocBase(false, false, true);
 }
 
-void Doc::CastOffDocBase(bool useSb, bool usePb, bool smart)
+void Doc::CastOffBreaksDoc(const CastOffBreaks &breaks)
+{
+    Doc::CastOffDocBase(false, false, false, &breaks);
+}
+
+void Doc::CastOffDocBase(bool useSb, bool usePb, bool smart, const CastOffBreaks *breaks)
 {
+    ProfilerEvent event(PROFILER_STAGE, "Doc::CastOffDocBase");
+
     Pages *pages = this->GetPages();
     assert(pages);
 
@@ -946,17 +1041,40 @@ void Doc::CastOffDocBase(bool useSb, bool usePb, bool smart)
     // Check if the the horizontal layout is cached by looking at the first measure
     // The cache is not set the first time, or can be reset by Doc::UnCastOffDoc
     Measure *firstMeasure = vrv_cast<Measure *>(unCastOffPage->FindDescendantByType(MEASURE));
-    if (!firstMeasure || !firstMeasure->HasCachedHorizontalLayout()) {
-        // LogDebug("Performing the horizontal layout");
-        unCastOffPage->LayOutHorizontally();
-        unCastOffPage->LayOutHorizontallyWithCache();
-    }
-    else {
+    const bool hasCache = (firstMeasure && firstMeasure->HasCachedHorizontalLayout());
+    // With known breaks, the widths of the systems are stored and the content does not need to be laid out again
+    const bool hasSystemWidths = (breaks && hasCache);
+    if (hasSystemWidths) {
+        LogDebug("Casting off with known breaks");
+    }
+    else if (hasCache && m_horizontalLayout.empty()) {
+        // Only the positions cached in the content can be restored (e.g., with a selection)
         unCastOffPage->LayOutHorizontallyWithCache(true);
     }
+    else if (!hasCache || !this->RestoreHorizontalLayout(unCastOffPage)) {
+        // Look in the persistent cache (if enabled) before performing the horizontal layout
+        LayoutCache layoutCache(this);
+        if (layoutCache.Load(unCastOffPage)) {
+            unCastOffPage->LayOutHorizontallyWithCache(true);
+        }
+        else {
+            // LogDebug("Performing the horizontal layout");
+            unCastOffPage->LayOutHorizontally();
+            unCastOffPage->LayOutHorizontallyWithCache();
+            layoutCache.Save(unCastOffPage);
+        }
+        this->StoreHorizontalLayout(unCastOffPage);
+    }
 
     Page *castOffSinglePage = new Page();
 
+    std::set<std::string> systemBreaks;
+    std::set<std::string> pageBreaks;
+    if (breaks) {
+        systemBreaks.insert(breaks->m_systems.begin(), breaks->m_systems.end());
+        pageBreaks.insert(breaks->m_pages.begin(), breaks->m_pages.end());
+    }
+
     System *leftoverSystem = NULL;
     if (useSb && !usePb && !smart) {
         CastOffEncodingFunctor castOffEncoding(this, castOffSinglePage, false);
@@ -965,9 +1083,11 @@ void Doc::CastOffDocBase(bool useSb, bool usePb, bool smart)
     else {
         CastOffSystemsFunctor castOffSystems(castOffSinglePage, this, smart);
         castOffSystems.SetSystemWidth(m_drawingPageContentWidth);
+        if (breaks) castOffSystems.SetBreaks(&systemBreaks);
         unCastOffPage->Process(castOffSystems);
         leftoverSystem = castOffSystems.GetLeftoverSystem();
     }
+
     // We can now detach and delete the old content page
     pages->DetachChild(0);
     assert(unCastOffPage && !unCastOffPage->GetParent());
@@ -976,9 +1096,36 @@ void Doc::CastOffDocBase(bool useSb, bool usePb, bool smart)
 
     // Store the cast off system widths => these are used to adjust the horizontal spacing
     // for a given duration during page layout
-    AlignMeasuresFunctor alignMeasures(this);
-    alignMeasures.StoreCastOffSystemWidths(true);
-    castOffSinglePage->Process(alignMeasures);
+    ListOfObjects systems = castOffSinglePage->FindAllDescendantsByType(SYSTEM, false, 1);
+    if (hasSystemWidths && (systems.size() == breaks->m_systemWidths.size())) {
+        int idx = 0;
+        for (Object *object : systems) {
+            System *system = vrv_cast<System *>(object);
+            system->m_castOffTotalWidth = breaks->m_systemWidths.at(idx).first;
+            system->m_castOffJustifiableWidth = breaks->m_systemWidths.at(idx).second;
+            ++idx;
+        }
+    }
+    else {
+        if (hasSystemWidths) LogWarning("The breaks do not match the content");
+        AlignMeasuresFunctor alignMeasures(this);
+        alignMeasures.StoreCastOffSystemWidths(true);
+        castOffSinglePage->Process(alignMeasures);
+    }
+
+    m_castOffBreaks = CastOffBreaks();
+    for (Object *object : systems) {
+        System *system = vrv_cast<System *>(object);
+        m_castOffBreaks.m_systemWidths.push_back({ system->m_castOffTotalWidth, system->m_castOffJustifiableWidth });
+        if (system->GetChildCount() > 0) m_castOffBreaks.m_systems.push_back(system->GetChild(0)->GetID());
+    }
+    // With known breaks, the leftover system is the last one if it was merged in the previous cast off
+    if (breaks && !breaks->m_leftover.empty() && !m_castOffBreaks.m_systems.empty()
+        && (m_castOffBreaks.m_systems.back() == breaks->m_leftover)) {
+        leftoverSystem = vrv_cast<System *>(castOffSinglePage->GetLast(SYSTEM));
+    }
+    Object *leftoverFirst
+        = (leftoverSystem && (leftoverSystem->GetChildCount() > 0)) ? leftoverSystem->GetChild(0) : NULL;
 
     // Replace it with the castOffSinglePage
     pages->AddChild(castOffSinglePage);
@@ -1002,7 +1149,8 @@ void Doc::CastOffDocBase(bool useSb, bool usePb, bool smart)
     // Here we redo the alignment because of the new scoreDefs
     // Because of the new scoreDef, we need to reset cached drawingX
     castOffSinglePage->ResetCachedDrawingX();
-    castOffSinglePage->LayOutVertically();
+    // The vertical layout is needed only for finding the page breaks
+    if (!breaks) castOffSinglePage->LayOutVertically();
 
     // Detach the contentPage to prepare for CastOffPages
     pages->DetachChild(0);
@@ -1017,11 +1165,31 @@ void Doc::CastOffDocBase(bool useSb, bool usePb, bool smart)
     CastOffPagesFunctor castOffPages(castOffSinglePage, this, castOffFirstPage);
     castOffPages.SetPageHeight(m_drawingPageContentHeight);
     castOffPages.SetLeftoverSystem(leftoverSystem);
+    if (breaks) castOffPages.SetBreaks(&pageBreaks);
 
     pages->AddChild(castOffFirstPage);
     castOffSinglePage->Process(castOffPages);
+    // The content of the leftover system was moved to the previous one
+    if (leftoverFirst && (leftoverFirst->GetParent() != leftoverSystem)) {
+        m_castOffBreaks.m_leftover = leftoverFirst->GetID();
+    }
     delete castOffSinglePage;
 
+    for (Object *page : pages->GetChildren()) {
+        bool isFirstSystem = true;
+        for (Object *system : page->GetChildren()) {
+            if (!system->Is(SYSTEM) || (system->GetChildCount() == 0)) continue;
+            Object *measure = system->FindDescendantByType(MEASURE);
+            const std::string measureID = (measure) ? measure->GetID() : "";
+            m_castOffBreaks.m_systemMeasures.push_back(measureID);
+            if (isFirstSystem) {
+                m_castOffBreaks.m_pages.push_back(system->GetChild(0)->GetID());
+                m_castOffBreaks.m_pageMeasures.push_back(measureID);
+                isFirstSystem = false;
+            }
+        }
+    }
+
     this->ScoreDefSetCurrentDoc(true);
     if (optimize) {
         this->ScoreDefOptimizeDoc();
@@ -1030,8 +1198,38 @@ void Doc::CastOffDocBase(bool useSb, bool usePb, bool smart)
     m_isCastOff = true;
 }
 
+void Doc::StoreHorizontalLayout(Page *page)
+{
+    assert(page);
+
+    m_horizontalLayout.clear();
+    PersistHorizontalLayoutFunctor persistHorizontalLayout(&m_horizontalLayout, false);
+    page->Process(persistHorizontalLayout);
+}
+
+bool Doc::RestoreHorizontalLayout(Page *page)
+{
+    assert(page);
+
+    // The positions left by the layout of the pages are justified and are not the ones of the content page
+    page->ResetAligners();
+
+    PersistHorizontalLayoutFunctor persistHorizontalLayout(&m_horizontalLayout, true);
+    page->Process(persistHorizontalLayout);
+    if (persistHorizontalLayout.HasFailed()) {
+        LogDebug("The stored horizontal layout does not match the content");
+        m_horizontalLayout.clear();
+        return false;
+    }
+    page->LayOutHorizontallyWithCache(true);
+
+    return true;
+}
+
 void Doc::UnCastOffDoc(bool resetCache)
 {
+    ProfilerEvent event(PROFILER_STAGE, "Doc::UnCastOffDoc");
+
     if (!this->IsCastOff()) {
         LogDebug("Document is not cast off");
         return;
@@ -1044,6 +1242,8 @@ void Doc::UnCastOffDoc(bool resetCache)
     UnCastOffFunctor unCastOff(unCastOffPage);
     unCastOff.SetResetCache(resetCache);
     this->Process(unCastOff);
+    if (resetCache) m_horizontalLayout.clear();
+    m_castOffBreaks = CastOffBreaks();
 
     pages->ClearChildren();
 
@@ -1059,8 +1259,30 @@ void Doc::UnCastOffDoc(bool resetCache)
     m_isCastOff = false;
 }
 
+void Doc::MergePagesDoc()
+{
+    ProfilerEvent event(PROFILER_STAGE, "Doc::MergePagesDoc");
+
+    Pages *pages = this->GetPages();
+    assert(pages);
+
+    Page *mergedPage = new Page();
+    UnCastOffFunctor unCastOff(mergedPage);
+    // Only the pages and their systems are visited (Pages > Page > System)
+    pages->Process(unCastOff, 2);
+    m_castOffBreaks = CastOffBreaks();
+
+    pages->ClearChildren();
+    pages->AddChild(mergedPage);
+
+    this->ResetDataPage();
+    m_isCastOff = false;
+}
+
 void Doc::CastOffEncodingDoc()
 {
+    ProfilerEvent event(PROFILER_STAGE, "Doc::CastOffEncodingDoc");
+
     if (this->IsCastOff()) {
         LogDebug("Document is already cast off");
         return;
@@ -1107,12 +1329,27 @@ void Doc::InitSelectionDoc(DocSelection &selection, bool resetCache)
     // No new selection to apply;
     if (!selection.m_isPending) return;
 
+    // The content page changes with the selection
+    m_horizontalLayout.clear();
+
+    // The content outside an excerpt is not un-cast off when resetting it
+    bool isExcerptReset = false;
     if (this->HasSelection()) {
+        isExcerptReset = m_selectionIsExcerpt;
         this->ResetSelectionDoc(resetCache);
     }
 
     selection.Set(this);
 
+    // For an excerpt, only the selected measures are moved and processed
+    if (this->HasSelection() && m_selectionIsExcerpt && this->InitExcerptDoc(resetCache)) return;
+
+    // Otherwise the content outside the previous excerpt needs to be un-cast off, including its cached layout
+    if (isExcerptReset) {
+        m_isCastOff = true;
+        this->UnCastOffDoc();
+    }
+
     if (!this->HasSelection()) return;
 
     assert(!m_selectionPreceding && !m_selectionFollowing);
@@ -1159,6 +1396,123 @@ void Doc::InitSelectionDoc(DocSelection &selection, bool resetCache)
     this->ReactivateSelection(true);
 }
 
+bool Doc::InitExcerptDoc(bool resetCache)
+{
+    ProfilerEvent event(PROFILER_STAGE, "Doc::InitExcerptDoc");
+
+    Pages *pages = this->GetPages();
+    assert(pages);
+
+    // Look only at the content of the systems (Pages > Page > System > Measure)
+    Object *start = pages->FindDescendantByID(m_selectionStart, 3);
+    if (!start || !start->Is(MEASURE) || !start->GetParent()->Is(SYSTEM)) return false;
+
+    // The scoreDef is set only once for the complete document and the changes are recorded
+    this->ScoreDefSetCurrentDoc();
+
+    if (this->IsCastOff()) this->MergePagesDoc();
+
+    System *system = vrv_cast<System *>(start->GetParent());
+    assert(system);
+    Page *page = vrv_cast<Page *>(system->GetParent());
+    assert(page);
+
+    const int startIdx = start->GetIdx();
+    int endIdx = VRV_UNSET;
+    for (int i = startIdx; i < system->GetChildCount(); ++i) {
+        Object *child = system->GetChild(i);
+        if (child->Is(MEASURE) && (child->GetID() == m_selectionEnd)) {
+            endIdx = i;
+            break;
+        }
+    }
+    if (endIdx == VRV_UNSET) {
+        LogWarning("Selection end '%s' could not be found", m_selectionEnd.c_str());
+        endIdx = system->GetChildCount() - 1;
+    }
+
+    // The scoreDef at the start of the selection
+    Measure *scoreDefMeasure = this->GetDrawingScoreDefMeasure(system, startIdx);
+    ScoreDef *scoreDef = (scoreDefMeasure) ? scoreDefMeasure->GetDrawingScoreDef() : &page->m_drawingScoreDef;
+    System *selectionSystem = new System();
+    selectionSystem->SetDrawingScoreDef(scoreDef);
+
+    Page *selectionPage = new Page();
+    selectionPage->AddChild(selectionSystem);
+    System *followingSystem = new System();
+    Page *followingPage = new Page();
+    followingPage->AddChild(followingSystem);
+
+    // Split the system and move the page content after it (e.g., the end of the score) to the following page
+    for (int i = startIdx; i < system->GetChildCount(); ++i) {
+        Object *child = system->Relinquish(i);
+        if (i <= endIdx) {
+            selectionSystem->AddChild(child);
+        }
+        else {
+            followingSystem->AddChild(child);
+        }
+    }
+    system->ClearRelinquishedChildren();
+    for (int i = system->GetIdx() + 1; i < page->GetChildCount(); ++i) {
+        followingPage->AddChild(page->Relinquish(i));
+    }
+    page->ClearRelinquishedChildren();
+
+    // The staves of the following measures can point to the drawing scoreDef of a selected measure.
+    // It is given to the first following measure since the ones of the selection are reset with its layout.
+    Measure *endScoreDefMeasure
+        = this->GetDrawingScoreDefMeasure(selectionSystem, selectionSystem->GetChildCount() - 1);
+    Measure *followingMeasure = vrv_cast<Measure *>(followingSystem->FindDescendantByType(MEASURE));
+    if (endScoreDefMeasure && followingMeasure && !followingMeasure->GetDrawingScoreDef()) {
+        endScoreDefMeasure->MoveDrawingScoreDefTo(followingMeasure);
+    }
+
+    // The cached layout can be kept only if all the selected measures have one
+    bool hasCache = true;
+    ListOfObjects measures = selectionSystem->FindAllDescendantsByType(MEASURE, false);
+    for (Object *measure : measures) {
+        if (!vrv_cast<Measure *>(measure)->HasCachedHorizontalLayout()) hasCache = false;
+    }
+    UnCastOffFunctor unCastOff(selectionPage);
+    unCastOff.SetResetCache(resetCache || !hasCache);
+    for (Object *child : selectionSystem->GetChildren()) {
+        child->Process(unCastOff);
+    }
+
+    pages->AddChild(selectionPage);
+    pages->AddChild(followingPage);
+    this->ResetDataPage();
+
+    this->ReactivateSelection(true);
+
+    // Only the selection remains in the document and the scoreDef is set from the selection score
+    this->ScoreDefSetCurrentDoc(true);
+
+    return true;
+}
+
+Measure *Doc::GetDrawingScoreDefMeasure(System *system, int idx)
+{
+    assert(system);
+
+    for (int i = idx; i >= 0; --i) {
+        Object *child = system->GetChild(i);
+        if (child->Is(MEASURE)) {
+            Measure *measure = vrv_cast<Measure *>(child);
+            if (measure->GetDrawingScoreDef()) return measure;
+        }
+        else {
+            ListOfObjects measures = child->FindAllDescendantsByType(MEASURE, false);
+            for (auto iter = measures.rbegin(); iter != measures.rend(); ++iter) {
+                Measure *measure = vrv_cast<Measure *>(*iter);
+                if (measure->GetDrawingScoreDef()) return measure;
+            }
+        }
+    }
+    return NULL;
+}
+
 void Doc::ResetSelectionDoc(bool resetCache)
 {
     assert(m_selectionPreceding && m_selectionFollowing);
@@ -1170,6 +1524,12 @@ void Doc::ResetSelectionDoc(bool resetCache)
 
     this->DeactiveateSelection();
 
+    // The content of an excerpt is only moved back - see Doc::InitSelectionDoc
+    if (m_selectionIsExcerpt) {
+        this->MergePagesDoc();
+        return;
+    }
+
     this->m_isCastOff = true;
     this->UnCastOffDoc(resetCache);
 }
@@ -1218,13 +1578,20 @@ void Doc::ReactivateSelection(bool resetAligners)
     selectionPage->InsertChild(selectionScore, 0);
 
     m_selectionPreceding = vrv_cast<Page *>(pages->GetChild(0));
+    m_selectionFollowing = vrv_cast<Page *>(pages->GetChild(lastPage));
+
+    // For an excerpt, only reset what is accessed when rendering control events outside the selection
+    if (resetAligners && m_selectionIsExcerpt) {
+        this->ResetSelectionContext(selectionPage);
+        resetAligners = false;
+    }
+
     // Reset the aligners because data will be accessed when rendering control events outside the selection
     if (resetAligners && m_selectionPreceding->FindDescendantByType(MEASURE)) {
         this->SetDrawingPage(0);
         m_selectionPreceding->ResetAligners();
     }
 
-    m_selectionFollowing = vrv_cast<Page *>(pages->GetChild(lastPage));
     // Same for the following content
     if (resetAligners && m_selectionFollowing->FindDescendantByType(MEASURE)) {
         this->SetDrawingPage(2);
@@ -1238,8 +1605,35 @@ void Doc::ReactivateSelection(bool resetAligners)
     this->m_drawingPage = NULL;
 }
 
+void Doc::ResetSelectionContext(Page *selectionPage)
+{
+    assert(selectionPage);
+
+    std::set<Object *> contextMeasures;
+
+    ListOfObjects timeSpanningElements;
+    InterfaceComparison comparison(INTERFACE_TIME_SPANNING);
+    selectionPage->FindAllDescendantsByComparison(&timeSpanningElements, &comparison);
+    for (Object *object : timeSpanningElements) {
+        TimeSpanningInterface *interface = object->GetTimeSpanningInterface();
+        assert(interface);
+        for (LayerElement *element : { interface->GetStart(), interface->GetEnd() }) {
+            if (!element || (element->GetFirstAncestor(PAGE) == selectionPage)) continue;
+            Object *measure = element->GetFirstAncestor(MEASURE);
+            if (measure) contextMeasures.insert(measure);
+        }
+    }
+
+    ResetVerticalAlignmentFunctor resetVerticalAlignment;
+    for (Object *measure : contextMeasures) {
+        measure->Process(resetVerticalAlignment);
+    }
+}
+
 void Doc::ConvertToPageBasedDoc()
 {
+    ProfilerEvent event(PROFILER_STAGE, "Doc::ConvertToPageBasedDoc");
+
     Pages *pages = new Pages();
     Page *page = new Page();
     pages->AddChild(page);
@@ -1257,6 +1651,8 @@ void Doc::ConvertToPageBasedDoc()
 
 void Doc::ConvertToCastOffMensuralDoc(bool castOff)
 {
+    ProfilerEvent event(PROFILER_STAGE, "Doc::ConvertToCastOffMensuralDoc");
+
     if (!m_isMensuralMusicOnly) return;
 
     // Do not convert transcription files
@@ -1305,6 +1701,8 @@ void Doc::ConvertToCastOffMensuralDoc(bool castOff)
 
 void Doc::ConvertMarkupDoc(bool permanent)
 {
+    ProfilerEvent event(PROFILER_STAGE, "Doc::ConvertMarkupDoc");
+
     if (m_markup == MARKUP_DEFAULT) return;
 
     LogInfo("Converting markup...");
@@ -1369,6 +1767,8 @@ void Doc::ConvertMarkupDoc(bool permanent)
 
 void Doc::TransposeDoc()
 {
+    ProfilerEvent event(PROFILER_STAGE, "Doc::TransposeDoc");
+
     Transposer transposer;
     transposer.SetBase600(); // Set extended chromatic alteration mode (allowing more than double sharps/flats)
 
@@ -1409,6 +1809,8 @@ void Doc::TransposeDoc()
 
 void Doc::ExpandExpansions()
 {
+    ProfilerEvent event(PROFILER_STAGE, "Doc::ExpandExpansions");
+
     // Upon MEI import: use expansion ID, given by command line argument
     std::string expansionId = this->GetOptions()->m_expand.GetValue();
     if (expansionId.empty()) return;
@@ -30,6 +30,7 @@ namespace vrv {
 
 DocSelection::DocSelection()
 {
+    m_isExcerpt = false;
     m_isPending = false;
 }
 
@@ -41,6 +42,7 @@ bool DocSelection::Parse(const std::string &selection)
     m_selectionRangeStart = VRV_UNSET;
     m_selectionRangeEnd = VRV_UNSET;
     m_measureRange = "";
+    m_isExcerpt = false;
 
     jsonxx::Object json;
 
@@ -58,6 +60,7 @@ bool DocSelection::Parse(const std::string &selection)
         return false;
     }
     else {
+        if (json.has<jsonxx::Boolean>("excerpt")) m_isExcerpt = json.get<jsonxx::Boolean>("excerpt");
         // Only a start or an end - this is not valid
         if (json.has<jsonxx::String>("measureRange")) {
             m_measureRange = json.get<jsonxx::String>("measureRange");
@@ -118,6 +121,7 @@ void DocSelection::Set(Doc *doc)
 
     doc->m_selectionStart = "";
     doc->m_selectionEnd = "";
+    doc->m_selectionIsExcerpt = m_isExcerpt;
 
     if (m_selectionRangeStart != VRV_UNSET) {
         std::string selectionStartId = "";
@@ -26,9 +26,9 @@ static const ClassRegistrar<Dot> s_factory("dot", DOT);
 
 Dot::Dot() : LayerElement(DOT, "dot-"), PositionInterface(), AttColor(), AttDotLog()
 {
-    this->RegisterInterface(PositionInterface::GetAttClasses(), PositionInterface::IsInterface());
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_DOTLOG);
+    this->RegisterInterface<PositionInterface>(this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttDotLog>(ATT_DOTLOG, this);
 
     this->Reset();
 }
@@ -176,7 +176,7 @@ void BeamDrawingInterface::InitCoords(const ListOfObjects &childList, Staff *sta
 
         // Look at beam breaks
         m_beamElementCoords.at(elementCount)->m_breaksec = 0;
-        AttBeamSecondary *beamsecondary = dynamic_cast<AttBeamSecondary *>(current);
+        AttBeamSecondary *beamsecondary = current->GetAtt<AttBeamSecondary>(ATT_BEAMSECONDARY);
         if (beamsecondary && beamsecondary->HasBreaksec()) {
             if (!m_changingDur) m_changingDur = true;
             m_beamElementCoords.at(elementCount)->m_breaksec = beamsecondary->GetBreaksec();
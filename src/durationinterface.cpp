@@ -38,14 +38,14 @@ DurationInterface::DurationInterface()
     , AttFermataPresent()
     , AttStaffIdent()
 {
-    this->RegisterInterfaceAttClass(ATT_AUGMENTDOTS);
-    this->RegisterInterfaceAttClass(ATT_BEAMSECONDARY);
-    this->RegisterInterfaceAttClass(ATT_DURATIONGES);
-    this->RegisterInterfaceAttClass(ATT_DURATIONLOG);
-    this->RegisterInterfaceAttClass(ATT_DURATIONQUALITY);
-    this->RegisterInterfaceAttClass(ATT_DURATIONRATIO);
-    this->RegisterInterfaceAttClass(ATT_FERMATAPRESENT);
-    this->RegisterInterfaceAttClass(ATT_STAFFIDENT);
+    this->RegisterInterfaceAttClass<AttAugmentDots>(ATT_AUGMENTDOTS, this);
+    this->RegisterInterfaceAttClass<AttBeamSecondary>(ATT_BEAMSECONDARY, this);
+    this->RegisterInterfaceAttClass<AttDurationGes>(ATT_DURATIONGES, this);
+    this->RegisterInterfaceAttClass<AttDurationLog>(ATT_DURATIONLOG, this);
+    this->RegisterInterfaceAttClass<AttDurationQuality>(ATT_DURATIONQUALITY, this);
+    this->RegisterInterfaceAttClass<AttDurationRatio>(ATT_DURATIONRATIO, this);
+    this->RegisterInterfaceAttClass<AttFermataPresent>(ATT_FERMATAPRESENT, this);
+    this->RegisterInterfaceAttClass<AttStaffIdent>(ATT_STAFFIDENT, this);
 
     this->Reset();
 }
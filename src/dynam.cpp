@@ -47,14 +47,14 @@ Dynam::Dynam()
     , AttMidiValue2()
     , AttVerticalGroup()
 {
-    this->RegisterInterface(TextDirInterface::GetAttClasses(), TextDirInterface::IsInterface());
-    this->RegisterInterface(TimeSpanningInterface::GetAttClasses(), TimeSpanningInterface::IsInterface());
-    this->RegisterAttClass(ATT_ENCLOSINGCHARS);
-    this->RegisterAttClass(ATT_EXTENDER);
-    this->RegisterAttClass(ATT_LINERENDBASE);
-    this->RegisterAttClass(ATT_MIDIVALUE);
-    this->RegisterAttClass(ATT_MIDIVALUE2);
-    this->RegisterAttClass(ATT_VERTICALGROUP);
+    this->RegisterInterface<TextDirInterface>(this);
+    this->RegisterInterface<TimeSpanningInterface>(this);
+    this->RegisterAttClass<AttEnclosingChars>(ATT_ENCLOSINGCHARS, this);
+    this->RegisterAttClass<AttExtender>(ATT_EXTENDER, this);
+    this->RegisterAttClass<AttLineRendBase>(ATT_LINERENDBASE, this);
+    this->RegisterAttClass<AttMidiValue>(ATT_MIDIVALUE, this);
+    this->RegisterAttClass<AttMidiValue2>(ATT_MIDIVALUE2, this);
+    this->RegisterAttClass<AttVerticalGroup>(ATT_VERTICALGROUP, this);
 
     this->Reset();
 }
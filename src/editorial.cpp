@@ -37,8 +37,8 @@ namespace vrv {
 EditorialElement::EditorialElement()
     : Object(EDITORIAL_ELEMENT, "ee-"), SystemMilestoneInterface(), AttLabelled(), AttTyped()
 {
-    this->RegisterAttClass(ATT_LABELLED);
-    this->RegisterAttClass(ATT_TYPED);
+    this->RegisterAttClass<AttLabelled>(ATT_LABELLED, this);
+    this->RegisterAttClass<AttTyped>(ATT_TYPED, this);
 
     this->Reset();
 }
@@ -46,8 +46,8 @@ EditorialElement::EditorialElement()
 EditorialElement::EditorialElement(ClassId classId)
     : Object(classId, "ee-"), SystemMilestoneInterface(), AttLabelled(), AttTyped()
 {
-    this->RegisterAttClass(ATT_LABELLED);
-    this->RegisterAttClass(ATT_TYPED);
+    this->RegisterAttClass<AttLabelled>(ATT_LABELLED, this);
+    this->RegisterAttClass<AttTyped>(ATT_TYPED, this);
 
     this->Reset();
 }
@@ -55,8 +55,8 @@ EditorialElement::EditorialElement(ClassId classId)
 EditorialElement::EditorialElement(ClassId classId, const std::string &classIdStr)
     : Object(classId, classIdStr), SystemMilestoneInterface(), AttLabelled(), AttTyped()
 {
-    this->RegisterAttClass(ATT_LABELLED);
-    this->RegisterAttClass(ATT_TYPED);
+    this->RegisterAttClass<AttLabelled>(ATT_LABELLED, this);
+    this->RegisterAttClass<AttTyped>(ATT_TYPED, this);
 
     this->Reset();
 }
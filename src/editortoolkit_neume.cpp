@@ -68,6 +68,13 @@ bool EditorToolkitNeume::ParseEditorAction(const std::string &json_editorAction)
         return false;
     }
 
+    // Dragging, inserting, resizing and changing staff keep the zone index up-to-date.
+    // Other actions can delete objects or change their zones and the index needs to be rebuilt.
+    if ((action != "chain") && (action != "drag") && (action != "insert") && (action != "resize")
+        && (action != "resizeRotate") && (action != "changeStaff")) {
+        m_zoneIndex.Reset();
+    }
+
     if (action == "drag") {
         std::string elementId;
         int x, y;
@@ -82,7 +89,11 @@ bool EditorToolkitNeume::ParseEditorAction(const std::string &json_editorAction)
         std::vector<std::pair<std::string, std::string>> attributes;
         if (this->ParseInsertAction(
                 json.get<jsonxx::Object>("param"), &elementType, &staffId, &ulx, &uly, &lrx, &lry, &attributes)) {
-            return this->Insert(elementType, staffId, ulx, uly, lrx, lry, attributes);
+            if (!this->Insert(elementType, staffId, ulx, uly, lrx, lry, attributes)) return false;
+            if (m_infoObject.has<jsonxx::String>("uuid")) {
+                this->UpdateZoneIndex(m_infoObject.get<jsonxx::String>("uuid"));
+            }
+            return true;
         }
         LogWarning("Could not parse the insert action");
     }
@@ -590,20 +601,7 @@ bool EditorToolkitNeume::Insert(std::string elementType, std::string staffId, in
 
     // Find closest valid staff
     if (staffId == "auto") {
-        ListOfObjects staves = m_doc->FindAllDescendantsByType(STAFF, false);
-        std::vector<Object *> stavesVector(staves.begin(), staves.end());
-
-        ClosestBB comp;
-        comp.x = ulx;
-        comp.y = uly;
-
-        if (staves.size() > 0) {
-            std::sort(stavesVector.begin(), stavesVector.end(), comp);
-            staff = dynamic_cast<Staff *>(stavesVector.at(0));
-        }
-        else {
-            staff = NULL;
-        }
+        staff = vrv_cast<Staff *>(this->GetZoneIndex()->FindClosest(STAFF, ulx, uly));
     }
     else {
         staff = dynamic_cast<Staff *>(m_doc->FindDescendantByID(staffId));
@@ -1494,6 +1492,7 @@ bool EditorToolkitNeume::Resize(std::string elementId, int ulx, int uly, int lrx
             zone->SetRotate(rotate);
         }
         zone->Modify();
+        m_zoneIndex.Update(zone, staff);
         staff->GetParent()->StableSort(StaffSort());
     }
     else if (obj->Is(SYL)) {
@@ -1515,6 +1514,7 @@ bool EditorToolkitNeume::Resize(std::string elementId, int ulx, int uly, int lrx
             zone->SetRotate(rotate);
         }
         zone->Modify();
+        m_zoneIndex.Update(zone, syl);
     }
     else {
         LogError("Element of type '%s' is unsupported.", obj->GetClassName().c_str());
@@ -2354,15 +2354,13 @@ bool EditorToolkitNeume::ChangeStaff(std::string elementId)
         return false;
     }
 
-    ListOfObjects stavesList = m_doc->FindAllDescendantsByType(STAFF, false);
-
-    std::vector<Object *> staves(stavesList.begin(), stavesList.end());
-
-    ClosestBB comp;
+    // The point from which the closest staff is searched
+    int x = 0;
+    int y = 0;
 
     if (element->GetFacsimileInterface()->HasFacs()) {
-        comp.x = element->GetFacsimileInterface()->GetZone()->GetUlx();
-        comp.y = element->GetFacsimileInterface()->GetZone()->GetUly();
+        x = element->GetFacsimileInterface()->GetZone()->GetUlx();
+        y = element->GetFacsimileInterface()->GetZone()->GetUly();
     }
 
     else if (element->Is(SYLLABLE)) {
@@ -2374,8 +2372,8 @@ bool EditorToolkitNeume::ChangeStaff(std::string elementId)
             m_infoObject.import("message", "Couldn't generate bounding box for syllable.");
             return false;
         }
-        comp.x = (lrx + ulx) / 2;
-        comp.y = (uly + lry) / 2;
+        x = (lrx + ulx) / 2;
+        y = (uly + lry) / 2;
     }
 
     else {
@@ -2385,13 +2383,9 @@ bool EditorToolkitNeume::ChangeStaff(std::string elementId)
         return false;
     }
 
-    Staff *staff = NULL;
+    Staff *staff = vrv_cast<Staff *>(this->GetZoneIndex()->FindClosest(STAFF, x, y));
 
-    if (staves.size() > 0) {
-        std::sort(staves.begin(), staves.end(), comp);
-        staff = dynamic_cast<Staff *>(staves.front());
-    }
-    else {
+    if (!staff) {
         LogError("Could not find any staves. This should not happen");
         m_infoObject.import("status", "FAILURE");
         m_infoObject.import("message", "Could not find any staves. This should not happen");
@@ -2908,4 +2902,24 @@ bool EditorToolkitNeume::AdjustClefLineFromPosition(Clef *clef, Staff *staff)
     return true;
 }
 
+ZoneIndex *EditorToolkitNeume::GetZoneIndex()
+{
+    if (!m_zoneIndex.IsBuilt()) {
+        m_zoneIndex.Build(m_doc);
+    }
+    return &m_zoneIndex;
+}
+
+void EditorToolkitNeume::UpdateZoneIndex(const std::string &elementId)
+{
+    if (!m_zoneIndex.IsBuilt()) return;
+
+    Object *element = m_doc->FindDescendantByID(elementId);
+    if (!element) return;
+
+    // Inserted neume components come with a syllable and a syl that can have their own zones
+    Object *syllable = element->GetFirstAncestor(SYLLABLE);
+    m_zoneIndex.UpdateSubtree(syllable ? syllable : element);
+}
+
 } // namespace vrv
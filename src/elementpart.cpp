@@ -32,7 +32,7 @@ namespace vrv {
 
 Dots::Dots() : LayerElement(DOTS, "dots-"), AttAugmentDots()
 {
-    this->RegisterAttClass(ATT_AUGMENTDOTS);
+    this->RegisterAttClass<AttAugmentDots>(ATT_AUGMENTDOTS, this);
 
     this->Reset();
 }
@@ -131,7 +131,7 @@ Point Flag::GetStemDownNW(const Doc *doc, int staffSize, bool graceSize) const
 
 TupletBracket::TupletBracket() : LayerElement(TUPLET_BRACKET, "bracket-"), AttTupletVis()
 {
-    this->RegisterAttClass(ATT_TUPLETVIS);
+    this->RegisterAttClass<AttTupletVis>(ATT_TUPLETVIS, this);
 
     this->Reset();
 }
@@ -208,8 +208,8 @@ int TupletBracket::GetDrawingYRight() const
 
 TupletNum::TupletNum() : LayerElement(TUPLET_NUM, "num-"), AttNumberPlacement(), AttTupletVis()
 {
-    this->RegisterAttClass(ATT_NUMBERPLACEMENT);
-    this->RegisterAttClass(ATT_TUPLETVIS);
+    this->RegisterAttClass<AttNumberPlacement>(ATT_NUMBERPLACEMENT, this);
+    this->RegisterAttClass<AttTupletVis>(ATT_TUPLETVIS, this);
 
     this->Reset();
 }
@@ -31,8 +31,8 @@ static const ClassRegistrar<Ending> s_factory("ending", ENDING);
 
 Ending::Ending() : SystemElement(ENDING, "ending-"), SystemMilestoneInterface(), AttLineRend(), AttNNumberLike()
 {
-    this->RegisterAttClass(ATT_LINEREND);
-    this->RegisterAttClass(ATT_NINTEGER);
+    this->RegisterAttClass<AttLineRend>(ATT_LINEREND, this);
+    this->RegisterAttClass<AttNNumberLike>(ATT_NNUMBERLIKE, this);
 
     this->Reset();
 }
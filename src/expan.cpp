@@ -25,7 +25,7 @@ static const ClassRegistrar<Expan> s_factory("expan", EXPAN);
 
 Expan::Expan() : EditorialElement(EXPAN, "expan-"), AttSource()
 {
-    this->RegisterAttClass(ATT_SOURCE);
+    this->RegisterAttClass<AttSource>(ATT_SOURCE, this);
 
     this->Reset();
 }
@@ -25,7 +25,7 @@ static const ClassRegistrar<Expansion> s_factory("expansion", EXPANSION);
 
 Expansion::Expansion() : SystemElement(EXPANSION, "expansion-"), PlistInterface()
 {
-    this->RegisterInterface(PlistInterface::GetAttClasses(), PlistInterface::IsInterface());
+    this->RegisterInterface<PlistInterface>(this);
 
     this->Reset();
 }
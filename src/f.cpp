@@ -28,8 +28,8 @@ static const ClassRegistrar<F> s_factory("f", FIGURE);
 
 F::F() : TextElement(FIGURE, "f-"), TimeSpanningInterface(), AttExtender()
 {
-    this->RegisterInterface(TimeSpanningInterface::GetAttClasses(), TimeSpanningInterface::IsInterface());
-    this->RegisterAttClass(ATT_EXTENDER);
+    this->RegisterInterface<TimeSpanningInterface>(this);
+    this->RegisterAttClass<AttExtender>(ATT_EXTENDER, this);
 
     this->Reset();
 }
@@ -25,7 +25,7 @@ namespace vrv {
 
 FacsimileInterface::FacsimileInterface() : Interface(), AttFacsimile()
 {
-    this->RegisterInterfaceAttClass(ATT_FACSIMILE);
+    this->RegisterInterfaceAttClass<AttFacsimile>(ATT_FACSIMILE, this);
     this->Reset();
 }
 
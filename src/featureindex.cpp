@@ -0,0 +1,476 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        featureindex.cpp
+// Author:      Laurent Pugin
+// Created:     2023
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "featureindex.h"
+
+//----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <sstream>
+#include <utility>
+
+//----------------------------------------------------------------------------
+
+#include "featureextractor.h"
+#include "vrv.h"
+
+//----------------------------------------------------------------------------
+
+#include "jsonxx.h"
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// Helpers for the file format
+//----------------------------------------------------------------------------
+
+static void WriteVarint(std::string &output, uint64_t value)
+{
+    while (value >= 0x80) {
+        output.push_back((char)((value & 0x7F) | 0x80));
+        value >>= 7;
+    }
+    output.push_back((char)value);
+}
+
+static bool ReadVarint(const std::string &input, size_t &position, uint64_t &value)
+{
+    value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+        if (position >= input.size()) return false;
+        const unsigned char byte = input.at(position++);
+        value |= (uint64_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80)) return true;
+    }
+    return false;
+}
+
+static void WriteBytes(std::string &output, const std::string &bytes)
+{
+    WriteVarint(output, bytes.size());
+    output += bytes;
+}
+
+static bool ReadBytes(const std::string &input, size_t &position, std::string &bytes)
+{
+    uint64_t size;
+    if (!ReadVarint(input, position, size) || (size > input.size() - position)) return false;
+    bytes = input.substr(position, size);
+    position += size;
+    return true;
+}
+
+// The refined contour as a value from -2 to 2
+static bool ContourToValue(const std::string &contour, int &value)
+{
+    static const std::map<std::string, int> values = { { "D", -2 }, { "d", -1 }, { "s", 0 }, { "u", 1 }, { "U", 2 } };
+    auto iter = values.find(contour);
+    if (iter == values.end()) return false;
+    value = iter->second;
+    return true;
+}
+
+//----------------------------------------------------------------------------
+// FeatureIndex
+//----------------------------------------------------------------------------
+
+FeatureIndex::FeatureIndex()
+{
+    m_ngramLength = 4;
+
+    this->Reset();
+}
+
+void FeatureIndex::Reset()
+{
+    m_documents.clear();
+    for (int feature = 0; feature < FEATURE_COUNT; ++feature) {
+        m_keys[feature].clear();
+        m_offsets[feature].clear();
+        m_postings[feature].clear();
+    }
+}
+
+void FeatureIndex::SetNgramLength(int ngramLength)
+{
+    m_ngramLength = std::min(8, std::max(2, ngramLength));
+    this->Reset();
+}
+
+void FeatureIndex::FillDocument(Document &document, const FeatureExtractor &extractor)
+{
+    document.m_pitchIds.clear();
+    for (size_t i = 0; i < extractor.m_pitchesIds.size(); ++i) {
+        const jsonxx::Array &ids = extractor.m_pitchesIds.get<jsonxx::Array>((unsigned int)i);
+        std::string pitchIds;
+        for (size_t j = 0; j < ids.size(); ++j) {
+            if (j > 0) pitchIds += " ";
+            pitchIds += ids.get<jsonxx::String>((unsigned int)j);
+        }
+        document.m_pitchIds.push_back(pitchIds);
+    }
+
+    const jsonxx::Array *intervals[FEATURE_COUNT]
+        = { &extractor.m_intervalsChromatic, &extractor.m_intervalsDiatonic, &extractor.m_intervalRefinedContour };
+    for (int feature = 0; feature < FEATURE_COUNT; ++feature) {
+        std::vector<uint8_t> &values = document.m_values[feature];
+        values.clear();
+        values.reserve(intervals[feature]->size());
+        for (size_t i = 0; i < intervals[feature]->size(); ++i) {
+            const std::string &interval = intervals[feature]->get<jsonxx::String>((unsigned int)i);
+            int value = 0;
+            if (feature == REFINED_CONTOUR) {
+                ContourToValue(interval, value);
+            }
+            else {
+                value = atoi(interval.c_str());
+            }
+            values.push_back(ToKeyValue(value));
+        }
+    }
+}
+
+void FeatureIndex::AddDocuments(std::vector<Document> &documents)
+{
+    m_documents.reserve(m_documents.size() + documents.size());
+    for (Document &document : documents) {
+        m_documents.push_back(std::move(document));
+    }
+    documents.clear();
+
+    this->BuildPostings();
+}
+
+uint8_t FeatureIndex::ToKeyValue(int value)
+{
+    return (uint8_t)(std::min(127, std::max(-127, value)) + 128);
+}
+
+uint64_t FeatureIndex::GetKey(const std::vector<uint8_t> &values, int position) const
+{
+    uint64_t key = 0;
+    for (int i = position; i < position + m_ngramLength; ++i) {
+        key = (key << 8) | ((i < (int)values.size()) ? values.at(i) : 0);
+    }
+    return key;
+}
+
+void FeatureIndex::BuildPostings()
+{
+    for (int feature = 0; feature < FEATURE_COUNT; ++feature) {
+        size_t count = 0;
+        for (const Document &document : m_documents) count += document.m_values[feature].size();
+
+        // The entries are created in the order of the documents and of the positions, which the sort preserves
+        std::vector<std::pair<uint64_t, Posting>> entries;
+        entries.reserve(count);
+        for (uint32_t i = 0; i < (uint32_t)m_documents.size(); ++i) {
+            const std::vector<uint8_t> &values = m_documents.at(i).m_values[feature];
+            for (uint32_t position = 0; position < (uint32_t)values.size(); ++position) {
+                entries.push_back({ this->GetKey(values, position), { i, position } });
+            }
+        }
+        std::stable_sort(entries.begin(), entries.end(),
+            [](const std::pair<uint64_t, Posting> &a, const std::pair<uint64_t, Posting> &b) {
+                return (a.first < b.first);
+            });
+
+        m_keys[feature].clear();
+        m_offsets[feature].clear();
+        m_postings[feature].clear();
+        m_postings[feature].reserve(count);
+        for (const auto &[key, posting] : entries) {
+            if (m_keys[feature].empty() || (m_keys[feature].back() != key)) {
+                m_keys[feature].push_back(key);
+                m_offsets[feature].push_back((uint32_t)m_postings[feature].size());
+            }
+            m_postings[feature].push_back(posting);
+        }
+        m_offsets[feature].push_back((uint32_t)m_postings[feature].size());
+    }
+}
+
+bool FeatureIndex::Write(const std::string &filename) const
+{
+    std::string payload;
+    for (const Document &document : m_documents) {
+        WriteBytes(payload, document.m_id);
+        WriteVarint(payload, document.m_pitchIds.size());
+        for (const std::string &pitchIds : document.m_pitchIds) WriteBytes(payload, pitchIds);
+        for (int feature = 0; feature < FEATURE_COUNT; ++feature) {
+            const std::vector<uint8_t> &values = document.m_values[feature];
+            WriteBytes(payload, std::string(values.begin(), values.end()));
+        }
+    }
+    // The keys and the documents are delta-encoded
+    for (int feature = 0; feature < FEATURE_COUNT; ++feature) {
+        WriteVarint(payload, m_keys[feature].size());
+        uint64_t previousKey = 0;
+        for (size_t i = 0; i < m_keys[feature].size(); ++i) {
+            WriteVarint(payload, m_keys[feature].at(i) - previousKey);
+            previousKey = m_keys[feature].at(i);
+            const uint32_t first = m_offsets[feature].at(i);
+            const uint32_t last = m_offsets[feature].at(i + 1);
+            WriteVarint(payload, last - first);
+            uint32_t previousDocument = 0;
+            for (uint32_t j = first; j < last; ++j) {
+                const Posting &posting = m_postings[feature].at(j);
+                WriteVarint(payload, posting.m_document - previousDocument);
+                WriteVarint(payload, posting.m_position);
+                previousDocument = posting.m_document;
+            }
+        }
+    }
+
+    std::ofstream file(filename.c_str(), std::ios::out | std::ios::binary);
+    if (!file.is_open()) {
+        LogError("Feature index file '%s' cannot be written", filename.c_str());
+        return false;
+    }
+    file << "verovio-feature-index " << FORMAT_VERSION << " " << m_ngramLength << " " << m_documents.size() << " "
+         << payload.size() << "\n";
+    file.write(payload.data(), payload.size());
+    file.close();
+    if (!file) {
+        LogError("Feature index file '%s' cannot be written", filename.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+bool FeatureIndex::Read(const std::string &filename)
+{
+    this->Reset();
+
+    std::ifstream file(filename.c_str(), std::ios::in | std::ios::binary);
+    if (!file.is_open()) {
+        LogError("Feature index file '%s' cannot be opened", filename.c_str());
+        return false;
+    }
+
+    std::string header;
+    std::getline(file, header);
+    std::istringstream headerStream(header);
+    std::string magic;
+    int version = 0;
+    int ngramLength = 0;
+    size_t documentCount = 0;
+    size_t payloadSize = 0;
+    headerStream >> magic >> version >> ngramLength >> documentCount >> payloadSize;
+    const std::string payload((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if ((magic != "verovio-feature-index") || (version != FORMAT_VERSION) || (ngramLength < 2) || (ngramLength > 8)
+        || (payload.size() != payloadSize)) {
+        LogError("Feature index file '%s' is not valid", filename.c_str());
+        return false;
+    }
+    // Each document takes at least one byte of the payload
+    if (documentCount > payload.size()) {
+        LogError("Feature index file '%s' is corrupted", filename.c_str());
+        return false;
+    }
+    m_ngramLength = ngramLength;
+
+    size_t position = 0;
+    bool valid = true;
+    uint64_t value;
+    m_documents.resize(documentCount);
+    for (Document &document : m_documents) {
+        valid = valid && ReadBytes(payload, position, document.m_id) && ReadVarint(payload, position, value)
+            && (value <= payload.size() - position);
+        if (!valid) break;
+        document.m_pitchIds.resize(value);
+        for (std::string &pitchIds : document.m_pitchIds) valid = valid && ReadBytes(payload, position, pitchIds);
+        for (int feature = 0; valid && (feature < FEATURE_COUNT); ++feature) {
+            std::string values;
+            valid = ReadBytes(payload, position, values);
+            document.m_values[feature].assign(values.begin(), values.end());
+        }
+    }
+    for (int feature = 0; valid && (feature < FEATURE_COUNT); ++feature) {
+        valid = ReadVarint(payload, position, value) && (value <= payload.size() - position);
+        if (!valid) break;
+        const size_t keyCount = value;
+        m_keys[feature].reserve(keyCount);
+        m_offsets[feature].reserve(keyCount + 1);
+        uint64_t key = 0;
+        for (size_t i = 0; valid && (i < keyCount); ++i) {
+            uint64_t postingCount;
+            valid = ReadVarint(payload, position, value) && ReadVarint(payload, position, postingCount)
+                && (postingCount <= payload.size() - position);
+            if (!valid) break;
+            key += value;
+            m_keys[feature].push_back(key);
+            m_offsets[feature].push_back((uint32_t)m_postings[feature].size());
+            uint64_t document = 0;
+            for (uint64_t j = 0; j < postingCount; ++j) {
+                uint64_t documentDelta;
+                valid = ReadVarint(payload, position, documentDelta) && ReadVarint(payload, position, value);
+                document += documentDelta;
+                // The positions are checked when matching but the documents need to be valid
+                valid = valid && (document < documentCount);
+                if (!valid) break;
+                m_postings[feature].push_back({ (uint32_t)document, (uint32_t)value });
+            }
+        }
+        m_offsets[feature].push_back((uint32_t)m_postings[feature].size());
+    }
+
+    if (!valid || (position != payload.size())) {
+        LogError("Feature index file '%s' is corrupted", filename.c_str());
+        this->Reset();
+        return false;
+    }
+
+    return true;
+}
+
+void FeatureIndex::FindPostings(
+    Feature feature, uint64_t first, uint64_t last, int offset, std::vector<Posting> &postings) const
+{
+    const std::vector<uint64_t> &keys = m_keys[feature];
+    for (auto iter = std::lower_bound(keys.begin(), keys.end(), first); (iter != keys.end()) && (*iter <= last);
+         ++iter) {
+        const size_t i = iter - keys.begin();
+        for (uint32_t j = m_offsets[feature].at(i); j < m_offsets[feature].at(i + 1); ++j) {
+            const Posting &posting = m_postings[feature].at(j);
+            if ((int)posting.m_position < offset) continue;
+            postings.push_back({ posting.m_document, posting.m_position - offset });
+        }
+    }
+}
+
+bool FeatureIndex::Matches(Feature feature, const std::vector<uint8_t> &pattern, const Posting &posting) const
+{
+    const std::vector<uint8_t> &values = m_documents.at(posting.m_document).m_values[feature];
+    if (posting.m_position + pattern.size() > values.size()) return false;
+    return std::equal(pattern.begin(), pattern.end(), values.begin() + posting.m_position);
+}
+
+std::string FeatureIndex::Query(const std::string &jsonQuery) const
+{
+    jsonxx::Object json;
+    if (!json.parse(jsonQuery)) {
+        LogError("Cannot parse JSON std::string.");
+        return "{}";
+    }
+
+    static const std::map<std::string, Feature> features = { { "intervalsChromatic", INTERVALS_CHROMATIC },
+        { "intervalsDiatonic", INTERVALS_DIATONIC }, { "intervalRefinedContour", REFINED_CONTOUR } };
+
+    // Read the pattern, the contour being given as an array or as a string (e.g., "uuD")
+    Feature feature = FEATURE_COUNT;
+    std::vector<uint8_t> pattern;
+    for (const auto &[name, patternFeature] : features) {
+        if (!json.has<jsonxx::Array>(name) && !json.has<jsonxx::String>(name)) continue;
+        feature = patternFeature;
+        std::vector<std::string> items;
+        if (json.has<jsonxx::String>(name)) {
+            for (const char c : json.get<jsonxx::String>(name)) items.push_back(std::string(1, c));
+        }
+        else {
+            const jsonxx::Array &array = json.get<jsonxx::Array>(name);
+            for (size_t i = 0; i < array.size(); ++i) {
+                if (array.has<jsonxx::Number>((unsigned int)i)) {
+                    items.push_back(StringFormat("%d", (int)array.get<jsonxx::Number>((unsigned int)i)));
+                }
+                else if (array.has<jsonxx::String>((unsigned int)i)) {
+                    items.push_back(array.get<jsonxx::String>((unsigned int)i));
+                }
+            }
+        }
+        for (const std::string &item : items) {
+            int value = 0;
+            if (feature != REFINED_CONTOUR) {
+                value = atoi(item.c_str());
+            }
+            else if (!ContourToValue(item, value)) {
+                LogWarning("Unsupported contour value '%s' in the query", item.c_str());
+                return "{}";
+            }
+            pattern.push_back(ToKeyValue(value));
+        }
+        break;
+    }
+    if (pattern.empty()) {
+        LogWarning("The query has no pattern");
+        return "{}";
+    }
+    const int limit = json.has<jsonxx::Number>("limit") ? (int)json.get<jsonxx::Number>("limit") : 100;
+
+    std::vector<Posting> postings;
+    const int length = (int)pattern.size();
+    if (length < m_ngramLength) {
+        // Patterns shorter than the n-grams are found by prefix, the padding never matching a value
+        uint64_t prefix = 0;
+        for (uint8_t value : pattern) prefix = (prefix << 8) | value;
+        const int shift = 8 * (m_ngramLength - length);
+        const uint64_t first = prefix << shift;
+        this->FindPostings(feature, first, first | ((1ULL << shift) - 1), 0, postings);
+    }
+    else {
+        // Look up the n-gram of the pattern with the fewest postings and check the whole pattern
+        const std::vector<uint64_t> &keys = m_keys[feature];
+        int offset = 0;
+        size_t minCount = 0;
+        for (int i = 0; i <= length - m_ngramLength; ++i) {
+            const uint64_t key = this->GetKey(pattern, i);
+            auto iter = std::lower_bound(keys.begin(), keys.end(), key);
+            size_t count = 0;
+            if ((iter != keys.end()) && (*iter == key)) {
+                const size_t k = iter - keys.begin();
+                count = m_offsets[feature].at(k + 1) - m_offsets[feature].at(k);
+            }
+            if ((i == 0) || (count < minCount)) {
+                minCount = count;
+                offset = i;
+            }
+            if (count == 0) break;
+        }
+        const uint64_t key = this->GetKey(pattern, offset);
+        this->FindPostings(feature, key, key, offset, postings);
+        postings.erase(std::remove_if(postings.begin(), postings.end(),
+                           [this, feature, &pattern](const Posting &posting) {
+                               return !this->Matches(feature, pattern, posting);
+                           }),
+            postings.end());
+    }
+    std::sort(postings.begin(), postings.end(), [](const Posting &a, const Posting &b) {
+        return (a.m_document != b.m_document) ? (a.m_document < b.m_document) : (a.m_position < b.m_position);
+    });
+
+    jsonxx::Array matches;
+    for (const Posting &posting : postings) {
+        if ((limit > 0) && ((int)matches.size() >= limit)) break;
+        const Document &document = m_documents.at(posting.m_document);
+        // The notes of the pitches covered by the intervals
+        jsonxx::Array ids;
+        const int end = std::min((int)posting.m_position + length + 1, (int)document.m_pitchIds.size());
+        for (int i = posting.m_position; i < end; ++i) {
+            std::istringstream pitchIds(document.m_pitchIds.at(i));
+            std::string id;
+            while (pitchIds >> id) ids << id;
+        }
+        jsonxx::Object match;
+        match << "document" << document.m_id;
+        match << "position" << (int)posting.m_position;
+        match << "ids" << ids;
+        matches << match;
+    }
+
+    jsonxx::Object output;
+    output << "count" << (int)postings.size();
+    output << "matches" << matches;
+    return output.json();
+}
+
+} // namespace vrv
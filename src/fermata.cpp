@@ -34,12 +34,12 @@ Fermata::Fermata()
     , AttFermataVis()
     , AttPlacementRelStaff()
 {
-    this->RegisterInterface(TimePointInterface::GetAttClasses(), TimePointInterface::IsInterface());
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_ENCLOSINGCHARS);
-    this->RegisterAttClass(ATT_EXTSYM);
-    this->RegisterAttClass(ATT_FERMATAVIS);
-    this->RegisterAttClass(ATT_PLACEMENTRELSTAFF);
+    this->RegisterInterface<TimePointInterface>(this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttEnclosingChars>(ATT_ENCLOSINGCHARS, this);
+    this->RegisterAttClass<AttExtSym>(ATT_EXTSYM, this);
+    this->RegisterAttClass<AttFermataVis>(ATT_FERMATAVIS, this);
+    this->RegisterAttClass<AttPlacementRelStaff>(ATT_PLACEMENTRELSTAFF, this);
 
     this->Reset();
 }
@@ -27,7 +27,7 @@ static const ClassRegistrar<Fig> s_factory("fig", FIG);
 
 Fig::Fig() : TextElement(FIG, "fig-"), AreaPosInterface()
 {
-    this->RegisterInterface(AreaPosInterface::GetAttClasses(), AreaPosInterface::IsInterface());
+    this->RegisterInterface<AreaPosInterface>(this);
 
     this->Reset();
 }
@@ -158,7 +158,7 @@ FunctorCode FindByIDFunctor::VisitObject(const Object *object)
         return FUNCTOR_STOP;
     }
 
-    if (m_id == object->GetID()) {
+    if (object->HasID(m_id)) {
         m_element = object;
         return FUNCTOR_STOP;
     }
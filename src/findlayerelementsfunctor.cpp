@@ -9,9 +9,15 @@
 
 //----------------------------------------------------------------------------
 
+#include <algorithm>
+
+//----------------------------------------------------------------------------
+
 #include "layer.h"
 #include "layerelement.h"
+#include "measure.h"
 #include "staff.h"
+#include "timeinterface.h"
 
 namespace vrv {
 
@@ -243,6 +249,165 @@ FunctorCode FindSpannedLayerElementsFunctor::VisitMeasure(const Measure *measure
     return FUNCTOR_CONTINUE;
 }
 
+//----------------------------------------------------------------------------
+// LayerElementIndex
+//----------------------------------------------------------------------------
+
+LayerElementIndex::LayerElementIndex()
+{
+    m_count = 0;
+}
+
+void LayerElementIndex::AddMeasure(const Measure *measure)
+{
+    m_measureIndices[measure] = (int)m_measures.size();
+    m_measures.push_back(measure);
+}
+
+void LayerElementIndex::AddLayerElement(const LayerElement *layerElement)
+{
+    Entry entry;
+    entry.m_element = layerElement;
+    entry.m_order = m_count++;
+    // Elements outside a measure are always considered
+    entry.m_measureIdx = -1;
+    if (!m_measures.empty() && (layerElement->GetFirstAncestor(MEASURE) == m_measures.back())) {
+        entry.m_measureIdx = (int)m_measures.size() - 1;
+    }
+    const bool hasBB = (layerElement->HasContentBB() && !layerElement->HasEmptyBB());
+    entry.m_left = (hasBB) ? layerElement->GetContentLeft() : 0;
+    entry.m_right = (hasBB) ? layerElement->GetContentRight() : 0;
+
+    // The element is indexed for its staff and its cross staff
+    std::set<int> staffNs;
+    const Staff *staff = vrv_cast<const Staff *>(layerElement->GetFirstAncestor(STAFF));
+    staffNs.insert((staff) ? staff->GetN() : VRV_UNSET);
+    const Layer *layer = NULL;
+    const Staff *crossStaff = layerElement->GetCrossStaff(layer);
+    if (crossStaff) staffNs.insert(crossStaff->GetN());
+
+    for (int staffN : staffNs) {
+        StaffEntries &staffEntries = m_staves[staffN];
+        if (hasBB) {
+            staffEntries.m_entries.push_back(entry);
+            staffEntries.m_maxWidth = std::max(staffEntries.m_maxWidth, entry.m_right - entry.m_left);
+        }
+        else {
+            staffEntries.m_unbounded.push_back(entry);
+        }
+    }
+}
+
+void LayerElementIndex::Sort()
+{
+    for (auto &[staffN, staffEntries] : m_staves) {
+        std::stable_sort(staffEntries.m_entries.begin(), staffEntries.m_entries.end(),
+            [](const Entry &entry1, const Entry &entry2) { return (entry1.m_left < entry2.m_left); });
+    }
+}
+
+void LayerElementIndex::Process(FindSpannedLayerElementsFunctor &findSpannedLayerElements) const
+{
+    // The measures to consider are the ones from the start to the end measure of the spanning element.
+    // This is what FindSpannedLayerElementsFunctor::VisitMeasure does, without ordering each measure.
+    const TimeSpanningInterface *interface = findSpannedLayerElements.GetInterface();
+    assert(interface);
+    int firstMeasureIdx = 0;
+    int lastMeasureIdx = (int)m_measures.size() - 1;
+    if (!m_measures.empty()) {
+        const Measure *startMeasure = interface->GetStartMeasure();
+        auto iter = m_measureIndices.find(startMeasure);
+        if (iter != m_measureIndices.end()) {
+            firstMeasureIdx = iter->second;
+        }
+        else if (Object::IsPreOrdered(m_measures.back(), startMeasure)) {
+            firstMeasureIdx = (int)m_measures.size();
+        }
+        const Measure *endMeasure = interface->GetEndMeasure();
+        iter = m_measureIndices.find(endMeasure);
+        if (iter != m_measureIndices.end()) {
+            lastMeasureIdx = iter->second;
+        }
+        else if (Object::IsPreOrdered(endMeasure, m_measures.front())) {
+            lastMeasureIdx = -1;
+        }
+    }
+
+    const int minPos = findSpannedLayerElements.GetMinPos();
+    const int maxPos = findSpannedLayerElements.GetMaxPos();
+    std::vector<const Entry *> entries;
+    const std::set<int> &staffNs = findSpannedLayerElements.GetStaffNs();
+    if (staffNs.empty()) {
+        for (const auto &[staffN, staffEntries] : m_staves) {
+            this->CollectEntries(staffEntries, minPos, maxPos, firstMeasureIdx, lastMeasureIdx, entries);
+        }
+    }
+    else {
+        for (int staffN : staffNs) {
+            auto staffIter = m_staves.find(staffN);
+            if (staffIter != m_staves.end()) {
+                this->CollectEntries(staffIter->second, minPos, maxPos, firstMeasureIdx, lastMeasureIdx, entries);
+            }
+        }
+    }
+
+    // Keep the order of the tree and remove the cross-staff duplicates
+    std::sort(entries.begin(), entries.end(),
+        [](const Entry *entry1, const Entry *entry2) { return (entry1->m_order < entry2->m_order); });
+    entries.erase(std::unique(entries.begin(), entries.end(),
+                      [](const Entry *entry1, const Entry *entry2) { return (entry1->m_order == entry2->m_order); }),
+        entries.end());
+
+    for (const Entry *entry : entries) {
+        findSpannedLayerElements.VisitLayerElement(entry->m_element);
+    }
+}
+
+void LayerElementIndex::CollectEntries(const StaffEntries &staffEntries, int minPos, int maxPos,
+    int firstMeasureIdx, int lastMeasureIdx, std::vector<const Entry *> &entries) const
+{
+    auto inRange = [firstMeasureIdx, lastMeasureIdx](const Entry &entry) {
+        return ((entry.m_measureIdx == -1)
+            || ((entry.m_measureIdx >= firstMeasureIdx) && (entry.m_measureIdx <= lastMeasureIdx)));
+    };
+
+    // Elements starting before minPos - maxWidth cannot reach minPos
+    auto first = std::upper_bound(staffEntries.m_entries.begin(), staffEntries.m_entries.end(),
+        minPos - staffEntries.m_maxWidth, [](int pos, const Entry &entry) { return (pos < entry.m_left); });
+    for (auto iter = first; (iter != staffEntries.m_entries.end()) && (iter->m_left < maxPos); ++iter) {
+        if (inRange(*iter)) entries.push_back(&(*iter));
+    }
+    // Elements without bounding box when indexed are checked by the functor
+    for (const Entry &entry : staffEntries.m_unbounded) {
+        if (inRange(entry)) entries.push_back(&entry);
+    }
+}
+
+//----------------------------------------------------------------------------
+// IndexLayerElementsFunctor
+//----------------------------------------------------------------------------
+
+IndexLayerElementsFunctor::IndexLayerElementsFunctor(LayerElementIndex *index) : ConstFunctor()
+{
+    m_index = index;
+}
+
+FunctorCode IndexLayerElementsFunctor::VisitLayerElement(const LayerElement *layerElement)
+{
+    if (layerElement->IsScoreDefElement()) return FUNCTOR_SIBLINGS;
+
+    m_index->AddLayerElement(layerElement);
+
+    return FUNCTOR_CONTINUE;
+}
+
+FunctorCode IndexLayerElementsFunctor::VisitMeasure(const Measure *measure)
+{
+    m_index->AddMeasure(measure);
+
+    return FUNCTOR_CONTINUE;
+}
+
 //----------------------------------------------------------------------------
 // GetRelativeLayerElementFunctor
 //----------------------------------------------------------------------------
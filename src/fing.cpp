@@ -27,9 +27,9 @@ static const ClassRegistrar<Fing> s_factory("fing", FING);
 
 Fing::Fing() : ControlElement(FING, "fing-"), TimePointInterface(), TextDirInterface(), AttNNumberLike()
 {
-    this->RegisterInterface(TimePointInterface::GetAttClasses(), TimePointInterface::IsInterface());
-    this->RegisterInterface(TextDirInterface::GetAttClasses(), TextDirInterface::IsInterface());
-    this->RegisterAttClass(ATT_NNUMBERLIKE);
+    this->RegisterInterface<TimePointInterface>(this);
+    this->RegisterInterface<TextDirInterface>(this);
+    this->RegisterAttClass<AttNNumberLike>(ATT_NNUMBERLIKE, this);
 
     this->Reset();
 }
@@ -36,8 +36,8 @@ static const ClassRegistrar<FTrem> s_factory("fTrem", FTREM);
 
 FTrem::FTrem() : LayerElement(FTREM, "ftrem-"), BeamDrawingInterface(), AttFTremVis(), AttTremMeasured()
 {
-    this->RegisterAttClass(ATT_FTREMVIS);
-    this->RegisterAttClass(ATT_TREMMEASURED);
+    this->RegisterAttClass<AttFTremVis>(ATT_FTREMVIS, this);
+    this->RegisterAttClass<AttTremMeasured>(ATT_TREMMEASURED, this);
 
     this->Reset();
 }
@@ -34,11 +34,11 @@ Gliss::Gliss()
     , AttLineRendBase()
     , AttNNumberLike()
 {
-    this->RegisterInterface(TimeSpanningInterface::GetAttClasses(), TimeSpanningInterface::IsInterface());
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_LINEREND);
-    this->RegisterAttClass(ATT_LINERENDBASE);
-    this->RegisterAttClass(ATT_NNUMBERLIKE);
+    this->RegisterInterface<TimeSpanningInterface>(this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttLineRend>(ATT_LINEREND, this);
+    this->RegisterAttClass<AttLineRendBase>(ATT_LINERENDBASE, this);
+    this->RegisterAttClass<AttNNumberLike>(ATT_NNUMBERLIKE, this);
 
     this->Reset();
 }
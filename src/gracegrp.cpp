@@ -36,9 +36,9 @@ static const ClassRegistrar<GraceGrp> s_factory("graceGrp", GRACEGRP);
 
 GraceGrp::GraceGrp() : LayerElement(GRACEGRP, "gracegrp-"), AttColor(), AttGraced(), AttGraceGrpLog()
 {
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_GRACED);
-    this->RegisterAttClass(ATT_GRACEGRPLOG);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttGraced>(ATT_GRACED, this);
+    this->RegisterAttClass<AttGraceGrpLog>(ATT_GRACEGRPLOG, this);
 
     this->Reset();
 }
@@ -26,10 +26,10 @@ static const ClassRegistrar<Graphic> s_factory("graphic", GRAPHIC);
 
 Graphic::Graphic() : Object(GRAPHIC, "graphic-"), AttPointing(), AttWidth(), AttHeight(), AttTyped()
 {
-    this->RegisterAttClass(ATT_POINTING);
-    this->RegisterAttClass(ATT_WIDTH);
-    this->RegisterAttClass(ATT_HEIGHT);
-    this->RegisterAttClass(ATT_TYPED);
+    this->RegisterAttClass<AttPointing>(ATT_POINTING, this);
+    this->RegisterAttClass<AttWidth>(ATT_WIDTH, this);
+    this->RegisterAttClass<AttHeight>(ATT_HEIGHT, this);
+    this->RegisterAttClass<AttTyped>(ATT_TYPED, this);
     this->Reset();
 }
 
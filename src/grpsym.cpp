@@ -29,11 +29,11 @@ static const ClassRegistrar<GrpSym> s_factory("grpSym", GRPSYM);
 GrpSym::GrpSym()
     : Object(GRPSYM, "grpsym-"), AttColor(), AttGrpSymLog(), AttStaffGroupingSym(), AttStartId(), AttStartEndId()
 {
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_GRPSYMLOG);
-    this->RegisterAttClass(ATT_STAFFGROUPINGSYM);
-    this->RegisterAttClass(ATT_STARTID);
-    this->RegisterAttClass(ATT_STARTENDID);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttGrpSymLog>(ATT_GRPSYMLOG, this);
+    this->RegisterAttClass<AttStaffGroupingSym>(ATT_STAFFGROUPINGSYM, this);
+    this->RegisterAttClass<AttStartId>(ATT_STARTID, this);
+    this->RegisterAttClass<AttStartEndId>(ATT_STARTENDID, this);
 
     this->Reset();
 }
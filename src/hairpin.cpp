@@ -40,13 +40,13 @@ Hairpin::Hairpin()
     , AttPlacementRelStaff()
     , AttVerticalGroup()
 {
-    this->RegisterInterface(TimeSpanningInterface::GetAttClasses(), TimeSpanningInterface::IsInterface());
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_HAIRPINLOG);
-    this->RegisterAttClass(ATT_HAIRPINVIS);
-    this->RegisterAttClass(ATT_LINERENDBASE);
-    this->RegisterAttClass(ATT_PLACEMENTRELSTAFF);
-    this->RegisterAttClass(ATT_VERTICALGROUP);
+    this->RegisterInterface<TimeSpanningInterface>(this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttHairpinLog>(ATT_HAIRPINLOG, this);
+    this->RegisterAttClass<AttHairpinVis>(ATT_HAIRPINVIS, this);
+    this->RegisterAttClass<AttLineRendBase>(ATT_LINERENDBASE, this);
+    this->RegisterAttClass<AttPlacementRelStaff>(ATT_PLACEMENTRELSTAFF, this);
+    this->RegisterAttClass<AttVerticalGroup>(ATT_VERTICALGROUP, this);
 
     this->Reset();
 }
@@ -32,7 +32,7 @@ static const ClassRegistrar<HalfmRpt> s_factory("halfmRpt", HALFMRPT);
 
 HalfmRpt::HalfmRpt() : LayerElement(HALFMRPT, "mrpt-")
 {
-    this->RegisterAttClass(ATT_COLOR);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
 
     this->Reset();
 }
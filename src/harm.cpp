@@ -40,10 +40,10 @@ Harm::Harm()
     , AttLang()
     , AttNNumberLike()
 {
-    this->RegisterInterface(TextDirInterface::GetAttClasses(), TextDirInterface::IsInterface());
-    this->RegisterInterface(TimeSpanningInterface::GetAttClasses(), TimeSpanningInterface::IsInterface());
-    this->RegisterAttClass(ATT_LANG);
-    this->RegisterAttClass(ATT_NNUMBERLIKE);
+    this->RegisterInterface<TextDirInterface>(this);
+    this->RegisterInterface<TimeSpanningInterface>(this);
+    this->RegisterAttClass<AttLang>(ATT_LANG, this);
+    this->RegisterAttClass<AttNNumberLike>(ATT_NNUMBERLIKE, this);
 
     this->Reset();
 }
@@ -783,7 +783,7 @@ FunctorCode Alignment::AcceptEnd(ConstFunctor &functor) const
 
 AlignmentReference::AlignmentReference() : Object(ALIGNMENT_REFERENCE), AttNInteger()
 {
-    this->RegisterAttClass(ATT_NINTEGER);
+    this->RegisterAttClass<AttNInteger>(ATT_NINTEGER, this);
 
     this->Reset();
 
@@ -792,7 +792,7 @@ AlignmentReference::AlignmentReference() : Object(ALIGNMENT_REFERENCE), AttNInte
 
 AlignmentReference::AlignmentReference(int staffN) : Object(ALIGNMENT_REFERENCE), AttNInteger()
 {
-    this->RegisterAttClass(ATT_NINTEGER);
+    this->RegisterAttClass<AttNInteger>(ATT_NINTEGER, this);
 
     this->Reset();
 
@@ -28,10 +28,10 @@ static const ClassRegistrar<InstrDef> s_factory("instrDef", INSTRDEF);
 InstrDef::InstrDef()
     : Object(INSTRDEF, "instrdef-"), AttChannelized(), AttLabelled(), AttMidiInstrument(), AttNNumberLike()
 {
-    this->RegisterAttClass(ATT_CHANNELIZED);
-    this->RegisterAttClass(ATT_LABELLED);
-    this->RegisterAttClass(ATT_MIDIINSTRUMENT);
-    this->RegisterAttClass(ATT_NNUMBERLIKE);
+    this->RegisterAttClass<AttChannelized>(ATT_CHANNELIZED, this);
+    this->RegisterAttClass<AttLabelled>(ATT_LABELLED, this);
+    this->RegisterAttClass<AttMidiInstrument>(ATT_MIDIINSTRUMENT, this);
+    this->RegisterAttClass<AttNNumberLike>(ATT_NNUMBERLIKE, this);
 
     this->Reset();
 }
@@ -59,23 +59,188 @@
 
 //----------------------------------------------------------------------------
 
+#include "jsonxx.h"
+
+//----------------------------------------------------------------------------
+
 #ifndef NO_ABC_SUPPORT
 #endif /* NO_ABC_SUPPORT */
 
 namespace vrv {
 
+//----------------------------------------------------------------------------
+// ABCCollection
+//----------------------------------------------------------------------------
+
+void ABCCollection::Reset()
+{
+    m_data.clear();
+    m_headerLength = 0;
+    m_tunes.clear();
+    m_referenceNumbers.clear();
+}
+
+bool ABCCollection::Load(const std::string &data, const std::string &jsonIndex)
+{
+    this->Reset();
+    m_data = data;
+
+    if (jsonIndex.empty() || !this->ReadIndex(jsonIndex)) {
+        if (!jsonIndex.empty()) LogWarning("ABC collection: the index does not match the data and is rebuilt");
+        this->BuildIndex();
+    }
+
+    for (int i = 0; i < (int)m_tunes.size(); ++i) {
+        m_referenceNumbers.emplace(m_tunes.at(i).m_referenceNumber, i);
+    }
+
+    if (m_tunes.empty()) {
+        LogError("ABC collection: no tune found in the data");
+        return false;
+    }
+    return true;
+}
+
+void ABCCollection::BuildIndex()
+{
+    m_headerLength = m_data.size();
+    m_tunes.clear();
+
+    ABCTuneInfo *tune = NULL;
+    bool inBody = false;
+    size_t lineStart = 0;
+    while (lineStart < m_data.size()) {
+        size_t lineEnd = m_data.find('\n', lineStart);
+        if (lineEnd == std::string::npos) lineEnd = m_data.size();
+        const char *line = m_data.data() + lineStart;
+        const size_t lineLength = lineEnd - lineStart;
+        // Information fields have a letter followed by a colon
+        if ((lineLength >= 2) && (line[1] == ':')) {
+            auto fieldValue = [line, lineLength]() {
+                std::string value(line + 2, lineLength - 2);
+                const size_t first = value.find_first_not_of(" \t");
+                if (first == std::string::npos) return std::string();
+                const size_t last = value.find_last_not_of(" \t\r");
+                return value.substr(first, last - first + 1);
+            };
+            if (line[0] == 'X') {
+                if (tune) {
+                    tune->m_length = lineStart - tune->m_offset;
+                }
+                else {
+                    m_headerLength = lineStart;
+                }
+                tune = &m_tunes.emplace_back();
+                tune->m_offset = lineStart;
+                tune->m_referenceNumber = atoi(fieldValue().c_str());
+                inBody = false;
+            }
+            else if (tune && !inBody) {
+                if ((line[0] == 'T') && tune->m_title.empty()) {
+                    tune->m_title = fieldValue();
+                }
+                else if (line[0] == 'K') {
+                    // The K: field ends the tune header
+                    tune->m_key = fieldValue();
+                    inBody = true;
+                }
+            }
+        }
+        lineStart = lineEnd + 1;
+    }
+    if (tune) {
+        tune->m_length = m_data.size() - tune->m_offset;
+    }
+}
+
+bool ABCCollection::ReadIndex(const std::string &jsonIndex)
+{
+    jsonxx::Object json;
+    if (!json.parse(jsonIndex)) return false;
+    if (!json.has<jsonxx::Number>("size") || !json.has<jsonxx::Number>("headerLength")
+        || !json.has<jsonxx::Array>("tunes")) {
+        return false;
+    }
+    if ((size_t)json.get<jsonxx::Number>("size") != m_data.size()) return false;
+    m_headerLength = (size_t)json.get<jsonxx::Number>("headerLength");
+    if (m_headerLength > m_data.size()) return false;
+
+    const jsonxx::Array &tunes = json.get<jsonxx::Array>("tunes");
+    for (int i = 0; i < (int)tunes.size(); ++i) {
+        if (!tunes.has<jsonxx::Object>(i)) return false;
+        const jsonxx::Object &entry = tunes.get<jsonxx::Object>(i);
+        if (!entry.has<jsonxx::Number>("offset") || !entry.has<jsonxx::Number>("length")) return false;
+        ABCTuneInfo tune;
+        tune.m_offset = (size_t)entry.get<jsonxx::Number>("offset");
+        tune.m_length = (size_t)entry.get<jsonxx::Number>("length");
+        // Make sure the tune is within the data and that it starts with the X: field
+        if ((tune.m_offset + tune.m_length > m_data.size()) || (m_data.compare(tune.m_offset, 2, "X:") != 0)) {
+            m_tunes.clear();
+            return false;
+        }
+        tune.m_referenceNumber = (int)entry.get<jsonxx::Number>("n", 0);
+        tune.m_title = entry.get<jsonxx::String>("title", "");
+        tune.m_key = entry.get<jsonxx::String>("key", "");
+        m_tunes.push_back(tune);
+    }
+    return true;
+}
+
+std::string ABCCollection::GetIndexAsJson() const
+{
+    jsonxx::Object json;
+    jsonxx::Array tunes;
+    for (const ABCTuneInfo &tune : m_tunes) {
+        jsonxx::Object entry;
+        entry << "n" << tune.m_referenceNumber;
+        entry << "title" << tune.m_title;
+        entry << "key" << tune.m_key;
+        entry << "offset" << (double)tune.m_offset;
+        entry << "length" << (double)tune.m_length;
+        tunes << entry;
+    }
+    json << "size" << (double)m_data.size();
+    json << "headerLength" << (double)m_headerLength;
+    json << "tunes" << tunes;
+    return json.json();
+}
+
+const ABCTuneInfo *ABCCollection::GetTune(int index) const
+{
+    if ((index < 0) || (index >= (int)m_tunes.size())) return NULL;
+    return &m_tunes.at(index);
+}
+
+int ABCCollection::GetTuneIndex(int referenceNumber) const
+{
+    auto it = m_referenceNumbers.find(referenceNumber);
+    return (it != m_referenceNumbers.end()) ? it->second : -1;
+}
+
+std::string ABCCollection::GetTuneData(int index) const
+{
+    const ABCTuneInfo *tune = this->GetTune(index);
+    if (!tune) return "";
+
+    std::string data;
+    data.reserve(m_headerLength + tune->m_length + 1);
+    data.append(m_data, 0, m_headerLength);
+    data.append(m_data, tune->m_offset, tune->m_length);
+    return data;
+}
+
 #ifndef NO_ABC_SUPPORT
 
-// Global variables:
-std::string abcLine;
+// Global variables (thread_local for tunes being imported in parallel):
+thread_local std::string abcLine;
 #define MAX_DATA_LEN 1024 // One line of the abc file would not be that long!
-char dataKey[MAX_DATA_LEN];
-char dataValue[MAX_DATA_LEN]; // ditto as above
+thread_local char dataKey[MAX_DATA_LEN];
+thread_local char dataValue[MAX_DATA_LEN]; // ditto as above
 
 const std::string pitch = "FCGDAEB";
 const std::string shorthandDecoration = ".~HLMOPSTuv";
-std::string keyPitchAlter = "";
-int keyPitchAlterAmount = 0;
+thread_local std::string keyPitchAlter = "";
+thread_local int keyPitchAlterAmount = 0;
 
 //----------------------------------------------------------------------------
 // ABCInput
@@ -19253,7 +19253,8 @@ void HumdrumInput::addSystemClefKeyTimeChange(int startline, int endline)
             // should not happen
             continue;
         }
-        setTransposition(staves[i], *transposetok[i]);
+        // Only *ITrd changes are collected, for which the data is at sounding pitch
+        setDynamicTransposition(i, staves[i], *transposetok[i]);
     }
 }
 
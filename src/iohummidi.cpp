@@ -0,0 +1,279 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        iohummidi.cpp
+// Author:      Laurent Pugin
+// Created:     2023
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "iohummidi.h"
+
+//----------------------------------------------------------------------------
+
+#include <cassert>
+#include <cctype>
+#include <cstdio>
+
+//----------------------------------------------------------------------------
+
+#include "vrv.h"
+#include "vrvdef.h"
+
+//----------------------------------------------------------------------------
+
+#include "MidiFile.h"
+
+namespace vrv {
+
+#ifndef NO_HUMDRUM_SUPPORT
+
+//----------------------------------------------------------------------------
+// HumdrumMIDIConverter
+//----------------------------------------------------------------------------
+
+HumdrumMIDIConverter::HumdrumMIDIConverter()
+{
+    m_midiFile = NULL;
+}
+
+HumdrumMIDIConverter::~HumdrumMIDIConverter() {}
+
+bool HumdrumMIDIConverter::Convert(const std::string &humdrumData, smf::MidiFile *midiFile)
+{
+    assert(midiFile);
+
+    m_midiFile = midiFile;
+    m_transSemi.clear();
+    m_tiedNotes.clear();
+
+    hum::HumdrumFile infile;
+    if (!infile.readString(humdrumData)) {
+        LogError("The Humdrum data could not be parsed");
+        return false;
+    }
+
+    // Staves are numbered from the top, i.e., from the last **kern spine
+    std::vector<hum::HTp> kernStarts = infile.getKernSpineStartList();
+    std::map<int, int> midiTracks;
+    for (int i = 0; i < (int)kernStarts.size(); ++i) {
+        midiTracks[kernStarts.at(i)->getTrack()] = (int)kernStarts.size() - i;
+    }
+    if (kernStarts.empty()) {
+        LogWarning("No **kern spine to convert to MIDI");
+        return false;
+    }
+
+    // track 0 is reserved for meta messages common to all tracks
+    if (m_midiFile->getTrackCount() < (int)kernStarts.size() + 1) {
+        m_midiFile->addTracks((int)kernStarts.size() + 1 - m_midiFile->getTrackCount());
+    }
+
+    double currentTempo = this->GetInitialTempo(infile, kernStarts.back());
+    m_midiFile->addTempo(0, 0, currentTempo);
+
+    for (auto it = kernStarts.rbegin(); it != kernStarts.rend(); ++it) {
+        this->ConvertStaffInfo(*it, midiTracks.at((*it)->getTrack()));
+    }
+
+    const int tpq = m_midiFile->getTPQ();
+    for (int i = 0; i < infile.getLineCount(); ++i) {
+        hum::HumdrumLine &line = infile[i];
+        if (line.isInterpretation()) {
+            // Tempo changes
+            for (int j = 0; j < line.getFieldCount(); ++j) {
+                hum::HTp token = line.token(j);
+                if (!token->isKern() || (token->compare(0, 3, "*MM") != 0)) continue;
+                if ((token->size() < 4) || !std::isdigit((*token)[3])) continue;
+                const double tempo = std::stoi(token->substr(3));
+                if (tempo != currentTempo) {
+                    currentTempo = tempo;
+                    m_midiFile->addTempo(0, token->getDurationFromStart().getFloat() * tpq, currentTempo);
+                }
+                break;
+            }
+        }
+        else if (line.isData()) {
+            for (int j = 0; j < line.getFieldCount(); ++j) {
+                hum::HTp token = line.token(j);
+                if (!token->isKern() || token->isNull()) continue;
+                this->ConvertDataToken(token, midiTracks.at(token->getTrack()));
+            }
+        }
+    }
+
+    this->FlushTiedNotes();
+
+    return true;
+}
+
+double HumdrumMIDIConverter::GetInitialTempo(hum::HumdrumFile &infile, hum::HTp spineStart)
+{
+    int top = 4;
+    int bot = 4;
+    for (hum::HTp token = spineStart; token && !token->isData(); token = token->getNextToken()) {
+        if (!token->isInterpretation()) continue;
+        if (token->compare(0, 3, "*MM") == 0) {
+            if ((token->size() > 3) && std::isdigit((*token)[3])) {
+                return std::stoi(token->substr(3));
+            }
+            break;
+        }
+        if (token->isTimeSignature()) {
+            if (sscanf(token->c_str(), "*M%d/%d", &top, &bot) != 2) {
+                top = 4;
+                bot = 4;
+            }
+        }
+    }
+
+    // Guess the tempo from the last OMD before the data
+    hum::HTp omd = NULL;
+    for (int i = 0; i < infile.getLineCount(); ++i) {
+        if (infile[i].isData()) break;
+        if (infile[i].isReference() && (infile[i].getReferenceKey() == "OMD")) {
+            omd = infile.token(i, 0);
+        }
+    }
+    if (omd) {
+        const int guess = hum::Convert::tempoNameToMm(*omd, bot, top);
+        if (guess > 0) return guess;
+    }
+
+    // Slow rhythms are given a basic Renaissance tempo
+    double sum = 0.0;
+    int count = 0;
+    for (int i = 0; i < infile.getLineCount(); ++i) {
+        if (infile[i].getDuration() == 0) continue;
+        ++count;
+        sum += infile[i].getDuration().getFloat();
+    }
+    if ((count > 0) && (sum / count > 2.0)) return 400.0;
+
+    return MIDI_TEMPO;
+}
+
+void HumdrumMIDIConverter::ConvertStaffInfo(hum::HTp spineStart, int midiTrack)
+{
+    const int midiChannel = 0;
+    m_transSemi[midiTrack] = 0;
+
+    std::string trackName;
+    hum::HTp instrumentCode = NULL;
+    hum::HTp keySig = NULL;
+    hum::HTp keyDesignation = NULL;
+    hum::HTp meterSig = NULL;
+    hum::HTp instrumentTranspose = NULL;
+    for (hum::HTp token = spineStart; token && !token->isData(); token = token->getNextToken()) {
+        if (!token->isInterpretation()) continue;
+        if (token->isInstrumentName()) {
+            if (trackName.empty()) trackName = token->getInstrumentName();
+        }
+        else if ((token->compare(0, 2, "*I") == 0) && (token->size() > 2) && std::islower((*token)[2])) {
+            if (!instrumentCode) instrumentCode = token;
+        }
+        else if (token->isKeySignature()) {
+            if (!keySig) keySig = token;
+        }
+        else if (token->isKeyDesignation()) {
+            if (!keyDesignation) keyDesignation = token;
+        }
+        else if (token->isTimeSignature()) {
+            if (!meterSig) meterSig = token;
+        }
+        else if (token->compare(0, 4, "*Trd") == 0) {
+            int diatonic = 0;
+            int chromatic = 0;
+            if (sscanf(token->c_str(), "*Trd%dc%d", &diatonic, &chromatic) == 2) {
+                m_transSemi[midiTrack] = -chromatic;
+            }
+        }
+        else if (token->compare(0, 5, "*ITrd") == 0) {
+            if (!instrumentTranspose) instrumentTranspose = token;
+        }
+    }
+
+    if (instrumentCode) {
+        static thread_local hum::HumInstrument imap;
+        const int gmpc = imap.getGM(*instrumentCode);
+        if (gmpc >= 0) m_midiFile->addPatchChange(midiTrack, 0, midiChannel, gmpc);
+    }
+    if (!trackName.empty()) {
+        m_midiFile->addTrackName(midiTrack, 0, trackName);
+    }
+    if (keySig) {
+        int fifths = 0;
+        for (char c : *keySig) {
+            if (c == '#') ++fifths;
+            if (c == '-') --fifths;
+        }
+        // With *ITrd the data is at sounding pitch but the key signature is the written one (as in HumdrumInput)
+        if (instrumentTranspose) {
+            fifths += hum::Convert::base40IntervalToLineOfFifths(hum::Convert::transToBase40(*instrumentTranspose));
+        }
+        const bool minor = (keyDesignation && (keyDesignation->size() > 1) && std::islower((*keyDesignation)[1]));
+        m_midiFile->addKeySignature(midiTrack, 0, fifths, minor);
+    }
+    if (meterSig) {
+        int count = 0;
+        int unit = 0;
+        if ((sscanf(meterSig->c_str(), "*M%d/%d", &count, &unit) == 2) && (count > 0) && (unit > 0)) {
+            m_midiFile->addTimeSignature(midiTrack, 0, count, unit);
+        }
+    }
+}
+
+void HumdrumMIDIConverter::ConvertDataToken(hum::HTp token, int midiTrack)
+{
+    const int midiChannel = 0;
+    const int tpq = m_midiFile->getTPQ();
+    const double startTime = token->getDurationFromStart().getFloat();
+
+    const int count = token->getSubtokenCount();
+    for (int i = 0; i < count; ++i) {
+        const std::string subtoken = token->getSubtoken(i);
+        // Rests, grace notes and spine placeholders
+        if ((subtoken.find('r') != std::string::npos) || (subtoken.find('q') != std::string::npos)
+            || (subtoken.find('Q') != std::string::npos) || (subtoken.find_first_of("abcdefgABCDEFG") == std::string::npos)) {
+            continue;
+        }
+        const int pitch = hum::Convert::kernToMidiNoteNumber(subtoken) + m_transSemi[midiTrack];
+        if ((pitch < 0) || (pitch > 127)) continue;
+
+        const double stopTime = startTime + hum::Convert::recipToDuration(subtoken).getFloat();
+        const bool tieStart = (subtoken.find('[') != std::string::npos);
+        const bool tieContinue = (subtoken.find('_') != std::string::npos);
+        const bool tieEnd = (subtoken.find(']') != std::string::npos);
+
+        const std::pair<int, int> key = { midiTrack, pitch };
+        auto tied = m_tiedNotes.find(key);
+        if ((tieContinue || tieEnd) && (tied != m_tiedNotes.end())) {
+            tied->second.m_stopTime = stopTime;
+            if (tieEnd) {
+                m_midiFile->addNoteOn(midiTrack, tied->second.m_startTime * tpq, midiChannel, pitch, MIDI_VELOCITY);
+                m_midiFile->addNoteOff(midiTrack, tied->second.m_stopTime * tpq, midiChannel, pitch);
+                m_tiedNotes.erase(tied);
+            }
+            continue;
+        }
+        if (tieStart || tieContinue) {
+            m_tiedNotes[key] = { startTime, stopTime };
+            continue;
+        }
+        m_midiFile->addNoteOn(midiTrack, startTime * tpq, midiChannel, pitch, MIDI_VELOCITY);
+        m_midiFile->addNoteOff(midiTrack, stopTime * tpq, midiChannel, pitch);
+    }
+}
+
+void HumdrumMIDIConverter::FlushTiedNotes()
+{
+    const int midiChannel = 0;
+    const int tpq = m_midiFile->getTPQ();
+    for (const auto &[key, tied] : m_tiedNotes) {
+        m_midiFile->addNoteOn(key.first, tied.m_startTime * tpq, midiChannel, key.second, MIDI_VELOCITY);
+        m_midiFile->addNoteOff(key.first, tied.m_stopTime * tpq, midiChannel, key.second);
+    }
+    m_tiedNotes.clear();
+}
+
+#endif /* NO_HUMDRUM_SUPPORT */
+
+} // namespace vrv
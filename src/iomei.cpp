@@ -11,6 +11,7 @@
 
 #include <cassert>
 #include <iostream>
+#include <string_view>
 
 //----------------------------------------------------------------------------
 
@@ -107,6 +108,7 @@
 #include "phrase.h"
 #include "pitchinflection.h"
 #include "plica.h"
+#include "profiler.h"
 #include "proport.h"
 #include "rdg.h"
 #include "ref.h"
@@ -155,6 +157,8 @@ namespace vrv {
 const std::vector<std::string> MEIInput::s_editorialElementNames = { "abbr", "add", "app", "annot", "choice", "corr",
     "damage", "del", "expan", "orig", "ref", "reg", "restore", "sic", "subst", "supplied", "unclear" };
 
+const std::string MEIInput::s_measureChunkName = "verovioMeasureChunk";
+
 //----------------------------------------------------------------------------
 // MEIOutput
 //----------------------------------------------------------------------------
@@ -175,6 +179,7 @@ MEIOutput::~MEIOutput() {}
 
 bool MEIOutput::Export()
 {
+    ProfilerEvent event(PROFILER_EXPORT, "MEIOutput::Export");
 
     if (m_removeIds) {
         FindAllReferencedObjectsFunctor findAllReferencedObjects(&m_referredObjects);
@@ -3285,26 +3290,190 @@ MEIInput::MEIInput(Doc *doc) : Input(doc)
     m_hasScoreDef = false;
     m_readingScoreBased = false;
     m_meiversion = meiVersion_MEIVERSION_NONE;
+    m_streamedData = NULL;
 }
 
 MEIInput::~MEIInput() {}
 
 bool MEIInput::Import(const std::string &mei)
+{
+    return this->ImportData(mei, NULL);
+}
+
+bool MEIInput::ImportInPlace(std::string &mei)
+{
+    return this->ImportData(mei, &mei);
+}
+
+bool MEIInput::ImportData(const std::string &mei, std::string *inPlaceData)
 {
     try {
         m_doc->Reset();
         m_doc->SetType(Raw);
+        m_streamedData = NULL;
         pugi::xml_document doc;
-        doc.load_string(mei.c_str(), (pugi::parse_comments | pugi::parse_default) & ~pugi::parse_eol);
+        const unsigned int parseOptions = (pugi::parse_comments | pugi::parse_default) & ~pugi::parse_eol;
+        // The XPath queries can select any part of the content and need the full parse
+        const Options *options = m_doc->GetOptions();
+        const bool hasXPathQuery = (!options->m_appXPathQuery.GetValue().empty()
+            || !options->m_choiceXPathQuery.GetValue().empty() || !options->m_mdivXPathQuery.GetValue().empty()
+            || !options->m_substXPathQuery.GetValue().empty());
+        if (options->m_streamingImport.GetValue() && hasXPathQuery) {
+            LogInfo("The streaming import is not used with XPath queries");
+        }
+        else if (options->m_streamingImport.GetValue()) {
+            // Only the skeleton is parsed here and the measures are parsed one by one when they are read
+            std::string skeleton;
+            if (this->ExtractMeasureChunks(mei, skeleton)) {
+                m_streamedData = &mei;
+                doc.load_string(skeleton.c_str(), parseOptions);
+            }
+        }
+        if (!m_streamedData && inPlaceData) {
+            // The parser uses the buffer for the tree instead of copying it
+            doc.load_buffer_inplace(inPlaceData->data(), inPlaceData->size(), parseOptions, pugi::encoding_utf8);
+        }
+        else if (!m_streamedData) {
+            doc.load_string(mei.c_str(), parseOptions);
+        }
         pugi::xml_node root = doc.first_child();
-        return this->ReadDoc(root);
+        const bool success = this->ReadDoc(root);
+        m_streamedData = NULL;
+        return success;
     }
     catch (char *str) {
         LogError("%s", str);
+        m_streamedData = NULL;
         return false;
     }
 }
 
+bool MEIInput::ExtractMeasureChunks(const std::string &mei, std::string &skeleton)
+{
+    enum { MARKUP_START, MARKUP_END, MARKUP_EMPTY, MARKUP_OTHER };
+
+    // Return the position after the markup starting at pos, with the kind of markup and the element name
+    auto scanMarkup = [&mei](size_t pos, int &kind, std::string_view &name) -> size_t {
+        kind = MARKUP_OTHER;
+        if (mei.compare(pos, 4, "<!--") == 0) {
+            const size_t end = mei.find("-->", pos + 4);
+            return (end == std::string::npos) ? end : end + 3;
+        }
+        if (mei.compare(pos, 9, "<![CDATA[") == 0) {
+            const size_t end = mei.find("]]>", pos + 9);
+            return (end == std::string::npos) ? end : end + 3;
+        }
+        if (mei.compare(pos, 2, "<?") == 0) {
+            const size_t end = mei.find("?>", pos + 2);
+            return (end == std::string::npos) ? end : end + 2;
+        }
+        if (mei.compare(pos, 2, "<!") == 0) {
+            // A doctype, possibly with an internal subset
+            const size_t end = mei.find_first_of("[>", pos + 2);
+            if ((end == std::string::npos) || (mei.at(end) == '>')) {
+                return (end == std::string::npos) ? end : end + 1;
+            }
+            const size_t subsetEnd = mei.find("]>", end);
+            return (subsetEnd == std::string::npos) ? subsetEnd : subsetEnd + 2;
+        }
+        const bool isEnd = (mei.compare(pos, 2, "</") == 0);
+        const size_t nameStart = pos + (isEnd ? 2 : 1);
+        const size_t nameEnd = mei.find_first_of(" \t\r\n/>", nameStart);
+        if (nameEnd == std::string::npos) return nameEnd;
+        name = std::string_view(mei).substr(nameStart, nameEnd - nameStart);
+        // Skip the attributes, which can have '>' in their values
+        char quote = 0;
+        size_t i = nameEnd;
+        for (; i < mei.size(); ++i) {
+            const char c = mei[i];
+            if (quote) {
+                if (c == quote) quote = 0;
+            }
+            else if ((c == '"') || (c == '\'')) {
+                quote = c;
+            }
+            else if (c == '>') {
+                break;
+            }
+        }
+        if (i == mei.size()) return std::string::npos;
+        kind = (isEnd) ? MARKUP_END : ((mei[i - 1] == '/') ? MARKUP_EMPTY : MARKUP_START);
+        return i + 1;
+    };
+
+    skeleton.clear();
+    // The position up to which the data has been copied to the skeleton
+    size_t copied = 0;
+    int depth = 0;
+    // The depth of the <music> element, -1 outside of it - <measure> elements in the header (incipits) are kept
+    int musicDepth = -1;
+    int chunkCount = 0;
+    int kind;
+    std::string_view name;
+    size_t pos = mei.find('<');
+    while (pos != std::string::npos) {
+        size_t end = scanMarkup(pos, kind, name);
+        if (end == std::string::npos) return false;
+        if (kind == MARKUP_START) {
+            // Page-based MEI is not supported
+            if (name == "pages") return false;
+            if ((name == "music") && (musicDepth == -1)) musicDepth = depth;
+            if ((name == "measure") && (musicDepth != -1)) {
+                // Look for the end of the measure
+                int measureDepth = 1;
+                while (measureDepth > 0) {
+                    end = mei.find('<', end);
+                    if (end == std::string::npos) return false;
+                    end = scanMarkup(end, kind, name);
+                    if (end == std::string::npos) return false;
+                    if (kind == MARKUP_START) ++measureDepth;
+                    if (kind == MARKUP_END) --measureDepth;
+                }
+                skeleton.append(mei, copied, pos - copied);
+                skeleton += StringFormat(
+                    "<%s offset=\"%zu\" length=\"%zu\"/>", s_measureChunkName.c_str(), pos, end - pos);
+                copied = end;
+                ++chunkCount;
+            }
+            else {
+                ++depth;
+            }
+        }
+        else if (kind == MARKUP_END) {
+            --depth;
+            if (depth == musicDepth) musicDepth = -1;
+        }
+        pos = mei.find('<', end);
+    }
+    skeleton.append(mei, copied, std::string::npos);
+
+    return (chunkCount > 0);
+}
+
+bool MEIInput::ReadMeasureChunk(Object *parent, pugi::xml_node chunk)
+{
+    assert(m_streamedData);
+
+    const size_t offset = chunk.attribute("offset").as_ullong();
+    const size_t length = chunk.attribute("length").as_ullong();
+    if (offset + length > m_streamedData->size()) {
+        LogError("The measure chunk at offset %zu is out of range", offset);
+        return false;
+    }
+
+    // The document of the measure is freed when the measure has been read
+    pugi::xml_document measureDoc;
+    pugi::xml_parse_result result = measureDoc.load_buffer(m_streamedData->data() + offset, length,
+        (pugi::parse_comments | pugi::parse_default) & ~pugi::parse_eol, pugi::encoding_utf8);
+    if (!result) {
+        LogError("The measure at offset %zu cannot be parsed: %s", offset, result.description());
+        return false;
+    }
+    pugi::xml_node measure = measureDoc.first_child();
+    this->NormalizeAttributes(measure);
+    return this->ReadMeasure(parent, measure);
+}
+
 bool MEIInput::IsAllowed(std::string element, Object *filterParent)
 {
     if (!filterParent || (element == "")) {
@@ -4354,6 +4523,10 @@ bool MEIInput::ReadSectionChildren(Object *parent, pugi::xml_node parentNode)
             //}
             success = this->ReadMeasure(parent, current);
         }
+        else if (m_streamedData && (current.name() == s_measureChunkName)) {
+            assert(!unmeasured);
+            success = this->ReadMeasureChunk(parent, current);
+        }
         // xml comment
         else if (std::string(current.name()) == "") {
             success = this->ReadXMLComment(parent, current);
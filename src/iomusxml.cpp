@@ -135,6 +135,23 @@ bool MusicXmlInput::Import(const std::string &musicxml)
     }
 }
 
+bool MusicXmlInput::ImportInPlace(std::string &musicxml)
+{
+    try {
+        m_doc->Reset();
+        m_doc->SetType(Raw);
+        pugi::xml_document xmlDoc;
+        // The parser uses the buffer for the tree instead of copying it
+        xmlDoc.load_buffer_inplace(musicxml.data(), musicxml.size(), pugi::parse_default, pugi::encoding_utf8);
+        pugi::xml_node root = xmlDoc.first_child();
+        return ReadMusicXml(root);
+    }
+    catch (char *str) {
+        LogError("%s", str);
+        return false;
+    }
+}
+
 //////////////////////////////////////////////////////////////////////////////
 // XML helpers
 
@@ -36,6 +36,7 @@
 #include "mrest.h"
 #include "multirest.h"
 #include "note.h"
+#include "profiler.h"
 #include "rest.h"
 #include "score.h"
 #include "scoredef.h"
@@ -63,6 +64,8 @@ PAEOutput::~PAEOutput() {}
 
 bool PAEOutput::Export(std::string &output)
 {
+    ProfilerEvent event(PROFILER_EXPORT, "PAEOutput::Export");
+
     m_docScoreDef = true;
     m_mensural = false;
     m_skip = false;
@@ -2436,6 +2439,7 @@ namespace pae {
 PAEInput::PAEInput(Doc *doc) : Input(doc)
 {
     m_scoreBased = false;
+    m_validationOnly = false;
 }
 
 PAEInput::~PAEInput()
@@ -2588,7 +2592,7 @@ bool PAEInput::Was(pae::Token &token, const std::string &map)
 bool PAEInput::HasInput(char inputChar)
 {
     auto it = std::find_if(
-        m_pae.begin(), m_pae.end(), [inputChar](pae::Token token) { return (token.m_inputChar == inputChar); });
+        m_pae.begin(), m_pae.end(), [inputChar](const pae::Token &token) { return (token.m_inputChar == inputChar); });
     return (it != m_pae.end());
 }
 
@@ -2618,7 +2622,7 @@ void PAEInput::AddToken(char c, int &position)
     }
 }
 
-void PAEInput::PrepareInsertion(int position, std::list<pae::Token> &insertion)
+void PAEInput::PrepareInsertion(int position, std::vector<pae::Token> &insertion)
 {
     for (pae::Token &token : insertion) {
         token.m_position = position;
@@ -2777,11 +2781,13 @@ bool PAEInput::Import(const std::string &input)
     m_doc->SetType(Raw);
 
     // Genereate the header and add a comment to the project description
-    m_doc->GenerateMEIHeader(false);
-    pugi::xml_node projectDesc = m_doc->m_header.first_child().select_node("//projectDesc").node();
-    if (projectDesc) {
-        pugi::xml_node p1 = projectDesc.append_child("p");
-        p1.text().set("Converted from Plaine and Easie to MEI");
+    if (!m_validationOnly) {
+        m_doc->GenerateMEIHeader(false);
+        pugi::xml_node projectDesc = m_doc->m_header.first_child().select_node("//projectDesc").node();
+        if (projectDesc) {
+            pugi::xml_node p1 = projectDesc.append_child("p");
+            p1.text().set("Converted from Plaine and Easie to MEI");
+        }
     }
 
     bool success = true;
@@ -3127,7 +3133,7 @@ bool PAEInput::Parse()
     // We should have no object left, just in case they need to be delete.
     this->ClearTokenObjects();
 
-    if (!m_scoreBased) m_doc->ConvertToPageBasedDoc();
+    if (!m_scoreBased && !m_validationOnly) m_doc->ConvertToPageBasedDoc();
 
     return success;
 }
@@ -3396,11 +3402,11 @@ bool PAEInput::ConvertRepeatedFigure()
     // A status flag indicating that we are in figure of in a repetition of a figure
     pae::status_FIGURE status = pae::FIGURE_NONE;
     // The figure that will be repeated and to which we copy tokens
-    std::list<pae::Token> figure;
+    std::vector<pae::Token> figure;
     // A pointer to the beginning of the figure (for debugging purposes)
     pae::Token *figureToken = NULL;
 
-    std::list<pae::Token>::iterator token = m_pae.begin();
+    std::vector<pae::Token>::iterator token = m_pae.begin();
     while (token != m_pae.end()) {
         if (token->IsVoid()) {
             ++token;
@@ -3445,11 +3451,10 @@ bool PAEInput::ConvertRepeatedFigure()
                 token->m_char = 0;
                 // Set position and clone objects
                 PrepareInsertion(token->m_position, figure);
-                // Move to the next token because we insert before it
-                ++token;
-                m_pae.insert(token, figure.begin(), figure.end());
-                // Move back to the previous token (now the end of the figure)
-                --token;
+                // Insert after the current token and move to the end of the figure
+                const int index = (int)std::distance(m_pae.begin(), token) + (int)figure.size();
+                m_pae.insert(std::next(token), figure.begin(), figure.end());
+                token = m_pae.begin() + index;
                 status = pae::FIGURE_REPEAT;
             }
             // End of repetitions - this includes the end of a measure
@@ -3489,11 +3494,11 @@ bool PAEInput::ConvertRepeatedMeasure()
     if (!this->HasInput('i')) return true;
 
     // The measure that will be repeated and to which we copy tokens
-    std::list<pae::Token> measure;
+    std::vector<pae::Token> measure;
     bool measureStart = false;
     bool repeat = false;
 
-    std::list<pae::Token>::iterator token = m_pae.begin();
+    std::vector<pae::Token>::iterator token = m_pae.begin();
     while (token != m_pae.end()) {
         if (token->IsVoid()) {
             ++token;
@@ -3517,11 +3522,10 @@ bool PAEInput::ConvertRepeatedMeasure()
             else {
                 // Set position and clone objects
                 PrepareInsertion(token->m_position, measure);
-                // Move to the next token because we insert before it
-                ++token;
-                m_pae.insert(token, measure.begin(), measure.end());
-                // Move back to the previous token (now the end of the measure)
-                --token;
+                // Insert after the current token and move to the end of the measure
+                const int index = (int)std::distance(m_pae.begin(), token) + (int)measure.size();
+                m_pae.insert(std::next(token), measure.begin(), measure.end());
+                token = m_pae.begin() + index;
                 repeat = true;
             }
         }
@@ -3827,10 +3831,10 @@ bool PAEInput::ConvertChord()
 
     // A flag for the chord status NONE|MARKER|NOTE
     pae::status_CHORD status = pae::CHORD_NONE;
-    // The iterator of the last note that can become the first note of a chord
-    std::list<pae::Token>::iterator note = m_pae.end();
+    // The index of the last note that can become the first note of a chord (-1 if none)
+    int note = -1;
 
-    std::list<pae::Token>::iterator token = m_pae.begin();
+    std::vector<pae::Token>::iterator token = m_pae.begin();
     while (token != m_pae.end()) {
         if (token->IsVoid()) {
             ++token;
@@ -3840,7 +3844,7 @@ bool PAEInput::ConvertChord()
         // We encounter a chord marker - change the status if we have a note previously
         if (token->m_char == '^') {
             token->m_char = 0;
-            if (note == m_pae.end()) {
+            if (note == -1) {
                 LogPAE(ERR_020_CHORD_NOTE_BEFORE, *token);
                 if (m_pedanticMode) return false;
             }
@@ -3862,7 +3866,7 @@ bool PAEInput::ConvertChord()
                 LogPAE(ERR_021_CHORD_NOTE_AFTER, *token);
                 if (m_pedanticMode) return false;
                 status = pae::CHORD_NONE;
-                note = m_pae.end();
+                note = -1;
             }
             ++token;
             continue;
@@ -3871,21 +3875,24 @@ bool PAEInput::ConvertChord()
         // We passed the last note of the chord - create it
         if (status == pae::CHORD_NOTE) {
             Chord *chord = new Chord();
-            m_pae.insert(note, pae::Token(0, pae::UNKOWN_POS, chord));
-            m_pae.insert(token, pae::Token(pae::CONTAINER_END, pae::UNKOWN_POS, chord));
+            // Inserting before the note moves the current token by one
+            const int index = (int)std::distance(m_pae.begin(), token) + 1;
+            m_pae.insert(m_pae.begin() + note, pae::Token(0, pae::UNKOWN_POS, chord));
+            token = m_pae.begin() + index;
+            token = std::next(m_pae.insert(token, pae::Token(pae::CONTAINER_END, pae::UNKOWN_POS, chord)));
         }
 
         status = pae::CHORD_NONE;
         if (token->Is(NOTE)) {
-            note = token;
+            note = (int)std::distance(m_pae.begin(), token);
         }
         // Previous token was already a note - we allow fermata or trill on the first note of a chord
-        else if (note != m_pae.end() && ((token->m_char == 0 && token->m_inputChar == ')') || token->Is(TRILL))) {
+        else if (note != -1 && ((token->m_char == 0 && token->m_inputChar == ')') || token->Is(TRILL))) {
             ++token;
             continue;
         }
         else {
-            note = m_pae.end();
+            note = -1;
         }
 
         ++token;
@@ -3901,7 +3908,7 @@ bool PAEInput::ConvertBeam()
     bool withinGrace = false;
 
     // Here we need an iterator because we might have to add a missing closing tag
-    std::list<pae::Token>::iterator token = m_pae.begin();
+    std::vector<pae::Token>::iterator token = m_pae.begin();
     while (token != m_pae.end()) {
         if (token->IsVoid()) {
             ++token;
@@ -4024,7 +4031,7 @@ bool PAEInput::ConvertGraceGrp()
     GraceGrp *graceGrp = NULL;
 
     // Here we need an iterator because we might have to add a missing closing tag
-    std::list<pae::Token>::iterator token = m_pae.begin();
+    std::vector<pae::Token>::iterator token = m_pae.begin();
     while (token != m_pae.end()) {
         if (token->IsVoid()) {
             ++token;
@@ -4146,7 +4153,7 @@ bool PAEInput::ConvertTuplet()
     };
 
     // Here we need an iterator because we might have to add a missing closing tag
-    std::list<pae::Token>::iterator token = m_pae.begin();
+    std::vector<pae::Token>::iterator token = m_pae.begin();
     while (token != m_pae.end()) {
         if (token->IsVoid()) {
             ++token;
@@ -4236,7 +4243,7 @@ bool PAEInput::ConvertDuration()
     bool isChord = false;
 
     // Here we need an iterator because we might have to add a mensural dots
-    std::list<pae::Token>::iterator token = m_pae.begin();
+    std::vector<pae::Token>::iterator token = m_pae.begin();
     while (token != m_pae.end()) {
         if (token->IsVoid()) {
             ++token;
@@ -4402,12 +4409,12 @@ bool PAEInput::ConvertLigature()
 
     // A flag for the ligature status NONE|MARKER|NOTE
     pae::status_LIGATURE status = pae::LIGATURE_NONE;
-    // The iterator of the last note that can become the first note of a ligature
-    std::list<pae::Token>::iterator note = m_pae.end();
+    // The index of the last note that can become the first note of a ligature (-1 if none)
+    int note = -1;
     // The previous ligature note for checking that is it not of the same pitch
     Note *previousNote = NULL;
 
-    std::list<pae::Token>::iterator token = m_pae.begin();
+    std::vector<pae::Token>::iterator token = m_pae.begin();
     while (token != m_pae.end()) {
         if (token->IsVoid()) {
             ++token;
@@ -4417,7 +4424,7 @@ bool PAEInput::ConvertLigature()
         // We encounter a ligature marker - change the status if we have a note previously
         if (token->m_char == '+') {
             token->m_char = 0;
-            if (note == m_pae.end()) {
+            if (note == -1) {
                 LogPAE(ERR_061_LIGATURE_NOTE_BEFORE, *token);
                 if (m_pedanticMode) return false;
             }
@@ -4443,7 +4450,7 @@ bool PAEInput::ConvertLigature()
                     LogPAE(ERR_063_LIGATURE_PITCH, *token);
                     if (m_pedanticMode) return false;
                     status = pae::LIGATURE_NONE;
-                    note = m_pae.end();
+                    note = -1;
                     previousNote = NULL;
                 }
                 // Check the duration is valid for a ligature
@@ -4451,7 +4458,7 @@ bool PAEInput::ConvertLigature()
                     LogPAE(ERR_064_LIGATURE_DURATION, *token);
                     if (m_pedanticMode) return false;
                     status = pae::LIGATURE_NONE;
-                    note = m_pae.end();
+                    note = -1;
                     previousNote = NULL;
                 }
                 else {
@@ -4465,7 +4472,7 @@ bool PAEInput::ConvertLigature()
                 LogPAE(ERR_062_LIGATURE_NOTE_AFTER, *token);
                 if (m_pedanticMode) return false;
                 status = pae::LIGATURE_NONE;
-                note = m_pae.end();
+                note = -1;
                 previousNote = NULL;
             }
             ++token;
@@ -4475,19 +4482,22 @@ bool PAEInput::ConvertLigature()
         // We passed the last note of the ligature - create it
         if (status == pae::LIGATURE_NOTE) {
             Ligature *ligature = new Ligature();
-            m_pae.insert(note, pae::Token(0, pae::UNKOWN_POS, ligature));
-            m_pae.insert(token, pae::Token(pae::CONTAINER_END, pae::UNKOWN_POS, ligature));
+            // Inserting before the note moves the current token by one
+            const int index = (int)std::distance(m_pae.begin(), token) + 1;
+            m_pae.insert(m_pae.begin() + note, pae::Token(0, pae::UNKOWN_POS, ligature));
+            token = m_pae.begin() + index;
+            token = std::next(m_pae.insert(token, pae::Token(pae::CONTAINER_END, pae::UNKOWN_POS, ligature)));
         }
 
         status = pae::LIGATURE_NONE;
         if (token->Is(NOTE)) {
-            note = token;
+            note = (int)std::distance(m_pae.begin(), token);
             previousNote = vrv_cast<Note *>(token->m_object);
             assert(previousNote);
         }
         // Previous token was a note but current is a ')' skip it because we allow fermata on a ligature note
         else if (token->m_inputChar != ')') {
-            note = m_pae.end();
+            note = -1;
             previousNote = NULL;
         }
 
@@ -4662,7 +4672,7 @@ bool PAEInput::CheckContentPreBuild()
 
     pae::Token *previousToken = NULL;
 
-    std::list<pae::Token>::iterator token = m_pae.begin();
+    std::vector<pae::Token>::iterator token = m_pae.begin();
     while (token != m_pae.end()) {
         if (token->IsVoid() || !token->m_object) {
             ++token;
@@ -4675,7 +4685,7 @@ bool PAEInput::CheckContentPreBuild()
             if (m_pedanticMode) return false;
             Measure *measure = new Measure();
             measure->SetRight(BARRENDITION_invis);
-            m_pae.insert(token, pae::Token(0, pae::UNKOWN_POS, measure));
+            token = std::next(m_pae.insert(token, pae::Token(0, pae::UNKOWN_POS, measure)));
         }
         // Check that the measure rest is at the end of a measure
         else if (previousToken && previousToken->Is(MULTIREST) && !token->Is(MEASURE)) {
@@ -4683,7 +4693,7 @@ bool PAEInput::CheckContentPreBuild()
             if (m_pedanticMode) return false;
             Measure *measure = new Measure();
             measure->SetRight(BARRENDITION_invis);
-            m_pae.insert(token, pae::Token(0, pae::UNKOWN_POS, measure));
+            token = std::next(m_pae.insert(token, pae::Token(0, pae::UNKOWN_POS, measure)));
         }
 
         if (token->m_object) {
@@ -39,12 +39,12 @@ KeyAccid::KeyAccid()
     , AttExtSym()
 {
 
-    this->RegisterInterface(PitchInterface::GetAttClasses(), PitchInterface::IsInterface());
-    this->RegisterInterface(PositionInterface::GetAttClasses(), PositionInterface::IsInterface());
-    this->RegisterAttClass(ATT_ACCIDENTAL);
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_ENCLOSINGCHARS);
-    this->RegisterAttClass(ATT_EXTSYM);
+    this->RegisterInterface<PitchInterface>(this);
+    this->RegisterInterface<PositionInterface>(this);
+    this->RegisterAttClass<AttAccidental>(ATT_ACCIDENTAL, this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttEnclosingChars>(ATT_ENCLOSINGCHARS, this);
+    this->RegisterAttClass<AttExtSym>(ATT_EXTSYM, this);
 
     this->Reset();
 }
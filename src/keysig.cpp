@@ -82,13 +82,13 @@ KeySig::KeySig()
     , AttKeySigVis()
     , AttVisibility()
 {
-    this->RegisterAttClass(ATT_ACCIDENTAL);
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_PITCH);
-    this->RegisterAttClass(ATT_KEYSIGANL);
-    this->RegisterAttClass(ATT_KEYSIGLOG);
-    this->RegisterAttClass(ATT_KEYSIGVIS);
-    this->RegisterAttClass(ATT_VISIBILITY);
+    this->RegisterAttClass<AttAccidental>(ATT_ACCIDENTAL, this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttPitch>(ATT_PITCH, this);
+    this->RegisterAttClass<AttKeySigAnl>(ATT_KEYSIGANL, this);
+    this->RegisterAttClass<AttKeySigLog>(ATT_KEYSIGLOG, this);
+    this->RegisterAttClass<AttKeySigVis>(ATT_KEYSIGVIS, this);
+    this->RegisterAttClass<AttVisibility>(ATT_VISIBILITY, this);
 
     this->Reset();
 }
@@ -53,10 +53,10 @@ Layer::Layer()
     , AttTyped()
     , AttVisibility()
 {
-    this->RegisterAttClass(ATT_CUE);
-    this->RegisterAttClass(ATT_NINTEGER);
-    this->RegisterAttClass(ATT_TYPED);
-    this->RegisterAttClass(ATT_VISIBILITY);
+    this->RegisterAttClass<AttCue>(ATT_CUE, this);
+    this->RegisterAttClass<AttNInteger>(ATT_NINTEGER, this);
+    this->RegisterAttClass<AttTyped>(ATT_TYPED, this);
+    this->RegisterAttClass<AttVisibility>(ATT_VISIBILITY, this);
 
     // owned pointers need to be set to NULL;
     m_staffDefClef = NULL;
@@ -28,9 +28,9 @@ static const ClassRegistrar<LayerDef> s_factory("layerDef", LAYERDEF);
 
 LayerDef::LayerDef() : Object(LAYERDEF, "layerdef-"), AttLabelled(), AttNInteger(), AttTyped()
 {
-    this->RegisterAttClass(ATT_LABELLED);
-    this->RegisterAttClass(ATT_NINTEGER);
-    this->RegisterAttClass(ATT_TYPED);
+    this->RegisterAttClass<AttLabelled>(ATT_LABELLED, this);
+    this->RegisterAttClass<AttNInteger>(ATT_NINTEGER, this);
+    this->RegisterAttClass<AttTyped>(ATT_TYPED, this);
 
     this->Reset();
 }
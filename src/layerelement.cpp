@@ -77,11 +77,11 @@ namespace vrv {
 LayerElement::LayerElement()
     : Object(LAYER_ELEMENT, "le-"), FacsimileInterface(), LinkingInterface(), AttCoordX1(), AttLabelled(), AttTyped()
 {
-    this->RegisterInterface(FacsimileInterface::GetAttClasses(), FacsimileInterface::IsInterface());
-    this->RegisterInterface(LinkingInterface::GetAttClasses(), LinkingInterface::IsInterface());
-    this->RegisterAttClass(ATT_COORDX1);
-    this->RegisterAttClass(ATT_LABELLED);
-    this->RegisterAttClass(ATT_TYPED);
+    this->RegisterInterface<FacsimileInterface>(this);
+    this->RegisterInterface<LinkingInterface>(this);
+    this->RegisterAttClass<AttCoordX1>(ATT_COORDX1, this);
+    this->RegisterAttClass<AttLabelled>(ATT_LABELLED, this);
+    this->RegisterAttClass<AttTyped>(ATT_TYPED, this);
 
     this->Reset();
 }
@@ -89,11 +89,11 @@ LayerElement::LayerElement()
 LayerElement::LayerElement(ClassId classId)
     : Object(classId, "le-"), FacsimileInterface(), LinkingInterface(), AttCoordX1(), AttLabelled(), AttTyped()
 {
-    this->RegisterInterface(FacsimileInterface::GetAttClasses(), FacsimileInterface::IsInterface());
-    this->RegisterInterface(LinkingInterface::GetAttClasses(), LinkingInterface::IsInterface());
-    this->RegisterAttClass(ATT_COORDX1);
-    this->RegisterAttClass(ATT_LABELLED);
-    this->RegisterAttClass(ATT_TYPED);
+    this->RegisterInterface<FacsimileInterface>(this);
+    this->RegisterInterface<LinkingInterface>(this);
+    this->RegisterAttClass<AttCoordX1>(ATT_COORDX1, this);
+    this->RegisterAttClass<AttLabelled>(ATT_LABELLED, this);
+    this->RegisterAttClass<AttTyped>(ATT_TYPED, this);
 
     this->Reset();
 }
@@ -101,11 +101,11 @@ LayerElement::LayerElement(ClassId classId)
 LayerElement::LayerElement(ClassId classId, const std::string &classIdStr)
     : Object(classId, classIdStr), FacsimileInterface(), LinkingInterface(), AttCoordX1(), AttLabelled(), AttTyped()
 {
-    this->RegisterInterface(FacsimileInterface::GetAttClasses(), FacsimileInterface::IsInterface());
-    this->RegisterInterface(LinkingInterface::GetAttClasses(), LinkingInterface::IsInterface());
-    this->RegisterAttClass(ATT_COORDX1);
-    this->RegisterAttClass(ATT_LABELLED);
-    this->RegisterAttClass(ATT_TYPED);
+    this->RegisterInterface<FacsimileInterface>(this);
+    this->RegisterInterface<LinkingInterface>(this);
+    this->RegisterAttClass<AttCoordX1>(ATT_COORDX1, this);
+    this->RegisterAttClass<AttLabelled>(ATT_LABELLED, this);
+    this->RegisterAttClass<AttTyped>(ATT_TYPED, this);
 
     this->Reset();
 }
@@ -1031,7 +1031,7 @@ int LayerElement::CalcLayerOverlap(const Doc *doc, int direction, int y1, int y2
 
 data_STEMMODIFIER LayerElement::GetDrawingStemMod() const
 {
-    const AttStems *stem = dynamic_cast<const AttStems *>(this);
+    const AttStems *stem = this->GetAtt<AttStems>(ATT_STEMS);
     if (!stem) return STEMMODIFIER_NONE;
 
     return stem->GetStemMod();
@@ -0,0 +1,173 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        layoutcache.cpp
+// Author:      Laurent Pugin
+// Created:     2023
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "layoutcache.h"
+
+//----------------------------------------------------------------------------
+
+#include <cassert>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <random>
+#include <sstream>
+
+//----------------------------------------------------------------------------
+
+#include "cachehorizontallayoutfunctor.h"
+#include "doc.h"
+#include "options.h"
+#include "page.h"
+#include "profiler.h"
+#include "vrv.h"
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// LayoutCache
+//----------------------------------------------------------------------------
+
+LayoutCache::LayoutCache(Doc *doc)
+{
+    assert(doc);
+
+    m_doc = doc;
+
+    const std::string directory = m_doc->GetOptions()->m_layoutCacheDir.GetValue();
+    if (directory.empty() || m_doc->GetDataHash().empty()) return;
+
+    m_key = this->GetKey();
+    m_filename = directory;
+    if ((m_filename.back() != '/') && (m_filename.back() != '\\')) m_filename += "/";
+    m_filename += m_key + ".vrvlayout";
+}
+
+bool LayoutCache::Load(Page *page)
+{
+    assert(page);
+
+    if (!this->IsEnabled()) return false;
+
+    ProfilerEvent event(PROFILER_STAGE, "LayoutCache::Load");
+
+    std::ifstream file(m_filename.c_str(), std::ios::in | std::ios::binary);
+    // Not cached yet
+    if (!file.is_open()) return false;
+
+    std::string header;
+    std::getline(file, header);
+    std::istringstream headerStream(header);
+    std::string magic;
+    int version = 0;
+    std::string key;
+    int count = -1;
+    std::string payloadHash;
+    headerStream >> magic >> version >> key >> count >> payloadHash;
+    if ((magic != "verovio-layout-cache") || (version != FORMAT_VERSION) || (key != m_key) || (count < 0)) {
+        LogWarning("Layout cache file '%s' is not valid and is ignored", m_filename.c_str());
+        return false;
+    }
+
+    const std::string payload((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    if ((payload.size() != (std::size_t)count * 4) || (Hash(payload) != payloadHash)) {
+        LogWarning("Layout cache file '%s' is corrupted and is ignored", m_filename.c_str());
+        return false;
+    }
+
+    // The values are stored as 32-bit little-endian integers
+    std::vector<int> values(count);
+    for (int i = 0; i < count; ++i) {
+        const unsigned char *bytes = (const unsigned char *)payload.data() + i * 4;
+        values[i] = (int32_t)((uint32_t)bytes[0] | ((uint32_t)bytes[1] << 8) | ((uint32_t)bytes[2] << 16)
+            | ((uint32_t)bytes[3] << 24));
+    }
+
+    // The alignments need to be created before their position can be restored
+    page->ResetAligners();
+
+    PersistHorizontalLayoutFunctor persistHorizontalLayout(&values, true);
+    page->Process(persistHorizontalLayout);
+    if (persistHorizontalLayout.HasFailed()) {
+        LogWarning("Layout cache file '%s' does not match the content and is ignored", m_filename.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+bool LayoutCache::Save(Page *page)
+{
+    assert(page);
+
+    if (!this->IsEnabled()) return false;
+
+    ProfilerEvent event(PROFILER_STAGE, "LayoutCache::Save");
+
+    std::vector<int> values;
+    PersistHorizontalLayoutFunctor persistHorizontalLayout(&values, false);
+    page->Process(persistHorizontalLayout);
+
+    std::string payload;
+    payload.reserve(values.size() * 4);
+    for (int value : values) {
+        const uint32_t bytes = (uint32_t)value;
+        for (int shift = 0; shift < 32; shift += 8) payload.push_back((char)((bytes >> shift) & 0xFF));
+    }
+
+    // Write to a temporary file first so another process never reads a partial file
+    std::random_device randomDevice;
+    const std::string tmpFilename = StringFormat("%s.%08x.tmp", m_filename.c_str(), randomDevice());
+    std::ofstream file(tmpFilename.c_str(), std::ios::out | std::ios::binary);
+    if (!file.is_open()) {
+        LogWarning("Layout cache file '%s' cannot be written", m_filename.c_str());
+        return false;
+    }
+    file << "verovio-layout-cache " << FORMAT_VERSION << " " << m_key << " " << values.size() << " " << Hash(payload)
+         << "\n";
+    file.write(payload.data(), payload.size());
+    file.close();
+
+    // The renaming fails on some platforms if the file has been written by another process in the meantime
+    if (!file || (std::rename(tmpFilename.c_str(), m_filename.c_str()) != 0)) {
+        std::remove(tmpFilename.c_str());
+        return false;
+    }
+
+    return true;
+}
+
+std::string LayoutCache::Hash(const std::string &data)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    for (const unsigned char c : data) {
+        hash ^= c;
+        hash *= 1099511628211ULL;
+    }
+    return StringFormat("%016llx", (unsigned long long)hash);
+}
+
+std::string LayoutCache::GetKey() const
+{
+    std::ostringstream key;
+    key << "data=" << m_doc->GetDataHash() << "\n";
+    for (const auto &[name, option] : *m_doc->GetOptions()->GetItems()) {
+        // The options only used when drawing do not change the layout
+        if (option->GetStage() == OptionStage::Drawing) continue;
+        key << name << "=" << option->GetStrValue() << "\n";
+    }
+    if (m_doc->HasSelection()) {
+        key << "selection=" << m_doc->m_selectionStart << "," << m_doc->m_selectionEnd << ","
+            << m_doc->m_selectionIsExcerpt << "\n";
+    }
+    key << "font=" << m_doc->GetResources().GetCurrentFontName() << "\n";
+    key << "version=" << GetVersion() << "\n";
+
+    return Hash(key.str());
+}
+
+} // namespace vrv
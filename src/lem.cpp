@@ -25,7 +25,7 @@ static const ClassRegistrar<Lem> s_factory("lem", LEM);
 
 Lem::Lem() : EditorialElement(LEM, "lem-"), AttSource()
 {
-    this->RegisterAttClass(ATT_SOURCE);
+    this->RegisterAttClass<AttSource>(ATT_SOURCE, this);
 
     this->Reset();
 }
@@ -32,7 +32,7 @@ static const ClassRegistrar<Ligature> s_factory("ligature", LIGATURE);
 
 Ligature::Ligature() : LayerElement(LIGATURE, "ligature-"), ObjectListInterface(), AttLigatureVis()
 {
-    this->RegisterAttClass(ATT_LIGATUREVIS);
+    this->RegisterAttClass<AttLigatureVis>(ATT_LIGATUREVIS, this);
 
     this->Reset();
 }
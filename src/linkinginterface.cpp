@@ -25,7 +25,7 @@ namespace vrv {
 
 LinkingInterface::LinkingInterface() : Interface(), AttLinking()
 {
-    this->RegisterInterfaceAttClass(ATT_LINKING);
+    this->RegisterInterfaceAttClass<AttLinking>(ATT_LINKING, this);
 
     this->Reset();
 }
@@ -123,7 +123,7 @@ FunctorCode LinkingInterface::InterfacePrepareStaffCurrentTimeSpanning(
 
     // if @extender is available, the explicit "true" is required
     if (object->HasAttClass(ATT_EXTENDER)) {
-        AttExtender *att = dynamic_cast<AttExtender *>(object);
+        AttExtender *att = object->GetAtt<AttExtender>(ATT_EXTENDER);
         assert(att);
         if (att->GetExtender() != BOOLEAN_true) return FUNCTOR_CONTINUE;
     }
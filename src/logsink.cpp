@@ -0,0 +1,132 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        logsink.cpp
+// Author:      Laurent Pugin
+// Created:     2023
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "logsink.h"
+
+//----------------------------------------------------------------------------
+
+#include <cassert>
+
+//----------------------------------------------------------------------------
+
+#include "vrv.h"
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// LogSink
+//----------------------------------------------------------------------------
+
+thread_local LogSink *LogSink::s_current = NULL;
+std::atomic<LogLevel> LogSink::s_defaultLogLevel = LOG_WARNING;
+std::atomic<bool> LogSink::s_defaultLoggingToBuffer = false;
+
+LogSink::LogSink()
+{
+    m_length = 0;
+    m_duplicateCount = 0;
+    m_droppedCount = 0;
+    m_maxMessages = MAX_MESSAGES;
+    m_logLevel = -1;
+    m_loggingToBuffer = -1;
+}
+
+void LogSink::Add(const std::string &message)
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    if (m_index.count(message)) {
+        ++m_duplicateCount;
+        return;
+    }
+    if ((int)m_messages.size() >= m_maxMessages) {
+        ++m_droppedCount;
+        return;
+    }
+
+    m_messages.push_back(message);
+    m_index.insert(m_messages.back());
+    m_length += message.size();
+}
+
+void LogSink::Reset()
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_index.clear();
+    m_messages.clear();
+    m_length = 0;
+    m_duplicateCount = 0;
+    m_droppedCount = 0;
+}
+
+std::string LogSink::GetLog() const
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::string log;
+    log.reserve(m_length);
+    for (const std::string &message : m_messages) {
+        log += message;
+    }
+    if (m_droppedCount > 0) {
+        log += StringFormat("[Warning] %d more messages not logged (limit of %d messages)\n", m_droppedCount,
+            m_maxMessages);
+    }
+    return log;
+}
+
+int LogSink::GetMessageCount() const
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    return (int)m_messages.size();
+}
+
+int LogSink::GetDuplicateCount() const
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_duplicateCount;
+}
+
+int LogSink::GetDroppedCount() const
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_droppedCount;
+}
+
+int LogSink::GetMaxMessages() const
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    return m_maxMessages;
+}
+
+void LogSink::SetMaxMessages(int maxMessages)
+{
+    assert(maxMessages >= 0);
+
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_maxMessages = maxMessages;
+}
+
+LogLevel LogSink::GetLogLevel() const
+{
+    const int logLevel = m_logLevel;
+    return (logLevel == -1) ? s_defaultLogLevel.load() : logLevel;
+}
+
+bool LogSink::IsLoggingToBuffer() const
+{
+    const int loggingToBuffer = m_loggingToBuffer;
+    return (loggingToBuffer == -1) ? s_defaultLoggingToBuffer.load() : (loggingToBuffer == 1);
+}
+
+} // namespace vrv
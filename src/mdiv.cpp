@@ -30,8 +30,8 @@ static const ClassRegistrar<Mdiv> s_factory("mdiv", MDIV);
 
 Mdiv::Mdiv() : PageElement(MDIV, "mdiv-"), PageMilestoneInterface(), AttLabelled(), AttNNumberLike()
 {
-    this->RegisterAttClass(ATT_LABELLED);
-    this->RegisterAttClass(ATT_NNUMBERLIKE);
+    this->RegisterAttClass<AttLabelled>(ATT_LABELLED, this);
+    this->RegisterAttClass<AttNNumberLike>(ATT_NNUMBERLIKE, this);
 
     this->Reset();
 }
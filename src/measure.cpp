@@ -65,14 +65,14 @@ Measure::Measure(bool measureMusic, int logMeasureNb)
     , AttPointing()
     , AttTyped()
 {
-    this->RegisterAttClass(ATT_BARRING);
-    this->RegisterAttClass(ATT_COORDX1);
-    this->RegisterAttClass(ATT_COORDX2);
-    this->RegisterAttClass(ATT_MEASURELOG);
-    this->RegisterAttClass(ATT_METERCONFORMANCEBAR);
-    this->RegisterAttClass(ATT_NNUMBERLIKE);
-    this->RegisterAttClass(ATT_POINTING);
-    this->RegisterAttClass(ATT_TYPED);
+    this->RegisterAttClass<AttBarring>(ATT_BARRING, this);
+    this->RegisterAttClass<AttCoordX1>(ATT_COORDX1, this);
+    this->RegisterAttClass<AttCoordX2>(ATT_COORDX2, this);
+    this->RegisterAttClass<AttMeasureLog>(ATT_MEASURELOG, this);
+    this->RegisterAttClass<AttMeterConformanceBar>(ATT_METERCONFORMANCEBAR, this);
+    this->RegisterAttClass<AttNNumberLike>(ATT_NNUMBERLIKE, this);
+    this->RegisterAttClass<AttPointing>(ATT_POINTING, this);
+    this->RegisterAttClass<AttTyped>(ATT_TYPED, this);
 
     m_measuredMusic = measureMusic;
 
@@ -254,8 +254,15 @@ void Measure::CacheXRel(bool restore)
 
 bool Measure::IsFirstInSystem() const
 {
-    assert(this->GetParent());
-    return (this->GetParent()->GetFirst(MEASURE) == this);
+    const Object *parent = this->GetParent();
+    assert(parent);
+    // Do not use GetFirst because its iterator is shared when the measures are laid out in parallel
+    // The search stops at the first measure whatever the position of this one
+    for (int i = 0; i < parent->GetChildCount(); ++i) {
+        const Object *child = parent->GetChild(i);
+        if (child->Is(MEASURE)) return (child == this);
+    }
+    return false;
 }
 
 bool Measure::IsLastInSystem() const
@@ -420,6 +427,17 @@ void Measure::ResetDrawingScoreDef()
     }
 }
 
+void Measure::MoveDrawingScoreDefTo(Measure *measure)
+{
+    assert(measure && !measure->m_drawingScoreDef);
+
+    if (!m_drawingScoreDef) return;
+
+    measure->m_drawingScoreDef = m_drawingScoreDef;
+    m_drawingScoreDef = NULL;
+    this->SetDrawingScoreDef(measure->m_drawingScoreDef);
+}
+
 std::vector<Staff *> Measure::GetFirstStaffGrpStaves(ScoreDef *scoreDef)
 {
     assert(scoreDef);
@@ -39,13 +39,13 @@ Mensur::Mensur()
     , AttSlashCount()
     , AttStaffLoc()
 {
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_CUE);
-    this->RegisterAttClass(ATT_DURATIONRATIO);
-    this->RegisterAttClass(ATT_MENSURALSHARED);
-    this->RegisterAttClass(ATT_MENSURVIS);
-    this->RegisterAttClass(ATT_SLASHCOUNT);
-    this->RegisterAttClass(ATT_STAFFLOC);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttCue>(ATT_CUE, this);
+    this->RegisterAttClass<AttDurationRatio>(ATT_DURATIONRATIO, this);
+    this->RegisterAttClass<AttMensuralShared>(ATT_MENSURALSHARED, this);
+    this->RegisterAttClass<AttMensurVis>(ATT_MENSURVIS, this);
+    this->RegisterAttClass<AttSlashCount>(ATT_SLASHCOUNT, this);
+    this->RegisterAttClass<AttStaffLoc>(ATT_STAFFLOC, this);
 
     this->Reset();
 }
@@ -30,9 +30,9 @@ static const ClassRegistrar<MeterSig> s_factory("meterSig", METERSIG);
 
 MeterSig::MeterSig() : LayerElement(METERSIG, "msig-"), AttEnclosingChars(), AttMeterSigLog(), AttMeterSigVis()
 {
-    this->RegisterAttClass(ATT_ENCLOSINGCHARS);
-    this->RegisterAttClass(ATT_METERSIGLOG);
-    this->RegisterAttClass(ATT_METERSIGVIS);
+    this->RegisterAttClass<AttEnclosingChars>(ATT_ENCLOSINGCHARS, this);
+    this->RegisterAttClass<AttMeterSigLog>(ATT_METERSIGLOG, this);
+    this->RegisterAttClass<AttMeterSigVis>(ATT_METERSIGVIS, this);
 
     this->Reset();
 }
@@ -33,11 +33,11 @@ MeterSigGrp::MeterSigGrp()
     , AttMeterSigGrpLog()
     , AttTyped()
 {
-    this->RegisterInterface(LinkingInterface::GetAttClasses(), LinkingInterface::IsInterface());
-    this->RegisterAttClass(ATT_BASIC);
-    this->RegisterAttClass(ATT_LABELLED);
-    this->RegisterAttClass(ATT_METERSIGGRPLOG);
-    this->RegisterAttClass(ATT_TYPED);
+    this->RegisterInterface<LinkingInterface>(this);
+    this->RegisterAttClass<AttBasic>(ATT_BASIC, this);
+    this->RegisterAttClass<AttLabelled>(ATT_LABELLED, this);
+    this->RegisterAttClass<AttMeterSigGrpLog>(ATT_METERSIGGRPLOG, this);
+    this->RegisterAttClass<AttTyped>(ATT_TYPED, this);
 
     this->Reset();
 }
@@ -34,11 +34,11 @@ MNum::MNum()
     , AttLang()
     , AttTypography()
 {
-    this->RegisterInterface(TextDirInterface::GetAttClasses(), TextDirInterface::IsInterface());
-    this->RegisterInterface(TimePointInterface::GetAttClasses(), TimePointInterface::IsInterface());
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_LANG);
-    this->RegisterAttClass(ATT_TYPOGRAPHY);
+    this->RegisterInterface<TextDirInterface>(this);
+    this->RegisterInterface<TimePointInterface>(this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttLang>(ATT_LANG, this);
+    this->RegisterAttClass<AttTypography>(ATT_TYPOGRAPHY, this);
 
     this->Reset();
 }
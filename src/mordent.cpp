@@ -35,12 +35,12 @@ Mordent::Mordent()
     , AttPlacementRelStaff()
     , AttMordentLog()
 {
-    this->RegisterInterface(TimePointInterface::GetAttClasses(), TimePointInterface::IsInterface());
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_EXTSYM);
-    this->RegisterAttClass(ATT_ORNAMENTACCID);
-    this->RegisterAttClass(ATT_PLACEMENTRELSTAFF);
-    this->RegisterAttClass(ATT_MORDENTLOG);
+    this->RegisterInterface<TimePointInterface>(this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttExtSym>(ATT_EXTSYM, this);
+    this->RegisterAttClass<AttOrnamentAccid>(ATT_ORNAMENTACCID, this);
+    this->RegisterAttClass<AttPlacementRelStaff>(ATT_PLACEMENTRELSTAFF, this);
+    this->RegisterAttClass<AttMordentLog>(ATT_MORDENTLOG, this);
 
     this->Reset();
 }
@@ -32,11 +32,11 @@ static const ClassRegistrar<MRest> s_factory("mRest", MREST);
 MRest::MRest()
     : LayerElement(MREST, "mrest-"), PositionInterface(), AttColor(), AttCue(), AttFermataPresent(), AttVisibility()
 {
-    this->RegisterInterface(PositionInterface::GetAttClasses(), PositionInterface::IsInterface());
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_CUE);
-    this->RegisterAttClass(ATT_FERMATAPRESENT);
-    this->RegisterAttClass(ATT_VISIBILITY);
+    this->RegisterInterface<PositionInterface>(this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttCue>(ATT_CUE, this);
+    this->RegisterAttClass<AttFermataPresent>(ATT_FERMATAPRESENT, this);
+    this->RegisterAttClass<AttVisibility>(ATT_VISIBILITY, this);
 
     this->Reset();
 }
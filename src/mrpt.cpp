@@ -32,9 +32,9 @@ static const ClassRegistrar<MRpt> s_factory("mRpt", MRPT);
 
 MRpt::MRpt() : LayerElement(MRPT, "mrpt-"), AttColor(), AttNumbered(), AttNumberPlacement()
 {
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_NUMBERED);
-    this->RegisterAttClass(ATT_NUMBERPLACEMENT);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttNumbered>(ATT_NUMBERED, this);
+    this->RegisterAttClass<AttNumberPlacement>(ATT_NUMBERPLACEMENT, this);
 
     this->Reset();
 }
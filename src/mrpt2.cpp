@@ -32,7 +32,7 @@ static const ClassRegistrar<MRpt2> s_factory("mRpt2", MRPT2);
 
 MRpt2::MRpt2() : LayerElement(MRPT2, "mrpt2-"), AttColor()
 {
-    this->RegisterAttClass(ATT_COLOR);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
 
     this->Reset();
 }
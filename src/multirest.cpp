@@ -29,12 +29,12 @@ MultiRest::MultiRest()
     , AttNumberPlacement()
     , AttWidth()
 {
-    this->RegisterInterface(PositionInterface::GetAttClasses(), PositionInterface::IsInterface());
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_MULTIRESTVIS);
-    this->RegisterAttClass(ATT_NUMBERED);
-    this->RegisterAttClass(ATT_NUMBERPLACEMENT);
-    this->RegisterAttClass(ATT_WIDTH);
+    this->RegisterInterface<PositionInterface>(this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttMultiRestVis>(ATT_MULTIRESTVIS, this);
+    this->RegisterAttClass<AttNumbered>(ATT_NUMBERED, this);
+    this->RegisterAttClass<AttNumberPlacement>(ATT_NUMBERPLACEMENT, this);
+    this->RegisterAttClass<AttWidth>(ATT_WIDTH, this);
     this->Reset();
 }
 
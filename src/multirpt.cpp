@@ -32,7 +32,7 @@ static const ClassRegistrar<MultiRpt> s_factory("multiRpt", MULTIRPT);
 
 MultiRpt::MultiRpt() : LayerElement(MULTIRPT, "multirpt-"), AttNumbered()
 {
-    this->RegisterAttClass(ATT_NUMBERED);
+    this->RegisterAttClass<AttNumbered>(ATT_NUMBERED, this);
     this->Reset();
 }
 
@@ -38,12 +38,12 @@ Nc::Nc()
     , AttNcForm()
 
 {
-    this->RegisterInterface(DurationInterface::GetAttClasses(), DurationInterface::IsInterface());
-    this->RegisterInterface(PitchInterface::GetAttClasses(), PitchInterface::IsInterface());
-    this->RegisterInterface(PositionInterface::GetAttClasses(), PositionInterface::IsInterface());
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_INTERVALMELODIC);
-    this->RegisterAttClass(ATT_NCFORM);
+    this->RegisterInterface<DurationInterface>(this);
+    this->RegisterInterface<PitchInterface>(this);
+    this->RegisterInterface<PositionInterface>(this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttIntervalMelodic>(ATT_INTERVALMELODIC, this);
+    this->RegisterAttClass<AttNcForm>(ATT_NCFORM, this);
 
     this->Reset();
 }
@@ -46,7 +46,7 @@ static const ClassRegistrar<Neume> s_factory("neume", NEUME);
 
 Neume::Neume() : LayerElement(NEUME, "neume-"), ObjectListInterface(), AttColor()
 {
-    this->RegisterAttClass(ATT_COLOR);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
     this->Reset();
 }
 
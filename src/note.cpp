@@ -70,23 +70,23 @@ Note::Note()
     , AttTiePresent()
     , AttVisibility()
 {
-    this->RegisterInterface(DurationInterface::GetAttClasses(), DurationInterface::IsInterface());
-    this->RegisterInterface(PitchInterface::GetAttClasses(), PitchInterface::IsInterface());
-    this->RegisterInterface(PositionInterface::GetAttClasses(), PositionInterface::IsInterface());
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_COLORATION);
-    this->RegisterAttClass(ATT_CUE);
-    this->RegisterAttClass(ATT_EXTSYM);
-    this->RegisterAttClass(ATT_GRACED);
-    this->RegisterAttClass(ATT_HARMONICFUNCTION);
-    this->RegisterAttClass(ATT_NOTEGESTAB);
-    this->RegisterAttClass(ATT_NOTEHEADS);
-    this->RegisterAttClass(ATT_NOTEVISMENSURAL);
-    this->RegisterAttClass(ATT_MIDIVELOCITY);
-    this->RegisterAttClass(ATT_STEMS);
-    this->RegisterAttClass(ATT_STEMSCMN);
-    this->RegisterAttClass(ATT_TIEPRESENT);
-    this->RegisterAttClass(ATT_VISIBILITY);
+    this->RegisterInterface<DurationInterface>(this);
+    this->RegisterInterface<PitchInterface>(this);
+    this->RegisterInterface<PositionInterface>(this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttColoration>(ATT_COLORATION, this);
+    this->RegisterAttClass<AttCue>(ATT_CUE, this);
+    this->RegisterAttClass<AttExtSym>(ATT_EXTSYM, this);
+    this->RegisterAttClass<AttGraced>(ATT_GRACED, this);
+    this->RegisterAttClass<AttHarmonicFunction>(ATT_HARMONICFUNCTION, this);
+    this->RegisterAttClass<AttNoteGesTab>(ATT_NOTEGESTAB, this);
+    this->RegisterAttClass<AttNoteHeads>(ATT_NOTEHEADS, this);
+    this->RegisterAttClass<AttNoteVisMensural>(ATT_NOTEVISMENSURAL, this);
+    this->RegisterAttClass<AttMidiVelocity>(ATT_MIDIVELOCITY, this);
+    this->RegisterAttClass<AttStems>(ATT_STEMS, this);
+    this->RegisterAttClass<AttStemsCmn>(ATT_STEMSCMN, this);
+    this->RegisterAttClass<AttTiePresent>(ATT_TIEPRESENT, this);
+    this->RegisterAttClass<AttVisibility>(ATT_VISIBILITY, this);
 
     this->Reset();
 }
@@ -15,6 +15,7 @@
 #include <math.h>
 #include <random>
 #include <sstream>
+#include <thread>
 
 //----------------------------------------------------------------------------
 
@@ -41,6 +42,7 @@
 #include "note.h"
 #include "page.h"
 #include "plistinterface.h"
+#include "profiler.h"
 #include "resetfunctor.h"
 #include "savefunctor.h"
 #include "score.h"
@@ -61,6 +63,100 @@
 
 namespace vrv {
 
+//----------------------------------------------------------------------------
+// ObjectTraits
+//----------------------------------------------------------------------------
+
+// Guards the creation of new instances since documents can be loaded in parallel
+static std::mutex s_objectTraitsMutex;
+
+ObjectTraits::ObjectTraits() : m_interfaceMask(0), m_attOffsetTable(NULL) {}
+
+const ObjectTraits *ObjectTraits::GetRoot(ClassId classId)
+{
+    static const ObjectTraits *s_roots = new ObjectTraits[UNSPECIFIED + 1];
+
+    assert(classId <= UNSPECIFIED);
+    return &s_roots[classId];
+}
+
+const ObjectTraits *ObjectTraits::WithAttClass(AttClassId attClassId, int offset) const
+{
+    static const std::vector<std::pair<AttClassId, int>> noAttClasses;
+    return this->GetNext((int)attClassId * 2, noAttClasses, INTERFACE, offset);
+}
+
+const ObjectTraits *ObjectTraits::WithInterface(
+    const std::vector<std::pair<AttClassId, int>> *attClasses, InterfaceId interfaceId, int offset) const
+{
+    assert(attClasses);
+
+    return this->GetNext((int)interfaceId * 2 + 1, *attClasses, interfaceId, offset);
+}
+
+const ObjectTraits *ObjectTraits::GetNext(
+    int key, const std::vector<std::pair<AttClassId, int>> &attClasses, InterfaceId interfaceId, int offset) const
+{
+    const std::lock_guard<std::mutex> lock(s_objectTraitsMutex);
+
+    auto iter = m_next.find(key);
+    if (iter != m_next.end()) {
+        // All the objects of a class have their bases at the same offsets
+        assert((key % 2) || (iter->second->m_attOffsets.back() == offset));
+        return iter->second;
+    }
+
+    ObjectTraits *next = new ObjectTraits();
+    next->m_attClasses = m_attClasses;
+    next->m_attOffsets = m_attOffsets;
+    next->m_interfaces = m_interfaces;
+    next->m_attClassSet = m_attClassSet;
+    next->m_interfaceMask = m_interfaceMask;
+    if (key % 2) {
+        // The offsets of the interface att classes are given from the interface base
+        for (const auto &[attClassId, attOffset] : attClasses) {
+            next->m_attClasses.push_back(attClassId);
+            next->m_attOffsets.push_back(offset + attOffset);
+            next->m_attClassSet.set(attClassId);
+        }
+        assert(interfaceId < 32);
+        next->m_interfaces.push_back(interfaceId);
+        next->m_interfaceMask |= (1u << interfaceId);
+    }
+    else {
+        next->m_attClasses.push_back((AttClassId)(key / 2));
+        next->m_attOffsets.push_back(offset);
+        next->m_attClassSet.set(key / 2);
+    }
+    m_next[key] = next;
+    return next;
+}
+
+const int *ObjectTraits::CreateAttOffsetTable() const
+{
+    const std::lock_guard<std::mutex> lock(s_objectTraitsMutex);
+
+    const int *table = m_attOffsetTable.load(std::memory_order_acquire);
+    if (table) return table;
+
+    int *offsets = new int[ATT_CLASS_max];
+    std::fill(offsets, offsets + ATT_CLASS_max, NO_OFFSET);
+    std::bitset<ATT_CLASS_max> filled;
+    for (int i = 0; i < (int)m_attClasses.size(); ++i) {
+        const AttClassId attClassId = m_attClasses.at(i);
+        if (!filled.test(attClassId)) {
+            offsets[attClassId] = m_attOffsets.at(i);
+            filled.set(attClassId);
+        }
+        // An att class registered with two different bases cannot be reached
+        else if (offsets[attClassId] != m_attOffsets.at(i)) {
+            offsets[attClassId] = NO_OFFSET;
+        }
+    }
+    m_attOffsetTable.store(offsets, std::memory_order_release);
+    return offsets;
+}
+
 //----------------------------------------------------------------------------
 // Object
 //----------------------------------------------------------------------------
@@ -68,6 +164,24 @@ namespace vrv {
 thread_local unsigned long Object::s_objectCounter = 0;
 thread_local uint32_t Object::s_xmlIDCounter = 0;
 
+// Write the id for a generated number into the buffer (the prefix and at most seven base 36 digits)
+static int FormatHashID(char prefix, uint32_t number, char *buffer)
+{
+    static const char digits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+    char reversed[8];
+    int count = 0;
+    uint32_t value = Object::Hash(number);
+    do {
+        reversed[count++] = digits[value % 36];
+        value /= 36;
+    } while (value);
+
+    buffer[0] = prefix;
+    for (int i = 0; i < count; ++i) buffer[i + 1] = reversed[count - i - 1];
+    return count + 1;
+}
+
 Object::Object() : BoundingBox()
 {
     if (s_objectCounter++ == 0) {
@@ -104,7 +218,7 @@ Object::Object(const Object &object) : BoundingBox(object)
     this->ResetBoundingBox(); // It does not make sense to keep the values of the BBox
 
     m_classId = object.m_classId;
-    m_classIdStr = object.m_classIdStr;
+    m_classIdPrefix = object.m_classIdPrefix;
     m_parent = NULL;
 
     // Flags
@@ -113,8 +227,7 @@ Object::Object(const Object &object) : BoundingBox(object)
     m_isReferenceObject = object.m_isReferenceObject;
 
     // Also copy attribute classes
-    m_attClasses = object.m_attClasses;
-    m_interfaces = object.m_interfaces;
+    m_traits = object.m_traits;
     // New id
     this->GenerateID();
     // For now do not copy them
@@ -151,7 +264,7 @@ Object &Object::operator=(const Object &object)
         this->ResetBoundingBox(); // It does not make sense to keep the values of the BBox
 
         m_classId = object.m_classId;
-        m_classIdStr = object.m_classIdStr;
+        m_classIdPrefix = object.m_classIdPrefix;
         m_parent = NULL;
         // Flags
         m_isAttribute = object.m_isAttribute;
@@ -159,8 +272,7 @@ Object &Object::operator=(const Object &object)
         m_isReferenceObject = object.m_isReferenceObject;
 
         // Also copy attribute classes
-        m_attClasses = object.m_attClasses;
-        m_interfaces = object.m_interfaces;
+        m_traits = object.m_traits;
         // New id
         this->GenerateID();
         // For now do now copy them
@@ -194,15 +306,15 @@ void Object::Init(ClassId classId, const std::string &classIdStr)
     assert(classIdStr.size());
 
     m_classId = classId;
-    m_classIdStr = classIdStr;
+    m_classIdPrefix = classIdStr.at(0);
     m_parent = NULL;
+    m_traits = ObjectTraits::GetRoot(classId);
     // Flags
     m_isAttribute = false;
     m_isModified = true;
     m_isReferenceObject = false;
     // Comments
-    m_comment = "";
-    m_closingComment = "";
+    m_comments.reset();
 
     this->GenerateID();
 
@@ -243,10 +355,22 @@ void Object::Reset()
     this->ResetBoundingBox();
 }
 
-void Object::RegisterInterface(std::vector<AttClassId> *attClasses, InterfaceId interfaceId)
+void Object::SetComment(std::string comment)
+{
+    if (!m_comments) {
+        if (comment.empty()) return;
+        m_comments = std::make_unique<std::pair<std::string, std::string>>();
+    }
+    m_comments->first = comment;
+}
+
+void Object::SetClosingComment(std::string endComment)
 {
-    m_attClasses.insert(m_attClasses.end(), attClasses->begin(), attClasses->end());
-    m_interfaces.push_back(interfaceId);
+    if (!m_comments) {
+        if (endComment.empty()) return;
+        m_comments = std::make_unique<std::pair<std::string, std::string>>();
+    }
+    m_comments->second = endComment;
 }
 
 bool Object::IsMilestoneElement()
@@ -771,7 +895,44 @@ int Object::DeleteChildrenByComparison(Comparison *comparison)
 
 void Object::GenerateID()
 {
-    m_id = m_classIdStr.at(0) + Object::GenerateHashID();
+    m_idNumber = ++s_xmlIDCounter;
+    m_id.clear();
+    m_idState.store(ID_GENERATED, std::memory_order_release);
+}
+
+void Object::FormatID() const
+{
+    // The id can be accessed from the layout threads, so only the first thread formats it
+    uint8_t state = ID_GENERATED;
+    if (m_idState.compare_exchange_strong(state, ID_FORMATTING, std::memory_order_acquire)) {
+        char buffer[8];
+        m_id.assign(buffer, FormatHashID(m_classIdPrefix, m_idNumber, buffer));
+        m_idState.store(ID_FORMATTED, std::memory_order_release);
+        return;
+    }
+    // Wait for another thread formatting it
+    while (m_idState.load(std::memory_order_acquire) != ID_FORMATTED) {
+        std::this_thread::yield();
+    }
+}
+
+void Object::SetID(const std::string &id)
+{
+    // The id is set only when the object is not accessed by other threads
+    assert(m_idState.load(std::memory_order_relaxed) != ID_FORMATTING);
+
+    m_id = id;
+    m_idState.store(ID_FORMATTED, std::memory_order_release);
+}
+
+bool Object::HasID(const std::string &id) const
+{
+    if (m_idState.load(std::memory_order_acquire) == ID_FORMATTED) return (m_id == id);
+
+    if ((id.size() < 2) || (id.size() > 8) || (id.at(0) != m_classIdPrefix)) return false;
+    char buffer[8];
+    const int length = FormatHashID(m_classIdPrefix, m_idNumber, buffer);
+    return (id.compare(0, std::string::npos, buffer, length) == 0);
 }
 
 void Object::ResetID()
@@ -1018,10 +1179,22 @@ void Object::Process(Functor &functor, int deepness, bool skipFirst)
         return;
     }
 
+    // Profile the outermost call for the functor
+    if (!functor.IsProcessing()) {
+        ProfilerEvent event(PROFILER_FUNCTOR, typeid(functor));
+        const int visitCount = functor.GetVisitCount();
+        functor.SetProcessing(true);
+        this->Process(functor, deepness, skipFirst);
+        functor.SetProcessing(false);
+        event.SetVisits(functor.GetVisitCount() - visitCount);
+        return;
+    }
+
     // Update the current score stored in the document
     this->UpdateDocumentScore(functor.GetDirection());
 
     if (!skipFirst) {
+        functor.IncrementVisitCount();
         FunctorCode code = this->Accept(functor);
         functor.SetCode(code);
     }
@@ -1075,10 +1248,22 @@ void Object::Process(ConstFunctor &functor, int deepness, bool skipFirst) const
         return;
     }
 
+    // Profile the outermost call for the functor
+    if (!functor.IsProcessing()) {
+        ProfilerEvent event(PROFILER_FUNCTOR, typeid(functor));
+        const int visitCount = functor.GetVisitCount();
+        functor.SetProcessing(true);
+        this->Process(functor, deepness, skipFirst);
+        functor.SetProcessing(false);
+        event.SetVisits(functor.GetVisitCount() - visitCount);
+        return;
+    }
+
     // Update the current score stored in the document
     const_cast<Object *>(this)->UpdateDocumentScore(functor.GetDirection());
 
     if (!skipFirst) {
+        functor.IncrementVisitCount();
         FunctorCode code = this->Accept(functor);
         functor.SetCode(code);
     }
@@ -1247,9 +1432,10 @@ void Object::SeedID(uint32_t seed)
 
 std::string Object::GenerateHashID()
 {
-    uint32_t nr = Hash(++s_xmlIDCounter);
+    char buffer[8];
+    const int length = FormatHashID(' ', ++s_xmlIDCounter, buffer);
 
-    return BaseEncodeInt(nr, 36);
+    return std::string(buffer + 1, length - 1);
 }
 
 uint32_t Object::Hash(uint32_t number, bool reverse)
@@ -0,0 +1,127 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        objectarena.cpp
+// Author:      Laurent Pugin
+// Created:     2023
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "objectarena.h"
+
+//----------------------------------------------------------------------------
+
+#include <cassert>
+#include <cstdlib>
+#include <new>
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// ObjectArena
+//----------------------------------------------------------------------------
+
+struct ObjectArena::BlockHeader {
+    ObjectArena *m_arena;
+    std::size_t m_sizeClass;
+};
+
+thread_local ObjectArena *ObjectArena::s_current = NULL;
+
+ObjectArena::ObjectArena() : m_freeLists(SIZE_CLASSES + 1, NULL)
+{
+    static_assert(sizeof(BlockHeader) <= GRANULE, "The block header must fit in one granule");
+
+    m_chunkPos = NULL;
+    m_chunkEnd = NULL;
+    m_liveCount = 0;
+    m_released = false;
+}
+
+ObjectArena::~ObjectArena()
+{
+    for (char *chunk : m_chunks) {
+        std::free(chunk);
+    }
+}
+
+void *ObjectArena::New(std::size_t size)
+{
+    // Size class in granules, including the header
+    const std::size_t sizeClass = (size + 2 * GRANULE - 1) / GRANULE;
+
+    ObjectArena *arena = s_current;
+    void *block = NULL;
+    if (arena && (sizeClass <= SIZE_CLASSES)) {
+        block = arena->Allocate(sizeClass);
+    }
+    else {
+        arena = NULL;
+        block = std::malloc(sizeClass * GRANULE);
+        if (!block) throw std::bad_alloc();
+    }
+
+    BlockHeader *header = static_cast<BlockHeader *>(block);
+    header->m_arena = arena;
+    header->m_sizeClass = sizeClass;
+    return static_cast<char *>(block) + GRANULE;
+}
+
+void ObjectArena::Delete(void *ptr)
+{
+    if (!ptr) return;
+
+    void *block = static_cast<char *>(ptr) - GRANULE;
+    BlockHeader *header = static_cast<BlockHeader *>(block);
+    if (header->m_arena) {
+        header->m_arena->Free(block, header->m_sizeClass);
+    }
+    else {
+        std::free(block);
+    }
+}
+
+void ObjectArena::Release()
+{
+    assert(!m_released);
+
+    m_released = true;
+    if (m_liveCount == 0) delete this;
+}
+
+void *ObjectArena::Allocate(std::size_t sizeClass)
+{
+    ++m_liveCount;
+
+    void *block = m_freeLists[sizeClass];
+    if (block) {
+        m_freeLists[sizeClass] = *static_cast<void **>(block);
+        return block;
+    }
+
+    const std::size_t size = sizeClass * GRANULE;
+    if (size > (std::size_t)(m_chunkEnd - m_chunkPos)) {
+        // The remaining space of the last chunk is lost
+        char *chunk = static_cast<char *>(std::malloc(CHUNK_SIZE));
+        if (!chunk) {
+            --m_liveCount;
+            throw std::bad_alloc();
+        }
+        m_chunks.push_back(chunk);
+        m_chunkPos = chunk;
+        m_chunkEnd = chunk + CHUNK_SIZE;
+    }
+    block = m_chunkPos;
+    m_chunkPos += size;
+    return block;
+}
+
+void ObjectArena::Free(void *block, std::size_t sizeClass)
+{
+    assert(m_liveCount > 0);
+
+    *static_cast<void **>(block) = m_freeLists[sizeClass];
+    m_freeLists[sizeClass] = block;
+
+    if ((--m_liveCount == 0) && m_released) delete this;
+}
+
+} // namespace vrv
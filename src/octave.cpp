@@ -36,13 +36,13 @@ Octave::Octave()
     , AttNNumberLike()
     , AttOctaveDisplacement()
 {
-    this->RegisterInterface(TimeSpanningInterface::GetAttClasses(), TimeSpanningInterface::IsInterface());
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_EXTENDER);
-    this->RegisterAttClass(ATT_LINEREND);
-    this->RegisterAttClass(ATT_LINERENDBASE);
-    this->RegisterAttClass(ATT_NNUMBERLIKE);
-    this->RegisterAttClass(ATT_OCTAVEDISPLACEMENT);
+    this->RegisterInterface<TimeSpanningInterface>(this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttExtender>(ATT_EXTENDER, this);
+    this->RegisterAttClass<AttLineRend>(ATT_LINEREND, this);
+    this->RegisterAttClass<AttLineRendBase>(ATT_LINERENDBASE, this);
+    this->RegisterAttClass<AttNNumberLike>(ATT_NNUMBERLIKE, this);
+    this->RegisterAttClass<AttOctaveDisplacement>(ATT_OCTAVEDISPLACEMENT, this);
 
     this->Reset();
 }
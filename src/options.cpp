@@ -916,6 +916,12 @@ Options::Options()
     m_allPages.SetShortOption('a', true);
     m_baseOptions.AddOption(&m_allPages);
 
+    m_allTunes.SetInfo("All tunes", "Render all the tunes of an ABC collection in parallel with one output per tune");
+    m_allTunes.Init(false);
+    m_allTunes.SetKey("allTunes");
+    m_allTunes.SetShortOption(' ', true);
+    m_baseOptions.AddOption(&m_allTunes);
+
     m_inputFrom.SetInfo("Input from",
         "Select input format from: \"abc\", \"darms\", \"humdrum\", \"mei\", \"pae\", \"xml\" (musicxml)");
     m_inputFrom.Init("mei");
@@ -951,11 +957,12 @@ Options::Options()
     m_scale.Init(DEFAULT_SCALE, MIN_SCALE, MAX_SCALE);
     m_scale.SetKey("scale");
     m_scale.SetShortOption('s', false);
+    m_scale.SetStage(OptionStage::CastOff);
     m_baseOptions.AddOption(&m_scale);
 
     m_outputTo.SetInfo("Output to",
         "Select output format to: \"mei\", \"mei-pb\", \"mei-basic\", \"svg\", \"midi\", \"timemap\", "
-        "\"expansionmap\", \"humdrum\" or "
+        "\"expansionmap\", \"humdrum\", \"hummidi\" or "
         "\"pae\"");
     m_outputTo.Init("svg");
     m_outputTo.SetKey("outputTo");
@@ -982,141 +989,196 @@ Options::Options()
 
     m_adjustPageHeight.SetInfo("Adjust page height", "Adjust the page height to the height of the content");
     m_adjustPageHeight.Init(false);
+    m_adjustPageHeight.SetStage(OptionStage::VerticalLayout);
     this->Register(&m_adjustPageHeight, "adjustPageHeight", &m_general);
 
     m_adjustPageWidth.SetInfo("Adjust page width", "Adjust the page width to the width of the content");
     m_adjustPageWidth.Init(false);
+    m_adjustPageWidth.SetStage(OptionStage::CastOff);
     this->Register(&m_adjustPageWidth, "adjustPageWidth", &m_general);
 
     m_breaks.SetInfo("Breaks", "Define page and system breaks layout");
     m_breaks.Init(BREAKS_auto, &Option::s_breaks);
+    m_breaks.SetStage(OptionStage::CastOff);
     this->Register(&m_breaks, "breaks", &m_general);
 
     m_breaksSmartSb.SetInfo("Smart breaks sb usage threshold",
         "In smart breaks mode, the portion of system width usage at which an encoded sb will be used");
     m_breaksSmartSb.Init(0.66, 0.0, 1.0);
+    m_breaksSmartSb.SetStage(OptionStage::CastOff);
     this->Register(&m_breaksSmartSb, "breaksSmartSb", &m_general);
 
     m_condense.SetInfo("Condense", "Control condensed score layout");
     m_condense.Init(CONDENSE_auto, &Option::s_condense);
+    m_condense.SetStage(OptionStage::CastOff);
     this->Register(&m_condense, "condense", &m_general);
 
     m_condenseFirstPage.SetInfo("Condense first page", "When condensing a score also condense the first page");
     m_condenseFirstPage.Init(false);
+    m_condenseFirstPage.SetStage(OptionStage::CastOff);
     this->Register(&m_condenseFirstPage, "condenseFirstPage", &m_general);
 
     m_condenseNotLastSystem.SetInfo(
         "Condense not last system", "When condensing a score never condense the last system");
     m_condenseNotLastSystem.Init(false);
+    m_condenseNotLastSystem.SetStage(OptionStage::CastOff);
     this->Register(&m_condenseNotLastSystem, "condenseNotLastSystem", &m_general);
 
     m_condenseTempoPages.SetInfo(
         "Condense tempo pages", "When condensing a score also condense pages with a tempo change");
     m_condenseTempoPages.Init(false);
+    m_condenseTempoPages.SetStage(OptionStage::CastOff);
     this->Register(&m_condenseTempoPages, "condenseTempoPages", &m_general);
 
+    m_dataOnly.SetInfo("Data only",
+        "Load the data without any layout, for MIDI, timemap, features or MEI output (pages are laid out on demand)");
+    m_dataOnly.Init(false);
+    m_dataOnly.SetStage(OptionStage::Data);
+    this->Register(&m_dataOnly, "dataOnly", &m_general);
+
     m_evenNoteSpacing.SetInfo("Even note spacing", "Align notes and rests without adding duration based space");
     m_evenNoteSpacing.Init(false);
     this->Register(&m_evenNoteSpacing, "evenNoteSpacing", &m_general);
 
     m_expand.SetInfo("Expand expansion", "Expand all referenced elements in the expansion <xml:id>");
     m_expand.Init("");
+    m_expand.SetStage(OptionStage::Data);
     this->Register(&m_expand, "expand", &m_general);
 
     m_footer.SetInfo("Footer", "Control footer layout");
     m_footer.Init(FOOTER_auto, &Option::s_footer);
+    m_footer.SetStage(OptionStage::Data);
     this->Register(&m_footer, "footer", &m_general);
 
     m_header.SetInfo("Header", "Control header layout");
     m_header.Init(HEADER_auto, &Option::s_header);
+    m_header.SetStage(OptionStage::Data);
     this->Register(&m_header, "header", &m_general);
 
     m_humType.SetInfo("Humdrum type", "Include type attributes when importing from Humdrum");
     m_humType.Init(false);
+    m_humType.SetStage(OptionStage::Data);
     this->Register(&m_humType, "humType", &m_general);
 
     m_incip.SetInfo("Incip", "Read <incip> elements as data input");
     m_incip.Init(false);
+    m_incip.SetStage(OptionStage::Data);
     this->Register(&m_incip, "incip", &m_general);
 
+    m_incipitMode.SetInfo("Incipit mode",
+        "No header and footer, and single-staff content on a single system without cast-off and cross-staff passes");
+    m_incipitMode.Init(false);
+    m_incipitMode.SetStage(OptionStage::Data);
+    this->Register(&m_incipitMode, "incipitMode", &m_general);
+
     m_justifyVertically.SetInfo("Justify vertically", "Justify spacing vertically to fill the page");
     m_justifyVertically.Init(false);
+    m_justifyVertically.SetStage(OptionStage::VerticalLayout);
     this->Register(&m_justifyVertically, "justifyVertically", &m_general);
 
     m_landscape.SetInfo("Landscape orientation", "Swap the values for page height and page width");
     m_landscape.Init(false);
+    m_landscape.SetStage(OptionStage::CastOff);
     this->Register(&m_landscape, "landscape", &m_general);
 
+    m_layoutCacheDir.SetInfo("Layout cache directory",
+        "The directory where the horizontal layout of the cast-off is persisted for the same input and options");
+    m_layoutCacheDir.Init("");
+    m_layoutCacheDir.SetStage(OptionStage::Drawing);
+    this->Register(&m_layoutCacheDir, "layoutCacheDir", &m_general);
+
+    m_layoutThreads.SetInfo("Layout threads",
+        "The number of threads for the measure-by-measure horizontal layout (0 for the number of hardware threads)");
+    m_layoutThreads.Init(1, 0, 64);
+    m_layoutThreads.SetStage(OptionStage::Drawing);
+    this->Register(&m_layoutThreads, "layoutThreads", &m_general);
+
     m_ligatureAsBracket.SetInfo("Ligature as bracket", "Render ligatures as bracket instead of original notation");
     m_ligatureAsBracket.Init(false);
     this->Register(&m_ligatureAsBracket, "ligatureAsBracket", &m_general);
 
     m_mensuralToMeasure.SetInfo("Mensural to measure", "Convert mensural sections to measure-based MEI");
     m_mensuralToMeasure.Init(false);
+    m_mensuralToMeasure.SetStage(OptionStage::Data);
     this->Register(&m_mensuralToMeasure, "mensuralToMeasure", &m_general);
 
     m_minLastJustification.SetInfo("Minimum last-system-justification width",
         "The last system is only justified if the unjustified width is greater than this percent");
     m_minLastJustification.Init(0.8, 0.0, 1.0);
+    m_minLastJustification.SetStage(OptionStage::CastOff);
     this->Register(&m_minLastJustification, "minLastJustification", &m_general);
 
     m_mmOutput.SetInfo("MM output", "Specify that the output in the SVG is given in mm (default is px)");
     m_mmOutput.Init(false);
+    m_mmOutput.SetStage(OptionStage::Drawing);
     this->Register(&m_mmOutput, "mmOutput", &m_general);
 
     m_moveScoreDefinitionToStaff.SetInfo("Move score definition to staff",
         "Move score definition (clef, keySig, meterSig, etc.) from scoreDef to staffDef");
     m_moveScoreDefinitionToStaff.Init(false);
+    m_moveScoreDefinitionToStaff.SetStage(OptionStage::Data);
     this->Register(&m_moveScoreDefinitionToStaff, "moveScoreDefinitionToStaff", &m_general);
 
     m_noJustification.SetInfo("No justification", "Do not justify the system");
     m_noJustification.Init(false);
+    m_noJustification.SetStage(OptionStage::CastOff);
     this->Register(&m_noJustification, "noJustification", &m_general);
 
     m_openControlEvents.SetInfo("Open control event", "Render open control events");
     m_openControlEvents.Init(false);
+    m_openControlEvents.SetStage(OptionStage::Data);
     this->Register(&m_openControlEvents, "openControlEvents", &m_general);
 
     m_outputIndent.SetInfo("Output indentation", "Output indentation value for MEI and SVG");
     m_outputIndent.Init(3, 1, 10);
+    m_outputIndent.SetStage(OptionStage::Drawing);
     this->Register(&m_outputIndent, "outputIndent", &m_general);
 
     m_outputFormatRaw.SetInfo(
         "Raw formatting for MEI output", "Writes MEI out with no line indenting or non-content newlines.");
     m_outputFormatRaw.Init(false);
+    m_outputFormatRaw.SetStage(OptionStage::Drawing);
     this->Register(&m_outputFormatRaw, "outputFormatRaw", &m_general);
 
     m_outputIndentTab.SetInfo("Output indentation with tab", "Output indentation with tabulation for MEI and SVG");
     m_outputIndentTab.Init(false);
+    m_outputIndentTab.SetStage(OptionStage::Drawing);
     this->Register(&m_outputIndentTab, "outputIndentTab", &m_general);
 
     m_outputSmuflXmlEntities.SetInfo(
         "Output SMuFL XML entities", "Output SMuFL characters as XML entities instead of hex byte codes ");
     m_outputSmuflXmlEntities.Init(false);
+    m_outputSmuflXmlEntities.SetStage(OptionStage::Drawing);
     this->Register(&m_outputSmuflXmlEntities, "outputSmuflXmlEntities", &m_general);
 
     m_pageHeight.SetInfo("Page height", "The page height");
     m_pageHeight.Init(2970, 100, 60000, true);
+    m_pageHeight.SetStage(OptionStage::CastOff);
     this->Register(&m_pageHeight, "pageHeight", &m_general);
 
     m_pageMarginBottom.SetInfo("Page bottom margin", "The page bottom margin");
     m_pageMarginBottom.Init(50, 0, 500, true);
+    m_pageMarginBottom.SetStage(OptionStage::CastOff);
     this->Register(&m_pageMarginBottom, "pageMarginBottom", &m_general);
 
     m_pageMarginLeft.SetInfo("Page left margin", "The page left margin");
     m_pageMarginLeft.Init(50, 0, 500, true);
+    m_pageMarginLeft.SetStage(OptionStage::CastOff);
     this->Register(&m_pageMarginLeft, "pageMarginLeft", &m_general);
 
     m_pageMarginRight.SetInfo("Page right margin", "The page right margin");
     m_pageMarginRight.Init(50, 0, 500, true);
+    m_pageMarginRight.SetStage(OptionStage::CastOff);
     this->Register(&m_pageMarginRight, "pageMarginRight", &m_general);
 
     m_pageMarginTop.SetInfo("Page top margin", "The page top margin");
     m_pageMarginTop.Init(50, 0, 500, true);
+    m_pageMarginTop.SetStage(OptionStage::CastOff);
     this->Register(&m_pageMarginTop, "pageMarginTop", &m_general);
 
     m_pageWidth.SetInfo("Page width", "The page width");
     m_pageWidth.Init(2100, 100, 100000, true);
+    m_pageWidth.SetStage(OptionStage::CastOff);
     this->Register(&m_pageWidth, "pageWidth", &m_general);
 
     m_pedalStyle.SetInfo("Pedal style", "The global pedal style");
@@ -1125,27 +1187,40 @@ Options::Options()
 
     m_preserveAnalyticalMarkup.SetInfo("Preserve analytical markup", "Preserves the analytical markup in MEI");
     m_preserveAnalyticalMarkup.Init(false);
+    m_preserveAnalyticalMarkup.SetStage(OptionStage::Data);
     this->Register(&m_preserveAnalyticalMarkup, "preserveAnalyticalMarkup", &m_general);
 
+    m_profile.SetInfo("Profile the processing",
+        "Record the time spent in the processing stages, functors, drawing, import and export (see the profiling "
+        "report)");
+    m_profile.Init(false);
+    m_profile.SetStage(OptionStage::Drawing);
+    this->Register(&m_profile, "profile", &m_general);
+
     m_removeIds.SetInfo("Remove IDs in MEI", "Remove XML IDs in the MEI output that are not referenced");
     m_removeIds.Init(false);
+    m_removeIds.SetStage(OptionStage::Drawing);
     this->Register(&m_removeIds, "removeIds", &m_general);
 
     m_scaleToPageSize.SetInfo(
         "Scale to fit the page size", "Scale the content within the page instead of scaling the page itself");
     m_scaleToPageSize.Init(false);
+    m_scaleToPageSize.SetStage(OptionStage::CastOff);
     this->Register(&m_scaleToPageSize, "scaleToPageSize", &m_general);
 
     m_showRuntime.SetInfo("Show runtime on CLI", "Display the total runtime on command-line");
     m_showRuntime.Init(false);
+    m_showRuntime.SetStage(OptionStage::Drawing);
     this->Register(&m_showRuntime, "showRuntime", &m_general);
 
     m_shrinkToFit.SetInfo("Shrink content to fit page", "Scale down page content to fit the page height if needed");
     m_shrinkToFit.Init(false);
+    m_shrinkToFit.SetStage(OptionStage::Drawing);
     this->Register(&m_shrinkToFit, "shrinkToFit", &m_general);
 
     m_smuflTextFont.SetInfo("Smufl text font", "Specify if the smufl text font is embedded, linked, or ignored");
     m_smuflTextFont.Init(SMUFLTEXTFONT_embedded, &Option::s_smuflTextFont);
+    m_smuflTextFont.SetStage(OptionStage::Drawing);
     this->Register(&m_smuflTextFont, "smuflTextFont", &m_general);
 
     m_staccatoCenter.SetInfo(
@@ -1153,37 +1228,64 @@ Options::Options()
     m_staccatoCenter.Init(false);
     this->Register(&m_staccatoCenter, "staccatoCenter", &m_general);
 
+    m_streamingImport.SetInfo("Streaming import",
+        "Import score-based MEI measure by measure to reduce the memory used by the import (e.g., from 304 MB to 277 "
+        "MB for a 9 MB file); the peak memory of the process, reached when preparing the data, is not reduced; "
+        "not applied with XPath queries");
+    m_streamingImport.Init(false);
+    m_streamingImport.SetStage(OptionStage::Data);
+    this->Register(&m_streamingImport, "streamingImport", &m_general);
+
     m_svgBoundingBoxes.SetInfo("Svg bounding boxes viewbox on svg root", "Include bounding boxes in SVG output");
     m_svgBoundingBoxes.Init(false);
+    m_svgBoundingBoxes.SetStage(OptionStage::VerticalLayout);
     this->Register(&m_svgBoundingBoxes, "svgBoundingBoxes", &m_general);
 
     m_svgCss.SetInfo("SVG additional CSS", "CSS (as a string) to be added to the SVG output");
     m_svgCss.Init("");
+    m_svgCss.SetStage(OptionStage::Drawing);
     this->Register(&m_svgCss, "svgCss", &m_general);
 
     m_svgViewBox.SetInfo("Use viewbox on svg root", "Use viewBox on svg root element for easy scaling of document");
     m_svgViewBox.Init(false);
+    m_svgViewBox.SetStage(OptionStage::Drawing);
     this->Register(&m_svgViewBox, "svgViewBox", &m_general);
 
     m_svgHtml5.SetInfo("Output SVG for HTML5 embedding",
         "Write data-id and data-class attributes for JS usage and id clash avoidance");
     m_svgHtml5.Init(false);
+    m_svgHtml5.SetStage(OptionStage::Drawing);
     this->Register(&m_svgHtml5, "svgHtml5", &m_general);
 
     m_svgFormatRaw.SetInfo(
         "Raw formatting for SVG output", "Writes SVG out with no line indenting or non-content newlines");
     m_svgFormatRaw.Init(false);
+    m_svgFormatRaw.SetStage(OptionStage::Drawing);
     this->Register(&m_svgFormatRaw, "svgFormatRaw", &m_general);
 
     m_svgRemoveXlink.SetInfo("Remove xlink: from href attributes",
         "Removes the xlink: prefix on href attributes for compatibility with some newer browsers");
     m_svgRemoveXlink.Init(false);
+    m_svgRemoveXlink.SetStage(OptionStage::Drawing);
     this->Register(&m_svgRemoveXlink, "svgRemoveXlink", &m_general);
 
+    m_svgGlyphSprite.SetInfo("Reference glyphs from a shared sprite",
+        "Do not include the glyphs in the SVG but reference them with font-qualified IDs from a shared sprite");
+    m_svgGlyphSprite.Init(false);
+    m_svgGlyphSprite.SetStage(OptionStage::Drawing);
+    this->Register(&m_svgGlyphSprite, "svgGlyphSprite", &m_general);
+
+    m_svgGlyphSpriteUrl.SetInfo(
+        "URL of the glyph sprite", "The URL of the external glyph sprite (empty for a sprite inlined in the page)");
+    m_svgGlyphSpriteUrl.Init("");
+    m_svgGlyphSpriteUrl.SetStage(OptionStage::Drawing);
+    this->Register(&m_svgGlyphSpriteUrl, "svgGlyphSpriteUrl", &m_general);
+
     m_svgAdditionalAttribute.SetInfo("Add additional attribute in SVG",
         "Add additional attribute for graphical elements in SVG as \"data-*\", for "
         "example, \"note@pname\" would add a \"data-pname\" to all note elements");
     m_svgAdditionalAttribute.Init();
+    m_svgAdditionalAttribute.SetStage(OptionStage::Drawing);
     this->Register(&m_svgAdditionalAttribute, "svgAdditionalAttribute", &m_general);
 
     m_unit.SetInfo("Unit", "The MEI unit (1⁄2 of the distance between the staff lines)");
@@ -1197,19 +1299,23 @@ Options::Options()
     m_useFacsimile.SetInfo(
         "Use facsimile for layout", "Use information in the <facsimile> element to control the layout");
     m_useFacsimile.Init(false);
+    m_useFacsimile.SetStage(OptionStage::Data);
     this->Register(&m_useFacsimile, "useFacsimile", &m_general);
 
     m_usePgFooterForAll.SetInfo("Use PgFooter for all", "Use the pgFooter for all pages");
     m_usePgFooterForAll.Init(false);
+    m_usePgFooterForAll.SetStage(OptionStage::CastOff);
     this->Register(&m_usePgFooterForAll, "usePgFooterForAll", &m_general);
 
     m_usePgHeaderForAll.SetInfo("Use PgHeader for all", "Use the pgHeader for all pages");
     m_usePgHeaderForAll.Init(false);
+    m_usePgHeaderForAll.SetStage(OptionStage::CastOff);
     this->Register(&m_usePgHeaderForAll, "usePgHeaderForAll", &m_general);
 
     m_xmlIdChecksum.SetInfo(
         "XML IDs based on checksum", "Seed the generator for XML IDs using the checksum of the input data");
     m_xmlIdChecksum.Init(false);
+    m_xmlIdChecksum.SetStage(OptionStage::Data);
     this->Register(&m_xmlIdChecksum, "xmlIdChecksum", &m_general);
 
     /********* General layout *********/
@@ -1252,6 +1358,7 @@ Options::Options()
     m_breaksNoWidow.SetInfo(
         "Breaks no widow", "Prevent single measures on the last page by fitting it into previous system");
     m_breaksNoWidow.Init(false);
+    m_breaksNoWidow.SetStage(OptionStage::CastOff);
     this->Register(&m_breaksNoWidow, "breaksNoWidow", &m_generalLayout);
 
     // Optimized for five line staves
@@ -1266,6 +1373,7 @@ Options::Options()
 
     m_dynamDist.SetInfo("Dynam dist", "The default distance from the staff for dynamic marks");
     m_dynamDist.Init(1.0, 0.5, 16.0);
+    m_dynamDist.SetStage(OptionStage::VerticalLayout);
     this->Register(&m_dynamDist, "dynamDist", &m_generalLayout);
 
     m_dynamSingleGlyphs.SetInfo("Dynam single glyphs", "Don't use SMuFL's predefined dynamics glyph combinations");
@@ -1321,29 +1429,35 @@ Options::Options()
 
     m_harmDist.SetInfo("Harm dist", "The default distance from the staff of harmonic indications");
     m_harmDist.Init(1.0, 0.5, 16.0);
+    m_harmDist.SetStage(OptionStage::VerticalLayout);
     this->Register(&m_harmDist, "harmDist", &m_generalLayout);
 
     m_justificationStaff.SetInfo("Spacing staff justification", "The staff justification");
     m_justificationStaff.Init(1., 0., 10.);
+    m_justificationStaff.SetStage(OptionStage::VerticalLayout);
     this->Register(&m_justificationStaff, "justificationStaff", &m_generalLayout);
 
     m_justificationSystem.SetInfo("Spacing system justification", "The system spacing justification");
     m_justificationSystem.Init(1., 0., 10.);
+    m_justificationSystem.SetStage(OptionStage::VerticalLayout);
     this->Register(&m_justificationSystem, "justificationSystem", &m_generalLayout);
 
     m_justificationBracketGroup.SetInfo(
         "Spacing bracket group justification", "Space between staves inside a bracketed group justification");
     m_justificationBracketGroup.Init(1., 0., 10.);
+    m_justificationBracketGroup.SetStage(OptionStage::VerticalLayout);
     this->Register(&m_justificationBracketGroup, "justificationBracketGroup", &m_generalLayout);
 
     m_justificationBraceGroup.SetInfo(
         "Spacing brace group justification", "Space between staves inside a braced group justification");
     m_justificationBraceGroup.Init(1., 0., 10.);
+    m_justificationBraceGroup.SetStage(OptionStage::VerticalLayout);
     this->Register(&m_justificationBraceGroup, "justificationBraceGroup", &m_generalLayout);
 
     m_justificationMaxVertical.SetInfo("Maximum ratio of justifiable height for page",
         "Maximum ratio of justifiable height to page height that can be used for the vertical justification");
     m_justificationMaxVertical.Init(0.3, 0.0, 1.0);
+    m_justificationMaxVertical.SetStage(OptionStage::VerticalLayout);
     this->Register(&m_justificationMaxVertical, "justificationMaxVertical", &m_generalLayout);
 
     m_ledgerLineThickness.SetInfo("Ledger line thickness", "The thickness of the ledger lines");
@@ -1373,6 +1487,7 @@ Options::Options()
 
     m_lyricTopMinMargin.SetInfo("Lyric top min margin", "The minmal margin above the lyrics in MEI units");
     m_lyricTopMinMargin.Init(2.0, 0.0, 8.0);
+    m_lyricTopMinMargin.SetStage(OptionStage::VerticalLayout);
     this->Register(&m_lyricTopMinMargin, "lyricTopMinMargin", &m_generalLayout);
 
     m_lyricWordSpace.SetInfo("Lyric word space", "The lyric word space length");
@@ -1427,41 +1542,50 @@ Options::Options()
 
     m_slurCurveFactor.SetInfo("Slur curve factor", "Slur curve factor - high value means rounder slurs");
     m_slurCurveFactor.Init(1.0, 0.2, 5.0);
+    m_slurCurveFactor.SetStage(OptionStage::VerticalLayout);
     this->Register(&m_slurCurveFactor, "slurCurveFactor", &m_generalLayout);
 
     m_slurEndpointFlexibility.SetInfo(
         "Slur endpoint flexibility", "Slur endpoint flexibility - allow more endpoint movement during adjustment");
     m_slurEndpointFlexibility.Init(0.0, 0.0, 1.0);
+    m_slurEndpointFlexibility.SetStage(OptionStage::VerticalLayout);
     this->Register(&m_slurEndpointFlexibility, "slurEndpointFlexibility", &m_generalLayout);
 
     m_slurEndpointThickness.SetInfo("Slur endpoint thickness", "The endpoint slur thickness in MEI units");
     m_slurEndpointThickness.Init(0.1, 0.05, 0.25);
+    m_slurEndpointThickness.SetStage(OptionStage::VerticalLayout);
     this->Register(&m_slurEndpointThickness, "slurEndpointThickness", &m_generalLayout);
 
     m_slurMargin.SetInfo("Slur margin", "Slur safety distance in MEI units to obstacles");
     m_slurMargin.Init(1.0, 0.1, 4.0);
+    m_slurMargin.SetStage(OptionStage::VerticalLayout);
     this->Register(&m_slurMargin, "slurMargin", &m_generalLayout);
 
     m_slurMaxSlope.SetInfo("Slur max slope", "The maximum slur slope in degrees");
     m_slurMaxSlope.Init(60, 30, 85);
+    m_slurMaxSlope.SetStage(OptionStage::VerticalLayout);
     this->Register(&m_slurMaxSlope, "slurMaxSlope", &m_generalLayout);
 
     m_slurMidpointThickness.SetInfo("Slur midpoint thickness", "The midpoint slur thickness in MEI units");
     m_slurMidpointThickness.Init(0.6, 0.2, 1.2);
+    m_slurMidpointThickness.SetStage(OptionStage::VerticalLayout);
     this->Register(&m_slurMidpointThickness, "slurMidpointThickness", &m_generalLayout);
 
     m_slurSymmetry.SetInfo("Slur symmetry", "Slur symmetry - high value means more symmetric slurs");
     m_slurSymmetry.Init(0.0, 0.0, 1.0);
+    m_slurSymmetry.SetStage(OptionStage::VerticalLayout);
     this->Register(&m_slurSymmetry, "slurSymmetry", &m_generalLayout);
 
     m_spacingBraceGroup.SetInfo(
         "Spacing brace group", "Minimum space between staves inside a braced group in MEI units");
     m_spacingBraceGroup.Init(12, 0, 48);
+    m_spacingBraceGroup.SetStage(OptionStage::VerticalLayout);
     this->Register(&m_spacingBraceGroup, "spacingBraceGroup", &m_generalLayout);
 
     m_spacingBracketGroup.SetInfo(
         "Spacing bracket group", "Minimum space between staves inside a bracketed group in MEI units");
     m_spacingBracketGroup.Init(12, 0, 48);
+    m_spacingBracketGroup.SetStage(OptionStage::VerticalLayout);
     this->Register(&m_spacingBracketGroup, "spacingBracketGroup", &m_generalLayout);
 
     m_spacingDurDetection.SetInfo("Spacing dur detection", "Detect long duration for adjusting spacing");
@@ -1478,10 +1602,12 @@ Options::Options()
 
     m_spacingStaff.SetInfo("Spacing staff", "The staff minimal spacing in MEI units");
     m_spacingStaff.Init(12, 0, 48);
+    m_spacingStaff.SetStage(OptionStage::VerticalLayout);
     this->Register(&m_spacingStaff, "spacingStaff", &m_generalLayout);
 
     m_spacingSystem.SetInfo("Spacing system", "The system minimal spacing in MEI units");
     m_spacingSystem.Init(4, 0, 48);
+    m_spacingSystem.SetStage(OptionStage::VerticalLayout);
     this->Register(&m_spacingSystem, "spacingSystem", &m_generalLayout);
 
     m_staffLineWidth.SetInfo("Staff line width", "The staff line width in MEI units");
@@ -1502,6 +1628,7 @@ Options::Options()
 
     m_systemMaxPerPage.SetInfo("Max. System per Page", "Maximum number of systems per page");
     m_systemMaxPerPage.Init(0, 0, 24);
+    m_systemMaxPerPage.SetStage(OptionStage::CastOff);
     this->Register(&m_systemMaxPerPage, "systemMaxPerPage", &m_generalLayout);
 
     m_textEnclosureThickness.SetInfo("Text box line thickness", "The thickness of the line text enclosing box");
@@ -1543,51 +1670,61 @@ Options::Options()
         "\"./rdg[contains(@source, 'source-id')]\"; by default the <lem> or the "
         "first <rdg> is selected");
     m_appXPathQuery.Init();
+    m_appXPathQuery.SetStage(OptionStage::Data);
     this->Register(&m_appXPathQuery, "appXPathQuery", &m_selectors);
 
     m_choiceXPathQuery.SetInfo("Choice xPath query",
         "Set the xPath query for selecting <choice> child elements, for "
         "example: \"./orig\"; by default the first child is selected");
     m_choiceXPathQuery.Init();
+    m_choiceXPathQuery.SetStage(OptionStage::Data);
     this->Register(&m_choiceXPathQuery, "choiceXPathQuery", &m_selectors);
 
     m_loadSelectedMdivOnly.SetInfo(
         "Load selected Mdiv only", "Load only the selected mdiv; the content of the other is skipped");
     m_loadSelectedMdivOnly.Init(false);
+    m_loadSelectedMdivOnly.SetStage(OptionStage::Data);
     this->Register(&m_loadSelectedMdivOnly, "loadSelectedMdivOnly", &m_selectors);
 
     m_mdivAll.SetInfo("Mdiv all", "Load and render all <mdiv> elements in the MEI files");
     m_mdivAll.Init(false);
+    m_mdivAll.SetStage(OptionStage::Data);
     this->Register(&m_mdivAll, "mdivAll", &m_selectors);
 
     m_mdivXPathQuery.SetInfo("Mdiv xPath query",
         "Set the xPath query for selecting the <mdiv> to be rendered; only one <mdiv> can be rendered");
     m_mdivXPathQuery.Init("");
+    m_mdivXPathQuery.SetStage(OptionStage::Data);
     this->Register(&m_mdivXPathQuery, "mdivXPathQuery", &m_selectors);
 
     m_substXPathQuery.SetInfo("Subst xPath query",
         "Set the xPath query for selecting <subst> child elements, for "
         "example: \"./del\"; by default the first child is selected");
     m_substXPathQuery.Init();
+    m_substXPathQuery.SetStage(OptionStage::Data);
     this->Register(&m_substXPathQuery, "substXPathQuery", &m_selectors);
 
     m_transpose.SetInfo("Transpose the content", "Transpose the entire content");
     m_transpose.Init("");
+    m_transpose.SetStage(OptionStage::Data);
     this->Register(&m_transpose, "transpose", &m_selectors);
 
     m_transposeMdiv.SetInfo(
         "Transpose individual mdivs", "Json mapping the mdiv ids to the corresponding transposition");
     m_transposeMdiv.Init(JsonSource::String, "{}");
+    m_transposeMdiv.SetStage(OptionStage::Data);
     this->Register(&m_transposeMdiv, "transposeMdiv", &m_selectors);
 
     m_transposeSelectedOnly.SetInfo(
         "Transpose selected only", "Transpose only the selected content and ignore unselected editorial content");
     m_transposeSelectedOnly.Init(false);
+    m_transposeSelectedOnly.SetStage(OptionStage::Data);
     this->Register(&m_transposeSelectedOnly, "transposeSelectedOnly", &m_selectors);
 
     m_transposeToSoundingPitch.SetInfo(
         "Transpose to sounding pitch", "Transpose to sounding pitch by evaluating @trans.semi");
     m_transposeToSoundingPitch.Init(false);
+    m_transposeToSoundingPitch.SetStage(OptionStage::Data);
     this->Register(&m_transposeToSoundingPitch, "transposeToSoundingPitch", &m_selectors);
 
     /********* The layout margins by element *********/
@@ -1792,10 +1929,12 @@ Options::Options()
 
     m_midiNoCue.SetInfo("MIDI playback of cue notes", "Skip cue notes in MIDI output");
     m_midiNoCue.Init(false);
+    m_midiNoCue.SetStage(OptionStage::Drawing);
     this->Register(&m_midiNoCue, "midiNoCue", &m_midi);
 
     m_midiTempoAdjustment.SetInfo("MIDI tempo adjustment", "The MIDI tempo adjustment factor");
     m_midiTempoAdjustment.Init(1.0, 0.2, 4.0);
+    m_midiTempoAdjustment.SetStage(OptionStage::Drawing);
     this->Register(&m_midiTempoAdjustment, "midiTempoAdjustment", &m_midi);
 
     /********* Deprecated options *********/
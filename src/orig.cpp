@@ -25,7 +25,7 @@ static const ClassRegistrar<Orig> s_factory("orig", ORIG);
 
 Orig::Orig() : EditorialElement(ORIG, "orig-"), AttSource()
 {
-    this->RegisterAttClass(ATT_SOURCE);
+    this->RegisterAttClass<AttSource>(ATT_SOURCE, this);
 
     this->Reset();
 }
@@ -38,11 +38,11 @@ Ornam::Ornam()
     , AttExtSym()
     , AttOrnamentAccid()
 {
-    this->RegisterInterface(TextDirInterface::GetAttClasses(), TextDirInterface::IsInterface());
-    this->RegisterInterface(TimePointInterface::GetAttClasses(), TimePointInterface::IsInterface());
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_EXTSYM);
-    this->RegisterAttClass(ATT_ORNAMENTACCID);
+    this->RegisterInterface<TextDirInterface>(this);
+    this->RegisterInterface<TimePointInterface>(this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttExtSym>(ATT_EXTSYM, this);
+    this->RegisterAttClass<AttOrnamentAccid>(ATT_ORNAMENTACCID, this);
 
     this->Reset();
 }
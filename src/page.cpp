@@ -59,10 +59,12 @@
 #include "pgfoot2.h"
 #include "pghead.h"
 #include "pghead2.h"
+#include "profiler.h"
 #include "resetfunctor.h"
 #include "score.h"
 #include "staff.h"
 #include "system.h"
+#include "threadpool.h"
 #include "view.h"
 #include "vrv.h"
 
@@ -190,6 +192,8 @@ const RunningElement *Page::GetFooter() const
 
 void Page::LayOut(bool force)
 {
+    ProfilerEvent event(PROFILER_STAGE, "Page::LayOut");
+
     if (m_layoutDone && !force) {
         // We only need to reset the header - this will adjust the page number if necessary
         if (this->GetHeader()) this->GetHeader()->SetDrawingPage(this);
@@ -218,6 +222,8 @@ void Page::LayOut(bool force)
 
 void Page::LayOutTranscription(bool force)
 {
+    ProfilerEvent event(PROFILER_STAGE, "Page::LayOutTranscription");
+
     if (m_layoutDone && !force) {
         return;
     }
@@ -279,6 +285,23 @@ void Page::LayOutTranscription(bool force)
     m_layoutDone = true;
 }
 
+void Page::AlignDurations()
+{
+    Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
+    assert(doc);
+
+    // Doc::SetDrawingPage should have been called before
+    // Make sure we have the correct page
+    assert(this == doc->GetDrawingPage());
+
+    ResetHorizontalAlignmentFunctor resetHorizontalAlignment;
+    this->Process(resetHorizontalAlignment);
+
+    // Fill the measure aligners - this sets the time of each Alignment and the duration of the measures
+    AlignHorizontallyFunctor alignHorizontally(doc);
+    this->Process(alignHorizontally);
+}
+
 void Page::ResetAligners()
 {
     Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
@@ -362,6 +385,8 @@ void Page::ResetAligners()
 
 void Page::LayOutHorizontally()
 {
+    ProfilerEvent event(PROFILER_STAGE, "Page::LayOutHorizontally");
+
     Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
     assert(doc);
 
@@ -384,42 +409,8 @@ void Page::LayOutHorizontally()
     AdjustArticFunctor adjustArtic(doc);
     this->Process(adjustArtic);
 
-    // Adjust the x position of the LayerElement where multiple layers collide
-    // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
-    // For the first iteration align elements without taking dots into consideration
-    AdjustLayersFunctor adjustLayers(doc, doc->GetCurrentScoreDef()->GetStaffNs());
-    this->Process(adjustLayers);
-
-    // Adjust dots for the multiple layers. Try to align dots that can be grouped together when layers collide,
-    // otherwise keep their relative positioning
-    AdjustDotsFunctor adjustDots(doc, doc->GetCurrentScoreDef()->GetStaffNs());
-    this->Process(adjustDots);
-
-    // Adjust layers again, this time including dots positioning
-    AdjustLayersFunctor adjustLayersWithDots(doc, doc->GetCurrentScoreDef()->GetStaffNs());
-    adjustLayersWithDots.IgnoreDots(false);
-    this->Process(adjustLayersWithDots);
-
-    // Adjust the X position of the accidentals, including in chords
-    AdjustAccidXFunctor adjustAccidX(doc);
-    this->Process(adjustAccidX);
-
-    // Adjust the X shift of the Alignment looking at the bounding boxes
-    // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
-    AdjustXPosFunctor adjustXPos(doc, doc->GetCurrentScoreDef()->GetStaffNs());
-    adjustXPos.SetExcluded({ TABDURSYM });
-    this->Process(adjustXPos);
-
-    // Adjust tabRhythm separately
-    adjustXPos.ClearExcluded();
-    adjustXPos.SetIncluded({ BARLINE, KEYSIG, METERSIG, TABDURSYM });
-    adjustXPos.SetRightBarLinesOnly(true);
-    this->Process(adjustXPos);
-
-    // Adjust the X shift of the Alignment looking at the bounding boxes
-    // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
-    AdjustGraceXPosFunctor adjustGraceXPos(doc, doc->GetCurrentScoreDef()->GetStaffNs());
-    this->Process(adjustGraceXPos);
+    // Adjust the layers, the dots, the accidentals and the x position measure by measure
+    this->AdjustHorizontallyByMeasure(doc);
 
     // Adjust the spacing of clef changes since they are skipped in AdjustXPos
     // Look at each clef change and  move them to the left and add space if necessary
@@ -457,6 +448,81 @@ void Page::LayOutHorizontally()
     this->Process(alignMeasures);
 }
 
+void Page::AdjustHorizontallyByMeasure(Doc *doc)
+{
+    // Collect the measures with the score they belong to
+    // The staves of each score are looked for beforehand since the list of the scoreDef is updated lazily
+    std::vector<std::pair<Measure *, Score *>> measures;
+    std::map<Score *, std::vector<int>> staffNsByScore;
+    Score *score = doc->GetCurrentScore();
+    staffNsByScore[score] = score->GetScoreDef()->GetStaffNs();
+    ListOfObjects objects;
+    ClassIdsComparison comparison({ SCORE, MEASURE });
+    this->FindAllDescendantsByComparison(&objects, &comparison, 2);
+    for (Object *object : objects) {
+        if (object->Is(SCORE)) {
+            score = vrv_cast<Score *>(object);
+            staffNsByScore[score] = score->GetScoreDef()->GetStaffNs();
+        }
+        else {
+            measures.push_back({ vrv_cast<Measure *>(object), score });
+        }
+    }
+
+    // The adjustments only look at the content of the measure and can be done independently for each of them
+    auto adjustMeasure = [doc, &measures, &staffNsByScore](int index) {
+        Measure *measure = measures.at(index).first;
+        Score *score = measures.at(index).second;
+        const std::vector<int> &staffNs = staffNsByScore.at(score);
+
+        // Adjust the x position of the LayerElement where multiple layers collide
+        // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
+        // For the first iteration align elements without taking dots into consideration
+        AdjustLayersFunctor adjustLayers(doc, staffNs);
+        measure->Process(adjustLayers);
+
+        // Adjust dots for the multiple layers. Try to align dots that can be grouped together when layers collide,
+        // otherwise keep their relative positioning
+        AdjustDotsFunctor adjustDots(doc, staffNs);
+        measure->Process(adjustDots);
+
+        // Adjust layers again, this time including dots positioning
+        AdjustLayersFunctor adjustLayersWithDots(doc, staffNs);
+        adjustLayersWithDots.IgnoreDots(false);
+        measure->Process(adjustLayersWithDots);
+
+        // Adjust the X position of the accidentals, including in chords
+        AdjustAccidXFunctor adjustAccidX(doc);
+        adjustAccidX.SetScoreDef(score->GetScoreDef());
+        measure->Process(adjustAccidX);
+
+        // Adjust the X shift of the Alignment looking at the bounding boxes
+        // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
+        AdjustXPosFunctor adjustXPos(doc, staffNs);
+        adjustXPos.SetExcluded({ TABDURSYM });
+        measure->Process(adjustXPos);
+
+        // Adjust tabRhythm separately
+        adjustXPos.ClearExcluded();
+        adjustXPos.SetIncluded({ BARLINE, KEYSIG, METERSIG, TABDURSYM });
+        adjustXPos.SetRightBarLinesOnly(true);
+        measure->Process(adjustXPos);
+
+        // Adjust the X shift of the Alignment looking at the bounding boxes
+        // Look at each LayerElement and change the m_xShift if the bounding box is overlapping
+        AdjustGraceXPosFunctor adjustGraceXPos(doc, staffNs);
+        measure->Process(adjustGraceXPos);
+    };
+
+    ThreadPool *threadPool = doc->GetLayoutThreadPool();
+    if (!threadPool || (measures.size() < 2)) {
+        for (int i = 0; i < (int)measures.size(); ++i) adjustMeasure(i);
+    }
+    else {
+        threadPool->Run((int)measures.size(), adjustMeasure);
+    }
+}
+
 void Page::LayOutHorizontallyWithCache(bool restore)
 {
     Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
@@ -469,6 +535,8 @@ void Page::LayOutHorizontallyWithCache(bool restore)
 
 void Page::LayOutVertically()
 {
+    ProfilerEvent event(PROFILER_STAGE, "Page::LayOutVertically");
+
     Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
     assert(doc);
 
@@ -530,9 +598,11 @@ void Page::LayOutVertically()
     AdjustFloatingPositionersFunctor adjustFloatingPositioners(doc);
     this->Process(adjustFloatingPositioners);
 
-    // Adjust the overlap of the staff alignments by looking at the overflow bounding boxes
-    AdjustStaffOverlapFunctor adjustStaffOverlap(doc);
-    this->Process(adjustStaffOverlap);
+    // Adjust the overlap of the staff alignments by looking at the overflow bounding boxes - not with a single staff
+    if (!doc->IsIncipit()) {
+        AdjustStaffOverlapFunctor adjustStaffOverlap(doc);
+        this->Process(adjustStaffOverlap);
+    }
 
     // Set the Y position of each StaffAlignment
     // Adjust the Y shift to make sure there is a minimal space (staffMargin) between each staff
@@ -543,8 +613,10 @@ void Page::LayOutVertically()
     AdjustFloatingPositionersBetweenFunctor adjustFloatingPositionersBetween(doc);
     this->Process(adjustFloatingPositionersBetween);
 
-    AdjustCrossStaffYPosFunctor adjustCrossStaffYPos(doc);
-    this->Process(adjustCrossStaffYPos);
+    if (!doc->IsIncipit()) {
+        AdjustCrossStaffYPosFunctor adjustCrossStaffYPos(doc);
+        this->Process(adjustCrossStaffYPos);
+    }
 
     // Redraw are re-adjust the position of the slurs when we have cross-staff ones
     if (adjustSlurs.HasCrossStaffSlurs()) {
@@ -573,6 +645,8 @@ void Page::LayOutVertically()
 
 void Page::JustifyHorizontally()
 {
+    ProfilerEvent event(PROFILER_STAGE, "Page::JustifyHorizontally");
+
     Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
     assert(doc);
 
@@ -599,6 +673,8 @@ void Page::JustifyHorizontally()
 
 void Page::JustifyVertically()
 {
+    ProfilerEvent event(PROFILER_STAGE, "Page::JustifyVertically");
+
     Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
     assert(doc);
 
@@ -673,6 +749,8 @@ bool Page::IsJustificationRequired(const Doc *doc)
 
 void Page::LayOutPitchPos()
 {
+    ProfilerEvent event(PROFILER_STAGE, "Page::LayOutPitchPos");
+
     Doc *doc = vrv_cast<Doc *>(this->GetFirstAncestor(DOC));
     assert(doc);
 
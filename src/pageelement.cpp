@@ -24,21 +24,21 @@ namespace vrv {
 
 PageElement::PageElement() : Object(PAGE_ELEMENT, "pe"), AttTyped()
 {
-    this->RegisterAttClass(ATT_TYPED);
+    this->RegisterAttClass<AttTyped>(ATT_TYPED, this);
 
     this->Reset();
 }
 
 PageElement::PageElement(ClassId classId) : Object(classId, "pe"), AttTyped()
 {
-    this->RegisterAttClass(ATT_TYPED);
+    this->RegisterAttClass<AttTyped>(ATT_TYPED, this);
 
     this->Reset();
 }
 
 PageElement::PageElement(ClassId classId, const std::string &classIdStr) : Object(classId, classIdStr), AttTyped()
 {
-    this->RegisterAttClass(ATT_TYPED);
+    this->RegisterAttClass<AttTyped>(ATT_TYPED, this);
 
     this->Reset();
 }
@@ -26,8 +26,8 @@ namespace vrv {
 
 Pages::Pages() : Object(PAGES, "pages-"), AttLabelled(), AttNNumberLike()
 {
-    this->RegisterAttClass(ATT_LABELLED);
-    this->RegisterAttClass(ATT_NNUMBERLIKE);
+    this->RegisterAttClass<AttLabelled>(ATT_LABELLED, this);
+    this->RegisterAttClass<AttNNumberLike>(ATT_NNUMBERLIKE, this);
 
     this->Reset();
 }
@@ -31,7 +31,7 @@ static const ClassRegistrar<Pb> s_factory("pb", PB);
 
 Pb::Pb() : SystemElement(PB, "pb-"), AttNNumberLike()
 {
-    this->RegisterAttClass(ATT_NNUMBERLIKE);
+    this->RegisterAttClass<AttNNumberLike>(ATT_NNUMBERLIKE, this);
 
     this->Reset();
 }
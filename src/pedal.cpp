@@ -44,13 +44,13 @@ Pedal::Pedal()
     , AttPlacementRelStaff()
     , AttVerticalGroup()
 {
-    this->RegisterInterface(TimeSpanningInterface::GetAttClasses(), TimeSpanningInterface::IsInterface());
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_EXTSYM);
-    this->RegisterAttClass(ATT_PEDALLOG);
-    this->RegisterAttClass(ATT_PEDALVIS);
-    this->RegisterAttClass(ATT_PLACEMENTRELSTAFF);
-    this->RegisterAttClass(ATT_VERTICALGROUP);
+    this->RegisterInterface<TimeSpanningInterface>(this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttExtSym>(ATT_EXTSYM, this);
+    this->RegisterAttClass<AttPedalLog>(ATT_PEDALLOG, this);
+    this->RegisterAttClass<AttPedalVis>(ATT_PEDALVIS, this);
+    this->RegisterAttClass<AttPlacementRelStaff>(ATT_PLACEMENTRELSTAFF, this);
+    this->RegisterAttClass<AttVerticalGroup>(ATT_VERTICALGROUP, this);
 
     this->Reset();
 }
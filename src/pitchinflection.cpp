@@ -26,7 +26,7 @@ static const ClassRegistrar<PitchInflection> s_factory("pitchInflection", PITCHI
 
 PitchInflection::PitchInflection() : ControlElement(PITCHINFLECTION, "pinflexion-"), TimeSpanningInterface()
 {
-    this->RegisterInterface(TimeSpanningInterface::GetAttClasses(), TimeSpanningInterface::IsInterface());
+    this->RegisterInterface<TimeSpanningInterface>(this);
 
     this->Reset();
 }
@@ -29,9 +29,9 @@ namespace vrv {
 
 PitchInterface::PitchInterface() : Interface(), AttNoteGes(), AttOctave(), AttPitch()
 {
-    this->RegisterInterfaceAttClass(ATT_NOTEGES);
-    this->RegisterInterfaceAttClass(ATT_OCTAVE);
-    this->RegisterInterfaceAttClass(ATT_PITCH);
+    this->RegisterInterfaceAttClass<AttNoteGes>(ATT_NOTEGES, this);
+    this->RegisterInterfaceAttClass<AttOctave>(ATT_OCTAVE, this);
+    this->RegisterInterfaceAttClass<AttPitch>(ATT_PITCH, this);
 
     this->Reset();
 }
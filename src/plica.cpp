@@ -28,7 +28,7 @@ static const ClassRegistrar<Plica> s_factory("plica", PLICA);
 
 Plica::Plica() : LayerElement(PLICA, "plica-"), AttPlicaVis()
 {
-    this->RegisterAttClass(ATT_PLICAVIS);
+    this->RegisterAttClass<AttPlicaVis>(ATT_PLICAVIS, this);
 
     this->Reset();
 }
@@ -28,7 +28,7 @@ namespace vrv {
 
 PlistInterface::PlistInterface() : Interface(), AttPlist()
 {
-    this->RegisterInterfaceAttClass(ATT_PLIST);
+    this->RegisterInterfaceAttClass<AttPlist>(ATT_PLIST, this);
 
     this->Reset();
 }
@@ -24,8 +24,8 @@ namespace vrv {
 
 PositionInterface::PositionInterface() : Interface(), AttStaffLoc(), AttStaffLocPitched()
 {
-    this->RegisterInterfaceAttClass(ATT_STAFFLOC);
-    this->RegisterInterfaceAttClass(ATT_STAFFLOCPITCHED);
+    this->RegisterInterfaceAttClass<AttStaffLoc>(ATT_STAFFLOC, this);
+    this->RegisterInterfaceAttClass<AttStaffLocPitched>(ATT_STAFFLOCPITCHED, this);
 
     this->Reset();
 }
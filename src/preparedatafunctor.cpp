@@ -89,7 +89,7 @@ FunctorCode PrepareDataInitializationFunctor::VisitRunningElement(RunningElement
     const ListOfObjects &childList = runningElement->GetList(runningElement);
     for (ListOfObjects::const_iterator iter = childList.begin(); iter != childList.end(); ++iter) {
         int pos = 0;
-        AreaPosInterface *interface = dynamic_cast<AreaPosInterface *>(*iter);
+        AreaPosInterface *interface = (*iter)->GetAreaPosInterface();
         assert(interface);
         pos = runningElement->GetAlignmentPos(interface->GetHalign(), interface->GetValign());
         TextElement *text = vrv_cast<TextElement *>(*iter);
@@ -130,7 +130,7 @@ FunctorCode PrepareCueSizeFunctor::VisitLayerElement(LayerElement *layerElement)
     }
     // This covers the case when the @size is given on the element
     else if (layerElement->HasAttClass(ATT_CUE)) {
-        AttCue *att = dynamic_cast<AttCue *>(layerElement);
+        AttCue *att = layerElement->GetAtt<AttCue>(ATT_CUE);
         assert(att);
         if (att->HasCue()) layerElement->SetDrawingCueSize(att->GetCue() == BOOLEAN_true);
     }
@@ -192,7 +192,7 @@ FunctorCode PrepareCrossStaffFunctor::VisitLayerElement(LayerElement *layerEleme
 
     // Look for cross-staff situations
     // If we have one, make it available in m_crossStaff
-    AttStaffIdent *crossElement = dynamic_cast<AttStaffIdent *>(layerElement);
+    AttStaffIdent *crossElement = layerElement->GetAtt<AttStaffIdent>(ATT_STAFFIDENT);
     if (!crossElement) return FUNCTOR_CONTINUE;
 
     // If we have not @staff, set to what we had before (quite likely NULL for all non cross staff cases)
@@ -397,6 +397,9 @@ FunctorCode PrepareLinkingFunctor::VisitObject(Object *object)
         this->ResolveStemSameas(note);
     }
 
+    // Nothing to resolve - avoid formatting the ids of all the objects
+    if (m_nextIDPairs.empty() && m_sameasIDPairs.empty()) return FUNCTOR_CONTINUE;
+
     // @next
     std::string id = object->GetID();
     auto r1 = m_nextIDPairs.equal_range(id);
@@ -434,7 +437,7 @@ void PrepareLinkingFunctor::ResolveStemSameas(Note *note)
         }
     }
     // Second pass we resolve links
-    else {
+    else if (!m_stemSameasIDPairs.empty()) {
         const std::string id = note->GetID();
         if (m_stemSameasIDPairs.count(id)) {
             Note *noteStemSameas = m_stemSameasIDPairs.at(id);
@@ -486,9 +489,10 @@ FunctorCode PreparePlistFunctor::VisitObject(Object *object)
     else {
         if (!object->IsLayerElement()) return FUNCTOR_CONTINUE;
 
-        std::string id = object->GetID();
         auto i = std::find_if(m_interfaceIDTuples.begin(), m_interfaceIDTuples.end(),
-            [&id](std::tuple<PlistInterface *, std::string, Object *> tuple) { return (std::get<1>(tuple) == id); });
+            [object](const std::tuple<PlistInterface *, std::string, Object *> &tuple) {
+                return object->HasID(std::get<1>(tuple));
+            });
         if (i != m_interfaceIDTuples.end()) {
             std::get<2>(*i) = object;
         }
@@ -0,0 +1,191 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        profiler.cpp
+// Author:      Laurent Pugin
+// Created:     2023
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "profiler.h"
+
+//----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cassert>
+#include <cstdlib>
+#include <sstream>
+
+#if defined(__GNUG__) || defined(__clang__)
+#include <cxxabi.h>
+#endif
+
+//----------------------------------------------------------------------------
+
+#include "jsonxx.h"
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// Profiler
+//----------------------------------------------------------------------------
+
+thread_local Profiler *Profiler::s_current = NULL;
+
+Profiler::Profiler()
+{
+    m_start = Clock::now();
+    m_droppedEvents = 0;
+}
+
+void Profiler::Reset()
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    m_start = Clock::now();
+    m_entries.clear();
+    m_entryIndex.clear();
+    m_events.clear();
+    m_droppedEvents = 0;
+    m_threads.clear();
+}
+
+void Profiler::AddEvent(ProfilerCategory category, const char *name, const std::type_info *type,
+    Clock::time_point start, Clock::time_point end, int visits)
+{
+    assert(name || type);
+
+    using namespace std::chrono;
+
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    int index;
+    if (type) {
+        auto iter = m_typeNames.find(std::type_index(*type));
+        if (iter == m_typeNames.end()) {
+            iter = m_typeNames.insert({ std::type_index(*type), GetTypeName(*type) }).first;
+        }
+        index = this->GetEntryIndex(category, iter->second);
+    }
+    else {
+        index = this->GetEntryIndex(category, name);
+    }
+
+    const long long duration = duration_cast<microseconds>(end - start).count();
+    Entry &entry = m_entries.at(index);
+    ++entry.m_count;
+    entry.m_visits += visits;
+    entry.m_total += duration;
+    entry.m_max = std::max(entry.m_max, duration);
+
+    if ((int)m_events.size() >= MAX_EVENTS) {
+        ++m_droppedEvents;
+        return;
+    }
+
+    auto thread = m_threads.find(std::this_thread::get_id());
+    if (thread == m_threads.end()) {
+        thread = m_threads.insert({ std::this_thread::get_id(), (int)m_threads.size() + 1 }).first;
+    }
+
+    Event event;
+    event.m_entry = index;
+    event.m_thread = thread->second;
+    event.m_visits = visits;
+    event.m_start = duration_cast<microseconds>(start - m_start).count();
+    event.m_duration = duration;
+    m_events.push_back(event);
+}
+
+int Profiler::GetEntryIndex(ProfilerCategory category, const std::string &name)
+{
+    auto iter = m_entryIndex.find({ category, name });
+    if (iter != m_entryIndex.end()) return iter->second;
+
+    Entry entry;
+    entry.m_category = category;
+    entry.m_name = name;
+    m_entries.push_back(entry);
+    m_entryIndex[{ category, name }] = (int)m_entries.size() - 1;
+    return (int)m_entries.size() - 1;
+}
+
+std::string Profiler::GetReport() const
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::vector<const Entry *> entries;
+    for (const Entry &entry : m_entries) entries.push_back(&entry);
+    std::stable_sort(entries.begin(), entries.end(),
+        [](const Entry *entry1, const Entry *entry2) { return (entry1->m_total > entry2->m_total); });
+
+    // Times are given in milliseconds
+    jsonxx::Array entryArray;
+    for (const Entry *entry : entries) {
+        jsonxx::Object o;
+        o << "category" << CategoryToStr(entry->m_category);
+        o << "name" << entry->m_name;
+        o << "count" << entry->m_count;
+        if (entry->m_category == PROFILER_FUNCTOR) o << "visits" << (double)entry->m_visits;
+        o << "total" << entry->m_total / 1000.0;
+        o << "mean" << entry->m_total / 1000.0 / entry->m_count;
+        o << "max" << entry->m_max / 1000.0;
+        entryArray << o;
+    }
+
+    jsonxx::Object report;
+    report << "entries" << entryArray;
+    report << "droppedEvents" << m_droppedEvents;
+    return report.json();
+}
+
+std::string Profiler::GetTrace() const
+{
+    const std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Complete events ("X") with timestamps and durations in microseconds
+    // The trace is written directly because it can have many events - the names are type names or literals and need
+    // no escaping
+    std::ostringstream trace;
+    trace << "{\"traceEvents\":[";
+    for (int i = 0; i < (int)m_events.size(); ++i) {
+        const Event &event = m_events.at(i);
+        const Entry &entry = m_entries.at(event.m_entry);
+        if (i > 0) trace << ",";
+        trace << "{\"name\":\"" << entry.m_name << "\",\"cat\":\"" << CategoryToStr(entry.m_category)
+              << "\",\"ph\":\"X\",\"ts\":" << event.m_start << ",\"dur\":" << event.m_duration
+              << ",\"pid\":1,\"tid\":" << event.m_thread;
+        if (entry.m_category == PROFILER_FUNCTOR) trace << ",\"args\":{\"visits\":" << event.m_visits << "}";
+        trace << "}";
+    }
+    trace << "],\"displayTimeUnit\":\"ms\"}";
+    return trace.str();
+}
+
+std::string Profiler::GetTypeName(const std::type_info &type)
+{
+    std::string name = type.name();
+#if defined(__GNUG__) || defined(__clang__)
+    int status = 0;
+    char *demangled = abi::__cxa_demangle(name.c_str(), NULL, NULL, &status);
+    if ((status == 0) && demangled) name = demangled;
+    free(demangled);
+#endif
+    // Remove the class keyword (MSVC) and the namespace
+    if (name.rfind("class ", 0) == 0) name.erase(0, 6);
+    if (name.rfind("vrv::", 0) == 0) name.erase(0, 5);
+    return name;
+}
+
+std::string Profiler::CategoryToStr(ProfilerCategory category)
+{
+    switch (category) {
+        case PROFILER_TOOLKIT: return "toolkit";
+        case PROFILER_IMPORT: return "import";
+        case PROFILER_STAGE: return "stage";
+        case PROFILER_FUNCTOR: return "functor";
+        case PROFILER_DRAWING: return "drawing";
+        case PROFILER_EXPORT: return "export";
+        default: return "unknown";
+    }
+}
+
+} // namespace vrv
@@ -21,7 +21,7 @@ static const ClassRegistrar<Proport> s_factory("proport", PROPORT);
 
 Proport::Proport() : LayerElement(PROPORT, "prop-"), AttDurationRatio()
 {
-    this->RegisterAttClass(ATT_DURATIONRATIO);
+    this->RegisterAttClass<AttDurationRatio>(ATT_DURATIONRATIO, this);
 
     this->Reset();
 }
@@ -25,7 +25,7 @@ static const ClassRegistrar<Rdg> s_factory("rdg", RDG);
 
 Rdg::Rdg() : EditorialElement(RDG, "rdg-"), AttSource()
 {
-    this->RegisterAttClass(ATT_SOURCE);
+    this->RegisterAttClass<AttSource>(ATT_SOURCE, this);
 
     this->Reset();
 }
@@ -25,7 +25,7 @@ static const ClassRegistrar<Reg> s_factory("reg", REG);
 
 Reg::Reg() : EditorialElement(REG, "reg-"), AttSource()
 {
-    this->RegisterAttClass(ATT_SOURCE);
+    this->RegisterAttClass<AttSource>(ATT_SOURCE, this);
 
     this->Reset();
 }
@@ -31,11 +31,11 @@ static const ClassRegistrar<Reh> s_factory("reh", REH);
 Reh::Reh()
     : ControlElement(REH, "reh-"), TextDirInterface(), TimePointInterface(), AttColor(), AttLang(), AttVerticalGroup()
 {
-    this->RegisterInterface(TextDirInterface::GetAttClasses(), TextDirInterface::IsInterface());
-    this->RegisterInterface(TimePointInterface::GetAttClasses(), TimePointInterface::IsInterface());
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_LANG);
-    this->RegisterAttClass(ATT_VERTICALGROUP);
+    this->RegisterInterface<TextDirInterface>(this);
+    this->RegisterInterface<TimePointInterface>(this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttLang>(ATT_LANG, this);
+    this->RegisterAttClass<AttVerticalGroup>(ATT_VERTICALGROUP, this);
 
     this->Reset();
 }
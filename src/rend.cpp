@@ -39,13 +39,13 @@ Rend::Rend()
     , AttTypography()
     , AttWhitespace()
 {
-    this->RegisterInterface(AreaPosInterface::GetAttClasses(), AreaPosInterface::IsInterface());
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_LANG);
-    this->RegisterAttClass(ATT_NNUMBERLIKE);
-    this->RegisterAttClass(ATT_TEXTRENDITION);
-    this->RegisterAttClass(ATT_TYPOGRAPHY);
-    this->RegisterAttClass(ATT_WHITESPACE);
+    this->RegisterInterface<AreaPosInterface>(this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttLang>(ATT_LANG, this);
+    this->RegisterAttClass<AttNNumberLike>(ATT_NNUMBERLIKE, this);
+    this->RegisterAttClass<AttTextRendition>(ATT_TEXTRENDITION, this);
+    this->RegisterAttClass<AttTypography>(ATT_TYPOGRAPHY, this);
+    this->RegisterAttClass<AttWhitespace>(ATT_WHITESPACE, this);
 
     this->Reset();
 }
@@ -587,6 +587,7 @@ FunctorCode ResetHorizontalAlignmentFunctor::VisitSystem(System *system)
 {
     system->SetDrawingXRel(0);
     system->ResetDrawingAbbrLabelsWidth();
+    system->ResetLayerElementIndex();
 
     return FUNCTOR_CONTINUE;
 }
@@ -697,6 +698,8 @@ FunctorCode ResetVerticalAlignmentFunctor::VisitSystem(System *system)
     system->SetDrawingYRel(0);
 
     system->m_systemAligner.Reset();
+    // The index built before the horizontal layout was done is not valid for the vertical layout
+    system->ResetLayerElementIndex();
 
     return FUNCTOR_CONTINUE;
 }
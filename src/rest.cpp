@@ -160,12 +160,12 @@ Rest::Rest()
     , AttExtSym()
     , AttRestVisMensural()
 {
-    this->RegisterInterface(DurationInterface::GetAttClasses(), DurationInterface::IsInterface());
-    this->RegisterInterface(PositionInterface::GetAttClasses(), PositionInterface::IsInterface());
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_CUE);
-    this->RegisterAttClass(ATT_EXTSYM);
-    this->RegisterAttClass(ATT_RESTVISMENSURAL);
+    this->RegisterInterface<DurationInterface>(this);
+    this->RegisterInterface<PositionInterface>(this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttCue>(ATT_CUE, this);
+    this->RegisterAttClass<AttExtSym>(ATT_EXTSYM, this);
+    this->RegisterAttClass<AttRestVisMensural>(ATT_RESTVISMENSURAL, this);
     this->Reset();
 }
 
@@ -25,7 +25,7 @@ static const ClassRegistrar<Restore> s_factory("restore", RESTORE);
 
 Restore::Restore() : EditorialElement(RESTORE, "restore-"), AttSource()
 {
-    this->RegisterAttClass(ATT_SOURCE);
+    this->RegisterAttClass<AttSource>(ATT_SOURCE, this);
 
     this->Reset();
 }
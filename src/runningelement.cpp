@@ -34,8 +34,8 @@ namespace vrv {
 RunningElement::RunningElement()
     : Object(RUNNING_ELEMENT, "re"), ObjectListInterface(), AttHorizontalAlign(), AttTyped()
 {
-    this->RegisterAttClass(ATT_HORIZONTALALIGN);
-    this->RegisterAttClass(ATT_TYPED);
+    this->RegisterAttClass<AttHorizontalAlign>(ATT_HORIZONTALALIGN, this);
+    this->RegisterAttClass<AttTyped>(ATT_TYPED, this);
 
     this->Reset();
 }
@@ -43,8 +43,8 @@ RunningElement::RunningElement()
 RunningElement::RunningElement(ClassId classId)
     : Object(classId, "re"), ObjectListInterface(), AttHorizontalAlign(), AttTyped()
 {
-    this->RegisterAttClass(ATT_HORIZONTALALIGN);
-    this->RegisterAttClass(ATT_TYPED);
+    this->RegisterAttClass<AttHorizontalAlign>(ATT_HORIZONTALALIGN, this);
+    this->RegisterAttClass<AttTyped>(ATT_TYPED, this);
 
     this->Reset();
 }
@@ -52,8 +52,8 @@ RunningElement::RunningElement(ClassId classId)
 RunningElement::RunningElement(ClassId classId, const std::string &classIdStr)
     : Object(classId, classIdStr), AttHorizontalAlign(), AttTyped()
 {
-    this->RegisterAttClass(ATT_HORIZONTALALIGN);
-    this->RegisterAttClass(ATT_TYPED);
+    this->RegisterAttClass<AttHorizontalAlign>(ATT_HORIZONTALALIGN, this);
+    this->RegisterAttClass<AttTyped>(ATT_TYPED, this);
 
     this->Reset();
 }
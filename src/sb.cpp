@@ -31,7 +31,7 @@ static const ClassRegistrar<Sb> s_factory("sb", SB);
 
 Sb::Sb() : SystemElement(SB, "sb-"), AttNNumberLike()
 {
-    this->RegisterAttClass(ATT_NNUMBERLIKE);
+    this->RegisterAttClass<AttNNumberLike>(ATT_NNUMBERLIKE, this);
 
     this->Reset();
 }
@@ -38,8 +38,8 @@ static const ClassRegistrar<Score> s_factory("score", SCORE);
 
 Score::Score() : PageElement(SCORE, "score-"), PageMilestoneInterface(), AttLabelled(), AttNNumberLike()
 {
-    this->RegisterAttClass(ATT_LABELLED);
-    this->RegisterAttClass(ATT_NNUMBERLIKE);
+    this->RegisterAttClass<AttLabelled>(ATT_LABELLED, this);
+    this->RegisterAttClass<AttNNumberLike>(ATT_NNUMBERLIKE, this);
 
     this->Reset();
 }
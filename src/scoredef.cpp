@@ -50,16 +50,16 @@ namespace vrv {
 
 ScoreDefElement::ScoreDefElement() : Object(SCOREDEF_ELEMENT, "scoredefelement-"), ScoreDefInterface(), AttTyped()
 {
-    this->RegisterInterface(ScoreDefInterface::GetAttClasses(), ScoreDefInterface::IsInterface());
-    this->RegisterAttClass(ATT_TYPED);
+    this->RegisterInterface<ScoreDefInterface>(this);
+    this->RegisterAttClass<AttTyped>(ATT_TYPED, this);
 
     this->Reset();
 }
 
 ScoreDefElement::ScoreDefElement(ClassId classId) : Object(classId, "scoredefelement-"), ScoreDefInterface(), AttTyped()
 {
-    this->RegisterInterface(ScoreDefInterface::GetAttClasses(), ScoreDefInterface::IsInterface());
-    this->RegisterAttClass(ATT_TYPED);
+    this->RegisterInterface<ScoreDefInterface>(this);
+    this->RegisterAttClass<AttTyped>(ATT_TYPED, this);
 
     this->Reset();
 }
@@ -67,8 +67,8 @@ ScoreDefElement::ScoreDefElement(ClassId classId) : Object(classId, "scoredefele
 ScoreDefElement::ScoreDefElement(ClassId classId, const std::string &classIdStr)
     : Object(classId, classIdStr), ScoreDefInterface(), AttTyped()
 {
-    this->RegisterInterface(ScoreDefInterface::GetAttClasses(), ScoreDefInterface::IsInterface());
-    this->RegisterAttClass(ATT_TYPED);
+    this->RegisterInterface<ScoreDefInterface>(this);
+    this->RegisterAttClass<AttTyped>(ATT_TYPED, this);
 
     this->Reset();
 }
@@ -232,11 +232,11 @@ ScoreDef::ScoreDef()
     , AttTimeBase()
     , AttTuning()
 {
-    this->RegisterAttClass(ATT_DISTANCES);
-    this->RegisterAttClass(ATT_ENDINGS);
-    this->RegisterAttClass(ATT_OPTIMIZATION);
-    this->RegisterAttClass(ATT_TIMEBASE);
-    this->RegisterAttClass(ATT_TUNING);
+    this->RegisterAttClass<AttDistances>(ATT_DISTANCES, this);
+    this->RegisterAttClass<AttEndings>(ATT_ENDINGS, this);
+    this->RegisterAttClass<AttOptimization>(ATT_OPTIMIZATION, this);
+    this->RegisterAttClass<AttTimeBase>(ATT_TIMEBASE, this);
+    this->RegisterAttClass<AttTuning>(ATT_TUNING, this);
 
     this->Reset();
 }
@@ -0,0 +1,48 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        scoredefchanges.cpp
+// Author:      Laurent Pugin
+// Created:     2023
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "scoredefchanges.h"
+
+//----------------------------------------------------------------------------
+
+#include <cassert>
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// ScoreDefChanges
+//----------------------------------------------------------------------------
+
+ScoreDefChanges::ScoreDefChanges()
+{
+    m_isComplete = false;
+}
+
+void ScoreDefChanges::Reset()
+{
+    m_measures.clear();
+    m_isComplete = false;
+}
+
+ScoreDefChanges::MeasureChanges *ScoreDefChanges::AddMeasure(const Measure *measure)
+{
+    assert(!m_isComplete);
+
+    MeasureChanges &measureChanges = m_measures[measure];
+    measureChanges = MeasureChanges();
+    return &measureChanges;
+}
+
+const ScoreDefChanges::MeasureChanges *ScoreDefChanges::GetMeasureChanges(const Measure *measure) const
+{
+    if (!m_isComplete) return NULL;
+
+    auto iter = m_measures.find(measure);
+    return (iter != m_measures.end()) ? &iter->second : NULL;
+}
+
+} // namespace vrv
@@ -36,18 +36,16 @@ ScoreDefInterface::ScoreDefInterface()
     , AttSpacing()
     , AttSystems()
 {
-    this->RegisterInterfaceAttClass(ATT_BARRING);
-    this->RegisterInterfaceAttClass(ATT_DURATIONDEFAULT);
-    this->RegisterInterfaceAttClass(ATT_LYRICSTYLE);
-    this->RegisterInterfaceAttClass(ATT_MEASURENUMBERS);
-    this->RegisterInterfaceAttClass(ATT_METERSIGDEFAULTLOG);
-    this->RegisterInterfaceAttClass(ATT_METERSIGDEFAULTVIS);
-    this->RegisterInterfaceAttClass(ATT_MIDITEMPO);
-    this->RegisterInterfaceAttClass(ATT_MMTEMPO);
-    this->RegisterInterfaceAttClass(ATT_MULTINUMMEASURES);
-    this->RegisterInterfaceAttClass(ATT_PIANOPEDALS);
-    this->RegisterInterfaceAttClass(ATT_SPACING);
-    this->RegisterInterfaceAttClass(ATT_SYSTEMS);
+    this->RegisterInterfaceAttClass<AttBarring>(ATT_BARRING, this);
+    this->RegisterInterfaceAttClass<AttDurationDefault>(ATT_DURATIONDEFAULT, this);
+    this->RegisterInterfaceAttClass<AttLyricStyle>(ATT_LYRICSTYLE, this);
+    this->RegisterInterfaceAttClass<AttMeasureNumbers>(ATT_MEASURENUMBERS, this);
+    this->RegisterInterfaceAttClass<AttMidiTempo>(ATT_MIDITEMPO, this);
+    this->RegisterInterfaceAttClass<AttMmTempo>(ATT_MMTEMPO, this);
+    this->RegisterInterfaceAttClass<AttMultinumMeasures>(ATT_MULTINUMMEASURES, this);
+    this->RegisterInterfaceAttClass<AttPianoPedals>(ATT_PIANOPEDALS, this);
+    this->RegisterInterfaceAttClass<AttSpacing>(ATT_SPACING, this);
+    this->RegisterInterfaceAttClass<AttSystems>(ATT_SYSTEMS, this);
 
     this->Reset();
 }
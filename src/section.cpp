@@ -34,8 +34,8 @@ static const ClassRegistrar<Section> s_factory("section", SECTION);
 
 Section::Section() : SystemElement(SECTION, "section-"), SystemMilestoneInterface(), AttNNumberLike(), AttSectionVis()
 {
-    this->RegisterAttClass(ATT_NNUMBERLIKE);
-    this->RegisterAttClass(ATT_SECTIONVIS);
+    this->RegisterAttClass<AttNNumberLike>(ATT_NNUMBERLIKE, this);
+    this->RegisterAttClass<AttSectionVis>(ATT_SECTIONVIS, this);
 
     this->Reset();
 }
@@ -91,12 +91,16 @@ ScoreDefSetCurrentFunctor::ScoreDefSetCurrentFunctor(Doc *doc) : DocFunctor(doc)
     m_drawLabels = false;
     m_restart = false;
     m_hasMeasure = false;
+    m_recordedMeasure = NULL;
+    m_measureChanges = NULL;
 }
 
 FunctorCode ScoreDefSetCurrentFunctor::VisitObject(Object *object)
 {
     if (object->Is({ DOC, MDIV, PAGES })) return FUNCTOR_CONTINUE;
 
+    if (m_recordedMeasure) this->RecordMeasureContent(object);
+
     // starting a new page
     if (object->Is(PAGE)) {
         Page *page = vrv_cast<Page *>(object);
@@ -129,6 +133,8 @@ FunctorCode ScoreDefSetCurrentFunctor::VisitObject(Object *object)
         m_currentSystem = NULL;
         m_restart = false;
         m_hasMeasure = false;
+        m_recordedMeasure = NULL;
+        m_measureChanges = NULL;
         return FUNCTOR_CONTINUE;
     }
 
@@ -139,6 +145,8 @@ FunctorCode ScoreDefSetCurrentFunctor::VisitObject(Object *object)
         // This is the only thing we do for now - we need to wait until we reach the first measure
         m_currentSystem = system;
         m_hasMeasure = false;
+        m_recordedMeasure = NULL;
+        m_measureChanges = NULL;
         return FUNCTOR_CONTINUE;
     }
 
@@ -151,6 +159,13 @@ FunctorCode ScoreDefSetCurrentFunctor::VisitObject(Object *object)
 
         Measure *measure = vrv_cast<Measure *>(object);
         assert(measure);
+
+        // Record the content of the measure the first time, or use it if already recorded
+        ScoreDefChanges *scoreDefChanges = m_doc->GetScoreDefChanges();
+        m_recordedMeasure = NULL;
+        m_measureChanges = scoreDefChanges->GetMeasureChanges(measure);
+        if (!scoreDefChanges->IsComplete()) m_recordedMeasure = scoreDefChanges->AddMeasure(measure);
+
         int drawingFlags = 0;
         // This is the first measure of the system - more to do...
         if (m_currentSystem) {
@@ -188,22 +203,28 @@ FunctorCode ScoreDefSetCurrentFunctor::VisitObject(Object *object)
 
         // check if we need to draw barlines for current/previous measures (in cases when all staves are invisible in
         // them)
-        ListOfObjects currentObjects, previousObjects;
-        AttVisibilityComparison comparison(STAFF, BOOLEAN_false);
-        measure->FindAllDescendantsByComparison(&currentObjects, &comparison);
+        ListOfObjects currentObjects;
+        if (m_measureChanges) {
+            currentObjects = m_measureChanges->m_invisibleStaves;
+        }
+        else {
+            AttVisibilityComparison comparison(STAFF, BOOLEAN_false);
+            measure->FindAllDescendantsByComparison(&currentObjects, &comparison);
+            if (m_recordedMeasure) m_recordedMeasure->m_invisibleStaves = currentObjects;
+        }
         if ((int)currentObjects.size() == measure->GetChildCount(STAFF)) {
             drawingFlags |= Measure::BarlineDrawingFlags::INVISIBLE_MEASURE_CURRENT;
         }
         if (m_previousMeasure) {
-            m_previousMeasure->FindAllDescendantsByComparison(&previousObjects, &comparison);
-            if ((int)previousObjects.size() == m_previousMeasure->GetChildCount(STAFF))
+            if ((int)m_previousInvisibleStaves.size() == m_previousMeasure->GetChildCount(STAFF))
                 drawingFlags |= Measure::BarlineDrawingFlags::INVISIBLE_MEASURE_PREVIOUS;
         }
 
-        measure->SetInvisibleStaffBarlines(m_previousMeasure, currentObjects, previousObjects, drawingFlags);
+        measure->SetInvisibleStaffBarlines(m_previousMeasure, currentObjects, m_previousInvisibleStaves, drawingFlags);
         measure->SetDrawingBarLines(m_previousMeasure, drawingFlags);
 
         m_previousMeasure = measure;
+        m_previousInvisibleStaves = currentObjects;
         m_restart = false;
         m_hasMeasure = true;
 
@@ -286,18 +307,41 @@ FunctorCode ScoreDefSetCurrentFunctor::VisitObject(Object *object)
         Layer *layer = vrv_cast<Layer *>(object);
         assert(layer);
         if (m_doc->GetType() != Transcription) layer->SetDrawingStaffDefValues(m_currentStaffDef);
+        // The content of the layer does not need to be processed when the changes are already recorded
+        if (m_measureChanges) {
+            auto iter = m_measureChanges->m_layerElements.find(layer);
+            if (iter != m_measureChanges->m_layerElements.end()) {
+                for (LayerElement *element : iter->second) this->SetUpcomingValues(element);
+            }
+            return FUNCTOR_SIBLINGS;
+        }
         return FUNCTOR_CONTINUE;
     }
 
-    // starting a new clef
-    if (object->Is(CLEF)) {
+    // starting a new clef, keysig or mensur
+    if (object->Is({ CLEF, KEYSIG, MENSUR })) {
         LayerElement *element = vrv_cast<LayerElement *>(object);
         assert(element);
+        if (m_recordedMeasure) {
+            const Layer *layer = vrv_cast<const Layer *>(element->GetFirstAncestor(LAYER));
+            if (layer) m_recordedMeasure->m_layerElements[layer].push_back(element);
+        }
+        this->SetUpcomingValues(element);
+        return FUNCTOR_CONTINUE;
+    }
+
+    return FUNCTOR_CONTINUE;
+}
+
+void ScoreDefSetCurrentFunctor::SetUpcomingValues(LayerElement *element)
+{
+    // a clef
+    if (element->Is(CLEF)) {
         LayerElement *elementOrLink = element->ThisOrSameasLink();
-        if (!elementOrLink || !elementOrLink->Is(CLEF)) return FUNCTOR_CONTINUE;
+        if (!elementOrLink || !elementOrLink->Is(CLEF)) return;
         Clef *clef = vrv_cast<Clef *>(elementOrLink);
         if (clef->IsScoreDefElement()) {
-            return FUNCTOR_CONTINUE;
+            return;
         }
         assert(m_currentStaffDef);
         const int n = clef->m_crossStaff ? clef->m_crossStaff->GetN() : m_currentStaffDef->GetN();
@@ -305,40 +349,61 @@ FunctorCode ScoreDefSetCurrentFunctor::VisitObject(Object *object)
         assert(upcomingStaffDef);
         upcomingStaffDef->SetCurrentClef(clef);
         m_upcomingScoreDef.m_setAsDrawing = true;
-        return FUNCTOR_CONTINUE;
     }
 
-    // starting a new keysig
-    if (object->Is(KEYSIG)) {
-        KeySig *keySig = vrv_cast<KeySig *>(object);
+    // a keysig
+    else if (element->Is(KEYSIG)) {
+        KeySig *keySig = vrv_cast<KeySig *>(element);
         assert(keySig);
         if (keySig->IsScoreDefElement()) {
-            return FUNCTOR_CONTINUE;
+            return;
         }
         assert(m_currentStaffDef);
         StaffDef *upcomingStaffDef = m_upcomingScoreDef.GetStaffDef(m_currentStaffDef->GetN());
         assert(upcomingStaffDef);
         upcomingStaffDef->SetCurrentKeySig(keySig);
         m_upcomingScoreDef.m_setAsDrawing = true;
-        return FUNCTOR_CONTINUE;
     }
 
-    // starting a new mensur
-    if (object->Is(MENSUR)) {
-        Mensur *mensur = vrv_cast<Mensur *>(object);
+    // a mensur
+    else if (element->Is(MENSUR)) {
+        Mensur *mensur = vrv_cast<Mensur *>(element);
         assert(mensur);
         if (mensur->IsScoreDefElement()) {
-            return FUNCTOR_CONTINUE;
+            return;
         }
         assert(m_currentStaffDef);
         StaffDef *upcomingStaffDef = m_upcomingScoreDef.GetStaffDef(m_currentStaffDef->GetN());
         assert(upcomingStaffDef);
         upcomingStaffDef->SetCurrentMensur(mensur);
         m_upcomingScoreDef.m_setAsDrawing = true;
-        return FUNCTOR_CONTINUE;
     }
+}
 
-    return FUNCTOR_CONTINUE;
+void ScoreDefSetCurrentFunctor::RecordMeasureContent(Object *object)
+{
+    assert(m_recordedMeasure);
+
+    // Objects with a staff or a measure ancestor necessarily belong to the measure being recorded
+    if (object->Is({ CLEF, NOTE })) {
+        const Staff *staff = vrv_cast<const Staff *>(object->GetFirstAncestor(STAFF));
+        if (!staff) return;
+        if (object->Is(CLEF)) {
+            m_recordedMeasure->m_stavesWithClef.insert(staff);
+        }
+        else {
+            m_recordedMeasure->m_stavesWithNote.insert(staff);
+        }
+    }
+    else if (object->Is({ FERMATA, TEMPO })) {
+        if (!object->GetFirstAncestor(MEASURE)) return;
+        if (object->Is(FERMATA)) {
+            m_recordedMeasure->m_hasFermata = true;
+        }
+        else {
+            m_recordedMeasure->m_hasTempo = true;
+        }
+    }
 }
 
 //----------------------------------------------------------------------------
@@ -352,16 +417,26 @@ ScoreDefOptimizeFunctor::ScoreDefOptimizeFunctor(Doc *doc) : DocFunctor(doc)
     m_firstScoreDef = true;
     m_hasFermata = false;
     m_hasTempo = false;
+    m_measureChanges = NULL;
 }
 
 FunctorCode ScoreDefOptimizeFunctor::VisitMeasure(Measure *measure)
 {
+    // Use the content recorded when setting the current scoreDef if available
+    m_measureChanges = m_doc->GetScoreDefChanges()->GetMeasureChanges(measure);
+
     if (!m_doc->GetOptions()->m_condenseTempoPages.GetValue()) {
         return FUNCTOR_CONTINUE;
     }
 
-    m_hasFermata = (measure->FindDescendantByType(FERMATA));
-    m_hasTempo = (measure->FindDescendantByType(TEMPO));
+    if (m_measureChanges) {
+        m_hasFermata = m_measureChanges->m_hasFermata;
+        m_hasTempo = m_measureChanges->m_hasTempo;
+    }
+    else {
+        m_hasFermata = (measure->FindDescendantByType(FERMATA));
+        m_hasTempo = (measure->FindDescendantByType(TEMPO));
+    }
 
     return FUNCTOR_CONTINUE;
 }
@@ -373,6 +448,7 @@ FunctorCode ScoreDefOptimizeFunctor::VisitScore(Score *score)
     m_firstScoreDef = true;
     m_hasFermata = false;
     m_hasTempo = false;
+    m_measureChanges = NULL;
 
     return FUNCTOR_CONTINUE;
 }
@@ -388,7 +464,9 @@ FunctorCode ScoreDefOptimizeFunctor::VisitStaff(Staff *staff)
     }
 
     // Always show staves with a clef change
-    if (staff->FindDescendantByType(CLEF)) {
+    const bool hasClef = (m_measureChanges) ? (m_measureChanges->m_stavesWithClef.count(staff) > 0)
+                                            : (staff->FindDescendantByType(CLEF) != NULL);
+    if (hasClef) {
         staffDef->SetDrawingVisibility(OPTIMIZATION_SHOW);
     }
 
@@ -404,16 +482,11 @@ FunctorCode ScoreDefOptimizeFunctor::VisitStaff(Staff *staff)
 
     staffDef->SetDrawingVisibility(OPTIMIZATION_HIDDEN);
 
-    // Ignore layers that are empty (or with @sameas)
-    ListOfObjects layers;
-    IsEmptyComparison matchTypeLayer(LAYER);
-    matchTypeLayer.ReverseComparison();
-    staff->FindAllDescendantsByComparison(&layers, &matchTypeLayer);
-
-    Object *note = staff->FindDescendantByType(NOTE);
+    const bool hasNote = (m_measureChanges) ? (m_measureChanges->m_stavesWithNote.count(staff) > 0)
+                                            : (staff->FindDescendantByType(NOTE) != NULL);
 
     // Show the staff only if there are any notes
-    if (note) {
+    if (hasNote) {
         staffDef->SetDrawingVisibility(OPTIMIZATION_SHOW);
     }
 
@@ -618,7 +691,8 @@ FunctorCode ScoreDefUnsetCurrentFunctor::VisitLayer(Layer *layer)
 {
     layer->ResetStaffDefObjects();
 
-    return FUNCTOR_CONTINUE;
+    // Nothing to unset in the layer content
+    return FUNCTOR_SIBLINGS;
 }
 
 FunctorCode ScoreDefUnsetCurrentFunctor::VisitMeasure(Measure *measure)
@@ -25,7 +25,7 @@ static const ClassRegistrar<Sic> s_factory("sic", SIC);
 
 Sic::Sic() : EditorialElement(SIC, "sic-"), AttSource()
 {
-    this->RegisterAttClass(ATT_SOURCE);
+    this->RegisterAttClass<AttSource>(ATT_SOURCE, this);
 
     this->Reset();
 }
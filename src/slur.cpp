@@ -48,11 +48,11 @@ Slur::Slur()
     , AttCurveRend()
     , AttLayerIdent()
 {
-    this->RegisterInterface(TimeSpanningInterface::GetAttClasses(), TimeSpanningInterface::IsInterface());
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_CURVATURE);
-    this->RegisterAttClass(ATT_CURVEREND);
-    this->RegisterAttClass(ATT_LAYERIDENT);
+    this->RegisterInterface<TimeSpanningInterface>(this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttCurvature>(ATT_CURVATURE, this);
+    this->RegisterAttClass<AttCurveRend>(ATT_CURVEREND, this);
+    this->RegisterAttClass<AttLayerIdent>(ATT_LAYERIDENT, this);
 
     this->Reset();
 }
@@ -65,11 +65,11 @@ Slur::Slur(ClassId classId)
     , AttCurveRend()
     , AttLayerIdent()
 {
-    this->RegisterInterface(TimeSpanningInterface::GetAttClasses(), TimeSpanningInterface::IsInterface());
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_CURVATURE);
-    this->RegisterAttClass(ATT_CURVEREND);
-    this->RegisterAttClass(ATT_LAYERIDENT);
+    this->RegisterInterface<TimeSpanningInterface>(this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttCurvature>(ATT_CURVATURE, this);
+    this->RegisterAttClass<AttCurveRend>(ATT_CURVEREND, this);
+    this->RegisterAttClass<AttLayerIdent>(ATT_LAYERIDENT, this);
 
     this->Reset();
 }
@@ -82,11 +82,11 @@ Slur::Slur(ClassId classId, const std::string &classIdStr)
     , AttCurveRend()
     , AttLayerIdent()
 {
-    this->RegisterInterface(TimeSpanningInterface::GetAttClasses(), TimeSpanningInterface::IsInterface());
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_CURVATURE);
-    this->RegisterAttClass(ATT_CURVEREND);
-    this->RegisterAttClass(ATT_LAYERIDENT);
+    this->RegisterInterface<TimeSpanningInterface>(this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttCurvature>(ATT_CURVATURE, this);
+    this->RegisterAttClass<AttCurveRend>(ATT_CURVEREND, this);
+    this->RegisterAttClass<AttLayerIdent>(ATT_LAYERIDENT, this);
 
     this->Reset();
 }
@@ -220,8 +220,9 @@ void Slur::CalcSpannedElements(FloatingCurvePositioner *curve)
 
 SpannedElements Slur::CollectSpannedElements(const Staff *staff, int xMin, int xMax) const
 {
-    // Decide whether we search the whole parent system or just one measure which is much faster
-    const Object *container = this->IsSpanningMeasures() ? staff->GetFirstAncestor(SYSTEM) : this->GetStartMeasure();
+    // The search is done through the index of the parent system, limited to the spanned measures
+    const System *system = vrv_cast<const System *>(staff->GetFirstAncestor(SYSTEM));
+    assert(system);
 
     FindSpannedLayerElementsFunctor findSpannedLayerElements(this);
     findSpannedLayerElements.SetMinMaxPos(xMin, xMax);
@@ -241,7 +242,7 @@ SpannedElements Slur::CollectSpannedElements(const Staff *staff, int xMin, int x
     findSpannedLayerElements.SetStaffNs(staffNumbers);
 
     // Run the search without layer bounds
-    container->Process(findSpannedLayerElements);
+    system->FindSpannedLayerElements(findSpannedLayerElements);
 
     // Now determine the minimal and maximal layer
     std::set<int> layersN;
@@ -317,7 +318,7 @@ SpannedElements Slur::CollectSpannedElements(const Staff *staff, int xMin, int x
         if (layersAreSeparated || this->HasLayer()) {
             findSpannedLayerElements.ClearElements();
             findSpannedLayerElements.SetMinMaxLayerN(minLayerN, maxLayerN);
-            container->Process(findSpannedLayerElements);
+            system->FindSpannedLayerElements(findSpannedLayerElements);
             spannedElements = findSpannedLayerElements.GetElements();
         }
     }
@@ -27,7 +27,7 @@ static const ClassRegistrar<Space> s_factory("space", SPACE);
 
 Space::Space() : LayerElement(SPACE, "space-"), DurationInterface()
 {
-    this->RegisterInterface(DurationInterface::GetAttClasses(), DurationInterface::IsInterface());
+    this->RegisterInterface<DurationInterface>(this);
 
     this->Reset();
 }
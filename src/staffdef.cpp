@@ -43,15 +43,15 @@ StaffDef::StaffDef()
     , AttTimeBase()
     , AttTransposition()
 {
-    this->RegisterAttClass(ATT_DISTANCES);
-    this->RegisterAttClass(ATT_LABELLED);
-    this->RegisterAttClass(ATT_NINTEGER);
-    this->RegisterAttClass(ATT_NOTATIONTYPE);
-    this->RegisterAttClass(ATT_SCALABLE);
-    this->RegisterAttClass(ATT_STAFFDEFLOG);
-    this->RegisterAttClass(ATT_STAFFDEFVIS);
-    this->RegisterAttClass(ATT_TIMEBASE);
-    this->RegisterAttClass(ATT_TRANSPOSITION);
+    this->RegisterAttClass<AttDistances>(ATT_DISTANCES, this);
+    this->RegisterAttClass<AttLabelled>(ATT_LABELLED, this);
+    this->RegisterAttClass<AttNInteger>(ATT_NINTEGER, this);
+    this->RegisterAttClass<AttNotationType>(ATT_NOTATIONTYPE, this);
+    this->RegisterAttClass<AttScalable>(ATT_SCALABLE, this);
+    this->RegisterAttClass<AttStaffDefLog>(ATT_STAFFDEFLOG, this);
+    this->RegisterAttClass<AttStaffDefVis>(ATT_STAFFDEFVIS, this);
+    this->RegisterAttClass<AttTimeBase>(ATT_TIMEBASE, this);
+    this->RegisterAttClass<AttTransposition>(ATT_TRANSPOSITION, this);
 
     this->Reset();
 }
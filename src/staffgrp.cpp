@@ -40,13 +40,13 @@ StaffGrp::StaffGrp()
     , AttStaffGrpVis()
     , AttTyped()
 {
-    this->RegisterAttClass(ATT_BARRING);
-    this->RegisterAttClass(ATT_BASIC);
-    this->RegisterAttClass(ATT_LABELLED);
-    this->RegisterAttClass(ATT_NNUMBERLIKE);
-    this->RegisterAttClass(ATT_STAFFGROUPINGSYM);
-    this->RegisterAttClass(ATT_STAFFGRPVIS);
-    this->RegisterAttClass(ATT_TYPED);
+    this->RegisterAttClass<AttBarring>(ATT_BARRING, this);
+    this->RegisterAttClass<AttBasic>(ATT_BASIC, this);
+    this->RegisterAttClass<AttLabelled>(ATT_LABELLED, this);
+    this->RegisterAttClass<AttNNumberLike>(ATT_NNUMBERLIKE, this);
+    this->RegisterAttClass<AttStaffGroupingSym>(ATT_STAFFGROUPINGSYM, this);
+    this->RegisterAttClass<AttStaffGrpVis>(ATT_STAFFGRPVIS, this);
+    this->RegisterAttClass<AttTyped>(ATT_TYPED, this);
 
     this->Reset();
 }
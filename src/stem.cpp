@@ -33,9 +33,9 @@ static const ClassRegistrar<Note> s_factory("stem", STEM);
 
 Stem::Stem() : LayerElement(STEM, "stem-"), AttGraced(), AttStemVis(), AttVisibility()
 {
-    this->RegisterAttClass(ATT_GRACED);
-    this->RegisterAttClass(ATT_STEMVIS);
-    this->RegisterAttClass(ATT_VISIBILITY);
+    this->RegisterAttClass<AttGraced>(ATT_GRACED, this);
+    this->RegisterAttClass<AttStemVis>(ATT_STEMVIS, this);
+    this->RegisterAttClass<AttVisibility>(ATT_VISIBILITY, this);
 
     this->Reset();
 }
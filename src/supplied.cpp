@@ -25,7 +25,7 @@ static const ClassRegistrar<Supplied> s_factory("supplied", SUPPLIED);
 
 Supplied::Supplied() : EditorialElement(SUPPLIED, "supplied-"), AttSource()
 {
-    this->RegisterAttClass(ATT_SOURCE);
+    this->RegisterAttClass<AttSource>(ATT_SOURCE, this);
 
     this->Reset();
 }
@@ -29,8 +29,8 @@ static const ClassRegistrar<Surface> s_factory("surface", SURFACE);
 
 Surface::Surface() : Object(SURFACE, "surface-"), AttTyped(), AttCoordinated()
 {
-    this->RegisterAttClass(ATT_TYPED);
-    this->RegisterAttClass(ATT_COORDINATED);
+    this->RegisterAttClass<AttTyped>(ATT_TYPED, this);
+    this->RegisterAttClass<AttCoordinated>(ATT_COORDINATED, this);
     this->Reset();
 }
 
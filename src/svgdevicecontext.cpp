@@ -17,6 +17,7 @@
 #include "floatingobject.h"
 #include "glyph.h"
 #include "layerelement.h"
+#include "profiler.h"
 #include "staff.h"
 #include "staffdef.h"
 #include "view.h"
@@ -42,6 +43,7 @@ SvgDeviceContext::SvgDeviceContext() : DeviceContext(SVG_DEVICE_CONTEXT)
     this->SetPen(AxNONE, 1, AxSOLID);
 
     m_smuflGlyphs.clear();
+    m_smuflGlyphCodes.clear();
 
     m_committed = false;
     m_vrvTextFont = false;
@@ -54,6 +56,7 @@ SvgDeviceContext::SvgDeviceContext() : DeviceContext(SVG_DEVICE_CONTEXT)
     m_formatRaw = false;
     m_removeXlink = false;
     m_facsimile = false;
+    m_glyphSprite = false;
     m_indent = 2;
 
     // create the initial SVG element
@@ -115,12 +118,82 @@ void SvgDeviceContext::IncludeTextFont(const std::string &fontname, const Resour
     css.text().set(cssContent.c_str());
 }
 
+std::string SvgDeviceContext::GetGlyphId(const Glyph *glyph)
+{
+    assert(glyph);
+
+    if (m_glyphSprite) {
+        const Resources *resources = this->GetResources();
+        // Fallback glyphs come from the default font
+        std::string fontName = "Leipzig";
+        if (resources && !glyph->GetFallback()) fontName = resources->GetCurrentFontName();
+        return StringFormat("%s-%s", fontName.c_str(), glyph->GetCodeStr().c_str());
+    }
+    return StringFormat("%s-%s", glyph->GetCodeStr().c_str(), m_glyphPostfixId.c_str());
+}
+
+void SvgDeviceContext::AppendGlyphDefs(pugi::xml_node defs, const std::set<const Glyph *> &glyphs)
+{
+    pugi::xml_document sourceDoc;
+
+    // for each needed glyph
+    for (const Glyph *smuflGlyph : glyphs) {
+        // load the XML file that contains it as a pugi::xml_document
+        std::ifstream source(smuflGlyph->GetPath());
+        sourceDoc.load(source);
+
+        const std::string id = this->GetGlyphId(smuflGlyph);
+        // copy all the nodes inside into the master document
+        for (pugi::xml_node child = sourceDoc.first_child(); child; child = child.next_sibling()) {
+            child.attribute("id").set_value(id.c_str());
+            defs.append_copy(child);
+        }
+    }
+}
+
+std::string SvgDeviceContext::GetStringGlyphSprite(const std::set<const Glyph *> &glyphs)
+{
+    pugi::xml_document spriteDoc;
+    pugi::xml_node decl = spriteDoc.prepend_child(pugi::node_declaration);
+    decl.append_attribute("version") = "1.0";
+    decl.append_attribute("encoding") = "UTF-8";
+    decl.append_attribute("standalone") = "no";
+
+    pugi::xml_node svg = spriteDoc.append_child("svg");
+    svg.append_attribute("version") = "1.1";
+    svg.append_attribute("xmlns") = "http://www.w3.org/2000/svg";
+    svg.append_attribute("width") = "0";
+    svg.append_attribute("height") = "0";
+    // the sprite itself is not rendered when included inline in a HTML page
+    svg.append_attribute("style") = "position:absolute";
+    pugi::xml_node desc = svg.append_child("desc");
+    desc.text().set(StringFormat("Glyphs engraved by Verovio %s", GetVersion().c_str()).c_str());
+
+    // the IDs of the sprite are always the font qualified ones
+    const bool glyphSprite = m_glyphSprite;
+    m_glyphSprite = true;
+    this->AppendGlyphDefs(svg.append_child("defs"), glyphs);
+    m_glyphSprite = glyphSprite;
+
+    unsigned int output_flags = pugi::format_default;
+    if (m_formatRaw) {
+        output_flags |= pugi::format_raw;
+    }
+
+    std::ostringstream outdata;
+    std::string indent = (m_indent == -1) ? "\t" : std::string(m_indent, ' ');
+    spriteDoc.save(outdata, indent.c_str(), output_flags);
+    return outdata.str();
+}
+
 void SvgDeviceContext::Commit(bool xml_declaration)
 {
     if (m_committed) {
         return;
     }
 
+    ProfilerEvent event(PROFILER_EXPORT, "SvgDeviceContext::Commit");
+
     // take care of width/height once userScale is updated
     double height = (double)this->GetHeight() * this->GetUserScaleY();
     double width = (double)this->GetWidth() * this->GetUserScaleX();
@@ -164,25 +237,10 @@ void SvgDeviceContext::Commit(bool xml_declaration)
         }
     }
 
-    // header
-    if (m_smuflGlyphs.size() > 0) {
-
+    // header - in sprite mode the glyphs are defined in the shared sprite
+    if ((m_smuflGlyphs.size() > 0) && !m_glyphSprite) {
         pugi::xml_node defs = m_svgNode.prepend_child("defs");
-        pugi::xml_document sourceDoc;
-
-        // for each needed glyph
-        for (const Glyph *smuflGlyph : m_smuflGlyphs) {
-            // load the XML file that contains it as a pugi::xml_document
-            std::ifstream source(smuflGlyph->GetPath());
-            sourceDoc.load(source);
-
-            // copy all the nodes inside into the master document
-            for (pugi::xml_node child = sourceDoc.first_child(); child; child = child.next_sibling()) {
-                std::string id = StringFormat("%s-%s", child.attribute("id").value(), m_glyphPostfixId.c_str());
-                child.attribute("id").set_value(id.c_str());
-                defs.append_copy(child);
-            }
-        }
+        this->AppendGlyphDefs(defs, m_smuflGlyphs);
     }
 
     unsigned int output_flags = pugi::format_default | pugi::format_no_declaration;
@@ -214,7 +272,7 @@ void SvgDeviceContext::StartGraphic(
     Object *object, std::string gClass, std::string gId, GraphicID graphicID, bool prepend)
 {
     if (object->HasAttClass(ATT_TYPED)) {
-        AttTyped *att = dynamic_cast<AttTyped *>(object);
+        AttTyped *att = object->GetAtt<AttTyped>(ATT_TYPED);
         assert(att);
         if (att->HasType()) {
             gClass.append((gClass.empty() ? "" : " ") + att->GetType());
@@ -257,7 +315,7 @@ void SvgDeviceContext::StartGraphic(
     }
 
     if (object->HasAttClass(ATT_COLOR)) {
-        AttColor *att = dynamic_cast<AttColor *>(object);
+        AttColor *att = object->GetAtt<AttColor>(ATT_COLOR);
         assert(att);
         if (att->HasColor()) {
             m_currentNode.append_attribute("color") = att->GetColor().c_str();
@@ -266,7 +324,7 @@ void SvgDeviceContext::StartGraphic(
     }
 
     if (object->HasAttClass(ATT_LABELLED)) {
-        AttLabelled *att = dynamic_cast<AttLabelled *>(object);
+        AttLabelled *att = object->GetAtt<AttLabelled>(ATT_LABELLED);
         assert(att);
         if (att->HasLabel()) {
             pugi::xml_node svgTitle = m_currentNode.prepend_child("title");
@@ -276,7 +334,7 @@ void SvgDeviceContext::StartGraphic(
     }
 
     if (object->HasAttClass(ATT_LANG)) {
-        AttLang *att = dynamic_cast<AttLang *>(object);
+        AttLang *att = object->GetAtt<AttLang>(ATT_LANG);
         assert(att);
         if (att->HasLang()) {
             m_currentNode.append_attribute("xml:lang") = att->GetLang().c_str();
@@ -284,7 +342,7 @@ void SvgDeviceContext::StartGraphic(
     }
 
     if (object->HasAttClass(ATT_TYPOGRAPHY)) {
-        AttTypography *att = dynamic_cast<AttTypography *>(object);
+        AttTypography *att = object->GetAtt<AttTypography>(ATT_TYPOGRAPHY);
         assert(att);
         if (att->HasFontname()) m_currentNode.append_attribute("font-family") = att->GetFontname().c_str();
         if (att->HasFontstyle())
@@ -294,7 +352,7 @@ void SvgDeviceContext::StartGraphic(
     }
 
     if (object->HasAttClass(ATT_VISIBILITY)) {
-        AttVisibility *att = dynamic_cast<AttVisibility *>(object);
+        AttVisibility *att = object->GetAtt<AttVisibility>(ATT_VISIBILITY);
         assert(att);
         if (att->HasVisible()) {
             if (att->GetVisible() == BOOLEAN_true) {
@@ -307,7 +365,7 @@ void SvgDeviceContext::StartGraphic(
     }
 
     if (object->HasAttClass(ATT_LINKING)) {
-        AttLinking *att = dynamic_cast<AttLinking *>(object);
+        AttLinking *att = object->GetAtt<AttLinking>(ATT_LINKING);
         assert(att);
         if (att->HasFollows()) {
             m_currentNode.append_attribute("mei:follows") = att->GetFollows().c_str();
@@ -338,13 +396,13 @@ void SvgDeviceContext::StartTextGraphic(Object *object, std::string gClass, std:
     AppendAdditionalAttributes(object);
 
     if (object->HasAttClass(ATT_COLOR)) {
-        AttColor *att = dynamic_cast<AttColor *>(object);
+        AttColor *att = object->GetAtt<AttColor>(ATT_COLOR);
         assert(att);
         if (att->HasColor()) m_currentNode.append_attribute("fill") = att->GetColor().c_str();
     }
 
     if (object->HasAttClass(ATT_LABELLED)) {
-        AttLabelled *att = dynamic_cast<AttLabelled *>(object);
+        AttLabelled *att = object->GetAtt<AttLabelled>(ATT_LABELLED);
         assert(att);
         if (att->HasLabel()) {
             pugi::xml_node svgTitle = m_currentNode.prepend_child("title");
@@ -354,7 +412,7 @@ void SvgDeviceContext::StartTextGraphic(Object *object, std::string gClass, std:
     }
 
     if (object->HasAttClass(ATT_LANG)) {
-        AttLang *att = dynamic_cast<AttLang *>(object);
+        AttLang *att = object->GetAtt<AttLang>(ATT_LANG);
         assert(att);
         if (att->HasLang()) {
             m_currentNode.append_attribute("xml:lang") = att->GetLang().c_str();
@@ -362,7 +420,7 @@ void SvgDeviceContext::StartTextGraphic(Object *object, std::string gClass, std:
     }
 
     if (object->HasAttClass(ATT_TYPOGRAPHY)) {
-        AttTypography *att = dynamic_cast<AttTypography *>(object);
+        AttTypography *att = object->GetAtt<AttTypography>(ATT_TYPOGRAPHY);
         assert(att);
         if (att->HasFontname()) m_currentNode.append_attribute("font-family") = att->GetFontname().c_str();
         if (att->HasFontstyle())
@@ -372,7 +430,7 @@ void SvgDeviceContext::StartTextGraphic(Object *object, std::string gClass, std:
     }
 
     if (object->HasAttClass(ATT_WHITESPACE)) {
-        AttWhitespace *att = dynamic_cast<AttWhitespace *>(object);
+        AttWhitespace *att = object->GetAtt<AttWhitespace>(ATT_WHITESPACE);
         assert(att);
         if (att->HasSpace()) {
             m_currentNode.append_attribute("xml:space") = att->GetSpace().c_str();
@@ -1018,11 +1076,13 @@ void SvgDeviceContext::DrawMusicText(const std::u32string &text, int x, int y, b
 
         // Add the glyph to the array for the <defs>
         m_smuflGlyphs.insert(glyph);
+        if (m_glyphSprite) m_smuflGlyphCodes.insert(c);
 
         // Write the char in the SVG
         pugi::xml_node useChild = AddChild("use");
+        const std::string spriteUrl = (m_glyphSprite) ? m_glyphSpriteUrl : "";
         useChild.append_attribute(hrefAttrib.c_str())
-            = StringFormat("#%s-%s", glyph->GetCodeStr().c_str(), m_glyphPostfixId.c_str()).c_str();
+            = StringFormat("%s#%s", spriteUrl.c_str(), this->GetGlyphId(glyph).c_str()).c_str();
         useChild.append_attribute("x") = x;
         useChild.append_attribute("y") = y;
         useChild.append_attribute("height") = StringFormat("%dpx", m_fontStack.top()->GetPointSize()).c_str();
@@ -1111,9 +1171,12 @@ void SvgDeviceContext::AppendAdditionalAttributes(Object *object)
 {
     std::pair<std::multimap<ClassId, std::string>::iterator, std::multimap<ClassId, std::string>::iterator> range;
     range = m_svgAdditionalAttributes.equal_range(object->GetClassId()); // if correct class name...
+    if (range.first == range.second) return;
+
+    // The attributes are collected only once for all the additional attributes of the class
+    ArrayOfStrAttr attributes;
+    object->GetAttributes(&attributes);
     for (std::multimap<ClassId, std::string>::iterator it = range.first; it != range.second; ++it) {
-        ArrayOfStrAttr attributes;
-        object->GetAttributes(&attributes);
         for (ArrayOfStrAttr::iterator iter = attributes.begin(); iter != attributes.end(); ++iter) {
             if (it->second == (*iter).first) // ...and attribute exists in class name, add it to SVG element
                 m_currentNode.append_attribute(("data-" + it->second).c_str()) = (*iter).second.c_str();
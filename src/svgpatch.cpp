@@ -0,0 +1,209 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        svgpatch.cpp
+// Author:      Laurent Pugin
+// Created:     2023
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "svgpatch.h"
+
+//----------------------------------------------------------------------------
+
+#include <cassert>
+#include <cstring>
+#include <functional>
+#include <sstream>
+
+//----------------------------------------------------------------------------
+
+#include "svgdevicecontext.h"
+
+//----------------------------------------------------------------------------
+
+#include "jsonxx.h"
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// SvgPatch
+//----------------------------------------------------------------------------
+
+void SvgPatch::InitDeviceContext(int pageNo, SvgDeviceContext &svg) const
+{
+    auto iter = m_pages.find(pageNo);
+    if (iter != m_pages.end()) svg.SetGlyphPostfixId(iter->second.m_glyphPostfixId);
+}
+
+std::string SvgPatch::MakePatch(int pageNo, SvgDeviceContext &svg)
+{
+    // Make sure the SVG is committed
+    const std::string svgString = svg.GetStringSVG();
+
+    PageState pageState;
+    pageState.m_glyphPostfixId = svg.GetGlyphPostfixId();
+
+    pugi::xml_node root = svg.GetSvgNode();
+    pugi::xml_node defs;
+    std::string viewBox;
+    std::vector<pugi::xml_node> systems;
+
+    // Hash everything outside the systems, including the number of systems
+    std::size_t frameHash = HashAttributes(root, 0, false);
+    for (pugi::xml_node child : root.children()) {
+        const std::string name = child.name();
+        if (name == "desc") continue;
+        if (name == "defs") {
+            defs = child;
+            pageState.m_defsHash = HashNode(child, false, 0);
+        }
+        else if ((name == "svg") && HasBaseClass(child, "definition-scale")) {
+            viewBox = child.attribute("viewBox").value();
+            frameHash = HashAttributes(child, frameHash, false);
+            for (pugi::xml_node pageChild : child.children()) {
+                if (!HasBaseClass(pageChild, "page-margin")) {
+                    frameHash = HashNode(pageChild, false, frameHash);
+                    continue;
+                }
+                frameHash = HashAttributes(pageChild, frameHash, false);
+                for (pugi::xml_node group : pageChild.children()) {
+                    if (HasBaseClass(group, "system") && !GetGroupId(group).empty()) {
+                        systems.push_back(group);
+                        frameHash = Combine(frameHash, systems.size());
+                    }
+                    else {
+                        frameHash = HashNode(group, false, frameHash);
+                    }
+                }
+            }
+        }
+        else {
+            frameHash = HashNode(child, false, frameHash);
+        }
+    }
+    pageState.m_frameHash = frameHash;
+
+    // Hash the systems and their measures
+    // The IDs of the system and of its other groups are regenerated by the layout and are ignored in the frame
+    for (pugi::xml_node system : systems) {
+        SystemState systemState;
+        systemState.m_id = GetGroupId(system);
+        systemState.m_hash = HashNode(system, false, 0);
+        std::size_t systemFrameHash = HashAttributes(system, 0, true);
+        for (pugi::xml_node group : system.children()) {
+            const std::string id = GetGroupId(group);
+            if (HasBaseClass(group, "measure") && !id.empty()) {
+                systemState.m_measureHashes[id] = HashNode(group, false, 0);
+                systemFrameHash = Combine(systemFrameHash, std::hash<std::string>{}(id));
+            }
+            else {
+                systemFrameHash = HashNode(group, true, systemFrameHash);
+            }
+        }
+        systemState.m_frameHash = systemFrameHash;
+        pageState.m_systems.push_back(systemState);
+    }
+
+    // A full page is needed if the page was not rendered before or if the content outside the systems changed
+    auto iter = m_pages.find(pageNo);
+    bool full = (iter == m_pages.end());
+    if (!full) {
+        const PageState &previous = iter->second;
+        full = (previous.m_frameHash != pageState.m_frameHash)
+            || (previous.m_systems.size() != pageState.m_systems.size())
+            || (previous.m_glyphPostfixId != pageState.m_glyphPostfixId);
+    }
+
+    jsonxx::Object o;
+    o << "page" << pageNo;
+    o << "viewBox" << viewBox;
+    o << "full" << full;
+
+    if (full) {
+        o << "svg" << svgString;
+    }
+    else {
+        const PageState &previous = iter->second;
+        jsonxx::Object groups;
+        // The systems are matched by position and the groups are given with the ID of the group to be replaced
+        for (int i = 0; i < (int)pageState.m_systems.size(); ++i) {
+            SystemState &systemState = pageState.m_systems.at(i);
+            const SystemState &previousSystem = previous.m_systems.at(i);
+            if (systemState.m_hash == previousSystem.m_hash) continue;
+            // Only the measures changed - the measure IDs are part of the system frame hash
+            if (systemState.m_frameHash == previousSystem.m_frameHash) {
+                // The system group is kept with its previous ID
+                systemState.m_id = previousSystem.m_id;
+                for (pugi::xml_node group : systems.at(i).children()) {
+                    const std::string id = GetGroupId(group);
+                    if (!HasBaseClass(group, "measure") || id.empty()) continue;
+                    if (systemState.m_measureHashes.at(id) == previousSystem.m_measureHashes.at(id)) continue;
+                    groups << id << PrintNode(group);
+                }
+            }
+            else {
+                groups << previousSystem.m_id << PrintNode(systems.at(i));
+            }
+        }
+        o << "groups" << groups;
+        // New glyphs might be used in the groups
+        if (defs && (pageState.m_defsHash != previous.m_defsHash)) {
+            o << "defs" << PrintNode(defs);
+        }
+    }
+
+    m_pages[pageNo] = pageState;
+
+    return o.json();
+}
+
+std::size_t SvgPatch::HashNode(pugi::xml_node node, bool ignoreIds, std::size_t seed)
+{
+    seed = Combine(seed, std::hash<std::string>{}(node.name()));
+    seed = Combine(seed, std::hash<std::string>{}(node.value()));
+    seed = HashAttributes(node, seed, ignoreIds);
+    for (pugi::xml_node child : node.children()) {
+        seed = HashNode(child, ignoreIds, seed);
+    }
+    // Mark the end of the children
+    return Combine(seed, node.type());
+}
+
+std::string SvgPatch::PrintNode(pugi::xml_node node)
+{
+    std::ostringstream stream;
+    node.print(stream, "", pugi::format_raw);
+    return stream.str();
+}
+
+std::size_t SvgPatch::HashAttributes(pugi::xml_node node, std::size_t seed, bool ignoreIds)
+{
+    for (pugi::xml_attribute attribute : node.attributes()) {
+        if (ignoreIds && (!strcmp(attribute.name(), "id") || !strcmp(attribute.name(), "data-id"))) continue;
+        seed = Combine(seed, std::hash<std::string>{}(attribute.name()));
+        seed = Combine(seed, std::hash<std::string>{}(attribute.value()));
+    }
+    return seed;
+}
+
+std::string SvgPatch::GetGroupId(pugi::xml_node node)
+{
+    if (std::string(node.name()) != "g") return "";
+
+    pugi::xml_attribute id = node.attribute("id");
+    if (!id) id = node.attribute("data-id");
+    return id.value();
+}
+
+bool SvgPatch::HasBaseClass(pugi::xml_node node, const std::string &baseClass)
+{
+    const std::string gClass = node.attribute("class").value();
+    return (gClass.compare(0, baseClass.size(), baseClass) == 0)
+        && ((gClass.size() == baseClass.size()) || (gClass.at(baseClass.size()) == ' '));
+}
+
+std::size_t SvgPatch::Combine(std::size_t seed, std::size_t value)
+{
+    return seed ^ (value + 0x9e3779b9 + (seed << 6) + (seed >> 2));
+}
+
+} // namespace vrv
@@ -41,10 +41,10 @@ static const ClassRegistrar<Syl> s_factory("syl", SYL);
 Syl::Syl()
     : LayerElement(SYL, "syl-"), TextListInterface(), TimeSpanningInterface(), AttLang(), AttTypography(), AttSylLog()
 {
-    this->RegisterInterface(TimeSpanningInterface::GetAttClasses(), TimeSpanningInterface::IsInterface());
-    this->RegisterAttClass(ATT_LANG);
-    this->RegisterAttClass(ATT_TYPOGRAPHY);
-    this->RegisterAttClass(ATT_SYLLOG);
+    this->RegisterInterface<TimeSpanningInterface>(this);
+    this->RegisterAttClass<AttLang>(ATT_LANG, this);
+    this->RegisterAttClass<AttTypography>(ATT_TYPOGRAPHY, this);
+    this->RegisterAttClass<AttSylLog>(ATT_SYLLOG, this);
 
     this->Reset();
 }
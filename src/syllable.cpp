@@ -37,8 +37,8 @@ Syllable::Syllable() : LayerElement(SYLLABLE, "syllable-"), ObjectListInterface(
 
 void Syllable::Init()
 {
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_SLASHCOUNT);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttSlashCount>(ATT_SLASHCOUNT, this);
 
     this->Reset();
 }
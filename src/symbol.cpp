@@ -30,9 +30,9 @@ Symbol::Symbol() : TextElement(SYMBOL, "symbol-"), AttColor(), AttExtSym(), AttT
 {
     this->Reset();
 
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_EXTSYM);
-    this->RegisterAttClass(ATT_TYPOGRAPHY);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttExtSym>(ATT_EXTSYM, this);
+    this->RegisterAttClass<AttTypography>(ATT_TYPOGRAPHY, this);
 }
 
 Symbol::~Symbol() {}
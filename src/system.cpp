@@ -46,13 +46,14 @@ namespace vrv {
 
 System::System() : Object(SYSTEM, "system-"), DrawingListInterface(), AttTyped()
 {
-    this->RegisterAttClass(ATT_TYPED);
+    this->RegisterAttClass<AttTyped>(ATT_TYPED, this);
 
     // We set parent to it because we want to access the parent doc from the aligners
     m_systemAligner.SetParent(this);
 
     // owned pointers need to be set to NULL;
     m_drawingScoreDef = NULL;
+    m_layerElementIndex = NULL;
 
     this->Reset();
 }
@@ -70,6 +71,7 @@ void System::Reset()
     this->ResetTyped();
 
     this->ResetDrawingScoreDef();
+    this->ResetLayerElementIndex();
 
     m_systemLeftMar = 0;
     m_systemRightMar = 0;
@@ -211,6 +213,25 @@ void System::ResetDrawingScoreDef()
     }
 }
 
+void System::FindSpannedLayerElements(FindSpannedLayerElementsFunctor &findSpannedLayerElements) const
+{
+    if (!m_layerElementIndex) {
+        m_layerElementIndex = new LayerElementIndex();
+        IndexLayerElementsFunctor indexLayerElements(m_layerElementIndex);
+        this->Process(indexLayerElements);
+        m_layerElementIndex->Sort();
+    }
+    m_layerElementIndex->Process(findSpannedLayerElements);
+}
+
+void System::ResetLayerElementIndex()
+{
+    if (m_layerElementIndex) {
+        delete m_layerElementIndex;
+        m_layerElementIndex = NULL;
+    }
+}
+
 bool System::HasMixedDrawingStemDir(const LayerElement *start, const LayerElement *end) const
 {
     assert(start);
@@ -290,7 +311,7 @@ curvature_CURVEDIR System::GetPreferredCurveDirection(
     const Layer *layerStart = vrv_cast<const Layer *>(start->GetFirstAncestor(LAYER));
     assert(layerStart);
 
-    this->Process(findSpannedLayerElements);
+    this->FindSpannedLayerElements(findSpannedLayerElements);
 
     curvature_CURVEDIR preferredDirection = curvature_CURVEDIR_NONE;
     for (auto element : findSpannedLayerElements.GetElements()) {
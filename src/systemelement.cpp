@@ -24,14 +24,14 @@ namespace vrv {
 
 SystemElement::SystemElement() : FloatingObject(SYSTEM_ELEMENT, "se"), AttTyped()
 {
-    this->RegisterAttClass(ATT_TYPED);
+    this->RegisterAttClass<AttTyped>(ATT_TYPED, this);
 
     this->Reset();
 }
 
 SystemElement::SystemElement(ClassId classId) : FloatingObject(classId, "se"), AttTyped()
 {
-    this->RegisterAttClass(ATT_TYPED);
+    this->RegisterAttClass<AttTyped>(ATT_TYPED, this);
 
     this->Reset();
 }
@@ -39,7 +39,7 @@ SystemElement::SystemElement(ClassId classId) : FloatingObject(classId, "se"), A
 SystemElement::SystemElement(ClassId classId, const std::string &classIdStr)
     : FloatingObject(classId, classIdStr), AttTyped()
 {
-    this->RegisterAttClass(ATT_TYPED);
+    this->RegisterAttClass<AttTyped>(ATT_TYPED, this);
 
     this->Reset();
 }
@@ -28,7 +28,7 @@ static const ClassRegistrar<TabGrp> s_factory("tabGrp", TABGRP);
 
 TabGrp::TabGrp() : LayerElement(TABGRP, "tabgrp-"), ObjectListInterface(), DurationInterface()
 {
-    this->RegisterInterface(DurationInterface::GetAttClasses(), DurationInterface::IsInterface());
+    this->RegisterInterface<DurationInterface>(this);
 
     this->Reset();
 }
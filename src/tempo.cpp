@@ -39,12 +39,12 @@ Tempo::Tempo()
     , AttMidiTempo()
     , AttMmTempo()
 {
-    this->RegisterInterface(TextDirInterface::GetAttClasses(), TextDirInterface::IsInterface());
-    this->RegisterInterface(TimeSpanningInterface::GetAttClasses(), TimeSpanningInterface::IsInterface());
-    this->RegisterAttClass(ATT_EXTENDER);
-    this->RegisterAttClass(ATT_LANG);
-    this->RegisterAttClass(ATT_MIDITEMPO);
-    this->RegisterAttClass(ATT_MMTEMPO);
+    this->RegisterInterface<TextDirInterface>(this);
+    this->RegisterInterface<TimeSpanningInterface>(this);
+    this->RegisterAttClass<AttExtender>(ATT_EXTENDER, this);
+    this->RegisterAttClass<AttLang>(ATT_LANG, this);
+    this->RegisterAttClass<AttMidiTempo>(ATT_MIDITEMPO, this);
+    this->RegisterAttClass<AttMmTempo>(ATT_MMTEMPO, this);
 
     this->Reset();
 }
@@ -24,7 +24,7 @@ namespace vrv {
 
 TextDirInterface::TextDirInterface() : Interface(), AttPlacementRelStaff()
 {
-    this->RegisterInterfaceAttClass(ATT_PLACEMENTRELSTAFF);
+    this->RegisterInterfaceAttClass<AttPlacementRelStaff>(ATT_PLACEMENTRELSTAFF, this);
 
     this->Reset();
 }
@@ -47,7 +47,7 @@ bool TextDirInterface::AreChildrenAlignedTo(const Object *object, data_HORIZONTA
 {
     ArrayOfConstObjects children = object->GetChildren();
     bool hasHalign = std::any_of(children.begin(), children.end(), [&alignment](const Object *child) {
-        const AttHorizontalAlign *hAlign = dynamic_cast<const AttHorizontalAlign *>(child);
+        const AttHorizontalAlign *hAlign = child->GetAtt<AttHorizontalAlign>(ATT_HORIZONTALALIGN);
         return (hAlign && (hAlign->GetHalign() == alignment));
     });
     return hasHalign;
@@ -0,0 +1,154 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        threadpool.cpp
+// Author:      Laurent Pugin
+// Created:     2023
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "threadpool.h"
+
+//----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cassert>
+
+//----------------------------------------------------------------------------
+
+#include "logsink.h"
+#include "profiler.h"
+
+namespace vrv {
+
+//----------------------------------------------------------------------------
+// ThreadPool
+//----------------------------------------------------------------------------
+
+ThreadPool::ThreadPool(int threadCount)
+{
+    assert(threadCount > 0);
+
+    m_run = 0;
+    m_pendingWorkers = 0;
+    m_stop = false;
+    m_task = NULL;
+    m_logSink = NULL;
+    m_profiler = NULL;
+
+    for (int i = 0; i < threadCount; ++i) {
+        m_ranges.push_back(std::make_unique<Range>());
+    }
+    for (int i = 1; i < threadCount; ++i) {
+        m_threads.emplace_back(&ThreadPool::WorkerLoop, this, i);
+    }
+}
+
+ThreadPool::~ThreadPool()
+{
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_startCondition.notify_all();
+    for (std::thread &thread : m_threads) {
+        thread.join();
+    }
+}
+
+void ThreadPool::Run(int taskCount, const std::function<void(int)> &task)
+{
+    if (taskCount <= 0) return;
+
+    // Split the tasks in contiguous ranges
+    const int threadCount = this->GetThreadCount();
+    for (int i = 0; i < threadCount; ++i) {
+        Range &range = *m_ranges.at(i);
+        const std::lock_guard<std::mutex> lock(range.m_mutex);
+        range.m_begin = (int)((long long)taskCount * i / threadCount);
+        range.m_end = (int)((long long)taskCount * (i + 1) / threadCount);
+    }
+
+    {
+        const std::lock_guard<std::mutex> lock(m_mutex);
+        m_task = &task;
+        m_logSink = LogSink::GetCurrent();
+        m_profiler = Profiler::GetCurrent();
+        m_pendingWorkers = (int)m_threads.size();
+        ++m_run;
+    }
+    m_startCondition.notify_all();
+
+    this->Work(0);
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_doneCondition.wait(lock, [this] { return (m_pendingWorkers == 0); });
+    m_task = NULL;
+}
+
+int ThreadPool::GetThreadCount(int option)
+{
+    if (option > 0) return option;
+    return std::max(1, (int)std::thread::hardware_concurrency());
+}
+
+void ThreadPool::WorkerLoop(int worker)
+{
+    int run = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_startCondition.wait(lock, [this, run] { return (m_stop || (m_run != run)); });
+            if (m_stop) return;
+            run = m_run;
+        }
+
+        LogSinkScope logSinkScope(m_logSink);
+        Profiler *previousProfiler = Profiler::GetCurrent();
+        Profiler::SetCurrent(m_profiler);
+
+        this->Work(worker);
+
+        Profiler::SetCurrent(previousProfiler);
+
+        {
+            const std::lock_guard<std::mutex> lock(m_mutex);
+            --m_pendingWorkers;
+        }
+        m_doneCondition.notify_one();
+    }
+}
+
+void ThreadPool::Work(int worker)
+{
+    int task;
+    while (this->TakeTask(worker, task)) {
+        (*m_task)(task);
+    }
+}
+
+bool ThreadPool::TakeTask(int worker, int &task)
+{
+    // Take the next task of the own range first
+    {
+        Range &range = *m_ranges.at(worker);
+        const std::lock_guard<std::mutex> lock(range.m_mutex);
+        if (range.m_begin < range.m_end) {
+            task = range.m_begin++;
+            return true;
+        }
+    }
+
+    // Steal the last task of another range
+    const int threadCount = this->GetThreadCount();
+    for (int i = 1; i < threadCount; ++i) {
+        Range &range = *m_ranges.at((worker + i) % threadCount);
+        const std::lock_guard<std::mutex> lock(range.m_mutex);
+        if (range.m_begin < range.m_end) {
+            task = --range.m_end;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} // namespace vrv
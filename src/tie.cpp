@@ -36,10 +36,10 @@ static const ClassRegistrar<Tie> s_factory("tie", TIE);
 
 Tie::Tie() : ControlElement(TIE, "tie-"), TimeSpanningInterface(), AttColor(), AttCurvature(), AttCurveRend()
 {
-    this->RegisterInterface(TimeSpanningInterface::GetAttClasses(), TimeSpanningInterface::IsInterface());
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_CURVATURE);
-    this->RegisterAttClass(ATT_CURVEREND);
+    this->RegisterInterface<TimeSpanningInterface>(this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttCurvature>(ATT_CURVATURE, this);
+    this->RegisterAttClass<AttCurveRend>(ATT_CURVEREND, this);
 
     this->Reset();
 }
@@ -47,10 +47,10 @@ Tie::Tie() : ControlElement(TIE, "tie-"), TimeSpanningInterface(), AttColor(), A
 Tie::Tie(ClassId classId)
     : ControlElement(classId, "tie-"), TimeSpanningInterface(), AttColor(), AttCurvature(), AttCurveRend()
 {
-    this->RegisterInterface(TimeSpanningInterface::GetAttClasses(), TimeSpanningInterface::IsInterface());
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_CURVATURE);
-    this->RegisterAttClass(ATT_CURVEREND);
+    this->RegisterInterface<TimeSpanningInterface>(this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttCurvature>(ATT_CURVATURE, this);
+    this->RegisterAttClass<AttCurveRend>(ATT_CURVEREND, this);
 
     this->Reset();
 }
@@ -58,10 +58,10 @@ Tie::Tie(ClassId classId)
 Tie::Tie(ClassId classId, const std::string &classIdStr)
     : ControlElement(classId, classIdStr), TimeSpanningInterface(), AttColor(), AttCurvature(), AttCurveRend()
 {
-    this->RegisterInterface(TimeSpanningInterface::GetAttClasses(), TimeSpanningInterface::IsInterface());
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_CURVATURE);
-    this->RegisterAttClass(ATT_CURVEREND);
+    this->RegisterInterface<TimeSpanningInterface>(this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttCurvature>(ATT_CURVATURE, this);
+    this->RegisterAttClass<AttCurveRend>(ATT_CURVEREND, this);
 
     this->Reset();
 }
@@ -530,7 +530,7 @@ void Tie::UpdateTiePositioning(const FloatingCurvePositioner *curve, Point bezie
             int oppositeOverlap = 0;
             // calculate position for the tie in case there is overlap with FLAG in the future
             dotsPosition = object->GetDrawingX()
-                + (1 + dynamic_cast<const AttAugmentDots *>(durElement)->GetDots()) * drawingUnit;
+                + (1 + durElement->GetAtt<AttAugmentDots>(ATT_AUGMENTDOTS)->GetDots()) * drawingUnit;
             if (durElement->Is(CHORD)) {
                 // If this is chord, we need to make sure that ties are compared against relative dot. Since all dots
                 // have one BB and this action is done for outer ties only, we can safely take height of the BB to
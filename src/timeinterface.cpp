@@ -30,9 +30,9 @@ namespace vrv {
 
 TimePointInterface::TimePointInterface() : Interface(), AttStaffIdent(), AttStartId(), AttTimestampLog()
 {
-    this->RegisterInterfaceAttClass(ATT_STAFFIDENT);
-    this->RegisterInterfaceAttClass(ATT_STARTID);
-    this->RegisterInterfaceAttClass(ATT_TIMESTAMPLOG);
+    this->RegisterInterfaceAttClass<AttStaffIdent>(ATT_STAFFIDENT, this);
+    this->RegisterInterfaceAttClass<AttStartId>(ATT_STARTID, this);
+    this->RegisterInterfaceAttClass<AttTimestampLog>(ATT_TIMESTAMPLOG, this);
 
     this->Reset();
 }
@@ -58,7 +58,7 @@ void TimePointInterface::SetStart(LayerElement *start)
 bool TimePointInterface::SetStartOnly(LayerElement *element)
 {
     // LogDebug("%s - %s - %s", element->GetID().c_str(), m_startID.c_str(), m_endID.c_str() );
-    if (!m_start && !m_startID.empty() && (element->GetID() == m_startID)) {
+    if (!m_start && !m_startID.empty() && element->HasID(m_startID)) {
         this->SetStart(element);
         return true;
     }
@@ -127,7 +127,7 @@ std::vector<Staff *> TimePointInterface::GetTstampStaves(Measure *measure, Objec
         bool isInBetween = false;
         // limit between support to some elements?
         if (object->Is({ DYNAM, DIR, HAIRPIN, TEMPO })) {
-            AttPlacementRelStaff *att = dynamic_cast<AttPlacementRelStaff *>(object);
+            AttPlacementRelStaff *att = object->GetAtt<AttPlacementRelStaff>(ATT_PLACEMENTRELSTAFF);
             assert(att);
             isInBetween = (att->GetPlace() == STAFFREL_between);
         }
@@ -182,8 +182,8 @@ bool TimePointInterface::VerifyMeasure(const Object *owner) const
 
 TimeSpanningInterface::TimeSpanningInterface() : TimePointInterface(), AttStartEndId(), AttTimestamp2Log()
 {
-    this->RegisterInterfaceAttClass(ATT_STARTENDID);
-    this->RegisterInterfaceAttClass(ATT_TIMESTAMP2LOG);
+    this->RegisterInterfaceAttClass<AttStartEndId>(ATT_STARTENDID, this);
+    this->RegisterInterfaceAttClass<AttTimestamp2Log>(ATT_TIMESTAMP2LOG, this);
 
     this->Reset();
 }
@@ -217,10 +217,10 @@ void TimeSpanningInterface::SetIDStr()
 bool TimeSpanningInterface::SetStartAndEnd(LayerElement *element)
 {
     // LogDebug("%s - %s - %s", element->GetID().c_str(), m_startID.c_str(), m_endID.c_str() );
-    if (!m_start && !m_startID.empty() && (element->GetID() == m_startID)) {
+    if (!m_start && !m_startID.empty() && element->HasID(m_startID)) {
         this->SetStart(element);
     }
-    else if (!m_end && !m_endID.empty() && (element->GetID() == m_endID)) {
+    else if (!m_end && !m_endID.empty() && element->HasID(m_endID)) {
         this->SetEnd(element);
     }
     return (m_start && m_end);
@@ -21,14 +21,18 @@
 #include "editortoolkit_cmn.h"
 #include "editortoolkit_mensural.h"
 #include "editortoolkit_neume.h"
+#include "featureextractor.h"
+#include "featureindex.h"
 #include "findfunctor.h"
 #include "ioabc.h"
 #include "iodarms.h"
 #include "iohumdrum.h"
+#include "iohummidi.h"
 #include "iomei.h"
 #include "iomusxml.h"
 #include "iopae.h"
 #include "layer.h"
+#include "layoutcache.h"
 #include "measure.h"
 #include "nc.h"
 #include "neume.h"
@@ -40,6 +44,8 @@
 #include "slur.h"
 #include "staff.h"
 #include "svgdevicecontext.h"
+#include "svgpatch.h"
+#include "threadpool.h"
 #include "vrv.h"
 
 //----------------------------------------------------------------------------
@@ -62,8 +68,6 @@ const char *ZIP_SIGNATURE = "\x50\x4B\x03\x04";
 // Toolkit
 //----------------------------------------------------------------------------
 
-char *Toolkit::m_humdrumBuffer = NULL;
-
 Toolkit::Toolkit(bool initFont)
 {
     m_inputFrom = AUTO;
@@ -80,6 +84,11 @@ Toolkit::Toolkit(bool initFont)
     m_options = m_doc.GetOptions();
 
     m_editorToolkit = NULL;
+    m_abcCollection = NULL;
+    m_featureIndex = NULL;
+    m_svgPatch = NULL;
+
+    m_invalidatedStage = OptionStage::HorizontalLayout;
 
 #ifndef NO_RUNTIME
     m_runtimeClock = NULL;
@@ -100,6 +109,18 @@ Toolkit::~Toolkit()
         delete m_editorToolkit;
         m_editorToolkit = NULL;
     }
+    if (m_abcCollection) {
+        delete m_abcCollection;
+        m_abcCollection = NULL;
+    }
+    if (m_featureIndex) {
+        delete m_featureIndex;
+        m_featureIndex = NULL;
+    }
+    if (m_svgPatch) {
+        delete m_svgPatch;
+        m_svgPatch = NULL;
+    }
 #ifndef NO_RUNTIME
     if (m_runtimeClock) {
         delete m_runtimeClock;
@@ -108,6 +129,11 @@ Toolkit::~Toolkit()
 #endif
 }
 
+Toolkit::MethodScope::MethodScope(Toolkit *toolkit, const char *name)
+    : m_logSinkScope(&toolkit->m_logSink), m_profilerScope(toolkit->GetActiveProfiler(), name)
+{
+}
+
 std::string Toolkit::GetResourcePath() const
 {
     return m_doc.GetResources().GetPath();
@@ -115,14 +141,20 @@ std::string Toolkit::GetResourcePath() const
 
 bool Toolkit::SetResourcePath(const std::string &path)
 {
+    MethodScope methodScope(this, __func__);
     Resources &resources = m_doc.GetResourcesForModification();
     resources.SetPath(path);
+    m_glyphSpriteCodes.clear();
+    // The fonts are loaded again
+    m_invalidatedStage = OptionStage::HorizontalLayout;
     return resources.InitFonts();
 }
 
 bool Toolkit::SetFont(const std::string &fontName)
 {
     Resources &resources = m_doc.GetResourcesForModification();
+    // The glyphs accumulated for the sprite are the ones of the current font
+    if (fontName != resources.GetCurrentFontName()) m_glyphSpriteCodes.clear();
     const bool ok = resources.SetFont(fontName);
     if (!ok) LogWarning("Font '%s' could not be loaded", fontName.c_str());
     return ok;
@@ -135,11 +167,13 @@ bool Toolkit::SetScale(int scale)
 
 bool Toolkit::Select(const std::string &selection)
 {
+    MethodScope methodScope(this, __func__);
     return m_docSelection.Parse(selection);
 }
 
 bool Toolkit::SetOutputTo(std::string const &outputTo)
 {
+    MethodScope methodScope(this, __func__);
     if ((outputTo == "humdrum") || (outputTo == "hum")) {
         m_outputTo = HUMDRUM;
     }
@@ -176,6 +210,7 @@ bool Toolkit::SetOutputTo(std::string const &outputTo)
 
 bool Toolkit::SetInputFrom(std::string const &inputFrom)
 {
+    MethodScope methodScope(this, __func__);
     if (inputFrom == "abc") {
         m_inputFrom = ABC;
     }
@@ -292,14 +327,28 @@ FileFormat Toolkit::IdentifyInputFrom(const std::string &data)
 
 bool Toolkit::LoadFile(const std::string &filename)
 {
-    if (this->IsUTF16(filename)) {
-        return this->LoadUTF16File(filename);
+    MethodScope methodScope(this, __func__);
+
+    // The file is read once and its format is identified from the content
+    std::string content;
+    if (!this->ReadFile(filename, content)) {
+        return false;
+    }
+
+    if ((content.compare(0, 2, UTF_16_LE_BOM) == 0) || (content.compare(0, 2, UTF_16_BE_BOM) == 0)) {
+        return this->LoadUTF16Data(content);
     }
-    if (this->IsZip(filename)) {
-        return this->LoadZipFile(filename);
+    if (content.compare(0, 4, ZIP_SIGNATURE) == 0) {
+        return this->LoadZipData((const unsigned char *)content.data(), content.size());
     }
 
-    std::ifstream in(filename.c_str());
+    // The content is owned here and can be parsed in place
+    return this->LoadData(content, &content);
+}
+
+bool Toolkit::ReadFile(const std::string &filename, std::string &content)
+{
+    std::ifstream in(filename.c_str(), std::ios::in | std::ios::binary);
     if (!in.is_open()) {
         return false;
     }
@@ -310,50 +359,22 @@ bool Toolkit::LoadFile(const std::string &filename)
     in.seekg(0, std::ios::beg);
 
     // read the file into the std::string:
-    std::string content(fileSize, 0);
-    in.read(&content[0], fileSize);
-
-    return this->LoadData(content);
-}
+    content.resize(fileSize);
+    in.read(content.data(), fileSize);
+    content.resize(in.gcount());
 
-bool Toolkit::IsUTF16(const std::string &filename)
-{
-    std::ifstream fin(filename.c_str(), std::ios::in | std::ios::binary);
-    if (!fin.is_open()) {
-        return false;
-    }
-
-    char data[2];
-    memset(data, 0, 2);
-    fin.read(data, 2);
-    fin.close();
-
-    if (memcmp(data, UTF_16_LE_BOM, 2) == 0) return true;
-    if (memcmp(data, UTF_16_BE_BOM, 2) == 0) return true;
-
-    return false;
+    return true;
 }
 
-bool Toolkit::LoadUTF16File(const std::string &filename)
+bool Toolkit::LoadUTF16Data(const std::string &content)
 {
-    /// Loading a UTF-16 file with basic conversion ot UTF-8
-    /// This is called after checking if the file has a UTF-16 BOM
+    /// Loading UTF-16 data with basic conversion ot UTF-8
+    /// This is called after checking if the data has a UTF-16 BOM
 
     LogWarning("The file seems to be UTF-16 - trying to convert to UTF-8");
 
-    std::ifstream fin(filename.c_str(), std::ios::in | std::ios::binary);
-    if (!fin.is_open()) {
-        return false;
-    }
-
-    fin.seekg(0, std::ios::end);
-    std::streamsize wfileSize = (std::streamsize)fin.tellg();
-    fin.clear();
-
-    fin.seekg(0, std::wios::beg);
-
-    std::u16string u16data((wfileSize / 2) + 1, '\0');
-    fin.read((char *)&u16data[0], wfileSize);
+    std::u16string u16data((content.size() / 2) + 1, '\0');
+    memcpy(u16data.data(), content.data(), content.size());
 
     // order of the bytes has to be flipped
     if (u16data.at(0) == u'\uFFFE') {
@@ -374,77 +395,58 @@ bool Toolkit::LoadUTF16File(const std::string &filename)
     std::wstring_convert<std::codecvt_utf8<char16_t>, char16_t> convert;
     std::string utf8line = convert.to_bytes(u16data);
 
-    return this->LoadData(utf8line);
-}
-
-bool Toolkit::IsZip(const std::string &filename)
-{
-    std::ifstream fin(filename.c_str(), std::ios::in | std::ios::binary);
-    if (!fin.is_open()) {
-        return false;
-    }
-
-    char data[4];
-    memset(data, 0, 4);
-    fin.read(data, 4);
-    fin.close();
-
-    if (memcmp(data, ZIP_SIGNATURE, 4) == 0) return true;
-
-    return false;
+    return this->LoadData(utf8line, &utf8line);
 }
 
-bool Toolkit::LoadZipFile(const std::string &filename)
+bool Toolkit::LoadZipData(const unsigned char *data, size_t size)
 {
-    std::ifstream fin(filename.c_str(), std::ios::in | std::ios::binary);
-    if (!fin.is_open()) {
+#ifndef NO_MXL_SUPPORT
+    // The archive is read directly from the buffer without copying it
+    mz_zip_archive archive;
+    memset(&archive, 0, sizeof(archive));
+    if (!mz_zip_reader_init_mem(&archive, data, size, 0)) {
+        LogError("The archive cannot be read");
         return false;
     }
 
-    fin.seekg(0, std::ios::end);
-    std::streamsize fileSize = (std::streamsize)fin.tellg();
-    fin.clear();
-    fin.seekg(0, std::wios::beg);
-
-    std::vector<unsigned char> bytes;
-    bytes.reserve(fileSize + 1);
-
-    unsigned char buffer;
-    while (fin.read((char *)&buffer, sizeof(unsigned char))) {
-        bytes.push_back(buffer);
-    }
-
-    return this->LoadZipData(bytes);
-}
-
-bool Toolkit::LoadZipData(const std::vector<unsigned char> &bytes)
-{
-#ifndef NO_MXL_SUPPORT
-    miniz_cpp::zip_file file(bytes);
+    // Extract a file of the archive into a string
+    auto extract = [&archive](int index, std::string &content) {
+        mz_zip_archive_file_stat stat;
+        if ((index < 0) || !mz_zip_reader_file_stat(&archive, index, &stat)) return false;
+        content.resize((size_t)stat.m_uncomp_size);
+        return (bool)mz_zip_reader_extract_to_mem(&archive, index, content.data(), content.size(), 0);
+    };
 
     std::string filename;
+    std::string content;
     // Look for the meta file in the zip
-    for (miniz_cpp::zip_info &member : file.infolist()) {
-        if (member.filename == "META-INF/container.xml") {
-            std::string container = file.read(member.filename);
-            // Find the file name with an xpath query
-            pugi::xml_document doc;
-            doc.load_buffer(container.c_str(), container.size());
-            pugi::xml_node root = doc.first_child();
-            pugi::xml_node rootfile = root.select_node("/container/rootfiles/rootfile").node();
-            filename = rootfile.attribute("full-path").value();
-            break;
-        }
+    if (extract(mz_zip_reader_locate_file(&archive, "META-INF/container.xml", NULL, 0), content)) {
+        // Find the file name with an xpath query
+        pugi::xml_document doc;
+        doc.load_buffer(content.c_str(), content.size());
+        pugi::xml_node root = doc.first_child();
+        pugi::xml_node rootfile = root.select_node("/container/rootfiles/rootfile").node();
+        filename = rootfile.attribute("full-path").value();
     }
 
+    bool extracted = false;
     if (!filename.empty()) {
-        LogInfo("Loading file '%s' in the archive", filename.c_str());
-        return this->LoadData(file.read(filename));
+        extracted = extract(mz_zip_reader_locate_file(&archive, filename.c_str(), NULL, 0), content);
     }
-    else {
+    mz_zip_reader_end(&archive);
+
+    if (filename.empty()) {
         LogError("No file to load found in the archive");
         return false;
     }
+    else if (!extracted) {
+        LogError("The file '%s' cannot be extracted from the archive", filename.c_str());
+        return false;
+    }
+
+    LogInfo("Loading file '%s' in the archive", filename.c_str());
+    // The extracted content is owned here and can be parsed in place
+    return this->LoadData(content, &content);
 #else
     LogError("MXL import is not supported in this build.");
     return false;
@@ -453,23 +455,87 @@ bool Toolkit::LoadZipData(const std::vector<unsigned char> &bytes)
 
 bool Toolkit::LoadZipDataBase64(const std::string &data)
 {
+    MethodScope methodScope(this, __func__);
     std::vector<unsigned char> bytes = Base64Decode(data);
-    return this->LoadZipData(bytes);
+    return this->LoadZipData(bytes.data(), bytes.size());
 }
 
 bool Toolkit::LoadZipDataBuffer(const unsigned char *data, int length)
 {
-    std::vector<unsigned char> bytes(data, data + length);
-    return this->LoadZipData(bytes);
+    MethodScope methodScope(this, __func__);
+    return this->LoadZipData(data, (size_t)length);
+}
+
+bool Toolkit::LoadABCCollection(const std::string &data, const std::string &jsonIndex)
+{
+    MethodScope methodScope(this, __func__);
+    if (!m_abcCollection) m_abcCollection = new ABCCollection();
+    return m_abcCollection->Load(data, jsonIndex);
+}
+
+std::string Toolkit::GetABCCollectionIndex() const
+{
+    if (!m_abcCollection) return "{}";
+    return m_abcCollection->GetIndexAsJson();
+}
+
+bool Toolkit::LoadABCTune(int tune, bool byReferenceNumber)
+{
+    MethodScope methodScope(this, __func__);
+    if (!m_abcCollection || (m_abcCollection->GetTuneCount() == 0)) {
+        LogError("No ABC collection loaded");
+        return false;
+    }
+
+    const int index = (byReferenceNumber) ? m_abcCollection->GetTuneIndex(tune) : tune;
+    if (!m_abcCollection->GetTune(index)) {
+        LogError("Tune %d not found in the ABC collection", tune);
+        return false;
+    }
+
+    // Make sure the tune is read as ABC even if the file header prevents the auto-detection
+    FileFormat inputFrom = m_inputFrom;
+    m_inputFrom = ABC;
+    bool success = this->LoadData(m_abcCollection->GetTuneData(index));
+    m_inputFrom = inputFrom;
+    return success;
 }
 
 bool Toolkit::LoadData(const std::string &data)
 {
+    return this->LoadData(data, NULL);
+}
+
+bool Toolkit::LoadDataBuffer(const char *data, int length)
+{
+    MethodScope methodScope(this, __func__);
+    if (!data || (length < 0)) {
+        LogError("Invalid data buffer");
+        return false;
+    }
+    // The copy is owned here and can be parsed in place
+    std::string content(data, length);
+    return this->LoadData(content, &content);
+}
+
+bool Toolkit::LoadData(const std::string &data, std::string *inPlaceData)
+{
+    MethodScope methodScope(this, __func__);
     std::string newData;
     Input *input = NULL;
 
+    // Objects created during the loading and the layout are allocated in the document arena
+    ObjectArenaScope arenaScope(m_doc.GetArena());
+
     m_doc.m_expansionMap.Reset();
 
+    // The pages rendered for patches are not valid anymore
+    if (m_svgPatch) m_svgPatch->Reset();
+
+    // The layout is valid only once the data is loaded
+    m_layoutOptionValues.clear();
+    m_widthBreaks.clear();
+
     if (m_options->m_xmlIdChecksum.GetValue()) {
         crcInit();
         unsigned int cr = crcFast((unsigned char *)data.c_str(), (int)data.size());
@@ -518,6 +584,7 @@ bool Toolkit::LoadData(const std::string &data)
             input->SetOutputFormat("humdrum");
         }
 
+        ProfilerEvent event(PROFILER_IMPORT, typeid(*input));
         if (!input->Import(data)) {
             LogError("Error importing Humdrum data (1)");
             delete input;
@@ -694,9 +761,27 @@ bool Toolkit::LoadData(const std::string &data)
         return false;
     }
 
-    // load the file
+    // The hash of the input data identifies the content in the persistent layout cache
+    // It is calculated before the import because the data can be parsed in place
+    std::string dataHash;
+    if (!m_options->m_layoutCacheDir.GetValue().empty()) {
+        dataHash = LayoutCache::Hash(data);
+    }
+
+    // load the file - the converted data and the data owned by the caller can be modified by the import
     if (inputFormat != HUMDRUM) {
-        if (!input->Import(newData.size() ? newData : data)) {
+        ProfilerEvent event(PROFILER_IMPORT, typeid(*input));
+        bool success = false;
+        if (!newData.empty()) {
+            success = input->ImportInPlace(newData);
+        }
+        else if (inPlaceData) {
+            success = input->ImportInPlace(*inPlaceData);
+        }
+        else {
+            success = input->Import(data);
+        }
+        if (!success) {
             LogError("Error importing data");
             delete input;
             return false;
@@ -706,11 +791,12 @@ bool Toolkit::LoadData(const std::string &data)
     bool adjustPageHeight = m_options->m_adjustPageHeight.GetValue();
     int footerOption = m_options->m_footer.GetValue();
     // With adjusted page height, show the footer if explicitly set (i.e., not with "auto")
-    // generate the page header and footer if necessary
-    if ((!adjustPageHeight && (footerOption == FOOTER_auto)) || (footerOption == FOOTER_always)) {
+    // generate the page header and footer if necessary - never in incipit or data-only mode
+    const bool noPageSetup = (m_options->m_incipitMode.GetValue() || m_options->m_dataOnly.GetValue());
+    if (!noPageSetup && ((!adjustPageHeight && (footerOption == FOOTER_auto)) || (footerOption == FOOTER_always))) {
         m_doc.GenerateFooter();
     }
-    if (m_options->m_header.GetValue() == HEADER_auto) {
+    if (!noPageSetup && (m_options->m_header.GetValue() == HEADER_auto)) {
         m_doc.GenerateHeader();
     }
 
@@ -733,6 +819,10 @@ bool Toolkit::LoadData(const std::string &data)
         m_doc.ConvertToCastOffMensuralDoc(true);
     }
 
+    if (!dataHash.empty()) {
+        m_doc.SetDataHash(dataHash);
+    }
+
     // Do the layout? this depends on the options and the file. PAE and
     // DARMS have no layout information. MEI files _can_ have it, but it
     // might have been ignored because of the --breaks auto option.
@@ -753,6 +843,12 @@ bool Toolkit::LoadData(const std::string &data)
     // to be converted
     if (m_doc.GetType() == Transcription || m_doc.GetType() == Facs) breaks = BREAKS_none;
 
+    // In incipit mode the content remains on a single system and no cast-off is necessary
+    if (m_doc.IsIncipit()) breaks = BREAKS_none;
+
+    // In data-only mode no layout is done - the timemap only needs the duration-based alignment
+    if (m_options->m_dataOnly.GetValue()) breaks = BREAKS_none;
+
     if (breaks != BREAKS_none) {
         if (input->GetLayoutInformation() == LAYOUT_ENCODED
             && (breaks == BREAKS_encoded || breaks == BREAKS_line || breaks == BREAKS_smart)) {
@@ -787,6 +883,9 @@ bool Toolkit::LoadData(const std::string &data)
     delete input;
     m_view.SetDoc(&m_doc);
 
+    // The cast-off done when loading can differ from the one of RedoLayout
+    this->StoreLayoutOptions(OptionStage::CastOff);
+
 #if defined NO_HUMDRUM_SUPPORT
     // Create editor toolkit based on notation type.
     if (m_editorToolkit != NULL) {
@@ -807,6 +906,7 @@ bool Toolkit::LoadData(const std::string &data)
 
 std::string Toolkit::GetMEI(const std::string &jsonOptions)
 {
+    MethodScope methodScope(this, __func__);
     bool scoreBased = true;
     bool basic = false;
     bool ignoreHeader = false;
@@ -883,6 +983,7 @@ std::string Toolkit::GetMEI(const std::string &jsonOptions)
 
 std::string Toolkit::ValidatePAEFile(const std::string &filename)
 {
+    MethodScope methodScope(this, __func__);
     std::ifstream inFile;
     inFile.open(filename);
 
@@ -893,7 +994,9 @@ std::string Toolkit::ValidatePAEFile(const std::string &filename)
 
 std::string Toolkit::ValidatePAE(const std::string &data)
 {
+    MethodScope methodScope(this, __func__);
     PAEInput input(&m_doc);
+    input.SetValidationOnly(true);
     input.Import(data);
     m_doc.Reset();
     return input.GetValidationLog().json();
@@ -901,6 +1004,7 @@ std::string Toolkit::ValidatePAE(const std::string &data)
 
 bool Toolkit::SaveFile(const std::string &filename, const std::string &jsonOptions)
 {
+    MethodScope methodScope(this, __func__);
     std::string output = this->GetMEI(jsonOptions);
     if (output.empty()) {
         return false;
@@ -1024,6 +1128,7 @@ std::string Toolkit::GetAvailableOptions() const
 
 bool Toolkit::SetOptions(const std::string &jsonOptions)
 {
+    MethodScope methodScope(this, __func__);
     jsonxx::Object json;
 
     // Read JSON options
@@ -1260,6 +1365,7 @@ std::string Toolkit::GetOptionUsageString() const
 
 std::string Toolkit::GetElementAttr(const std::string &xmlId)
 {
+    MethodScope methodScope(this, __func__);
     jsonxx::Object o;
 
     const Object *element = NULL;
@@ -1324,6 +1430,7 @@ std::string Toolkit::GetElementAttr(const std::string &xmlId)
 
 std::string Toolkit::GetNotatedIdForElement(const std::string &xmlId)
 {
+    MethodScope methodScope(this, __func__);
     if (m_doc.m_expansionMap.HasExpansionMap()) {
         return m_doc.m_expansionMap.GetExpansionIDsForElement(xmlId).front();
     }
@@ -1334,6 +1441,7 @@ std::string Toolkit::GetNotatedIdForElement(const std::string &xmlId)
 
 std::string Toolkit::GetExpansionIdsForElement(const std::string &xmlId)
 {
+    MethodScope methodScope(this, __func__);
     jsonxx::Array a;
     if (m_doc.m_expansionMap.HasExpansionMap()) {
         for (std::string id : m_doc.m_expansionMap.GetExpansionIDsForElement(xmlId)) {
@@ -1348,8 +1456,16 @@ std::string Toolkit::GetExpansionIdsForElement(const std::string &xmlId)
 
 bool Toolkit::Edit(const std::string &editorAction)
 {
+    MethodScope methodScope(this, __func__);
     this->ResetLogBuffer();
 
+    // The edition can change the content recorded when setting the current scoreDef
+    m_doc.ResetScoreDefChanges();
+    // The content does not match the input data anymore for the persistent layout cache
+    m_doc.SetDataHash("");
+    // The layout has to be fully redone
+    m_invalidatedStage = OptionStage::HorizontalLayout;
+
     return m_editorToolkit->ParseEditorAction(editorAction);
 }
 
@@ -1360,11 +1476,32 @@ std::string Toolkit::EditInfo()
 
 std::string Toolkit::GetLog()
 {
-    std::string str;
-    for (const std::string &logStr : logBuffer) {
-        str += logStr;
-    }
-    return str;
+    return m_logSink.GetLog();
+}
+
+void Toolkit::EnableLog(LogLevel level)
+{
+    m_logSink.SetLogLevel(level);
+}
+
+void Toolkit::EnableLogToBuffer(bool value)
+{
+    m_logSink.SetLoggingToBuffer(value);
+}
+
+std::string Toolkit::GetProfilingReport() const
+{
+    return m_profiler.GetReport();
+}
+
+std::string Toolkit::GetProfilingTrace() const
+{
+    return m_profiler.GetTrace();
+}
+
+void Toolkit::ResetProfiling()
+{
+    m_profiler.Reset();
 }
 
 std::string Toolkit::GetVersion() const
@@ -1380,12 +1517,18 @@ void Toolkit::ResetXmlIdSeed(int seed)
 
 void Toolkit::ResetLogBuffer()
 {
-    logBuffer.clear();
+    m_logSink.Reset();
 }
 
 void Toolkit::RedoLayout(const std::string &jsonOptions)
 {
-    bool resetCache = true;
+    MethodScope methodScope(this, __func__);
+    ObjectArenaScope arenaScope(m_doc.GetArena());
+
+    const OptionStage stage = this->GetInvalidatedStage(m_layoutOptionValues);
+    // By default, the cached horizontal layout is kept when it is not invalidated
+    bool resetCache = (stage >= OptionStage::HorizontalLayout) || m_docSelection.m_isPending;
+    bool isResetCacheSet = false;
 
     jsonxx::Object json;
 
@@ -1395,7 +1538,10 @@ void Toolkit::RedoLayout(const std::string &jsonOptions)
             LogWarning("Cannot parse JSON std::string. Using default options.");
         }
         else {
-            if (json.has<jsonxx::Boolean>("resetCache")) resetCache = json.get<jsonxx::Boolean>("resetCache");
+            if (json.has<jsonxx::Boolean>("resetCache")) {
+                resetCache = json.get<jsonxx::Boolean>("resetCache");
+                isResetCacheSet = true;
+            }
         }
     }
 
@@ -1406,6 +1552,17 @@ void Toolkit::RedoLayout(const std::string &jsonOptions)
         return;
     }
 
+    if (stage == OptionStage::Data) {
+        LogDebug("Some options changed take effect only when the data is loaded again");
+    }
+    // Only drawing options changed - the layout is still valid
+    else if ((stage == OptionStage::Drawing) && !isResetCacheSet && !m_docSelection.m_isPending) {
+        return;
+    }
+
+    // The breaks found for other page widths do not match a new horizontal layout
+    if (resetCache) m_widthBreaks.clear();
+
     if (m_docSelection.m_isPending) {
         m_doc.InitSelectionDoc(m_docSelection, resetCache);
     }
@@ -1413,6 +1570,119 @@ void Toolkit::RedoLayout(const std::string &jsonOptions)
         m_doc.UnCastOffDoc(resetCache);
     }
 
+    // In incipit mode the content remains on a single system, and in data-only mode it is not laid out
+    if (m_doc.IsIncipit() || m_options->m_dataOnly.GetValue()) {
+        this->StoreLayoutOptions(OptionStage::Drawing);
+        return;
+    }
+
+    this->CastOffDoc();
+
+    this->StoreLayoutOptions(OptionStage::Drawing);
+}
+
+std::string Toolkit::RedoLayoutForWidths(const std::string &jsonWidths)
+{
+    MethodScope methodScope(this, __func__);
+    ObjectArenaScope arenaScope(m_doc.GetArena());
+
+    jsonxx::Array widths;
+    if (!widths.parse(jsonWidths)) {
+        LogError("Cannot parse JSON std::string.");
+        return "[]";
+    }
+
+    // Bring the layout up to date - the horizontal layout is the one of all the widths
+    this->RedoLayout();
+    m_widthBreaks.clear();
+
+    if ((this->GetPageCount() == 0) || (m_doc.GetType() == Transcription) || (m_doc.GetType() == Facs)
+        || m_doc.IsIncipit() || m_options->m_dataOnly.GetValue()) {
+        LogWarning("No data to cast off");
+        return "[]";
+    }
+    if ((m_options->m_breaks.GetValue() != BREAKS_auto) && (m_options->m_breaks.GetValue() != BREAKS_smart)) {
+        LogWarning("The cast off does not depend on the page width with '%s' breaks",
+            m_options->m_breaks.GetStrValue().c_str());
+        return "[]";
+    }
+
+    const int pageWidth = m_options->m_pageWidth.GetUnfactoredValue();
+    m_widthBreaks[pageWidth] = m_doc.GetCastOffBreaks();
+
+    jsonxx::Array result;
+    for (size_t i = 0; i < widths.size(); ++i) {
+        if (!widths.has<jsonxx::Number>((unsigned)i)) {
+            LogWarning("Page width at index %d is not a number and is ignored", (int)i);
+            continue;
+        }
+        const int width = (int)widths.get<jsonxx::Number>((unsigned)i);
+        if (m_widthBreaks.count(width) == 0) {
+            if (!m_options->m_pageWidth.SetValue(width)) continue;
+            m_doc.UnCastOffDoc(false);
+            this->CastOffDoc();
+            m_widthBreaks[width] = m_doc.GetCastOffBreaks();
+        }
+        const CastOffBreaks &breaks = m_widthBreaks.at(width);
+        jsonxx::Array systems;
+        for (const std::string &measureID : breaks.m_systemMeasures) systems << measureID;
+        jsonxx::Array pages;
+        for (const std::string &measureID : breaks.m_pageMeasures) pages << measureID;
+        jsonxx::Object o;
+        o << "pageWidth" << width;
+        o << "pageCount" << (int)breaks.m_pages.size();
+        o << "systems" << systems;
+        o << "pages" << pages;
+        result << o;
+    }
+
+    // Go back to the current page width
+    if (m_options->m_pageWidth.GetUnfactoredValue() != pageWidth) {
+        m_options->m_pageWidth.SetValue(pageWidth);
+        m_doc.UnCastOffDoc(false);
+        m_doc.CastOffBreaksDoc(m_widthBreaks.at(pageWidth));
+    }
+    this->StoreLayoutOptions(OptionStage::Drawing);
+    m_widthOptionValues = m_layoutOptionValues;
+
+    return result.json();
+}
+
+bool Toolkit::SwitchLayoutWidth(int pageWidth)
+{
+    MethodScope methodScope(this, __func__);
+    ObjectArenaScope arenaScope(m_doc.GetArena());
+    this->ResetLogBuffer();
+
+    if (m_widthBreaks.count(pageWidth) == 0) {
+        LogError("The data was not cast off for a page width of %d", pageWidth);
+        return false;
+    }
+
+    m_options->m_pageWidth.SetValue(pageWidth);
+
+    // The breaks are valid only if nothing else changed since they were found
+    std::map<std::string, std::string> optionValues = m_widthOptionValues;
+    optionValues["pageWidth"] = m_options->m_pageWidth.GetStrValue();
+    if (m_docSelection.m_isPending || (this->GetInvalidatedStage(optionValues) > OptionStage::Drawing)) {
+        LogDebug("The data is cast off again for all the page widths");
+        jsonxx::Array widths;
+        for (const auto &[width, breaks] : m_widthBreaks) widths << width;
+        // The document remains laid out for the page width
+        this->RedoLayoutForWidths(widths.json());
+        return (m_widthBreaks.count(pageWidth) > 0);
+    }
+
+    m_doc.UnCastOffDoc(false);
+    m_doc.CastOffBreaksDoc(m_widthBreaks.at(pageWidth));
+
+    this->StoreLayoutOptions(OptionStage::Drawing);
+
+    return true;
+}
+
+void Toolkit::CastOffDoc()
+{
     if (m_options->m_breaks.GetValue() == BREAKS_line) {
         m_doc.CastOffLineDoc();
     }
@@ -1427,8 +1697,39 @@ void Toolkit::RedoLayout(const std::string &jsonOptions)
     }
 }
 
+void Toolkit::StoreLayoutOptions(OptionStage invalidatedStage)
+{
+    m_layoutOptionValues.clear();
+    for (const auto &[name, option] : *m_options->GetItems()) {
+        m_layoutOptionValues[name] = option->GetStrValue();
+    }
+    m_layoutOptionValues["scale"] = m_options->m_scale.GetStrValue();
+    m_invalidatedStage = invalidatedStage;
+}
+
+OptionStage Toolkit::GetInvalidatedStage(const std::map<std::string, std::string> &optionValues) const
+{
+    if (optionValues.empty()) return OptionStage::HorizontalLayout;
+
+    OptionStage stage = m_invalidatedStage;
+    for (const auto &[name, option] : *m_options->GetItems()) {
+        if (option->GetStage() <= stage) continue;
+        auto iter = optionValues.find(name);
+        if ((iter == optionValues.end()) || (iter->second != option->GetStrValue())) {
+            stage = option->GetStage();
+        }
+    }
+    if ((m_options->m_scale.GetStage() > stage)
+        && (optionValues.at("scale") != m_options->m_scale.GetStrValue())) {
+        stage = m_options->m_scale.GetStage();
+    }
+
+    return stage;
+}
+
 void Toolkit::RedoPagePitchPosLayout()
 {
+    MethodScope methodScope(this, __func__);
     this->ResetLogBuffer();
 
     Page *page = m_doc.GetDrawingPage();
@@ -1438,6 +1739,9 @@ void Toolkit::RedoPagePitchPosLayout()
         return;
     }
 
+    // The layout of the page does not match a full layout anymore
+    m_invalidatedStage = OptionStage::HorizontalLayout;
+
     page->LayOutPitchPos();
 }
 
@@ -1500,6 +1804,7 @@ bool Toolkit::RenderToDeviceContext(int pageNo, DeviceContext *deviceContext)
 
 std::string Toolkit::RenderData(const std::string &data, const std::string &jsonOptions)
 {
+    MethodScope methodScope(this, __func__);
     if (this->SetOptions(jsonOptions) && this->LoadData(data)) return this->RenderToSVG(1);
 
     // Otherwise just return an empty string.
@@ -1508,12 +1813,50 @@ std::string Toolkit::RenderData(const std::string &data, const std::string &json
 
 std::string Toolkit::RenderToSVG(int pageNo, bool xmlDeclaration)
 {
+    MethodScope methodScope(this, __func__);
     this->ResetLogBuffer();
 
     int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
     // Create the SVG object, h & w come from the system
     // We will need to set the size of the page after having drawn it depending on the options
     SvgDeviceContext svg;
+    this->RenderToSvgDeviceContext(pageNo, svg);
+
+    std::string out_str = svg.GetStringSVG(xmlDeclaration);
+
+    // The page rendered for patches is now replaced
+    if (m_svgPatch) m_svgPatch->ResetPage(pageNo);
+
+    if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
+    return out_str;
+}
+
+std::string Toolkit::RenderToSVGPatch(int pageNo)
+{
+    MethodScope methodScope(this, __func__);
+    this->ResetLogBuffer();
+
+    if ((pageNo < 1) || (pageNo > this->GetPageCount())) {
+        LogWarning("Page %d does not exist", pageNo);
+        return "{}";
+    }
+
+    if (!m_svgPatch) m_svgPatch = new SvgPatch();
+
+    int initialPageNo = (m_doc.GetDrawingPage() == NULL) ? -1 : m_doc.GetDrawingPage()->GetIdx();
+    SvgDeviceContext svg;
+    // Keep the glyph IDs of the previous rendering of the page
+    m_svgPatch->InitDeviceContext(pageNo, svg);
+    this->RenderToSvgDeviceContext(pageNo, svg);
+
+    std::string out_str = m_svgPatch->MakePatch(pageNo, svg);
+
+    if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
+    return out_str;
+}
+
+void Toolkit::RenderToSvgDeviceContext(int pageNo, SvgDeviceContext &svg)
+{
     svg.SetResources(&m_doc.GetResources());
 
     int indent = (m_options->m_outputIndentTab.GetValue()) ? -1 : m_options->m_outputIndent.GetValue();
@@ -1546,17 +1889,20 @@ std::string Toolkit::RenderToSVG(int pageNo, bool xmlDeclaration)
     svg.SetRemoveXlink(m_options->m_svgRemoveXlink.GetValue());
     svg.SetAdditionalAttributes(m_options->m_svgAdditionalAttribute.GetValue());
     svg.SetSmuflTextFont((option_SMUFLTEXTFONT)m_options->m_smuflTextFont.GetValue());
+    svg.SetGlyphSprite(m_options->m_svgGlyphSprite.GetValue(), m_options->m_svgGlyphSpriteUrl.GetValue());
 
     // render the page
     this->RenderToDeviceContext(pageNo, &svg);
 
-    std::string out_str = svg.GetStringSVG(xmlDeclaration);
-    if (initialPageNo >= 0) m_doc.SetDrawingPage(initialPageNo);
-    return out_str;
+    // keep the glyphs for RenderToGlyphSprite
+    if (m_options->m_svgGlyphSprite.GetValue()) {
+        m_glyphSpriteCodes.insert(svg.GetSmuflGlyphCodes().begin(), svg.GetSmuflGlyphCodes().end());
+    }
 }
 
 bool Toolkit::RenderToSVGFile(const std::string &filename, int pageNo)
 {
+    MethodScope methodScope(this, __func__);
     this->ResetLogBuffer();
 
     std::string output = this->RenderToSVG(pageNo, true);
@@ -1574,13 +1920,54 @@ bool Toolkit::RenderToSVGFile(const std::string &filename, int pageNo)
     return true;
 }
 
+std::string Toolkit::RenderToGlyphSprite()
+{
+    MethodScope methodScope(this, __func__);
+    this->ResetLogBuffer();
+
+    const Resources &resources = m_doc.GetResources();
+    std::set<const Glyph *> glyphs;
+    for (char32_t code : m_glyphSpriteCodes) {
+        const Glyph *glyph = resources.GetGlyph(code);
+        if (glyph) glyphs.insert(glyph);
+    }
+
+    SvgDeviceContext svg;
+    svg.SetResources(&resources);
+    int indent = (m_options->m_outputIndentTab.GetValue()) ? -1 : m_options->m_outputIndent.GetValue();
+    svg.SetIndent(indent);
+    svg.SetFormatRaw(m_options->m_svgFormatRaw.GetValue());
+
+    return svg.GetStringGlyphSprite(glyphs);
+}
+
+bool Toolkit::RenderToGlyphSpriteFile(const std::string &filename)
+{
+    MethodScope methodScope(this, __func__);
+    std::string output = this->RenderToGlyphSprite();
+
+    std::ofstream outfile;
+    outfile.open(filename.c_str());
+
+    if (!outfile.is_open()) {
+        // add message?
+        return false;
+    }
+
+    outfile << output;
+    outfile.close();
+    return true;
+}
+
 std::string Toolkit::GetHumdrum()
 {
+    MethodScope methodScope(this, __func__);
     return this->GetHumdrumBuffer();
 }
 
 bool Toolkit::GetHumdrumFile(const std::string &filename)
 {
+    MethodScope methodScope(this, __func__);
     std::ofstream output;
     output.open(filename.c_str());
 
@@ -1596,11 +1983,13 @@ bool Toolkit::GetHumdrumFile(const std::string &filename)
 
 void Toolkit::GetHumdrum(std::ostream &output)
 {
+    MethodScope methodScope(this, __func__);
     output << this->GetHumdrumBuffer();
 }
 
 std::string Toolkit::RenderToMIDI()
 {
+    MethodScope methodScope(this, __func__);
     this->ResetLogBuffer();
 
     smf::MidiFile outputfile;
@@ -1618,6 +2007,7 @@ std::string Toolkit::RenderToMIDI()
 
 std::string Toolkit::RenderToPAE()
 {
+    MethodScope methodScope(this, __func__);
     this->ResetLogBuffer();
 
     if (this->GetPageCount() == 0) {
@@ -1635,6 +2025,7 @@ std::string Toolkit::RenderToPAE()
 
 bool Toolkit::RenderToPAEFile(const std::string &filename)
 {
+    MethodScope methodScope(this, __func__);
     this->ResetLogBuffer();
 
     std::string outputString = this->RenderToPAE();
@@ -1650,6 +2041,7 @@ bool Toolkit::RenderToPAEFile(const std::string &filename)
 
 std::string Toolkit::RenderToTimemap(const std::string &jsonOptions)
 {
+    MethodScope methodScope(this, __func__);
     bool includeMeasures = false;
     bool includeRests = false;
 
@@ -1676,6 +2068,7 @@ std::string Toolkit::RenderToTimemap(const std::string &jsonOptions)
 
 std::string Toolkit::RenderToExpansionMap()
 {
+    MethodScope methodScope(this, __func__);
     this->ResetLogBuffer();
 
     std::string output;
@@ -1685,6 +2078,7 @@ std::string Toolkit::RenderToExpansionMap()
 
 std::string Toolkit::GetElementsAtTime(int millisec)
 {
+    MethodScope methodScope(this, __func__);
     this->ResetLogBuffer();
 
     jsonxx::Object o;
@@ -1748,6 +2142,7 @@ std::string Toolkit::GetElementsAtTime(int millisec)
 
 bool Toolkit::RenderToMIDIFile(const std::string &filename)
 {
+    MethodScope methodScope(this, __func__);
     this->ResetLogBuffer();
 
     smf::MidiFile outputfile;
@@ -1761,6 +2156,7 @@ bool Toolkit::RenderToMIDIFile(const std::string &filename)
 
 bool Toolkit::RenderToTimemapFile(const std::string &filename, const std::string &jsonOptions)
 {
+    MethodScope methodScope(this, __func__);
     std::string outputString = this->RenderToTimemap(jsonOptions);
 
     std::ofstream output(filename.c_str());
@@ -1774,6 +2170,7 @@ bool Toolkit::RenderToTimemapFile(const std::string &filename, const std::string
 
 bool Toolkit::RenderToExpansionMapFile(const std::string &filename)
 {
+    MethodScope methodScope(this, __func__);
     std::string outputString = this->RenderToExpansionMap();
 
     std::ofstream output(filename.c_str());
@@ -1792,14 +2189,125 @@ int Toolkit::GetPageCount()
 
 std::string Toolkit::GetDescriptiveFeatures(const std::string &options)
 {
+    MethodScope methodScope(this, __func__);
     // For now do not handle any option
     std::string output;
     m_doc.ExportFeatures(output, options);
     return output;
 }
 
+bool Toolkit::BuildFeatureIndex(const std::string &jsonOptions)
+{
+    MethodScope methodScope(this, __func__);
+
+    jsonxx::Object json;
+    if (!json.parse(jsonOptions)) {
+        LogError("Cannot parse JSON std::string.");
+        return false;
+    }
+    if (!json.has<jsonxx::Array>("files")) {
+        LogError("No files to index");
+        return false;
+    }
+    std::vector<std::string> files;
+    const jsonxx::Array &filesArray = json.get<jsonxx::Array>("files");
+    for (size_t i = 0; i < filesArray.size(); ++i) {
+        if (filesArray.has<jsonxx::String>((unsigned int)i)) files.push_back(filesArray.get<jsonxx::String>(i));
+    }
+    const int ngramLength = json.has<jsonxx::Number>("ngramLength") ? json.get<jsonxx::Number>("ngramLength") : 4;
+    const int threads = json.has<jsonxx::Number>("threads") ? json.get<jsonxx::Number>("threads") : 0;
+    const std::string output = json.has<jsonxx::String>("output") ? json.get<jsonxx::String>("output") : "";
+
+    std::vector<FeatureIndex::Document> documents(files.size());
+    std::vector<char> indexed(files.size(), false);
+
+    // Each thread loads the files with its own toolkit
+    std::mutex toolkitMutex;
+    std::map<std::thread::id, std::unique_ptr<Toolkit>> toolkits;
+    const std::string resourcePath = m_doc.GetResources().GetPath();
+    auto indexFile = [&](int i) {
+        Toolkit *toolkit = NULL;
+        {
+            const std::lock_guard<std::mutex> lock(toolkitMutex);
+            auto iter = toolkits.find(std::this_thread::get_id());
+            if (iter != toolkits.end()) toolkit = iter->second.get();
+        }
+        if (!toolkit) {
+            std::unique_ptr<Toolkit> threadToolkit = std::make_unique<Toolkit>(false);
+            *threadToolkit->GetOptionsObj() = *m_options;
+            threadToolkit->GetOptionsObj()->m_dataOnly.SetValue(true);
+            threadToolkit->SetResourcePath(resourcePath);
+            toolkit = threadToolkit.get();
+            const std::lock_guard<std::mutex> lock(toolkitMutex);
+            toolkits[std::this_thread::get_id()] = std::move(threadToolkit);
+        }
+
+        // Seed the ids for each file for the index not to depend on the thread scheduling
+        if (m_options->m_xmlIdSeed.GetValue()) Object::SeedID(m_options->m_xmlIdSeed.GetValue());
+        if (!toolkit->LoadFile(files.at(i))) return;
+        FeatureExtractor extractor("");
+        if (!toolkit->m_doc.ExtractFeatures(extractor)) return;
+        documents.at(i).m_id = files.at(i);
+        FeatureIndex::FillDocument(documents.at(i), extractor);
+        indexed.at(i) = true;
+    };
+
+    const int threadCount = std::min(ThreadPool::GetThreadCount(threads), std::max(1, (int)files.size()));
+    if (threadCount <= 1) {
+        for (int i = 0; i < (int)files.size(); ++i) indexFile(i);
+    }
+    else {
+        ThreadPool threadPool(threadCount);
+        threadPool.Run((int)files.size(), indexFile);
+    }
+    toolkits.clear();
+
+    // Keep the documents in the order of the files
+    std::vector<FeatureIndex::Document> indexedDocuments;
+    for (int i = 0; i < (int)files.size(); ++i) {
+        if (indexed.at(i)) {
+            indexedDocuments.push_back(std::move(documents.at(i)));
+        }
+        else {
+            LogWarning("File '%s' could not be indexed", files.at(i).c_str());
+        }
+    }
+    documents.clear();
+
+    if (!m_featureIndex) m_featureIndex = new FeatureIndex();
+    m_featureIndex->SetNgramLength(ngramLength);
+    m_featureIndex->AddDocuments(indexedDocuments);
+    if (m_featureIndex->GetDocumentCount() == 0) {
+        LogError("No file could be indexed");
+        return false;
+    }
+
+    if (!output.empty()) return m_featureIndex->Write(output);
+    return true;
+}
+
+bool Toolkit::LoadFeatureIndex(const std::string &filename)
+{
+    MethodScope methodScope(this, __func__);
+
+    if (!m_featureIndex) m_featureIndex = new FeatureIndex();
+    return m_featureIndex->Read(filename);
+}
+
+std::string Toolkit::QueryFeatureIndex(const std::string &jsonQuery)
+{
+    MethodScope methodScope(this, __func__);
+
+    if (!m_featureIndex || (m_featureIndex->GetDocumentCount() == 0)) {
+        LogWarning("No feature index was built or loaded");
+        return "{}";
+    }
+    return m_featureIndex->Query(jsonQuery);
+}
+
 int Toolkit::GetPageWithElement(const std::string &xmlId)
 {
+    MethodScope methodScope(this, __func__);
     Object *element = m_doc.FindDescendantByID(xmlId);
     if (!element) {
         LogWarning("Element '%s' not found", xmlId.c_str());
@@ -1814,6 +2322,7 @@ int Toolkit::GetPageWithElement(const std::string &xmlId)
 
 int Toolkit::GetTimeForElement(const std::string &xmlId)
 {
+    MethodScope methodScope(this, __func__);
     this->ResetLogBuffer();
 
     Object *element = m_doc.FindDescendantByID(xmlId);
@@ -1862,6 +2371,7 @@ int Toolkit::GetTimeForElement(const std::string &xmlId)
 
 std::string Toolkit::GetTimesForElement(const std::string &xmlId)
 {
+    MethodScope methodScope(this, __func__);
     this->ResetLogBuffer();
 
     Object *element = m_doc.FindDescendantByID(xmlId);
@@ -1916,6 +2426,7 @@ std::string Toolkit::GetTimesForElement(const std::string &xmlId)
 
 std::string Toolkit::GetMIDIValuesForElement(const std::string &xmlId)
 {
+    MethodScope methodScope(this, __func__);
     this->ResetLogBuffer();
 
     Object *element = m_doc.FindDescendantByID(xmlId);
@@ -2030,6 +2541,7 @@ void Toolkit::SetInputFrom(FileFormat format)
 
 std::string Toolkit::ConvertMEIToHumdrum(const std::string &meiData)
 {
+    MethodScope methodScope(this, __func__);
 #ifndef NO_HUMDRUM_SUPPORT
     hum::Tool_mei2hum converter;
     pugi::xml_document xmlfile;
@@ -2048,6 +2560,7 @@ std::string Toolkit::ConvertMEIToHumdrum(const std::string &meiData)
 
 std::string Toolkit::ConvertHumdrumToHumdrum(const std::string &humdrumData)
 {
+    MethodScope methodScope(this, __func__);
 #ifndef NO_HUMDRUM_SUPPORT
 
     hum::HumdrumFileSet infiles;
@@ -2097,10 +2610,25 @@ std::string Toolkit::ConvertHumdrumToHumdrum(const std::string &humdrumData)
 
 std::string Toolkit::ConvertHumdrumToMIDI(const std::string &humdrumData)
 {
+    MethodScope methodScope(this, __func__);
 #ifndef NO_HUMDRUM_SUPPORT
-    return "TVRoZAAAAAYAAQAAAGRNVHJrAAAADQCQPHCBSJA8AAD/LwA=";
+    this->ResetLogBuffer();
+
+    smf::MidiFile outputfile;
+    outputfile.absoluteTicks();
+    HumdrumMIDIConverter converter;
+    if (!converter.Convert(humdrumData, &outputfile)) {
+        return "";
+    }
+    outputfile.sortTracks();
+
+    std::stringstream stream;
+    outputfile.write(stream);
+    return Base64Encode(
+        reinterpret_cast<const unsigned char *>(stream.str().c_str()), (unsigned int)stream.str().length());
 #else
-    return "TVRoZAAAAAYAAQAAAGRNVHJrAAAADQCQPHCBSJA8AAD/LwA=";
+    LogError("Humdrum is not supported in this build.");
+    return "";
 #endif
 }
 
@@ -37,14 +37,14 @@ Trill::Trill()
     , AttOrnamentAccid()
     , AttPlacementRelStaff()
 {
-    this->RegisterInterface(TimeSpanningInterface::GetAttClasses(), TimeSpanningInterface::IsInterface());
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_EXTENDER);
-    this->RegisterAttClass(ATT_EXTSYM);
-    this->RegisterAttClass(ATT_LINEREND);
-    this->RegisterAttClass(ATT_NNUMBERLIKE);
-    this->RegisterAttClass(ATT_ORNAMENTACCID);
-    this->RegisterAttClass(ATT_PLACEMENTRELSTAFF);
+    this->RegisterInterface<TimeSpanningInterface>(this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttExtender>(ATT_EXTENDER, this);
+    this->RegisterAttClass<AttExtSym>(ATT_EXTSYM, this);
+    this->RegisterAttClass<AttLineRend>(ATT_LINEREND, this);
+    this->RegisterAttClass<AttNNumberLike>(ATT_NNUMBERLIKE, this);
+    this->RegisterAttClass<AttOrnamentAccid>(ATT_ORNAMENTACCID, this);
+    this->RegisterAttClass<AttPlacementRelStaff>(ATT_PLACEMENTRELSTAFF, this);
 
     this->Reset();
 }
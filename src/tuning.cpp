@@ -29,7 +29,7 @@ static const ClassRegistrar<Tuning> s_factory("tuning", TUNING);
 
 Tuning::Tuning() : Object(TUNING, "tuning-"), AttCourseLog()
 {
-    this->RegisterAttClass(ATT_COURSELOG);
+    this->RegisterAttClass<AttCourseLog>(ATT_COURSELOG, this);
 
     this->Reset();
 }
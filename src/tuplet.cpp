@@ -45,10 +45,10 @@ Tuplet::Tuplet()
     , AttNumberPlacement()
     , AttTupletVis()
 {
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_DURATIONRATIO);
-    this->RegisterAttClass(ATT_NUMBERPLACEMENT);
-    this->RegisterAttClass(ATT_TUPLETVIS);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttDurationRatio>(ATT_DURATIONRATIO, this);
+    this->RegisterAttClass<AttNumberPlacement>(ATT_NUMBERPLACEMENT, this);
+    this->RegisterAttClass<AttTupletVis>(ATT_TUPLETVIS, this);
 
     this->Reset();
 }
@@ -37,12 +37,12 @@ Turn::Turn()
     , AttPlacementRelStaff()
     , AttTurnLog()
 {
-    this->RegisterInterface(TimePointInterface::GetAttClasses(), TimePointInterface::IsInterface());
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_EXTSYM);
-    this->RegisterAttClass(ATT_ORNAMENTACCID);
-    this->RegisterAttClass(ATT_PLACEMENTRELSTAFF);
-    this->RegisterAttClass(ATT_TURNLOG);
+    this->RegisterInterface<TimePointInterface>(this);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttExtSym>(ATT_EXTSYM, this);
+    this->RegisterAttClass<AttOrnamentAccid>(ATT_ORNAMENTACCID, this);
+    this->RegisterAttClass<AttPlacementRelStaff>(ATT_PLACEMENTRELSTAFF, this);
+    this->RegisterAttClass<AttTurnLog>(ATT_TURNLOG, this);
 
     this->Reset();
 }
@@ -25,7 +25,7 @@ static const ClassRegistrar<Unclear> s_factory("unclear", UNCLEAR);
 
 Unclear::Unclear() : EditorialElement(UNCLEAR, "unclear-"), AttSource()
 {
-    this->RegisterAttClass(ATT_SOURCE);
+    this->RegisterAttClass<AttSource>(ATT_SOURCE, this);
 
     this->Reset();
 }
@@ -35,10 +35,10 @@ static const ClassRegistrar<Verse> s_factory("verse", VERSE);
 
 Verse::Verse() : LayerElement(VERSE, "verse-"), AttColor(), AttLang(), AttNInteger(), AttTypography()
 {
-    this->RegisterAttClass(ATT_COLOR);
-    this->RegisterAttClass(ATT_LANG);
-    this->RegisterAttClass(ATT_NINTEGER);
-    this->RegisterAttClass(ATT_TYPOGRAPHY);
+    this->RegisterAttClass<AttColor>(ATT_COLOR, this);
+    this->RegisterAttClass<AttLang>(ATT_LANG, this);
+    this->RegisterAttClass<AttNInteger>(ATT_NINTEGER, this);
+    this->RegisterAttClass<AttTypography>(ATT_TYPOGRAPHY, this);
 
     this->Reset();
 }
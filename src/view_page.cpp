@@ -44,6 +44,7 @@
 #include "page.h"
 #include "pageelement.h"
 #include "pagemilestone.h"
+#include "profiler.h"
 #include "reh.h"
 #include "smufl.h"
 #include "staff.h"
@@ -63,6 +64,9 @@ void View::DrawCurrentPage(DeviceContext *dc, bool background)
     assert(dc);
     assert(m_doc);
 
+    // Profile the drawing by type of device context
+    ProfilerEvent event(PROFILER_DRAWING, typeid(*dc));
+
     // Ensure that resources are set
     const bool dcHasResources = dc->HasResources();
     if (!dcHasResources) dc->SetResources(&m_doc->GetResources());
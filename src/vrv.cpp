@@ -39,6 +39,7 @@
 #define GIT_COMMIT "[undefined]"
 #endif
 
+#include "logsink.h"
 #include "vrvdef.h"
 
 //----------------------------------------------------------------------------
@@ -63,13 +64,12 @@ namespace vrv {
 /** Global for LogElapsedTimeXXX functions (debugging purposes) */
 struct timeval start;
 
-/** For controlling the log level - warning level enabled by default */
-LogLevel logLevel = LOG_WARNING;
-
-/** By default log to stderr or JS console */
-bool loggingToBuffer = false;
-
-std::vector<std::string> logBuffer;
+/** Return the log level of the current sink or the default one outside a toolkit */
+static LogLevel GetCurrentLogLevel()
+{
+    const LogSink *logSink = LogSink::GetCurrent();
+    return (logSink) ? logSink->GetLogLevel() : LogSink::GetDefaultLogLevel();
+}
 
 void LogElapsedTimeStart()
 {
@@ -88,7 +88,7 @@ void LogElapsedTimeEnd(const char *msg)
 
 void LogDebug(const char *fmt, ...)
 {
-    if (logLevel < LOG_DEBUG) return;
+    if (GetCurrentLogLevel() < LOG_DEBUG) return;
 
 #if defined(DEBUG)
     std::string s;
@@ -102,7 +102,7 @@ void LogDebug(const char *fmt, ...)
 
 void LogError(const char *fmt, ...)
 {
-    if (logLevel < LOG_ERROR) return;
+    if (GetCurrentLogLevel() < LOG_ERROR) return;
 
     std::string s;
     va_list args;
@@ -114,7 +114,7 @@ void LogError(const char *fmt, ...)
 
 void LogInfo(const char *fmt, ...)
 {
-    if (logLevel < LOG_INFO) return;
+    if (GetCurrentLogLevel() < LOG_INFO) return;
 
     std::string s;
     va_list args;
@@ -126,7 +126,7 @@ void LogInfo(const char *fmt, ...)
 
 void LogWarning(const char *fmt, ...)
 {
-    if (logLevel < LOG_WARNING) return;
+    if (GetCurrentLogLevel() < LOG_WARNING) return;
 
     std::string s;
     va_list args;
@@ -136,11 +136,12 @@ void LogWarning(const char *fmt, ...)
     va_end(args);
 }
 
-void LogString(std::string message, LogLevel level)
+void LogString(const std::string &message, LogLevel level)
 {
-    if (loggingToBuffer) {
-        if (LogBufferContains(message)) return;
-        logBuffer.push_back(message);
+    // Messages logged outside a toolkit are output directly
+    LogSink *logSink = LogSink::GetCurrent();
+    if (logSink && logSink->IsLoggingToBuffer()) {
+        logSink->Add(message);
     }
     else {
 #ifdef __EMSCRIPTEN__
@@ -177,14 +178,6 @@ LogLevel StrToLogLevel(const std::string &level)
     return LOG_WARNING;
 }
 
-bool LogBufferContains(const std::string &s)
-{
-    for (const std::string &logStr : logBuffer) {
-        if (logStr == s) return true;
-    }
-    return false;
-}
-
 bool Check(Object *object)
 {
     assert(object);
@@ -197,12 +190,12 @@ bool Check(Object *object)
 
 void EnableLog(LogLevel level)
 {
-    logLevel = level;
+    LogSink::SetDefaultLogLevel(level);
 }
 
 void EnableLogToBuffer(bool value)
 {
-    loggingToBuffer = value;
+    LogSink::SetDefaultLoggingToBuffer(value);
 }
 
 //----------------------------------------------------------------------------
@@ -15,6 +15,7 @@
 
 #include "comparison.h"
 #include "vrv.h"
+#include "zoneindex.h"
 
 namespace vrv {
 
@@ -26,12 +27,23 @@ static const ClassRegistrar<Zone> s_factory("zone", ZONE);
 
 Zone::Zone() : Object(ZONE, "zone-"), AttTyped(), AttCoordinated()
 {
-    this->RegisterAttClass(ATT_TYPED);
-    this->RegisterAttClass(ATT_COORDINATED);
+    this->RegisterAttClass<AttTyped>(ATT_TYPED, this);
+    this->RegisterAttClass<AttCoordinated>(ATT_COORDINATED, this);
+    m_zoneIndex = NULL;
+
     this->Reset();
 }
 
-Zone::~Zone() {}
+Zone::Zone(const Zone &zone) : Object(zone), AttTyped(zone), AttCoordinated(zone)
+{
+    // A copy is not registered in the index of the original
+    m_zoneIndex = NULL;
+}
+
+Zone::~Zone()
+{
+    if (m_zoneIndex) m_zoneIndex->Remove(this);
+}
 
 void Zone::Reset()
 {
@@ -45,6 +57,8 @@ void Zone::ShiftByXY(int xDiff, int yDiff)
     this->SetLrx(this->GetLrx() + xDiff);
     this->SetUly(this->GetUly() + yDiff);
     this->SetLry(this->GetLry() + yDiff);
+
+    if (m_zoneIndex) m_zoneIndex->Update(this, NULL);
 }
 
 int Zone::GetLogicalUly() const
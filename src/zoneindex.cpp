@@ -0,0 +1,401 @@
+/////////////////////////////////////////////////////////////////////////////
+// Name:        zoneindex.cpp
+// Author:      Laurent Pugin
+// Created:     2023
+// Copyright (c) Authors and others. All rights reserved.
+/////////////////////////////////////////////////////////////////////////////
+
+#include "zoneindex.h"
+
+//----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cassert>
+#include <climits>
+#include <cmath>
+#include <queue>
+#include <tuple>
+
+//----------------------------------------------------------------------------
+
+#include "comparison.h"
+#include "facsimileinterface.h"
+#include "object.h"
+#include "vrv.h"
+#include "zone.h"
+
+namespace vrv {
+
+/** The maximum number of children or entries in a node */
+#define ZONE_INDEX_MAX_NODE_SIZE 8
+
+//----------------------------------------------------------------------------
+// ZoneIndexNode
+//----------------------------------------------------------------------------
+
+/**
+ * A node in the R-tree. Leaf nodes hold entries, inner nodes hold child nodes.
+ * Child nodes are owned by their parent.
+ */
+class ZoneIndexNode {
+public:
+    ZoneIndexNode(bool isLeaf) : m_isLeaf(isLeaf) {}
+    ~ZoneIndexNode()
+    {
+        for (ZoneIndexNode *child : m_children) delete child;
+    }
+
+    int GetSize() const { return (m_isLeaf) ? (int)m_entries.size() : (int)m_children.size(); }
+
+    /** Recalculate the bounding rectangle and the rotation flag from the content */
+    void UpdateRect();
+
+public:
+    ZoneRect m_rect;
+    bool m_isLeaf;
+    bool m_hasRotated = false;
+    ZoneIndexNode *m_parent = NULL;
+    std::vector<ZoneIndexNode *> m_children;
+    std::vector<ZoneIndexEntry *> m_entries;
+};
+
+//----------------------------------------------------------------------------
+// Static helpers
+//----------------------------------------------------------------------------
+
+static void ExtendRect(ZoneRect &rect, const ZoneRect &other, bool isFirst)
+{
+    if (isFirst) {
+        rect = other;
+        return;
+    }
+    rect.m_ulx = std::min(rect.m_ulx, other.m_ulx);
+    rect.m_uly = std::min(rect.m_uly, other.m_uly);
+    rect.m_lrx = std::max(rect.m_lrx, other.m_lrx);
+    rect.m_lry = std::max(rect.m_lry, other.m_lry);
+}
+
+static double GetRectArea(const ZoneRect &rect)
+{
+    return (double)(rect.m_lrx - rect.m_ulx) * (double)(rect.m_lry - rect.m_uly);
+}
+
+static double GetRectEnlargement(const ZoneRect &rect, const ZoneRect &other)
+{
+    ZoneRect extended = rect;
+    ExtendRect(extended, other, false);
+    return GetRectArea(extended) - GetRectArea(rect);
+}
+
+static int GetXDistance(const ZoneRect &rect, int x)
+{
+    return std::max((rect.m_ulx > x ? rect.m_ulx - x : 0), (x > rect.m_lrx ? x - rect.m_lrx : 0));
+}
+
+/**
+ * The lower bound of the distance between the point and any zone in the rect.
+ * When rotated zones are included, only the horizontal distance is a safe bound.
+ */
+static int GetLowerBound(const ZoneRect &rect, bool hasRotated, int x, int y)
+{
+    const int xDiff = GetXDistance(rect, x);
+    if (hasRotated) return xDiff;
+    const int yDiff = std::max((rect.m_uly > y ? rect.m_uly - y : 0), (y > rect.m_lry ? y - rect.m_lry : 0));
+    return sqrt(xDiff * xDiff + yDiff * yDiff);
+}
+
+static ZoneRect GetZoneRect(const Zone *zone)
+{
+    ZoneRect rect;
+    rect.m_ulx = std::min(zone->GetUlx(), zone->GetLrx());
+    rect.m_uly = std::min(zone->GetUly(), zone->GetLry());
+    rect.m_lrx = std::max(zone->GetUlx(), zone->GetLrx());
+    rect.m_lry = std::max(zone->GetUly(), zone->GetLry());
+    return rect;
+}
+
+void ZoneIndexNode::UpdateRect()
+{
+    m_hasRotated = false;
+    if (m_isLeaf) {
+        for (int i = 0; i < (int)m_entries.size(); ++i) {
+            ExtendRect(m_rect, m_entries.at(i)->m_rect, (i == 0));
+            m_hasRotated = m_hasRotated || m_entries.at(i)->m_isRotated;
+        }
+    }
+    else {
+        for (int i = 0; i < (int)m_children.size(); ++i) {
+            ExtendRect(m_rect, m_children.at(i)->m_rect, (i == 0));
+            m_hasRotated = m_hasRotated || m_children.at(i)->m_hasRotated;
+        }
+    }
+}
+
+//----------------------------------------------------------------------------
+// ZoneIndex
+//----------------------------------------------------------------------------
+
+ZoneIndex::ZoneIndex()
+{
+    m_root = NULL;
+    this->Reset();
+}
+
+ZoneIndex::~ZoneIndex()
+{
+    this->Reset();
+    delete m_root;
+}
+
+void ZoneIndex::Reset()
+{
+    for (auto &pair : m_entries) {
+        pair.second->m_zone->SetZoneIndex(NULL);
+        delete pair.second;
+    }
+    m_entries.clear();
+
+    if (m_root) delete m_root;
+    m_root = new ZoneIndexNode(true);
+    m_order = 0;
+    m_isBuilt = false;
+}
+
+void ZoneIndex::Build(Object *root)
+{
+    assert(root);
+
+    this->Reset();
+    this->UpdateSubtree(root);
+    m_isBuilt = true;
+}
+
+void ZoneIndex::UpdateSubtree(Object *root)
+{
+    assert(root);
+
+    ListOfObjects objects;
+    InterfaceComparison comparison(INTERFACE_FACSIMILE);
+    root->FindAllDescendantsByComparison(&objects, &comparison);
+    if (root->HasInterface(INTERFACE_FACSIMILE)) objects.push_front(root);
+
+    for (Object *object : objects) {
+        Zone *zone = object->GetFacsimileInterface()->GetZone();
+        if (zone) this->Update(zone, object);
+    }
+}
+
+void ZoneIndex::Insert(Zone *zone, Object *owner)
+{
+    assert(zone);
+    assert(owner);
+    assert(m_entries.count(zone) == 0);
+
+    ZoneIndexEntry *entry = new ZoneIndexEntry();
+    entry->m_zone = zone;
+    entry->m_owner = owner;
+    entry->m_rect = GetZoneRect(zone);
+    entry->m_isRotated = (zone->GetRotate() != 0.0);
+    entry->m_order = m_order++;
+    m_entries[zone] = entry;
+    zone->SetZoneIndex(this);
+
+    this->InsertEntry(entry);
+}
+
+void ZoneIndex::Remove(Zone *zone)
+{
+    auto it = m_entries.find(zone);
+    if (it == m_entries.end()) return;
+
+    ZoneIndexEntry *entry = it->second;
+    ZoneIndexNode *node = entry->m_leaf;
+    assert(node);
+    node->m_entries.erase(std::find(node->m_entries.begin(), node->m_entries.end(), entry));
+    m_entries.erase(it);
+    zone->SetZoneIndex(NULL);
+    delete entry;
+
+    // Remove the empty nodes and update the bounding rectangles upwards
+    while (node->m_parent) {
+        ZoneIndexNode *parent = node->m_parent;
+        if (node->GetSize() == 0) {
+            parent->m_children.erase(std::find(parent->m_children.begin(), parent->m_children.end(), node));
+            delete node;
+        }
+        else {
+            node->UpdateRect();
+        }
+        node = parent;
+    }
+    node->UpdateRect();
+
+    // Shorten the tree when the root has a single child
+    while (!m_root->m_isLeaf && (m_root->m_children.size() == 1)) {
+        ZoneIndexNode *root = m_root->m_children.front();
+        m_root->m_children.clear();
+        delete m_root;
+        m_root = root;
+        m_root->m_parent = NULL;
+    }
+    if (!m_root->m_isLeaf && m_root->m_children.empty()) {
+        delete m_root;
+        m_root = new ZoneIndexNode(true);
+    }
+}
+
+void ZoneIndex::Update(Zone *zone, Object *owner)
+{
+    assert(zone);
+
+    auto it = m_entries.find(zone);
+    if (it != m_entries.end()) {
+        // The owner is kept when not given
+        if (!owner) owner = it->second->m_owner;
+        // Nothing to do if the zone has not changed
+        const ZoneRect rect = GetZoneRect(zone);
+        const ZoneRect &current = it->second->m_rect;
+        if ((owner == it->second->m_owner) && (rect.m_ulx == current.m_ulx) && (rect.m_uly == current.m_uly)
+            && (rect.m_lrx == current.m_lrx) && (rect.m_lry == current.m_lry)
+            && ((zone->GetRotate() != 0.0) == it->second->m_isRotated)) {
+            return;
+        }
+        this->Remove(zone);
+    }
+    if (!owner) return;
+    this->Insert(zone, owner);
+}
+
+void ZoneIndex::InsertEntry(ZoneIndexEntry *entry)
+{
+    assert(entry);
+
+    // Choose the leaf needing the smallest enlargement
+    ZoneIndexNode *node = m_root;
+    while (!node->m_isLeaf) {
+        ZoneIndexNode *best = NULL;
+        double bestEnlargement = 0.0;
+        for (ZoneIndexNode *child : node->m_children) {
+            const double enlargement = GetRectEnlargement(child->m_rect, entry->m_rect);
+            if (!best || (enlargement < bestEnlargement)
+                || ((enlargement == bestEnlargement) && (GetRectArea(child->m_rect) < GetRectArea(best->m_rect)))) {
+                best = child;
+                bestEnlargement = enlargement;
+            }
+        }
+        assert(best);
+        node = best;
+    }
+
+    node->m_entries.push_back(entry);
+    entry->m_leaf = node;
+
+    if (node->GetSize() > ZONE_INDEX_MAX_NODE_SIZE) {
+        this->SplitNode(node);
+    }
+    else {
+        for (; node; node = node->m_parent) node->UpdateRect();
+    }
+}
+
+void ZoneIndex::SplitNode(ZoneIndexNode *node)
+{
+    assert(node);
+
+    node->UpdateRect();
+    // Split along the axis with the largest extent
+    const bool byX = ((node->m_rect.m_lrx - node->m_rect.m_ulx) >= (node->m_rect.m_lry - node->m_rect.m_uly));
+    auto getCenter = [byX](const ZoneRect &rect) {
+        return (byX) ? (rect.m_ulx + rect.m_lrx) : (rect.m_uly + rect.m_lry);
+    };
+
+    ZoneIndexNode *sibling = new ZoneIndexNode(node->m_isLeaf);
+    if (node->m_isLeaf) {
+        std::stable_sort(node->m_entries.begin(), node->m_entries.end(),
+            [&getCenter](ZoneIndexEntry *a, ZoneIndexEntry *b) { return getCenter(a->m_rect) < getCenter(b->m_rect); });
+        const int half = (int)node->m_entries.size() / 2;
+        sibling->m_entries.assign(node->m_entries.begin() + half, node->m_entries.end());
+        node->m_entries.resize(half);
+        for (ZoneIndexEntry *entry : sibling->m_entries) entry->m_leaf = sibling;
+    }
+    else {
+        std::stable_sort(node->m_children.begin(), node->m_children.end(),
+            [&getCenter](ZoneIndexNode *a, ZoneIndexNode *b) { return getCenter(a->m_rect) < getCenter(b->m_rect); });
+        const int half = (int)node->m_children.size() / 2;
+        sibling->m_children.assign(node->m_children.begin() + half, node->m_children.end());
+        node->m_children.resize(half);
+        for (ZoneIndexNode *child : sibling->m_children) child->m_parent = sibling;
+    }
+    node->UpdateRect();
+    sibling->UpdateRect();
+
+    // Grow the tree when splitting the root
+    if (!node->m_parent) {
+        assert(node == m_root);
+        m_root = new ZoneIndexNode(false);
+        m_root->m_children.push_back(node);
+        node->m_parent = m_root;
+    }
+
+    ZoneIndexNode *parent = node->m_parent;
+    parent->m_children.push_back(sibling);
+    sibling->m_parent = parent;
+
+    if (parent->GetSize() > ZONE_INDEX_MAX_NODE_SIZE) {
+        this->SplitNode(parent);
+    }
+    else {
+        for (; parent; parent = parent->m_parent) parent->UpdateRect();
+    }
+}
+
+Object *ZoneIndex::FindClosest(ClassId classId, int x, int y) const
+{
+    // Best-first search ordered by distance, then with nodes before entries, then by insertion order
+    using Candidate = std::tuple<int, int, int, const ZoneIndexNode *, const ZoneIndexEntry *>;
+    std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> queue;
+
+    if (m_root->GetSize() == 0) return NULL;
+    queue.push({ GetLowerBound(m_root->m_rect, m_root->m_hasRotated, x, y), 0, 0, m_root, NULL });
+
+    while (!queue.empty()) {
+        const Candidate candidate = queue.top();
+        queue.pop();
+        const ZoneIndexEntry *entry = std::get<4>(candidate);
+        if (entry) return entry->m_owner;
+
+        const ZoneIndexNode *node = std::get<3>(candidate);
+        if (node->m_isLeaf) {
+            for (const ZoneIndexEntry *child : node->m_entries) {
+                if (!child->m_owner->Is(classId)) continue;
+                queue.push({ GetDistance(child->m_zone, x, y), 1, child->m_order, NULL, child });
+            }
+        }
+        else {
+            for (const ZoneIndexNode *child : node->m_children) {
+                queue.push({ GetLowerBound(child->m_rect, child->m_hasRotated, x, y), 0, 0, child, NULL });
+            }
+        }
+    }
+
+    return NULL;
+}
+
+int ZoneIndex::GetDistance(const Zone *zone, int x, int y)
+{
+    assert(zone);
+
+    int ulx = zone->GetUlx();
+    int uly = zone->GetUly();
+    int lrx = zone->GetLrx();
+    int lry = zone->GetLry();
+    int offset = (x - ulx) * tan(zone->GetRotate() * M_PI / 180.0);
+    uly = uly - offset;
+    lry = lry - offset;
+    int xDiff = std::max((ulx > x ? ulx - x : 0), (x > lrx ? x - lrx : 0));
+    int yDiff = std::max((uly > y ? uly - y : 0), (y > lry ? y - lry : 0));
+
+    return sqrt(xDiff * xDiff + yDiff * yDiff);
+}
+
+} // namespace vrv
@@ -6,6 +6,14 @@
 /////////////////////////////////////////////////////////////////////////////
 
 #include "c_wrapper.h"
+
+//----------------------------------------------------------------------------
+
+#include <algorithm>
+#include <cstring>
+
+//----------------------------------------------------------------------------
+
 #include "toolkit.h"
 #include "vrv.h"
 
@@ -66,6 +74,25 @@ const char *vrvToolkit_editInfo(void *tkPtr)
     return tk->GetCString();
 }
 
+void vrvToolkit_enableLog(void *tkPtr, int level)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->EnableLog(level);
+}
+
+void vrvToolkit_enableLogToBuffer(void *tkPtr, bool value)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->EnableLogToBuffer(value);
+}
+
+const char *vrvToolkit_getABCCollectionIndex(void *tkPtr)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->GetABCCollectionIndex());
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_getAvailableOptions(void *tkPtr)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -152,6 +179,12 @@ const char *vrvToolkit_getMEI(void *tkPtr, const char *options)
     return tk->GetCString();
 }
 
+void *vrvToolkit_getMEIBuffer(void *tkPtr, const char *options)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    return new std::string(tk->GetMEI(options));
+}
+
 const char *vrvToolkit_getMIDIValuesForElement(void *tkPtr, const char *xmlId)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -192,6 +225,20 @@ int vrvToolkit_getPageWithElement(void *tkPtr, const char *xmlId)
     return tk->GetPageWithElement(xmlId);
 }
 
+const char *vrvToolkit_getProfilingReport(void *tkPtr)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->GetProfilingReport());
+    return tk->GetCString();
+}
+
+const char *vrvToolkit_getProfilingTrace(void *tkPtr)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->GetProfilingTrace());
+    return tk->GetCString();
+}
+
 double vrvToolkit_getTimeForElement(void *tkPtr, const char *xmlId)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -212,12 +259,30 @@ const char *vrvToolkit_getVersion(void *tkPtr)
     return tk->GetCString();
 }
 
+bool vrvToolkit_loadABCCollection(void *tkPtr, const char *data, const char *jsonIndex)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    return tk->LoadABCCollection(data, jsonIndex);
+}
+
+bool vrvToolkit_loadABCTune(void *tkPtr, int tune, bool byReferenceNumber)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    return tk->LoadABCTune(tune, byReferenceNumber);
+}
+
 bool vrvToolkit_loadData(void *tkPtr, const char *data)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
     return tk->LoadData(data);
 }
 
+bool vrvToolkit_loadDataBuffer(void *tkPtr, const char *data, int length)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    return tk->LoadDataBuffer(data, length);
+}
+
 bool vrvToolkit_loadZipDataBase64(void *tkPtr, const char *data)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -236,6 +301,13 @@ void vrvToolkit_redoLayout(void *tkPtr, const char *c_options)
     tk->RedoLayout(c_options);
 }
 
+const char *vrvToolkit_redoLayoutForWidths(void *tkPtr, const char *jsonWidths)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->RedoLayoutForWidths(jsonWidths));
+    return tk->GetCString();
+}
+
 void vrvToolkit_redoPagePitchPosLayout(void *tkPtr)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -256,6 +328,13 @@ const char *vrvToolkit_renderToExpansionMap(void *tkPtr)
     return tk->GetCString();
 }
 
+const char *vrvToolkit_renderToGlyphSprite(void *tkPtr)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->RenderToGlyphSprite());
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_renderToMIDI(void *tkPtr, const char *c_options)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -277,6 +356,19 @@ const char *vrvToolkit_renderToSVG(void *tkPtr, int page_no, bool xmlDeclaration
     return tk->GetCString();
 }
 
+void *vrvToolkit_renderToSVGBuffer(void *tkPtr, int page_no, bool xmlDeclaration)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    return new std::string(tk->RenderToSVG(page_no, xmlDeclaration));
+}
+
+const char *vrvToolkit_renderToSVGPatch(void *tkPtr, int page_no)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->SetCString(tk->RenderToSVGPatch(page_no));
+    return tk->GetCString();
+}
+
 const char *vrvToolkit_renderToTimemap(void *tkPtr, const char *c_options)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -290,6 +382,12 @@ void vrvToolkit_resetOptions(void *tkPtr)
     tk->ResetOptions();
 }
 
+void vrvToolkit_resetProfiling(void *tkPtr)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    tk->ResetProfiling();
+}
+
 void vrvToolkit_resetXmlIdSeed(void *tkPtr, int seed)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -308,6 +406,12 @@ bool vrvToolkit_setOptions(void *tkPtr, const char *options)
     return tk->SetOptions(options);
 }
 
+bool vrvToolkit_switchLayoutWidth(void *tkPtr, int pageWidth)
+{
+    Toolkit *tk = static_cast<Toolkit *>(tkPtr);
+    return tk->SwitchLayoutWidth(pageWidth);
+}
+
 const char *vrvToolkit_validatePAE(void *tkPtr, const char *data)
 {
     Toolkit *tk = static_cast<Toolkit *>(tkPtr);
@@ -315,4 +419,36 @@ const char *vrvToolkit_validatePAE(void *tkPtr, const char *data)
     return tk->GetCString();
 }
 
+/****************************************************************
+ * Methods exported to use the buffers returned by the Toolkit functions
+ * The output is moved into the buffer without being copied and the buffer
+ * remains valid until it is deleted, regardless of the subsequent calls
+ ****************************************************************/
+
+void vrvBuffer_destructor(void *bufferPtr)
+{
+    std::string *buffer = static_cast<std::string *>(bufferPtr);
+    delete buffer;
+}
+
+int vrvBuffer_copy(void *bufferPtr, char *data, int length)
+{
+    std::string *buffer = static_cast<std::string *>(bufferPtr);
+    const int size = std::min((int)buffer->size(), std::max(length, 0));
+    if (size > 0) memcpy(data, buffer->data(), size);
+    return (int)buffer->size();
+}
+
+const char *vrvBuffer_getData(void *bufferPtr)
+{
+    std::string *buffer = static_cast<std::string *>(bufferPtr);
+    return buffer->c_str();
+}
+
+int vrvBuffer_getLength(void *bufferPtr)
+{
+    std::string *buffer = static_cast<std::string *>(bufferPtr);
+    return (int)buffer->size();
+}
+
 } // extern C
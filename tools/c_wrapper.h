@@ -21,6 +21,9 @@ void *vrvToolkit_constructorResourcePath(const char *resourcePath);
 
 void vrvToolkit_destructor(void *tkPtr);
 bool vrvToolkit_edit(void *tkPtr, const char *editorAction);
+void vrvToolkit_enableLog(void *tkPtr, int level);
+void vrvToolkit_enableLogToBuffer(void *tkPtr, bool value);
+const char *vrvToolkit_getABCCollectionIndex(void *tkPtr);
 const char *vrvToolkit_getAvailableOptions(void *tkPtr);
 const char *vrvToolkit_getDefaultOptions(void *tkPtr);
 const char *vrvToolkit_getDescriptiveFeatures(void *tkPtr, const char *options);
@@ -33,31 +36,54 @@ const char *vrvToolkit_convertHumdrumToMIDI(void *tkPtr, const char *humdrumData
 const char *vrvToolkit_convertMEIToHumdrum(void *tkPtr, const char *meiData);
 const char *vrvToolkit_getLog(void *tkPtr);
 const char *vrvToolkit_getMEI(void *tkPtr, const char *options);
+void *vrvToolkit_getMEIBuffer(void *tkPtr, const char *options);
 const char *vrvToolkit_getMIDIValuesForElement(void *tkPtr, const char *xmlId);
 const char *vrvToolkit_getNotatedIdForElement(void *tkPtr, const char *xmlId);
 const char *vrvToolkit_getOptions(void *tkPtr);
 const char *vrvToolkit_getOptionUsageString(void *tkPtr);
 int vrvToolkit_getPageCount(void *tkPtr);
 int vrvToolkit_getPageWithElement(void *tkPtr, const char *xmlId);
+const char *vrvToolkit_getProfilingReport(void *tkPtr);
+const char *vrvToolkit_getProfilingTrace(void *tkPtr);
 double vrvToolkit_getTimeForElement(void *tkPtr, const char *xmlId);
 const char *vrvToolkit_getVersion(void *tkPtr);
+bool vrvToolkit_loadABCCollection(void *tkPtr, const char *data, const char *jsonIndex);
+bool vrvToolkit_loadABCTune(void *tkPtr, int tune, bool byReferenceNumber);
 bool vrvToolkit_loadData(void *tkPtr, const char *data);
+bool vrvToolkit_loadDataBuffer(void *tkPtr, const char *data, int length);
 bool vrvToolkit_loadZipDataBase64(void *tkPtr, const char *data);
 bool vrvToolkit_loadZipDataBuffer(void *tkPtr, const unsigned char *data, int length);
 void vrvToolkit_redoLayout(void *tkPtr, const char *c_options);
+const char *vrvToolkit_redoLayoutForWidths(void *tkPtr, const char *jsonWidths);
 void vrvToolkit_redoPagePitchPosLayout(void *tkPtr);
 const char *vrvToolkit_renderData(void *tkPtr, const char *data, const char *options);
 const char *vrvToolkit_renderToExpansionMap(void *tkPtr);
+const char *vrvToolkit_renderToGlyphSprite(void *tkPtr);
 const char *vrvToolkit_renderToMIDI(void *tkPtr, const char *c_options);
 const char *vrvToolkit_renderToPAE(void *tkPtr);
 const char *vrvToolkit_renderToSVG(void *tkPtr, int page_no, bool xmlDeclaration);
+void *vrvToolkit_renderToSVGBuffer(void *tkPtr, int page_no, bool xmlDeclaration);
+const char *vrvToolkit_renderToSVGPatch(void *tkPtr, int page_no);
 const char *vrvToolkit_renderToTimemap(void *tkPtr, const char *c_options);
 void vrvToolkit_resetOptions(void *tkPtr);
+void vrvToolkit_resetProfiling(void *tkPtr);
 void vrvToolkit_resetXmlIdSeed(void *tkPtr, int seed);
 bool vrvToolkit_select(void *tkPtr, const char *selection);
 bool vrvToolkit_setOptions(void *tkPtr, const char *options);
+bool vrvToolkit_switchLayoutWidth(void *tkPtr, int pageWidth);
 const char *vrvToolkit_validatePAE(void *tkPtr, const char *data);
 
+/****************************************************************
+ * Methods exported to use the buffers returned by the Toolkit functions
+ * The buffers are owned by the caller and have to be deleted with vrvBuffer_destructor
+ * vrvBuffer_copy copies at most length bytes into data and returns the length of the buffer
+ ****************************************************************/
+
+void vrvBuffer_destructor(void *bufferPtr);
+int vrvBuffer_copy(void *bufferPtr, char *data, int length);
+const char *vrvBuffer_getData(void *bufferPtr);
+int vrvBuffer_getLength(void *bufferPtr);
+
 #ifdef __cplusplus
 } // extern C
 #endif
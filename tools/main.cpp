@@ -5,13 +5,16 @@
 // Copyright (c) Authors and others. All rights reserved.
 /////////////////////////////////////////////////////////////////////////////
 
+#include <atomic>
 #include <cassert>
 #include <fstream>
 #include <iostream>
+#include <mutex>
 #include <regex>
 #include <sstream>
 #include <string>
 #include <sys/stat.h>
+#include <thread>
 
 #ifndef _WIN32
 #include <getopt.h>
@@ -21,12 +24,14 @@
 
 //----------------------------------------------------------------------------
 
+#include "ioabc.h"
 #include "options.h"
 #include "toolkit.h"
 #include "vrv.h"
 
 //----------------------------------------------------------------------------
 
+#include "MidiFile.h"
 #include "jsonxx.h"
 
 // Some redundant code to get basenames
@@ -72,6 +77,90 @@ bool optionExists(const std::string &option, int argc, char **argv, std::string
     return false;
 }
 
+// Render every tune of an ABC collection, each worker thread having its own toolkit
+bool render_all_tunes(vrv::Toolkit &toolkit, const std::string &data, const std::string &resourcePath,
+    const std::string &outfile, const std::string &outformat, bool allPages)
+{
+    vrv::ABCCollection collection;
+    if (!collection.Load(data)) {
+        return false;
+    }
+
+    const int tuneCount = collection.GetTuneCount();
+    const int threadCount = std::max(1, std::min(tuneCount, (int)std::thread::hardware_concurrency()));
+    std::atomic<int> nextTune(0);
+    std::atomic<bool> success(true);
+    std::mutex outputMutex;
+
+    auto worker = [&]() {
+        vrv::Toolkit tuneToolkit(false);
+        // Base options are not copied with the other options
+        const vrv::Options *options = toolkit.GetOptionsObj();
+        *tuneToolkit.GetOptionsObj() = *options;
+        tuneToolkit.GetOptionsObj()->m_scale.SetValue(options->m_scale.GetValue());
+        if (!tuneToolkit.SetResourcePath(resourcePath)
+            || !tuneToolkit.SetOptions(vrv::StringFormat("{\"font\": \"%s\" }", options->m_font.GetValue().c_str()))) {
+            success = false;
+            return;
+        }
+        tuneToolkit.SetInputFrom("abc");
+
+        for (int i = nextTune++; i < tuneCount; i = nextTune++) {
+            // Seed the ids for each tune for the output not to depend on the thread scheduling
+            if (options->m_xmlIdSeed.GetValue()) vrv::Object::SeedID(options->m_xmlIdSeed.GetValue());
+
+            const std::string tuneOutfile = outfile + vrv::StringFormat("_%03d", i + 1);
+            std::vector<std::string> written;
+            bool tuneSuccess = tuneToolkit.LoadData(collection.GetTuneData(i));
+            if (tuneSuccess && (outformat == "svg")) {
+                const int to = (allPages) ? tuneToolkit.GetPageCount() : 1;
+                for (int p = 1; p <= to; ++p) {
+                    std::string cur_outfile = tuneOutfile;
+                    if (allPages) {
+                        cur_outfile += vrv::StringFormat("_%03d", p);
+                    }
+                    cur_outfile += ".svg";
+                    tuneSuccess = tuneSuccess && tuneToolkit.RenderToSVGFile(cur_outfile, p);
+                    written.push_back(cur_outfile);
+                }
+            }
+            else if (tuneSuccess && (outformat == "midi")) {
+                tuneSuccess = tuneToolkit.RenderToMIDIFile(tuneOutfile + ".mid");
+                written.push_back(tuneOutfile + ".mid");
+            }
+            else if (tuneSuccess && (outformat == "timemap")) {
+                tuneSuccess = tuneToolkit.RenderToTimemapFile(tuneOutfile + ".json");
+                written.push_back(tuneOutfile + ".json");
+            }
+            else if (tuneSuccess) {
+                const char *scoreBased = (outformat == "mei-pb") ? "false" : "true";
+                const char *basic = (outformat == "mei-basic") ? "true" : "false";
+                std::string params = vrv::StringFormat("{'scoreBased': %s, 'basic': %s}", scoreBased, basic);
+                tuneSuccess = tuneToolkit.SaveFile(tuneOutfile + ".mei", params);
+                written.push_back(tuneOutfile + ".mei");
+            }
+
+            std::lock_guard<std::mutex> lock(outputMutex);
+            if (!tuneSuccess) {
+                std::cerr << "Unable to render tune " << i + 1 << "." << std::endl;
+                success = false;
+            }
+            for (const std::string &filename : written) {
+                std::cerr << "Output written to " << filename << "." << std::endl;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back(worker);
+    }
+    for (std::thread &thread : threads) {
+        thread.join();
+    }
+    return success;
+}
+
 int main(int argc, char **argv)
 {
     std::string infile;
@@ -81,6 +170,7 @@ int main(int argc, char **argv)
     bool std_output = false;
 
     int all_pages = 0;
+    int all_tunes = 0;
     int page = 1;
     int show_version = 0;
 
@@ -103,6 +193,7 @@ int main(int argc, char **argv)
         { "xml-id-seed", required_argument, 0, 'x' }, //
         // standard input - long options only or - as filename
         { "stdin", no_argument, 0, 'z' }, //
+        { "all-tunes", no_argument, 0, 'z' }, //
         { 0, 0, 0, 0 }
     };
 
@@ -221,6 +312,9 @@ int main(int argc, char **argv)
                 if (!strcmp(long_options[option_index].name, "stdin")) {
                     infile = "-";
                 }
+                else if (!strcmp(long_options[option_index].name, "all-tunes")) {
+                    all_tunes = 1;
+                }
                 break;
 
             case 'h':
@@ -280,10 +374,10 @@ int main(int argc, char **argv)
 
     if ((outformat != "svg") && (outformat != "mei") && (outformat != "mei-basic") && (outformat != "mei-pb")
         && (outformat != "midi") && (outformat != "timemap") && (outformat != "expansionmap")
-        && (outformat != "humdrum") && (outformat != "hum") && (outformat != "pae")) {
+        && (outformat != "humdrum") && (outformat != "hum") && (outformat != "hummidi") && (outformat != "pae")) {
         std::cerr << "Output format (" << outformat
-                  << ") can only be 'mei', 'mei-basic', 'mei-pb', 'svg', 'midi', 'timemap', 'expansionmap', 'humdrum' "
-                     "or 'pae'."
+                  << ") can only be 'mei', 'mei-basic', 'mei-pb', 'svg', 'midi', 'timemap', 'expansionmap', 'humdrum', "
+                     "'hummidi' or 'pae'."
                   << std::endl;
         exit(1);
     }
@@ -306,13 +400,40 @@ int main(int argc, char **argv)
         outfile = removeExtension(outfile);
     }
 
-    // Skip the layout for MIDI and timemap output by setting --breaks to none
+    // Skip the layout for MIDI and timemap output by loading the data only
     if ((outformat == "midi") || (outformat == "timemap") || (outformat == "expansionmap")) {
-        toolkit.SetOptions("{'breaks': 'none'}");
+        toolkit.SetOptions("{'dataOnly': true}");
+    }
+
+    // Render every tune of an ABC collection in parallel
+    if (all_tunes) {
+        if (std_output || (infile == "-")) {
+            std::cerr << "Rendering all tunes cannot be used with standard input or output." << std::endl;
+            exit(1);
+        }
+        if ((outformat == "expansionmap") || (outformat == "humdrum") || (outformat == "hum") || (outformat == "hummidi")
+            || (outformat == "pae")) {
+            std::cerr << "Rendering all tunes can only output 'svg', 'mei', 'mei-basic', 'mei-pb', 'midi' or 'timemap'."
+                      << std::endl;
+            exit(1);
+        }
+        std::ifstream instream(infile.c_str());
+        if (!instream.is_open()) {
+            std::cerr << "The file '" << infile << "' could not be opened." << std::endl;
+            exit(1);
+        }
+        std::stringstream data;
+        data << instream.rdbuf();
+        if (!render_all_tunes(toolkit, data.str(), resourcePath, outfile, outformat, all_pages)) {
+            exit(1);
+        }
+        free(long_options);
+        return 0;
     }
 
-    // Load the std input or load the file
-    if (!((toolkit.GetOutputTo() == vrv::HUMDRUM) && (toolkit.GetInputFrom() == vrv::MEI))) {
+    // Load the std input or load the file - Humdrum to MIDI is converted directly from the input
+    if (!((toolkit.GetOutputTo() == vrv::HUMDRUM) && (toolkit.GetInputFrom() == vrv::MEI))
+        && (toolkit.GetOutputTo() != vrv::HUMMIDI)) {
         if (infile == "-") {
             std::ostringstream data_stream;
             for (std::string line; getline(std::cin, line);) {
@@ -331,7 +452,7 @@ int main(int argc, char **argv)
         }
     }
 
-    if (toolkit.GetOutputTo() != vrv::HUMDRUM) {
+    if ((toolkit.GetOutputTo() != vrv::HUMDRUM) && (toolkit.GetOutputTo() != vrv::HUMMIDI)) {
         // Check the page range
         if (page > toolkit.GetPageCount()) {
             std::cerr << "The page requested (" << page << ") is not in the page range (max is "
@@ -369,6 +490,17 @@ int main(int argc, char **argv)
                 std::cerr << "Output written to " << cur_outfile << "." << std::endl;
             }
         }
+        // the glyphs referenced by the pages in sprite mode
+        if (!std_output && options->m_svgGlyphSprite.GetValue()) {
+            std::string sprite_outfile = outfile + "_glyphs.svg";
+            if (!toolkit.RenderToGlyphSpriteFile(sprite_outfile)) {
+                std::cerr << "Unable to write the glyph sprite to " << sprite_outfile << "." << std::endl;
+                exit(1);
+            }
+            else {
+                std::cerr << "Output written to " << sprite_outfile << "." << std::endl;
+            }
+        }
     }
 
     else if (outformat == "hummidi") {
@@ -401,15 +533,21 @@ int main(int argc, char **argv)
         }
 
         std::string base64midi = toolkit.ConvertHumdrumToMIDI(humdata);
+        if (base64midi.empty()) {
+            std::cerr << "The input could not be converted to MIDI." << std::endl;
+            exit(1);
+        }
         if (std_output) {
             std::cout << base64midi << std::endl;
         }
         else {
-            std::cerr << "Humdrum-MIDI to file not yet implemented." << std::endl;
-            // outfile += ".mid";
-            // smf::MidiFile outputfile;
-            // outputfile.readBase64(base64midi);
-            // outputfile.write(outfile);
+            outfile += ".mid";
+            smf::MidiFile outputfile;
+            if (!outputfile.readBase64(base64midi) || !outputfile.write(outfile)) {
+                std::cerr << "Unable to write MIDI to " << outfile << "." << std::endl;
+                exit(1);
+            }
+            std::cerr << "Output written to " << outfile << "." << std::endl;
         }
     }
     else if (outformat == "midi") {
@@ -589,6 +727,21 @@ int main(int argc, char **argv)
         toolkit.LogRuntime();
     }
 
+    // Write the profiling report and trace if desired
+    if (options->m_profile.GetValue()) {
+        if (std_output) {
+            std::cerr << toolkit.GetProfilingReport() << std::endl;
+        }
+        else {
+            std::ofstream reportStream((outfile + ".profile.json").c_str());
+            reportStream << toolkit.GetProfilingReport();
+            std::ofstream traceStream((outfile + ".trace.json").c_str());
+            traceStream << toolkit.GetProfilingTrace();
+            std::cerr << "Profiling report written to " << outfile << ".profile.json and " << outfile
+                      << ".trace.json." << std::endl;
+        }
+    }
+
     free(long_options);
     return 0;
 }